@@ -15,6 +15,12 @@
  *   /workspace/results/dublin-es-mro/<method>/kpis.csv
  *   /workspace/results/dublin-es-mro/<method>/enb-kpis.csv
  *   /workspace/results/dublin-es-mro/<method>/positions.csv
+ *
+ * With --sweepMethods and/or --sweepRuns, the eNB positions are read once
+ * and every (method, run) point is run in a forked worker, at most
+ * --sweepWorkers at a time (default: one per core). Each point writes to
+ * <resultRoot>/<method>/run-<run>/, and the KPI files of all the points are
+ * merged into <resultRoot>/sweep-kpis.csv and <resultRoot>/sweep-enb-kpis.csv.
  */
 
 #include "ns3/applications-module.h"
@@ -24,7 +30,7 @@
 #include "ns3/lte-module.h"
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
-#include "ns3/oran-lte-cell-control-state.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-module.h"
 #include "ns3/point-to-point-module.h"
 
@@ -82,6 +88,22 @@ EnsureDir(const std::string& path)
     }
 }
 
+static std::vector<std::string>
+SplitCommaList(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
 static std::vector<Vector>
 LoadEnbPositionsFromVectorFile(const std::string& path)
 {
@@ -354,7 +376,8 @@ SampleCellControlParams(Time interval,
         Ptr<LteEnbNetDevice> enb = DynamicCast<LteEnbNetDevice>(enbLteDevs.Get(i));
         Ptr<OranE2NodeTerminator> terminator = enbTerminators.Get(i);
         const uint64_t e2NodeId = terminator->GetE2NodeId();
-        const OranLteCellControlParams params = GetLteCellControlParameters(e2NodeId);
+        const OranCellControlParams params =
+            terminator->GetNearRtRic()->GetCellControlStore()->Get(e2NodeId);
 
         g_cellParamOut << now << "," << i << "," << e2NodeId << "," << enb->GetCellId() << ","
                        << enb->GetPhy()->GetTxPower() << "," << params.cioDb << ","
@@ -403,6 +426,9 @@ main(int argc, char* argv[])
     double mlbLoadImbalanceThreshold = 0.20;
     double mlbCioStepDb = 1.0;
     std::string dbFileName = "oran-dublin-es-mro.db";
+    std::string sweepMethods = "";
+    uint32_t sweepRuns = 0;
+    uint32_t sweepWorkers = 0;
 
     CommandLine cmd(__FILE__);
     cmd.AddValue("enbPosFile", "Dublin eNB position file", enbPosFile);
@@ -432,6 +458,13 @@ main(int argc, char* argv[])
     cmd.AddValue("mlbLoadImbalanceThreshold", "MLB hot/cold cell load imbalance threshold", mlbLoadImbalanceThreshold);
     cmd.AddValue("mlbCioStepDb", "MLB CIO adjustment step in dB", mlbCioStepDb);
     cmd.AddValue("mlbControlTtt", "Let MLB also tune TTT on hot cells", mlbControlTtt);
+    cmd.AddValue("sweepMethods",
+                 "Comma-separated CMM methods to sweep in forked workers",
+                 sweepMethods);
+    cmd.AddValue("sweepRuns", "Number of RNG runs to sweep in forked workers", sweepRuns);
+    cmd.AddValue("sweepWorkers",
+                 "Maximum concurrent sweep workers (0: one per core)",
+                 sweepWorkers);
     cmd.Parse(argc, argv);
 
     g_pingPongWindowSec = pingPongWindowSec;
@@ -448,7 +481,54 @@ main(int argc, char* argv[])
 
     EnsureDir("/workspace/results");
     EnsureDir(resultRoot);
-    const std::string resultDir = resultRoot + "/" + mitigationMethod;
+    std::vector<Vector> siteCenters = LoadEnbPositionsFromVectorFile(enbPosFile);
+
+    std::string resultDir = resultRoot + "/" + mitigationMethod;
+    if (!sweepMethods.empty() || sweepRuns > 0)
+    {
+        // Everything above is shared copy-on-write by the workers; each one
+        // runs the rest of main() for its (method, run) point. This scenario
+        // runs no ONNX models, so there is nothing to preload, and the nodes
+        // are created after the fork: objects take automatically assigned
+        // random streams in creation order, so creating them earlier would
+        // change the results of runs without a sweep.
+        OranSweepRunner sweep;
+        sweep.AddAxis("method",
+                      sweepMethods.empty() ? std::vector<std::string>{mitigationMethod}
+                                           : SplitCommaList(sweepMethods));
+        std::vector<std::string> runs;
+        for (uint32_t run = 1; run <= std::max<uint32_t>(sweepRuns, 1); run++)
+        {
+            runs.push_back(std::to_string(run));
+        }
+        sweep.AddAxis("run", runs);
+        sweep.SetMaxWorkers(sweepWorkers);
+
+        auto pointDir = [&resultRoot](const OranSweepPoint& point) {
+            return resultRoot + "/" + point.Get("method") + "/run-" + point.Get("run");
+        };
+
+        OranSweepPoint point;
+        if (!sweep.ForkWorkers(point))
+        {
+            sweep.MergeCsv(
+                [&pointDir](const OranSweepPoint& p) { return pointDir(p) + "/kpis.csv"; },
+                resultRoot + "/sweep-kpis.csv");
+            sweep.MergeCsv(
+                [&pointDir](const OranSweepPoint& p) { return pointDir(p) + "/enb-kpis.csv"; },
+                resultRoot + "/sweep-enb-kpis.csv");
+            std::cout << "SWEEP: points=" << sweep.GetPoints().size()
+                      << " workers=" << sweep.GetMaxWorkers() << " failed=" << sweep.GetNFailed()
+                      << " result_root=" << resultRoot << std::endl;
+            return sweep.GetNFailed() == 0 ? 0 : 1;
+        }
+
+        mitigationMethod = point.Get("method");
+        RngSeedManager::SetRun(std::stoul(point.Get("run")));
+        EnsureDir(resultRoot + "/" + mitigationMethod);
+        resultDir = pointDir(point);
+        dbFileName = resultDir + "/" + dbFileName;
+    }
     EnsureDir(resultDir);
 
     const std::string kpiPath = resultDir + "/kpis.csv";
@@ -485,7 +565,6 @@ main(int argc, char* argv[])
                    << "ret_deg\n";
     g_eventOut << "time_s,event_type,context,imsi,cell_id,rnti,target_cell_id,value\n";
 
-    std::vector<Vector> siteCenters = LoadEnbPositionsFromVectorFile(enbPosFile);
     const uint32_t numberOfEnbs = siteCenters.size();
     const uint32_t numberOfUes = targetUes;
 
@@ -0,0 +1,291 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * E2 message codec benchmark.
+ *
+ * Encodes and decodes one Report or Command of every type supported by
+ * OranE2Codec, checks that every decoded one matches the original, and
+ * prints the size of its E2 message and the mean encode and decode times.
+ * The decode time includes the creation of the ns-3 Object, as the Near-RT
+ * RIC E2 Terminator needs one to act on.
+ *
+ * It then times the round trip of Report batches of increasing size through
+ * an OranE2SocketTransport with its loopback peer, the cost of sending the
+ * E2 traffic to a RIC in another process on the same host.
+ *
+ * Usage:
+ *   ./ns3 run "oran-e2-codec-benchmark --iterations=10000 --batch-sizes=1,10,100"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranE2CodecBenchmark");
+
+/**
+ * Set the attributes every Report carries.
+ *
+ * @param report The Report.
+ * @param e2NodeId The E2 Node ID of the reporter.
+ * @return The Report.
+ */
+static Ptr<OranReport>
+Stamp(Ptr<OranReport> report, uint64_t e2NodeId)
+{
+    report->SetAttribute("ReporterE2NodeId", UintegerValue(e2NodeId));
+    report->SetAttribute("Time", TimeValue(MilliSeconds(12345)));
+    return report;
+}
+
+/**
+ * @param e2NodeId The E2 Node ID of the reporter.
+ * @return A single-cell RSRP/RSRQ Report.
+ */
+static Ptr<OranReport>
+MakeRsrpRsrq(uint64_t e2NodeId)
+{
+    Ptr<OranReport> report = CreateObject<OranReportLteUeRsrpRsrq>();
+    report->SetAttribute("Rnti", UintegerValue(17));
+    report->SetAttribute("CellId", UintegerValue(3));
+    report->SetAttribute("Rsrp", DoubleValue(-92.5));
+    report->SetAttribute("Rsrq", DoubleValue(-11.25));
+    report->SetAttribute("IsServingCell", BooleanValue(true));
+    report->SetAttribute("ComponentCarrierId", UintegerValue(0));
+    return Stamp(report, e2NodeId);
+}
+
+/**
+ * @return One Report of every type, with its name.
+ */
+static std::vector<std::pair<std::string, Ptr<OranReport>>>
+MakeReports()
+{
+    std::vector<std::pair<std::string, Ptr<OranReport>>> reports;
+
+    Ptr<OranReport> location = CreateObject<OranReportLocation>();
+    location->SetAttribute("Location", VectorValue(Vector(120.5, -33.25, 1.5)));
+    reports.emplace_back("Location", Stamp(location, 7));
+
+    Ptr<OranReport> appLoss = CreateObject<OranReportAppLoss>();
+    appLoss->SetAttribute("Loss", DoubleValue(0.0125));
+    reports.emplace_back("AppLoss", Stamp(appLoss, 7));
+
+    Ptr<OranReport> lteCellInfo = CreateObject<OranReportLteUeCellInfo>();
+    lteCellInfo->SetAttribute("CellId", UintegerValue(3));
+    lteCellInfo->SetAttribute("Rnti", UintegerValue(17));
+    reports.emplace_back("LteUeCellInfo", Stamp(lteCellInfo, 7));
+
+    reports.emplace_back("LteUeRsrpRsrq", MakeRsrpRsrq(7));
+
+    std::vector<OranUeCellRsrpRsrq> measurements;
+    for (uint16_t cellId = 1; cellId <= 4; cellId++)
+    {
+        measurements.push_back({cellId, 0, cellId == 3, -90.0 - cellId, -10.0 - 0.5 * cellId});
+    }
+    Ptr<OranReportLteUeMultiCellRsrpRsrq> lteMultiCell =
+        CreateObject<OranReportLteUeMultiCellRsrpRsrq>();
+    lteMultiCell->SetAttribute("Rnti", UintegerValue(17));
+    lteMultiCell->SetMeasurements(measurements);
+    reports.emplace_back("LteUeMultiCellRsrpRsrq (4 cells)", Stamp(lteMultiCell, 7));
+
+    Ptr<OranReport> lteEnergy = CreateObject<OranReportLteEnergyEfficiency>();
+    lteEnergy->SetAttribute("EnergyRemaining", DoubleValue(8123.75));
+    reports.emplace_back("LteEnergyEfficiency", Stamp(lteEnergy, 2));
+
+    Ptr<OranReport> lteDemand = CreateObject<OranReportLteUeAppDemand>();
+    lteDemand->SetAttribute("DemandMbps", DoubleValue(4.5));
+    reports.emplace_back("LteUeAppDemand", Stamp(lteDemand, 7));
+
+    Ptr<OranReport> nrCellInfo = CreateObject<OranReportNrUeCellInfo>();
+    nrCellInfo->SetAttribute("CellId", UintegerValue(3));
+    nrCellInfo->SetAttribute("Rnti", UintegerValue(17));
+    reports.emplace_back("NrUeCellInfo", Stamp(nrCellInfo, 7));
+
+    Ptr<OranReport> nrRsrpRsrq = CreateObject<OranReportNrUeRsrpRsrq>();
+    nrRsrpRsrq->SetAttribute("Rnti", UintegerValue(17));
+    nrRsrpRsrq->SetAttribute("CellId", UintegerValue(3));
+    nrRsrpRsrq->SetAttribute("Rsrp", DoubleValue(-92.5));
+    nrRsrpRsrq->SetAttribute("Rsrq", DoubleValue(-11.25));
+    nrRsrpRsrq->SetAttribute("IsServingCell", BooleanValue(true));
+    nrRsrpRsrq->SetAttribute("ComponentCarrierId", UintegerValue(0));
+    reports.emplace_back("NrUeRsrpRsrq", Stamp(nrRsrpRsrq, 7));
+
+    Ptr<OranReportNrUeMultiCellRsrpRsrq> nrMultiCell =
+        CreateObject<OranReportNrUeMultiCellRsrpRsrq>();
+    nrMultiCell->SetAttribute("Rnti", UintegerValue(17));
+    nrMultiCell->SetMeasurements(measurements);
+    reports.emplace_back("NrUeMultiCellRsrpRsrq (4 cells)", Stamp(nrMultiCell, 7));
+
+    Ptr<OranReport> nrEnergy = CreateObject<OranReportNrEnergyEfficiency>();
+    nrEnergy->SetAttribute("EnergyRemaining", DoubleValue(8123.75));
+    reports.emplace_back("NrEnergyEfficiency", Stamp(nrEnergy, 2));
+
+    Ptr<OranReport> nrDemand = CreateObject<OranReportNrUeAppDemand>();
+    nrDemand->SetAttribute("DemandMbps", DoubleValue(4.5));
+    reports.emplace_back("NrUeAppDemand", Stamp(nrDemand, 7));
+
+    return reports;
+}
+
+/**
+ * @return One Command of every type, with its name.
+ */
+static std::vector<std::pair<std::string, Ptr<OranCommand>>>
+MakeCommands()
+{
+    std::string cio = CellControlParameterToString(OranCellControlParameter::CIO);
+    return {
+        {"Lte2LteHandover", OranCommandLte2LteHandover::Create(2, 4, 17)},
+        {"Lte2LteTxPower", OranCommandLte2LteTxPower::Create(2, -3.0)},
+        {"Lte2LteCellParameter", OranCommandLte2LteCellParameter::Create(2, cio, 1.5, true)},
+        {"Nr2NrHandover", OranCommandNr2NrHandover::Create(2, 4, 17)},
+        {"Nr2NrTxPower", OranCommandNr2NrTxPower::Create(2, -3.0)},
+        {"Nr2NrCellParameter", OranCommandNr2NrCellParameter::Create(2, cio, 1.5, true)},
+    };
+}
+
+/**
+ * Time the encoding and decoding of one message, check the decoded Report
+ * or Command, and print a row.
+ *
+ * @param name The name of the row.
+ * @param encode Appends the message to a buffer.
+ * @param expected The ToString() of the original.
+ * @param iterations The number of times to encode and decode.
+ */
+template <typename Encode>
+static void
+Measure(const std::string& name,
+        Encode encode,
+        const std::string& expected,
+        uint32_t iterations)
+{
+    OranE2Codec codec;
+    std::vector<uint8_t> buffer;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        buffer.clear();
+        encode(codec, buffer);
+    }
+    double encodeNs = std::chrono::duration<double, std::nano>(
+                          std::chrono::steady_clock::now() - start)
+                          .count() /
+                      iterations;
+
+    std::vector<Ptr<OranReport>> reports;
+    std::vector<Ptr<OranCommand>> commands;
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        reports.clear();
+        commands.clear();
+        codec.Decode(buffer.data(), buffer.size(), reports, commands);
+    }
+    double decodeNs = std::chrono::duration<double, std::nano>(
+                          std::chrono::steady_clock::now() - start)
+                          .count() /
+                      iterations;
+
+    std::string decoded = !reports.empty() ? reports[0]->ToString() : commands[0]->ToString();
+    NS_ABORT_MSG_IF(decoded != expected,
+                    name << " decoded as \"" << decoded << "\" instead of \"" << expected << "\"");
+
+    std::cout << std::left << std::setw(34) << name << std::right << std::setw(8)
+              << buffer.size() << std::setw(14) << std::fixed << std::setprecision(0) << encodeNs
+              << std::setw(14) << decodeNs << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t iterations = 10000;
+    std::string batchSizes = "1,10,100,1000";
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("iterations", "Encodes, decodes, and round trips timed per row", iterations);
+    cmd.AddValue("batch-sizes", "Comma-separated Report batch sizes to send", batchSizes);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(iterations == 0, "Need at least one iteration");
+
+    std::cout << std::left << std::setw(34) << "message" << std::right << std::setw(8) << "bytes"
+              << std::setw(14) << "encode (ns)" << std::setw(14) << "decode (ns)" << std::endl;
+
+    for (const auto& entry : MakeReports())
+    {
+        Ptr<OranReport> report = entry.second;
+        Measure(
+            entry.first,
+            [report](OranE2Codec& codec, std::vector<uint8_t>& buffer) {
+                codec.EncodeReport(report, buffer);
+            },
+            report->ToString(),
+            iterations);
+    }
+    for (const auto& entry : MakeCommands())
+    {
+        Ptr<OranCommand> command = entry.second;
+        Measure(
+            entry.first,
+            [command](OranE2Codec& codec, std::vector<uint8_t>& buffer) {
+                codec.EncodeCommand(command, buffer);
+            },
+            command->ToString(),
+            iterations);
+    }
+
+    std::cout << std::endl
+              << std::setw(8) << "batch" << std::setw(10) << "bytes" << std::setw(16)
+              << "bytes/report" << std::setw(18) << "round trip (us)" << std::endl;
+
+    Ptr<OranE2SocketTransport> transport = CreateObject<OranE2SocketTransport>();
+    OranE2Codec codec;
+    std::istringstream sizes(batchSizes);
+    std::string token;
+    while (std::getline(sizes, token, ','))
+    {
+        uint32_t batchSize = std::stoul(token);
+        NS_ABORT_MSG_IF(batchSize == 0, "Batch sizes must be positive");
+
+        std::vector<Ptr<OranReport>> batch;
+        for (uint32_t i = 0; i < batchSize; i++)
+        {
+            batch.push_back(MakeRsrpRsrq(i + 1));
+        }
+        std::vector<uint8_t> buffer;
+        codec.EncodeReportBatch(batch, buffer);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            const std::vector<uint8_t>& reply = transport->Exchange(buffer);
+            NS_ABORT_MSG_IF(reply != buffer, "The loopback peer changed the message");
+        }
+        double roundTripUs = std::chrono::duration<double, std::micro>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count() /
+                             iterations;
+
+        std::cout << std::setw(8) << batchSize << std::setw(10) << buffer.size() << std::setw(16)
+                  << std::setprecision(1) << static_cast<double>(buffer.size()) / batchSize
+                  << std::setw(18) << std::setprecision(2) << roundTripUs << std::endl;
+    }
+
+    transport->Close();
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * Converts a binary E2 trace written by OranE2TraceRecorder to CSV.
+ *
+ * A trace is recorded by attaching a recorder to the Near-RT RIC E2
+ * Terminator of a scenario:
+ *
+ *   Ptr<OranE2TraceRecorder> recorder = CreateObject<OranE2TraceRecorder>();
+ *   recorder->SetAttribute("FileName", StringValue("oran-e2-trace.bin"));
+ *   recorder->Attach(nearRtRicE2Terminator);
+ *   ...
+ *   Simulator::Run();
+ *   recorder->Close();
+ *
+ * Usage:
+ *   ./ns3 run "oran-e2-trace-to-csv --trace=oran-e2-trace.bin --csv=oran-e2-trace.csv"
+ *   ./ns3 run "oran-e2-trace-to-csv --trace=oran-e2-trace.bin --from=10 --to=20"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <fstream>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranE2TraceToCsv");
+
+int
+main(int argc, char* argv[])
+{
+    std::string traceFile = "oran-e2-trace.bin";
+    std::string csvFile;
+    Time from = Seconds(0);
+    Time to = Time::Max();
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("trace", "The E2 trace file", traceFile);
+    cmd.AddValue("csv", "The CSV file to write (standard output if empty)", csvFile);
+    cmd.AddValue("from", "Only convert the records at or after this time", from);
+    cmd.AddValue("to", "Only convert the records before this time", to);
+    cmd.Parse(argc, argv);
+
+    OranE2TraceReader reader(traceFile);
+
+    std::ofstream csv;
+    if (!csvFile.empty())
+    {
+        csv.open(csvFile);
+        NS_ABORT_MSG_IF(!csv.is_open(), "Could not open \"" << csvFile << "\"");
+    }
+    std::ostream& os = csvFile.empty() ? std::cout : csv;
+
+    uint64_t first = reader.Seek(from);
+    uint64_t last = reader.Seek(to);
+
+    WriteE2TraceCsvHeader(os);
+    for (uint64_t i = first; i < last; i++)
+    {
+        WriteE2TraceCsvLine(os, reader.GetRecord(i));
+    }
+
+    std::cerr << "Converted " << last - first << " of " << reader.GetNRecords() << " records"
+              << std::endl;
+
+    return 0;
+}
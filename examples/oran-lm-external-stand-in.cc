@@ -0,0 +1,227 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * A stand-in for an external xApp driven by OranLmExternal, for testing the
+ * shared-memory bridge without Python. For every cycle, it hands each UE
+ * over to the cell with the highest RSRP in its last measurements, if that
+ * RSRP exceeds the one of the serving cell by more than the hysteresis.
+ *
+ * It is started by the LM when its Command attribute is set to the path of
+ * this program's binary (see the --xapp-command option of
+ * oran-lte-2-lte-rsrp-handover-lm-example), or separately, with the same
+ * region and FIFO names as the LM:
+ *
+ *   ./ns3 run "oran-lm-external-stand-in --region=/oran-xapp
+ *       --request-fifo=/tmp/oran-xapp.req --response-fifo=/tmp/oran-xapp.rsp"
+ *
+ * The names default to the ORAN_XAPP_REGION, ORAN_XAPP_REQUEST_FIFO, and
+ * ORAN_XAPP_RESPONSE_FIFO environment variables set by the LM.
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranLmExternalStandIn");
+
+namespace
+{
+
+/**
+ * @param name The environment variable.
+ * @param defaultValue The value if the variable is not set.
+ * @return The value of the variable.
+ */
+std::string
+GetEnv(const char* name, const std::string& defaultValue)
+{
+    const char* value = std::getenv(name);
+    return value != nullptr ? value : defaultValue;
+}
+
+/**
+ * Read exactly sizeof(uint64_t) bytes from a FIFO.
+ *
+ * @param fd The FIFO.
+ * @param value The value read.
+ * @return False on end of file.
+ */
+bool
+ReadSequence(int fd, uint64_t& value)
+{
+    std::size_t nRead = 0;
+    while (nRead < sizeof(value))
+    {
+        ssize_t n = read(fd, reinterpret_cast<char*>(&value) + nRead, sizeof(value) - nRead);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        NS_ABORT_MSG_IF(n < 0, "Could not read the request FIFO, errno=" << errno);
+        if (n == 0)
+        {
+            return false;
+        }
+        nRead += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * Write the handover commands for one cycle into the region.
+ *
+ * @param region The region.
+ * @param hysteresisDb The RSRP margin required for a handover.
+ * @return The number of commands written.
+ */
+uint32_t
+Decide(OranLmExternalHeader* region, double hysteresisDb)
+{
+    auto records = [region](const OranLmExternalTable& table) {
+        return reinterpret_cast<char*>(region) + table.offset;
+    };
+    const auto* ues = reinterpret_cast<const OranLmExternalUeRecord*>(records(region->ues));
+    const auto* cells = reinterpret_cast<const OranLmExternalCellRecord*>(records(region->cells));
+    const auto* measurements =
+        reinterpret_cast<const OranLmExternalMeasurementRecord*>(records(region->measurements));
+    auto* commands = reinterpret_cast<OranLmExternalCommandRecord*>(records(region->commands));
+
+    // (RAT, cell ID) -> E2 Node ID of the cell.
+    std::map<std::pair<uint8_t, uint16_t>, uint64_t> cellE2NodeIds;
+    for (uint32_t i = 0; i < region->cells.count; i++)
+    {
+        cellE2NodeIds[{cells[i].rat, cells[i].cellId}] = cells[i].e2NodeId;
+    }
+
+    // Measurements are written grouped by UE, in the order of the UEs.
+    uint32_t m = 0;
+    uint32_t nCommands = 0;
+    for (uint32_t u = 0; u < region->ues.count && nCommands < region->commands.capacity; u++)
+    {
+        const OranLmExternalUeRecord& ue = ues[u];
+        double servingRsrp = -std::numeric_limits<double>::infinity();
+        double bestRsrp = -std::numeric_limits<double>::infinity();
+        uint16_t bestCellId = ue.cellId;
+        for (; m < region->measurements.count && measurements[m].ueE2NodeId == ue.e2NodeId; m++)
+        {
+            const OranLmExternalMeasurementRecord& meas = measurements[m];
+            if (meas.cellId == ue.cellId)
+            {
+                servingRsrp = std::max(servingRsrp, meas.rsrp);
+            }
+            if (meas.rsrp > bestRsrp)
+            {
+                bestRsrp = meas.rsrp;
+                bestCellId = meas.cellId;
+            }
+        }
+
+        auto serving = cellE2NodeIds.find({ue.rat, ue.cellId});
+        if (ue.rnti == 0 || bestCellId == ue.cellId || serving == cellE2NodeIds.end() ||
+            !std::isfinite(servingRsrp) || bestRsrp - servingRsrp <= hysteresisDb)
+        {
+            continue;
+        }
+
+        OranLmExternalCommandRecord& command = commands[nCommands++];
+        std::memset(&command, 0, sizeof(command));
+        command.type = static_cast<uint8_t>(ue.rat == static_cast<uint8_t>(OranLmExternalRat::LTE)
+                                                ? OranLmExternalCommandType::LTE_HANDOVER
+                                                : OranLmExternalCommandType::NR_HANDOVER);
+        command.e2NodeId = serving->second;
+        command.cellId = bestCellId;
+        command.rnti = ue.rnti;
+    }
+
+    return nCommands;
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    std::string regionName = GetEnv("ORAN_XAPP_REGION", "/oran-xapp");
+    std::string requestFifo = GetEnv("ORAN_XAPP_REQUEST_FIFO", "/tmp/oran-xapp.req");
+    std::string responseFifo = GetEnv("ORAN_XAPP_RESPONSE_FIFO", "/tmp/oran-xapp.rsp");
+    double hysteresisDb = 3.0;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("region", "The name of the shared-memory region", regionName);
+    cmd.AddValue("request-fifo", "The FIFO the LM signals new snapshots on", requestFifo);
+    cmd.AddValue("response-fifo", "The FIFO to signal the commands on", responseFifo);
+    cmd.AddValue("hysteresis", "The RSRP margin (dB) required for a handover", hysteresisDb);
+    cmd.Parse(argc, argv);
+
+    // The LM creates the FIFOs when it is activated, which may be after this
+    // process was started.
+    struct stat st;
+    while (stat(requestFifo.c_str(), &st) != 0 || stat(responseFifo.c_str(), &st) != 0)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Same order as the LM: request first, then response.
+    int requestFd = open(requestFifo.c_str(), O_RDONLY);
+    NS_ABORT_MSG_IF(requestFd < 0, "Could not open \"" << requestFifo << "\", errno=" << errno);
+    int responseFd = open(responseFifo.c_str(), O_WRONLY);
+    NS_ABORT_MSG_IF(responseFd < 0, "Could not open \"" << responseFifo << "\", errno=" << errno);
+
+    int fd = shm_open(regionName.c_str(), O_RDWR, 0);
+    NS_ABORT_MSG_IF(fd < 0, "Could not open \"" << regionName << "\", errno=" << errno);
+    NS_ABORT_MSG_IF(fstat(fd, &st) != 0, "Could not stat \"" << regionName << "\"");
+    void* mapped = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    NS_ABORT_MSG_IF(mapped == MAP_FAILED, "Could not map \"" << regionName << "\"");
+
+    auto* region = static_cast<OranLmExternalHeader*>(mapped);
+    NS_ABORT_MSG_IF(std::memcmp(region->magic, "ORANXAPP", sizeof(region->magic)) != 0 ||
+                        region->version != ORAN_LM_EXTERNAL_VERSION,
+                    "\"" << regionName << "\" is not an external LM region of version "
+                         << ORAN_LM_EXTERNAL_VERSION);
+
+    uint64_t sequence = 0;
+    uint64_t nCycles = 0;
+    uint64_t nCommands = 0;
+    while (ReadSequence(requestFd, sequence))
+    {
+        NS_ABORT_MSG_IF(region->sequence != sequence, "Cycle " << sequence << " not in region");
+
+        region->commands.count = Decide(region, hysteresisDb);
+        region->responseSequence = sequence;
+        nCycles++;
+        nCommands += region->commands.count;
+
+        NS_ABORT_MSG_IF(write(responseFd, &sequence, sizeof(sequence)) !=
+                            static_cast<ssize_t>(sizeof(sequence)),
+                        "Could not write the response FIFO, errno=" << errno);
+    }
+
+    std::cerr << "xApp stand-in answered " << nCycles << " cycle(s) with " << nCommands
+              << " command(s)" << std::endl;
+
+    munmap(mapped, st.st_size);
+    close(requestFd);
+    close(responseFd);
+
+    return 0;
+}
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+#
+# Author: Abdul Wadud
+# Affiliation: University College Dublin, Ireland.
+#
+# An xApp driven by OranLmExternal, written in Python. It reads the snapshot
+# of every cycle in place from the shared-memory region of the LM and writes
+# its commands back into the same region, with the record layout described
+# in model/oran-lm-external-layout.h. Only the standard library is needed.
+#
+# The policy is the one of oran-lm-external-stand-in: each UE is handed over
+# to the cell with the highest RSRP in its last measurements, if that RSRP
+# exceeds the one of the serving cell by more than the hysteresis. Replace
+# XApp.decide() to prototype another policy.
+#
+# The LM starts the xApp when its Command attribute is set, e.g.:
+#
+#   ./ns3 run "oran-lte-2-lte-rsrp-handover-lm-example
+#       --xapp-command='python3 contrib/oran/examples/oran-lm-external-xapp.py'"
+#
+# The region and FIFO names default to the ORAN_XAPP_REGION,
+# ORAN_XAPP_REQUEST_FIFO, and ORAN_XAPP_RESPONSE_FIFO environment variables
+# set by the LM. Passing --dump prints every snapshot instead of acting on it.
+
+import argparse
+import math
+import mmap
+import os
+import struct
+import sys
+import time
+
+ORAN_LM_EXTERNAL_VERSION = 1
+
+RAT_LTE = 0
+RAT_NR = 1
+
+LTE_HANDOVER = 1
+NR_HANDOVER = 2
+LTE_TX_POWER = 3
+NR_TX_POWER = 4
+LTE_CELL_PARAMETER = 5
+NR_CELL_PARAMETER = 6
+
+# Native byte order and no padding ("="), as written by the simulator.
+HEADER = struct.Struct("=8sIIQq" + "IIII" * 4 + "Q24x")
+UE = struct.Struct("=QHHB3x4d")
+CELL = struct.Struct("=QHB5x7d")
+MEASUREMENT = struct.Struct("=QHHBBBxdd")
+COMMAND = struct.Struct("=QBBBxHHd8x")
+
+assert HEADER.size == 128 and UE.size == 48 and CELL.size == 72
+assert MEASUREMENT.size == 32 and COMMAND.size == 32
+
+# Byte offsets of the header fields the xApp writes.
+COMMANDS_COUNT_OFFSET = 32 + 3 * 16 + 8
+RESPONSE_SEQUENCE_OFFSET = 32 + 4 * 16
+
+
+class Region:
+    """The shared-memory region of an OranLmExternal, mapped read-write."""
+
+    def __init__(self, name):
+        path = "/dev/shm/" + name.lstrip("/")
+        fd = os.open(path, os.O_RDWR)
+        try:
+            self.buf = mmap.mmap(fd, 0, mmap.MAP_SHARED, mmap.PROT_READ | mmap.PROT_WRITE)
+        finally:
+            os.close(fd)
+
+        fields = HEADER.unpack_from(self.buf, 0)
+        if fields[0] != b"ORANXAPP" or fields[1] != ORAN_LM_EXTERNAL_VERSION:
+            sys.exit("%s is not an external LM region of version %d"
+                     % (path, ORAN_LM_EXTERNAL_VERSION))
+        if fields[2] != 0x01020304:
+            sys.exit("%s was written with a different byte order" % path)
+
+    def header(self):
+        """Return the sequence, the time (ns), and the (offset, capacity,
+        count) of the UE, cell, measurement, and command tables."""
+        f = HEADER.unpack_from(self.buf, 0)
+        tables = [tuple(f[5 + 4 * i:8 + 4 * i]) for i in range(4)]
+        return f[3], f[4], tables
+
+    def records(self, table, record):
+        offset, _, count = table
+        return [record.unpack_from(self.buf, offset + i * record.size) for i in range(count)]
+
+    def ues(self, tables):
+        return [
+            {"e2NodeId": r[0], "cellId": r[1], "rnti": r[2], "rat": r[3],
+             "position": r[4:7], "appDemand": r[7]}
+            for r in self.records(tables[0], UE)
+        ]
+
+    def cells(self, tables):
+        return [
+            {"e2NodeId": r[0], "cellId": r[1], "rat": r[2], "position": r[3:6],
+             "cioDb": r[6], "tttSec": r[7], "hysDb": r[8], "retDeg": r[9]}
+            for r in self.records(tables[1], CELL)
+        ]
+
+    def measurements(self, tables):
+        return [
+            {"ueE2NodeId": r[0], "cellId": r[1], "rnti": r[2], "isServing": r[3] != 0,
+             "componentCarrierId": r[4], "rat": r[5], "rsrp": r[6], "rsrq": r[7]}
+            for r in self.records(tables[2], MEASUREMENT)
+        ]
+
+    def write_commands(self, tables, sequence, commands):
+        offset, capacity, _ = tables[3]
+        if len(commands) > capacity:
+            print("Dropping %d command(s) that do not fit the region" % (len(commands) - capacity),
+                  file=sys.stderr)
+            commands = commands[:capacity]
+        for i, c in enumerate(commands):
+            COMMAND.pack_into(self.buf, offset + i * COMMAND.size,
+                              c["e2NodeId"], c["type"], c.get("parameter", 0),
+                              1 if c.get("isDelta", False) else 0,
+                              c.get("cellId", 0), c.get("rnti", 0), float(c.get("value", 0.0)))
+        struct.pack_into("=I", self.buf, COMMANDS_COUNT_OFFSET, len(commands))
+        struct.pack_into("=Q", self.buf, RESPONSE_SEQUENCE_OFFSET, sequence)
+
+    def close(self):
+        self.buf.close()
+
+
+class XApp:
+    """RSRP-based handover, the same policy as oran-lm-external-stand-in."""
+
+    def __init__(self, hysteresis_db):
+        self.hysteresis_db = hysteresis_db
+
+    def decide(self, time_ns, ues, cells, measurements):
+        cell_e2 = {(c["rat"], c["cellId"]): c["e2NodeId"] for c in cells}
+        by_ue = {}
+        for m in measurements:
+            by_ue.setdefault(m["ueE2NodeId"], []).append(m)
+
+        commands = []
+        for ue in ues:
+            serving = -math.inf
+            best, best_cell = -math.inf, ue["cellId"]
+            for m in by_ue.get(ue["e2NodeId"], []):
+                if m["cellId"] == ue["cellId"]:
+                    serving = max(serving, m["rsrp"])
+                if m["rsrp"] > best:
+                    best, best_cell = m["rsrp"], m["cellId"]
+
+            serving_e2 = cell_e2.get((ue["rat"], ue["cellId"]))
+            if (ue["rnti"] == 0 or best_cell == ue["cellId"] or serving_e2 is None
+                    or math.isinf(serving) or best - serving <= self.hysteresis_db):
+                continue
+
+            commands.append({
+                "type": LTE_HANDOVER if ue["rat"] == RAT_LTE else NR_HANDOVER,
+                "e2NodeId": serving_e2,
+                "cellId": best_cell,
+                "rnti": ue["rnti"],
+            })
+        return commands
+
+
+def read_sequence(fd):
+    data = b""
+    while len(data) < 8:
+        chunk = os.read(fd, 8 - len(data))
+        if not chunk:
+            return None
+        data += chunk
+    return struct.unpack("=Q", data)[0]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="xApp driven by OranLmExternal")
+    parser.add_argument("--region", default=os.environ.get("ORAN_XAPP_REGION", "/oran-xapp"))
+    parser.add_argument("--request-fifo",
+                        default=os.environ.get("ORAN_XAPP_REQUEST_FIFO", "/tmp/oran-xapp.req"))
+    parser.add_argument("--response-fifo",
+                        default=os.environ.get("ORAN_XAPP_RESPONSE_FIFO", "/tmp/oran-xapp.rsp"))
+    parser.add_argument("--hysteresis", type=float, default=3.0,
+                        help="the RSRP margin (dB) required for a handover")
+    parser.add_argument("--dump", action="store_true",
+                        help="print every snapshot and return no commands")
+    args = parser.parse_args()
+
+    # The LM creates the FIFOs when it is activated, which may be after this
+    # process was started.
+    while not (os.path.exists(args.request_fifo) and os.path.exists(args.response_fifo)):
+        time.sleep(0.01)
+
+    # Same order as the LM: request first, then response.
+    request = os.open(args.request_fifo, os.O_RDONLY)
+    response = os.open(args.response_fifo, os.O_WRONLY)
+    region = Region(args.region)
+    xapp = XApp(args.hysteresis)
+
+    cycles = 0
+    n_commands = 0
+    while True:
+        sequence = read_sequence(request)
+        if sequence is None:
+            break
+
+        current, time_ns, tables = region.header()
+        if current != sequence:
+            sys.exit("Cycle %d not in region (found %d)" % (sequence, current))
+
+        ues = region.ues(tables)
+        cells = region.cells(tables)
+        measurements = region.measurements(tables)
+        if args.dump:
+            print("cycle %d at %.3f s: %d UE(s), %d cell(s), %d measurement(s)"
+                  % (sequence, time_ns / 1e9, len(ues), len(cells), len(measurements)))
+            for record in ues + cells + measurements:
+                print("  ", record)
+            commands = []
+        else:
+            commands = xapp.decide(time_ns, ues, cells, measurements)
+
+        region.write_commands(tables, sequence, commands)
+        os.write(response, struct.pack("=Q", sequence))
+        cycles += 1
+        n_commands += len(commands)
+
+    print("Python xApp answered %d cycle(s) with %d command(s)" % (cycles, n_commands),
+          file=sys.stderr)
+    region.close()
+    os.close(request)
+    os.close(response)
+
+
+if __name__ == "__main__":
+    main()
@@ -30,6 +30,13 @@
  *   python3 ns3 run 'oran-lte-2-lte-dublin-four-xapp-example' 2>/dev/null > raw.log
  *   python3 workspace/scripts/parse_ns3_conflict_log.py --input raw.log \
  *           --mode dublin_four_xapp --out conflict_dataset.csv
+ *
+ * With --sweep-modes and/or --sweep-runs, the sites are read and the ONNX
+ * models selected with --use-onnx-* imported once, and every (mode, run)
+ * point is run in a forked worker, at most --sweep-workers at a time
+ * (default: one per core). Each point writes its stdout and its output
+ * files to <sweep-dir>/<mode>/run-<run>/, and the --kpi-csv files of all
+ * the points are merged into <sweep-dir>/sweep-<kpi-csv file name>.
  */
 
 #include "ns3/applications-module.h"
@@ -39,16 +46,18 @@
 #include "ns3/lte-module.h"
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-conflict-triage.h"
 #include "ns3/oran-lm-lte-2-lte-kpi-prediction.h"
-#include "ns3/oran-lte-cell-control-state.h"
 #include "ns3/oran-module.h"
 #include "ns3/oran-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
 #include "ns3/propagation-module.h"
 
 #include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <cstdio>
 #include <deque>
 #include <fstream>
 #include <iomanip>
@@ -57,6 +66,7 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
 
 using namespace ns3;
 
@@ -125,6 +135,7 @@ static uint32_t g_rsrpViolCycles  = 0;    // number of LM cycles with worst RSRP
 static NetDeviceContainer            g_enbDevs;
 static OranE2NodeTerminatorContainer g_e2EnbTerms;
 static OranE2NodeTerminatorContainer g_e2UeTerms; //!< index-aligned with the UE creation loop
+static std::vector<Ptr<OranReporter>> g_reporters; //!< every Reporter, for LogSuspendedReporters
 static std::vector<Ptr<OranRuDeviceEnergyModel>> g_enbEnergyModels;
 static std::vector<double>           g_enbInitialEnergyJ;
 
@@ -382,6 +393,43 @@ LoadPositions(const std::string& path, uint32_t maxEnbs)
     return pos;
 }
 
+static void
+EnsureDir(const std::string& path)
+{
+    if (::mkdir(path.c_str(), 0755) != 0 && errno != EEXIST)
+    {
+        NS_ABORT_MSG("Could not create directory " << path << " errno=" << errno);
+    }
+}
+
+static std::vector<std::string>
+SplitCommaList(const std::string& list)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+        {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// Moves an output path of a sweep point into the directory of the point,
+// keeping its file name; empty paths (disabled outputs) stay empty.
+static std::string
+InPointDir(const std::string& dir, const std::string& path)
+{
+    if (path.empty())
+    {
+        return path;
+    }
+    return dir + "/" + path.substr(path.find_last_of('/') + 1);
+}
+
 // ─── Trace callbacks ──────────────────────────────────────────────────────────
 // ReportCurrentCellRsrpSinr fires as (cellId, rnti, rsrp_W, sinr_linear, ccId)
 void
@@ -473,6 +521,27 @@ ReportUeDemand(uint32_t ueIdx, Ptr<OranReporterLteUeAppDemand> reporter, Time in
     Simulator::Schedule(interval, &ReportUeDemand, ueIdx, reporter, interval);
 }
 
+// With --enforce-subscriptions the RIC only keeps the Reporters its modules
+// subscribe to running; this prints, per Reporter type, how many of them
+// the subscriptions of the selected LMs and CMM left suspended.
+void
+LogSuspendedReporters()
+{
+    std::map<std::string, std::pair<uint32_t, uint32_t>> counts; // type -> (suspended, total)
+    for (const auto& reporter : g_reporters)
+    {
+        auto& count = counts[reporter->GetInstanceTypeId().GetName()];
+        count.first += reporter->IsSuspended() ? 1 : 0;
+        count.second++;
+    }
+    for (const auto& [type, count] : counts)
+    {
+        std::cout << "[SUBS] t=" << std::fixed << std::setprecision(2)
+                  << Simulator::Now().GetSeconds() << "s " << type << ": " << count.first
+                  << "/" << count.second << " suspended" << std::endl;
+    }
+}
+
 // HandoverStart (below) records each UE's pending attempt keyed by IMSI,
 // with its SOURCE cell -- g_hoAttempts is keyed by that same source cell.
 // But HandoverEndOk fires at whichever eNB completes the procedure (the
@@ -649,7 +718,8 @@ LogCellState(Time interval, double lmIntervalSec, Ptr<OranCmmConflictTriage> tri
         Ptr<LteEnbNetDevice> dev = DynamicCast<LteEnbNetDevice>(g_enbDevs.Get(i));
         uint64_t e2id  = g_e2EnbTerms.Get(i)->GetE2NodeId();
         uint16_t cellId = dev->GetCellId();
-        OranLteCellControlParams cp = GetLteCellControlParameters(e2id);
+        OranCellControlParams cp =
+            g_e2EnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
 
         // Per-cell RSRP / SINR (min RSRP, mean SINR of UEs served by this cell)
         double minRsrp = 0.0, sumSinr = 0.0;
@@ -904,6 +974,11 @@ main(int argc, char* argv[])
     bool        useOnnxMlb       = false;        // opt-in: DQN ONNX MLB instead of rule-based
     bool        useOnnxCco       = false;        // opt-in: DQN ONNX CCO instead of rule-based
     std::string groundTruthPath  = "";           // if set, dump real MRO training data (workspace/ml/mro_dqn/)
+    bool        enforceSubscriptions = true;     // suspend the Reporters no module reads
+    std::string sweepModes       = "";           // comma-separated modes run in forked workers
+    uint32_t    sweepRuns        = 0;            // RNG runs swept in forked workers
+    uint32_t    sweepWorkers     = 0;            // concurrent sweep workers (0: one per core)
+    std::string sweepDir         = "dublin-four-xapp-sweep";
     double      ccoRsrpDbm       = -95.0;        // CCO reactive / violation threshold
     double      ccoCritDbm       = -105.0;       // CCO: issue RET when critically low
     double      ccoFracThr       = 0.15;
@@ -960,6 +1035,15 @@ main(int argc, char* argv[])
     cmd.AddValue("proactive-thresh",   "KPI predictor RSRP threshold (dBm)",proactiveThresh);
     cmd.AddValue("ema-alpha",          "EMA smoothing factor",              emaAlpha);
     cmd.AddValue("pred-horizon",       "Prediction horizon (cycles)",       predHorizon);
+    cmd.AddValue("enforce-subscriptions", "Suspend the Reporters whose Reports no LM or CMM "
+                                          "subscribes to", enforceSubscriptions);
+    cmd.AddValue("sweep-modes",        "Comma-separated modes to sweep in forked workers",
+                                       sweepModes);
+    cmd.AddValue("sweep-runs",         "Number of RNG runs to sweep in forked workers",
+                                       sweepRuns);
+    cmd.AddValue("sweep-workers",      "Maximum concurrent sweep workers (0: one per core)",
+                                       sweepWorkers);
+    cmd.AddValue("sweep-dir",          "Directory of the per-point sweep outputs",  sweepDir);
     cmd.Parse(argc, argv);
     g_pingPongWindowSec = pingPongWindowSec;
 
@@ -991,6 +1075,89 @@ main(int argc, char* argv[])
     Config::SetDefault("ns3::ThreeGppChannelConditionModel::UpdatePeriod",
                        TimeValue(Seconds(1.0)));
 
+    // ── Static setup, shared by the sweep workers ──────────────────────────────
+    // Reading the sites and importing the ONNX models with the built-in
+    // engine, which starts no threads, is done once before forking. The
+    // nodes are still created after it, in their original order: objects
+    // take automatically assigned random streams in creation order, so
+    // hoisting them would change the results of runs without a sweep.
+    std::vector<Vector> sites = LoadPositions(enbPosFile, maxEnbs);
+    uint32_t nEnbs = sites.size();
+    uint32_t nUes  = nEnbs * nUesPerEnb;
+
+    // The ONNX LMs of every worker share these instead of importing the
+    // files again (see OranOnnxModel::Preload).
+    if (useOnnxMro)
+    {
+        for (const char* path :
+             {"mode_classifier.onnx", "traj_x.onnx", "traj_y.onnx", "rsrp.onnx", "mro_dqn.onnx"})
+        {
+            OranOnnxModel::Preload(path);
+        }
+    }
+    if (useOnnxEs)
+    {
+        OranOnnxModel::Preload("es_dqn.onnx");
+    }
+    if (useOnnxMlb)
+    {
+        OranOnnxModel::Preload("mlb_dqn.onnx");
+    }
+    if (useOnnxCco)
+    {
+        OranOnnxModel::Preload("cco_dqn.onnx");
+    }
+
+    if (!sweepModes.empty() || sweepRuns > 0)
+    {
+        // Each worker runs the rest of main() for its (mode, run) point and
+        // writes its outputs, stdout included, to <sweep-dir>/<mode>/run-<run>/.
+        OranSweepRunner sweep;
+        sweep.AddAxis("mode",
+                      sweepModes.empty() ? std::vector<std::string>{mode}
+                                         : SplitCommaList(sweepModes));
+        std::vector<std::string> runs;
+        for (uint32_t run = 1; run <= std::max<uint32_t>(sweepRuns, 1); run++)
+        {
+            runs.push_back(std::to_string(run));
+        }
+        sweep.AddAxis("run", runs);
+        sweep.SetMaxWorkers(sweepWorkers);
+
+        auto pointDir = [&sweepDir](const OranSweepPoint& point) {
+            return sweepDir + "/" + point.Get("mode") + "/run-" + point.Get("run");
+        };
+
+        EnsureDir(sweepDir);
+        OranSweepPoint point;
+        if (!sweep.ForkWorkers(point))
+        {
+            if (!kpiCsvPath.empty())
+            {
+                sweep.MergeCsv(
+                    [&](const OranSweepPoint& p) { return InPointDir(pointDir(p), kpiCsvPath); },
+                    sweepDir + "/sweep-" + kpiCsvPath.substr(kpiCsvPath.find_last_of('/') + 1));
+            }
+            std::cout << "SWEEP: points=" << sweep.GetPoints().size()
+                      << " workers=" << sweep.GetMaxWorkers() << " failed=" << sweep.GetNFailed()
+                      << " sweep_dir=" << sweepDir << std::endl;
+            return sweep.GetNFailed() == 0 ? 0 : 1;
+        }
+
+        mode = point.Get("mode");
+        RngSeedManager::SetRun(std::stoul(point.Get("run")));
+        EnsureDir(sweepDir + "/" + mode);
+        const std::string dir = pointDir(point);
+        EnsureDir(dir);
+        NS_ABORT_MSG_IF(!std::freopen((dir + "/stdout.log").c_str(), "w", stdout),
+                        "Cannot redirect the output of sweep point " << point.ToString());
+        dbFile          = InPointDir(dir, dbFile);
+        conflictLog     = InPointDir(dir, conflictLog);
+        losTracePath    = InPointDir(dir, losTracePath);
+        kpiCsvPath      = InPointDir(dir, kpiCsvPath);
+        groundTruthPath = InPointDir(dir, groundTruthPath);
+    }
+
     if (!losTracePath.empty())
     {
         g_losTraceFile.open(losTracePath);
@@ -1019,10 +1186,6 @@ main(int argc, char* argv[])
                        (LogLevel)(LOG_PREFIX_TIME | LOG_WARN));
 
     // ── Topology ──────────────────────────────────────────────────────────────
-    std::vector<Vector> sites = LoadPositions(enbPosFile, maxEnbs);
-    uint32_t nEnbs = sites.size();
-    uint32_t nUes  = nEnbs * nUesPerEnb;
-
     // 3GPP TR 38.901 UMi-StreetCanyon: matches this scenario's 20 m eNB height and
     // ~53 m inter-site spacing (dense urban small-cell, not macro). Replaces the
     // deterministic Cost231 model with a stochastic per-link LOS/NLOS state
@@ -1446,6 +1609,7 @@ main(int argc, char* argv[])
     }
 
     Ptr<OranNearRtRic> nearRtRic = oranHelper->CreateNearRtRic();
+    nearRtRic->SetAttribute("EnforceSubscriptions", BooleanValue(enforceSubscriptions));
 
     // Real per-cycle parameter-update counts (puf_TXP/CIO/RET/TTT in [STATE]
     // and the combined KPI CSV) come straight from the CMM, which already
@@ -1469,6 +1633,10 @@ main(int argc, char* argv[])
     if (!groundTruthPath.empty())
     {
         groundTruthFile.open(groundTruthPath);
+        // CollectGroundTruth reads the RSRP reports whether or not an LM does.
+        nearRtRic->AddSubscription(OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                                                    {OranNearRtRic::LTEUE},
+                                                    Seconds(0)});
         groundTruthFile << "time,ue_idx,mode,velocity,accel,jerk,bearing_rate,pos_x,pos_y,"
                           "rsrp_reports,los_reports\n";
         // Fixed 2s cadence, independent of --lm-interval: ground-truth collection
@@ -1522,6 +1690,7 @@ main(int argc, char* argv[])
         ueTerm->AddReporter(cellRep);
         ueTerm->AddReporter(rsrpRep);
         ueTerm->AddReporter(demandRep);
+        g_reporters.insert(g_reporters.end(), {locRep, cellRep, rsrpRep, demandRep});
         ueTerm->Attach(ueNodes.Get(u));
         Simulator::Schedule(Seconds(2.0), &OranE2NodeTerminatorLteUe::Activate, ueTerm);
         Simulator::Schedule(Seconds(2.0), &ReportUeDemand, u, demandRep, Seconds(2.0));
@@ -1551,6 +1720,7 @@ main(int argc, char* argv[])
                               StringValue("ns3::ConstantRandomVariable[Constant=0.5]"));
         enbTerm->AddReporter(locRep);
         enbTerm->AddReporter(energyRep);
+        g_reporters.insert(g_reporters.end(), {locRep, energyRep});
         enbTerm->Attach(enbNodes.Get(i));
         g_e2EnbTerms.Add(enbTerm);
         Simulator::Schedule(Seconds(1.5), &OranE2NodeTerminatorLteEnb::Activate, enbTerm);
@@ -1599,6 +1769,12 @@ main(int argc, char* argv[])
     Simulator::Schedule(Seconds(lmInterval + 2.0),
                         &LogCellState, Seconds(lmInterval), lmInterval, triage, enbCapacityMbps);
 
+    // The E2 nodes have registered and received the subscriptions by then.
+    if (enforceSubscriptions)
+    {
+        Simulator::Schedule(Seconds(4.0), &LogSuspendedReporters);
+    }
+
     Simulator::Stop(Seconds(simTime));
     Simulator::Run();
 
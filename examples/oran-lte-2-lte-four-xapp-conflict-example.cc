@@ -58,8 +58,8 @@
 #include "ns3/lte-module.h"
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-conflict-triage.h"
-#include "ns3/oran-lte-cell-control-state.h"
 #include "ns3/oran-module.h"
 #include "ns3/oran-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
@@ -441,7 +441,8 @@ main(int argc, char* argv[])
         Ptr<LteEnbNetDevice> dev = DynamicCast<LteEnbNetDevice>(enbDevs.Get(i));
         double txp = dev->GetPhy()->GetTxPower();
         uint64_t e2id = e2EnbTerms.Get(i)->GetE2NodeId();
-        OranLteCellControlParams cp = GetLteCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2EnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         double energyConsumedJ =
             g_initialEnergyJ[i] - enbSrcVec[i]->GetRemainingEnergy();
         std::cout << "  eNB-" << i
@@ -468,7 +469,8 @@ main(int argc, char* argv[])
     {
         Ptr<LteEnbNetDevice> dev = DynamicCast<LteEnbNetDevice>(enbDevs.Get(i));
         uint64_t e2id = e2EnbTerms.Get(i)->GetE2NodeId();
-        OranLteCellControlParams cp = GetLteCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2EnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         std::cout << " enb" << i << "_txp=" << dev->GetPhy()->GetTxPower()
                   << " enb" << i << "_cio=" << cp.cioDb;
     }
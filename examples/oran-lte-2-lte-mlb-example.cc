@@ -24,7 +24,7 @@
 #include "ns3/lte-module.h"
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
-#include "ns3/oran-lte-cell-control-state.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-module.h"
 #include "ns3/point-to-point-module.h"
 
@@ -258,7 +258,8 @@ main(int argc, char* argv[])
     for (uint32_t i = 0; i < e2EnbTerminators.GetN(); i++)
     {
         uint64_t e2Id = e2EnbTerminators.Get(i)->GetE2NodeId();
-        OranLteCellControlParams params = GetLteCellControlParameters(e2Id);
+        OranCellControlParams params =
+            e2EnbTerminators.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2Id);
         Ptr<LteEnbNetDevice> dev = DynamicCast<LteEnbNetDevice>(enbLteDevs.Get(i));
         std::cout << "  eNB" << i << "(cell=" << dev->GetCellId()
                   << ",e2=" << e2Id
@@ -157,6 +157,7 @@ main(int argc, char* argv[])
     Time lmQueryInterval = Seconds(5);
     std::string dbFileName = "oran-repository.db";
     std::string lateCommandPolicy = "DROP";
+    std::string xappCommand;
 
     // Command line arguments
     CommandLine cmd(__FILE__);
@@ -173,6 +174,11 @@ main(int argc, char* argv[])
                  "(\"DROP\" or \"SAVE\")",
                  lateCommandPolicy);
     cmd.AddValue("sim-time", "The amount of time to simulate", simTime);
+    cmd.AddValue("xapp-command",
+                 "If set, the handovers are decided by an external xApp started with this "
+                 "command (e.g., the oran-lm-external-stand-in binary, or \"python3 "
+                 "oran-lm-external-xapp.py\") instead of the RSRP Logic Module",
+                 xappCommand);
     cmd.Parse(argc, argv);
 
     LogComponentEnable("OranNearRtRic", (LogLevel)(LOG_PREFIX_TIME | LOG_WARN));
@@ -359,9 +365,20 @@ main(int argc, char* argv[])
     oranHelper->SetDataRepository("ns3::OranDataRepositorySqlite",
                                   "DatabaseFile",
                                   StringValue(dbFileName));
-    oranHelper->SetDefaultLogicModule("ns3::OranLmLte2LteRsrpHandover",
-                                      "ProcessingDelayRv",
-                                      StringValue(processingDelayRv));
+    if (xappCommand.empty())
+    {
+        oranHelper->SetDefaultLogicModule("ns3::OranLmLte2LteRsrpHandover",
+                                          "ProcessingDelayRv",
+                                          StringValue(processingDelayRv));
+    }
+    else
+    {
+        oranHelper->SetDefaultLogicModule("ns3::OranLmExternal",
+                                          "ProcessingDelayRv",
+                                          StringValue(processingDelayRv),
+                                          "Command",
+                                          StringValue(xappCommand));
+    }
     oranHelper->SetConflictMitigationModule("ns3::OranCmmNoop");
 
     nearRtRic = oranHelper->CreateNearRtRic();
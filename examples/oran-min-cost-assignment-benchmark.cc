@@ -0,0 +1,270 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * Min-cost UE to cell assignment benchmark.
+ *
+ * Drops cells on a square grid and UEs at random, a share of them around a
+ * few hotspots, gives every UE a log-normal demand, computes the RSRP of
+ * every UE from every cell with a log-distance path loss and log-normal
+ * shadowing, and attaches every UE to its strongest cell. Every cell may
+ * carry a share of the total demand, set by the slack.
+ *
+ * The UEs are then assigned with the same call the MLB Logic Module
+ * (OranLmLte2LteMobilityLoadBalancing) makes in ASSIGNMENT mode, which
+ * solves the min-cost assignment with OranMinCostAssignment, and solves it
+ * again with fewer UEs in the cells left over the budget, up to
+ * MaxAssignmentRounds times. The mean and worst time of the whole call and
+ * the number of solves are printed against the default LM query interval,
+ * and the demand left above the budget is compared with a greedy baseline
+ * that moves the UEs of overloaded cells, cheapest move first, to the
+ * cheapest cell with room left.
+ *
+ * Usage:
+ *   ./ns3 run "oran-min-cost-assignment-benchmark --ues=5000 --cells=100 --runs=5"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranMinCostAssignmentBenchmark");
+
+/**
+ * Assign the UEs of overloaded cells greedily.
+ *
+ * @param ues The UEs.
+ * @param numCells The number of cells.
+ * @param budgetMbps The demand every cell may carry.
+ * @param handoverCost The cost of a handover in dB.
+ * @param maxRsrpMargin How far below the serving RSRP a candidate cell may be, in dB.
+ * @param cost Set to the total cost.
+ * @return The demand left above the budget, in Mbps.
+ */
+static double
+SolveGreedy(const std::vector<OranLmLte2LteMobilityLoadBalancing::AssignmentUe>& ues,
+            uint32_t numCells,
+            double budgetMbps,
+            double handoverCost,
+            double maxRsrpMargin,
+            double& cost)
+{
+    std::vector<double> load(numCells, 0.0);
+    for (const auto& ue : ues)
+    {
+        load[ue.serving] += ue.demandMbps;
+    }
+
+    // The moves of the UEs of overloaded cells, cheapest first. The RSRP of
+    // the serving cell is the first one of every UE.
+    std::vector<std::tuple<double, uint32_t, uint32_t>> moves;
+    for (uint32_t i = 0; i < ues.size(); i++)
+    {
+        if (load[ues[i].serving] <= budgetMbps)
+        {
+            continue;
+        }
+        const double servingRsrp = ues[i].rsrp.front().second;
+        for (const auto& [cell, rsrp] : ues[i].rsrp)
+        {
+            const double loss = servingRsrp - rsrp;
+            if (cell != ues[i].serving && loss <= maxRsrpMargin)
+            {
+                moves.emplace_back(handoverCost + std::max(0.0, loss), i, cell);
+            }
+        }
+    }
+    std::sort(moves.begin(), moves.end());
+
+    cost = 0.0;
+    std::vector<bool> moved(ues.size(), false);
+    for (const auto& [moveCost, i, cell] : moves)
+    {
+        const auto& ue = ues[i];
+        if (moved[i] || load[ue.serving] <= budgetMbps ||
+            load[cell] + ue.demandMbps > budgetMbps)
+        {
+            continue;
+        }
+        load[ue.serving] -= ue.demandMbps;
+        load[cell] += ue.demandMbps;
+        cost += moveCost;
+        moved[i] = true;
+    }
+
+    double overload = 0.0;
+    for (auto cellLoad : load)
+    {
+        overload += std::max(0.0, cellLoad - budgetMbps);
+    }
+    return overload;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numUes = 5000;
+    uint32_t numCells = 100;
+    uint32_t runs = 5;
+    uint32_t seed = 1;
+    uint32_t maxRounds = 4;
+    double isd = 500.0;
+    double hotspotShare = 0.4;
+    double slack = 1.1;
+    double demandMbps = 1.0;
+    double demandSigma = 0.5;
+    double shadowingDb = 8.0;
+    double handoverCost = 3.0;
+    double maxRsrpMargin = 10.0;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("ues", "Number of UEs", numUes);
+    cmd.AddValue("cells", "Number of cells", numCells);
+    cmd.AddValue("runs", "Assignments timed", runs);
+    cmd.AddValue("seed", "Seed of the layout", seed);
+    cmd.AddValue("max-rounds", "Most times the assignment is solved per run", maxRounds);
+    cmd.AddValue("isd", "Distance between cells in m", isd);
+    cmd.AddValue("hotspot-share", "Share of the UEs dropped around hotspots", hotspotShare);
+    cmd.AddValue("slack", "Total cell budget over the total demand", slack);
+    cmd.AddValue("demand", "Mean demand of a UE in Mbps", demandMbps);
+    cmd.AddValue("demand-sigma", "Standard deviation of the log of the demand", demandSigma);
+    cmd.AddValue("shadowing", "Standard deviation of the shadowing in dB", shadowingDb);
+    cmd.AddValue("handover-cost", "Cost of a handover in dB", handoverCost);
+    cmd.AddValue("max-rsrp-margin",
+                 "How far below the serving RSRP a candidate cell may be, in dB. "
+                 "A large value makes every cell a candidate of every UE.",
+                 maxRsrpMargin);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(numUes == 0 || numCells == 0 || runs == 0,
+                    "At least one UE, one cell and one run are needed");
+
+    std::mt19937 rng(seed);
+    const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(numCells)));
+    const double area = side * isd;
+    std::uniform_real_distribution<double> uniform(0.0, area);
+    std::normal_distribution<double> shadowing(0.0, shadowingDb);
+    std::normal_distribution<double> scatter(0.0, isd / 3.0);
+    std::lognormal_distribution<double> demand(
+        std::log(demandMbps) - demandSigma * demandSigma / 2.0,
+        demandSigma);
+
+    std::vector<std::pair<double, double>> hotspots(std::max<uint32_t>(1, numCells / 20));
+    for (auto& hotspot : hotspots)
+    {
+        hotspot = {uniform(rng), uniform(rng)};
+    }
+
+    // Every UE is served by its strongest cell, and reports the cells within
+    // the margin of the serving RSRP, serving cell first.
+    std::vector<OranLmLte2LteMobilityLoadBalancing::AssignmentUe> ues(numUes);
+    std::vector<double> rsrp(numCells);
+    std::vector<double> load(numCells, 0.0);
+    std::size_t numCandidates = 0;
+    double totalDemandMbps = 0.0;
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        double x = uniform(rng);
+        double y = uniform(rng);
+        if (i < hotspotShare * numUes)
+        {
+            const auto& hotspot = hotspots[i % hotspots.size()];
+            x = std::clamp(hotspot.first + scatter(rng), 0.0, area);
+            y = std::clamp(hotspot.second + scatter(rng), 0.0, area);
+        }
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            double dx = x - ((c % side) + 0.5) * isd;
+            double dy = y - ((c / side) + 0.5) * isd;
+            double km = std::max(0.01, std::sqrt(dx * dx + dy * dy) / 1000.0);
+            rsrp[c] = 46.0 - 10.0 * std::log10(1200.0) - (128.1 + 37.6 * std::log10(km)) +
+                      shadowing(rng);
+        }
+        auto& ue = ues[i];
+        ue.serving = static_cast<uint32_t>(std::max_element(rsrp.begin(), rsrp.end()) -
+                                           rsrp.begin());
+        ue.demandMbps = demand(rng);
+        ue.rsrp.emplace_back(ue.serving, rsrp[ue.serving]);
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            if (c != ue.serving && rsrp[ue.serving] - rsrp[c] <= maxRsrpMargin)
+            {
+                ue.rsrp.emplace_back(c, rsrp[c]);
+            }
+        }
+        load[ue.serving] += ue.demandMbps;
+        totalDemandMbps += ue.demandMbps;
+        numCandidates += ue.rsrp.size();
+    }
+
+    const double budgetMbps = slack * totalDemandMbps / numCells;
+    uint32_t overloaded = 0;
+    double initialOverloadMbps = 0.0;
+    for (auto cellLoad : load)
+    {
+        overloaded += cellLoad > budgetMbps ? 1 : 0;
+        initialOverloadMbps += std::max(0.0, cellLoad - budgetMbps);
+    }
+
+    std::cout << numUes << " UEs, " << numCells << " cells of " << std::fixed
+              << std::setprecision(1) << budgetMbps << " Mbps, "
+              << static_cast<double>(numCandidates) / numUes << " candidates per UE, "
+              << overloaded << " cells overloaded by " << initialOverloadMbps << " Mbps"
+              << std::endl;
+
+    Ptr<OranLmLte2LteMobilityLoadBalancing> lm = CreateObject<OranLmLte2LteMobilityLoadBalancing>();
+    lm->SetAttribute("HandoverCost", DoubleValue(handoverCost));
+    lm->SetAttribute("MaxRsrpMargin", DoubleValue(maxRsrpMargin));
+    lm->SetAttribute("MaxAssignmentRounds", UintegerValue(maxRounds));
+
+    OranLmLte2LteMobilityLoadBalancing::AssignmentResult result;
+    double totalMs = 0.0;
+    double worstMs = 0.0;
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        result = lm->Assign(ues, numCells, budgetMbps);
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() -
+                                                              start)
+                        .count();
+        totalMs += ms;
+        worstMs = std::max(worstMs, ms);
+    }
+
+    uint32_t handovers = 0;
+    for (uint32_t i = 0; i < numUes; i++)
+    {
+        const int32_t cell = result.cells[i];
+        handovers += cell != OranMinCostAssignment::UNASSIGNED &&
+                             static_cast<uint32_t>(cell) != ues[i].serving
+                         ? 1
+                         : 0;
+    }
+
+    double greedyCost = 0.0;
+    double greedyOverloadMbps =
+        SolveGreedy(ues, numCells, budgetMbps, handoverCost, maxRsrpMargin, greedyCost);
+
+    const double intervalMs = 5000.0;
+    std::cout << std::setprecision(2) << "min-cost: " << totalMs / runs << " ms mean, "
+              << worstMs << " ms worst (" << 100.0 * worstMs / intervalMs
+              << "% of the 5 s LM query interval), " << result.rounds << " of at most "
+              << std::min(numCells, maxRounds) << " solves" << std::endl
+              << "min-cost: cost " << result.cost << ", " << handovers << " handovers, "
+              << result.overloadMbps << " Mbps left over budget" << std::endl
+              << "greedy:   cost " << greedyCost << ", " << greedyOverloadMbps
+              << " Mbps left over budget" << std::endl;
+
+    return 0;
+}
@@ -44,6 +44,7 @@
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
 #include "ns3/nr-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-conflict-triage-nr.h"
 #include "ns3/oran-lm-nr-2-nr-onnx-cco.h"
 #include "ns3/oran-lm-nr-2-nr-onnx-energy-saving.h"
@@ -51,7 +52,6 @@
 #include "ns3/oran-lm-nr-2-nr-onnx-mro.h"
 #include "ns3/oran-lm-nr-2-nr-txp-calibration.h"
 #include "ns3/oran-module.h"
-#include "ns3/oran-nr-cell-control-state.h"
 #include "ns3/oran-nr-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
 #include "ns3/three-gpp-propagation-loss-model.h"
@@ -584,7 +584,8 @@ LogCellState(Time interval, double lmIntervalSec, Ptr<OranCmmConflictTriageNr> t
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(g_gnbDevs.Get(i));
         uint64_t e2id = g_e2GnbTerms.Get(i)->GetE2NodeId();
         uint16_t cellId = dev->GetCellId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            g_e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
 
         double minRsrp = 0.0;
         uint32_t nUes = 0;
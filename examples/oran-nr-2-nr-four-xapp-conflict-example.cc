@@ -22,9 +22,9 @@
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
 #include "ns3/nr-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-conflict-triage-nr.h"
 #include "ns3/oran-module.h"
-#include "ns3/oran-nr-cell-control-state.h"
 #include "ns3/oran-nr-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
 
@@ -411,7 +411,8 @@ main(int argc, char* argv[])
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(gnbDevs.Get(i));
         double txp = dev->GetPhy(0)->GetTxPower();
         uint64_t e2id = e2GnbTerms.Get(i)->GetE2NodeId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         double energyConsumedJ = g_initialEnergyJ[i] - gnbSrcVec[i]->GetRemainingEnergy();
         std::cout << "  gNB-" << i << "  cell=" << dev->GetCellId() << "  TXP=" << txp << " dBm"
                   << "  CIO=" << cp.cioDb << " dB"
@@ -431,7 +432,8 @@ main(int argc, char* argv[])
     {
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(gnbDevs.Get(i));
         uint64_t e2id = e2GnbTerms.Get(i)->GetE2NodeId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         std::cout << " gnb" << i << "_txp=" << dev->GetPhy(0)->GetTxPower() << " gnb" << i
                   << "_cio=" << cp.cioDb;
     }
@@ -19,8 +19,8 @@
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
 #include "ns3/nr-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-module.h"
-#include "ns3/oran-nr-cell-control-state.h"
 #include "ns3/point-to-point-module.h"
 
 using namespace ns3;
@@ -279,7 +279,8 @@ main(int argc, char* argv[])
     for (uint32_t i = 0; i < e2GnbTerminators.GetN(); i++)
     {
         uint64_t e2Id = e2GnbTerminators.Get(i)->GetE2NodeId();
-        OranNrCellControlParams params = GetNrCellControlParameters(e2Id);
+        OranCellControlParams params =
+            e2GnbTerminators.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2Id);
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(gnbNetDev.Get(i));
         std::cout << "  gNB" << i << "(cell=" << dev->GetCellId() << ",e2=" << e2Id
                   << ",CIO=" << params.cioDb << ")";
@@ -19,9 +19,9 @@
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
 #include "ns3/nr-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-conflict-triage-nr.h"
 #include "ns3/oran-module.h"
-#include "ns3/oran-nr-cell-control-state.h"
 #include "ns3/oran-nr-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
 
@@ -76,7 +76,8 @@ LogCellState(Time interval)
     {
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(g_gnbDevs.Get(i));
         uint64_t e2id = g_e2GnbTerms.Get(i)->GetE2NodeId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            g_e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
 
         uint16_t cellId = dev->GetCellId();
         double minRsrp = 0.0;
@@ -515,7 +516,8 @@ main(int argc, char* argv[])
     {
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(gnbDevs.Get(i));
         uint64_t e2id = e2GnbTerms.Get(i)->GetE2NodeId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         double energyJ = initialEnergyJ[i] - gnbSrcVec[i]->GetRemainingEnergy();
         std::cout << "  gNB-" << i << "  TXP=" << dev->GetPhy(0)->GetTxPower() << " dBm"
                   << "  CIO=" << cp.cioDb << " dB"
@@ -536,7 +538,8 @@ main(int argc, char* argv[])
     {
         Ptr<NrGnbNetDevice> dev = DynamicCast<NrGnbNetDevice>(gnbDevs.Get(i));
         uint64_t e2id = e2GnbTerms.Get(i)->GetE2NodeId();
-        OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+        OranCellControlParams cp =
+            e2GnbTerms.Get(i)->GetNearRtRic()->GetCellControlStore()->Get(e2id);
         std::cout << " gnb" << i << "_txp=" << dev->GetPhy(0)->GetTxPower() << " gnb" << i
                   << "_cio=" << cp.cioDb;
     }
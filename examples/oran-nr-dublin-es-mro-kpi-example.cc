@@ -29,9 +29,9 @@
 #include "ns3/mobility-module.h"
 #include "ns3/network-module.h"
 #include "ns3/nr-module.h"
+#include "ns3/oran-cell-control-store.h"
 #include "ns3/oran-cmm-nr-2-nr-es-mro.h"
 #include "ns3/oran-module.h"
-#include "ns3/oran-nr-cell-control-state.h"
 #include "ns3/oran-nr-ru-energy-model.h"
 #include "ns3/point-to-point-module.h"
 
@@ -377,7 +377,8 @@ SampleCellControlParams(Time interval,
         Ptr<NrGnbNetDevice> gnb = DynamicCast<NrGnbNetDevice>(gnbNrDevs.Get(i));
         Ptr<OranE2NodeTerminator> terminator = gnbTerminators.Get(i);
         const uint64_t e2NodeId = terminator->GetE2NodeId();
-        const OranNrCellControlParams params = GetNrCellControlParameters(e2NodeId);
+        const OranCellControlParams params =
+            terminator->GetNearRtRic()->GetCellControlStore()->Get(e2NodeId);
 
         g_cellParamOut << now << "," << i << "," << e2NodeId << "," << gnb->GetCellId() << ","
                        << gnb->GetPhy(0)->GetTxPower() << "," << params.cioDb << ","
@@ -0,0 +1,151 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * ONNX inference benchmark.
+ *
+ * Loads every given ONNX model twice through OranOnnxModel, once on the
+ * built-in inference engine (OranOnnxNativeModel) and once on ONNX Runtime,
+ * runs both on the same random rows one row per call, the way the Logic
+ * Modules do, and prints the mean time per call of each and the largest
+ * difference between their outputs. Models the built-in engine does not
+ * support are run on ONNX Runtime only, and the reason is printed.
+ *
+ * The sample models can be copied from contrib/oran/examples/ to the
+ * working directory.
+ *
+ * Usage:
+ *   ./ns3 run "oran-onnx-inference-benchmark --iterations=10000
+ *              --models=cco_dqn.onnx,mro_dqn.onnx,traj_x.onnx"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranOnnxInferenceBenchmark");
+
+/**
+ * Run a model on every row, one row per call.
+ *
+ * @param model The model.
+ * @param rows The rows, one after the other.
+ * @param rowSize The number of features in a row.
+ * @param iterations The number of calls.
+ * @param outputs Set to the outputs of the calls, one after the other.
+ * @return The mean time per call, in microseconds.
+ */
+static double
+TimeCalls(OranOnnxModel& model,
+          const std::vector<float>& rows,
+          std::size_t rowSize,
+          uint32_t iterations,
+          std::vector<float>& outputs)
+{
+    std::size_t nRows = rows.size() / rowSize;
+    outputs.clear();
+
+    // Warm up, so that lazy initialization is not timed.
+    model.Run(rows.data(), 1, rowSize);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        const std::vector<float>& output =
+            model.Run(rows.data() + (i % nRows) * rowSize, 1, rowSize);
+        if (i < nRows)
+        {
+            outputs.insert(outputs.end(), output.begin(), output.end());
+        }
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+               .count() /
+           iterations;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t iterations = 10000;
+    std::string models = "cco_dqn.onnx,es_dqn.onnx,mlb_dqn.onnx,mro_dqn.onnx,mode_classifier.onnx,"
+                         "traj_x.onnx,traj_y.onnx,saved_trained_classification_pytorch.onnx";
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("iterations", "Calls timed per model and engine", iterations);
+    cmd.AddValue("models", "Comma-separated ONNX model paths", models);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(iterations == 0, "At least one iteration is needed");
+
+    std::mt19937 rng(1);
+    std::normal_distribution<float> feature(0.0f, 1.0f);
+
+    std::cout << std::left << std::setw(44) << "model" << std::right << std::setw(8) << "inputs"
+              << std::setw(14) << "native (us)" << std::setw(12) << "ORT (us)" << std::setw(10)
+              << "speedup" << std::setw(14) << "max |diff|" << std::endl;
+
+    std::istringstream list(models);
+    std::string path;
+    while (std::getline(list, path, ','))
+    {
+        OranOnnxModel ort;
+        ort.SetNativeEnabled(false);
+        ort.Load(path);
+
+        OranOnnxModel native;
+        native.Load(path);
+
+        std::size_t rowSize = native.GetInputSize();
+        NS_ABORT_MSG_IF(rowSize == 0, "The input width of \"" << path << "\" is not fixed");
+
+        std::vector<float> rows(rowSize * std::min<uint32_t>(iterations, 256));
+        for (auto& value : rows)
+        {
+            value = feature(rng);
+        }
+
+        std::vector<float> ortOutputs;
+        double ortUs = TimeCalls(ort, rows, rowSize, iterations, ortOutputs);
+
+        std::cout << std::left << std::setw(44) << path << std::right << std::setw(8) << rowSize
+                  << std::fixed << std::setprecision(2);
+        if (!native.IsNative())
+        {
+            OranOnnxNativeModel probe;
+            probe.Load(path);
+            std::cout << std::setw(14) << "-" << std::setw(12) << ortUs << "    not supported: "
+                      << probe.GetUnsupportedReason() << std::endl;
+            continue;
+        }
+
+        std::vector<float> nativeOutputs;
+        double nativeUs = TimeCalls(native, rows, rowSize, iterations, nativeOutputs);
+
+        NS_ABORT_MSG_IF(nativeOutputs.size() != ortOutputs.size(),
+                        "The engines return outputs of different sizes for \"" << path << "\"");
+        double maxDiff = 0.0;
+        for (std::size_t i = 0; i < nativeOutputs.size(); i++)
+        {
+            maxDiff = std::max(maxDiff,
+                               static_cast<double>(std::fabs(nativeOutputs[i] - ortOutputs[i])));
+        }
+
+        std::cout << std::setw(14) << nativeUs << std::setw(12) << ortUs << std::setw(9)
+                  << ortUs / nativeUs << "x" << std::setw(14) << std::scientific
+                  << std::setprecision(1) << maxDiff << std::defaultfloat << std::endl;
+    }
+
+    return 0;
+}
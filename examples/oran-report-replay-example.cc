@@ -0,0 +1,118 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * Offline replay of a recorded E2 report stream.
+ *
+ * Feeds the SQLite repository written by a previous run (by default the one
+ * of "oran-lte-2-lte-distance-handover-example") into a fresh Near-RT RIC
+ * configured like the one of that run, without simulating the LTE network.
+ * The distance handover LM runs unchanged on the replayed Reports, and the
+ * Commands it issues are printed instead of being applied.
+ *
+ * Usage:
+ *   ./ns3 run oran-lte-2-lte-distance-handover-example
+ *   ./ns3 run "oran-report-replay-example --trace-db=oran-repository.db"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranReportReplayExample");
+
+/**
+ * Prints the Commands sent to the replayed E2 nodes.
+ *
+ * @param e2NodeId The E2 Node ID of the replayed node.
+ * @param command The Command.
+ */
+void
+CommandSink(uint64_t e2NodeId, Ptr<const OranCommand> command)
+{
+    std::cout << Simulator::Now().GetSeconds() << " E2 Node " << e2NodeId << " <- "
+              << command->ToString() << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string traceDb = "oran-repository.db";
+    std::string dbFileName = "oran-replay-repository.db";
+    Time simTime = Seconds(50);
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("trace-db", "The repository of the recorded run", traceDb);
+    cmd.AddValue("db-file", "The repository of the replay", dbFileName);
+    cmd.AddValue("sim-time", "The simulation time to replay", simTime);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(traceDb == dbFileName, "The replay needs its own repository");
+
+    std::remove(dbFileName.c_str());
+
+    // Same Near-RT RIC as the recorded run.
+    Ptr<OranDataRepository> dataRepository = CreateObject<OranDataRepositorySqlite>();
+    Ptr<OranLm> defaultLm = CreateObject<OranLmLte2LteDistanceHandover>();
+    Ptr<OranCmm> cmm = CreateObject<OranCmmNoop>();
+    Ptr<OranNearRtRic> nearRtRic = CreateObject<OranNearRtRic>();
+    Ptr<OranNearRtRicE2Terminator> nearRtRicE2Terminator =
+        CreateObject<OranNearRtRicE2Terminator>();
+
+    dataRepository->SetAttribute("DatabaseFile", StringValue(dbFileName));
+
+    defaultLm->SetAttribute("Verbose", BooleanValue(true));
+    defaultLm->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    defaultLm->SetAttribute("ProcessingDelayRv",
+                            StringValue("ns3::ConstantRandomVariable[Constant=0]"));
+
+    cmm->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    cmm->SetAttribute("Verbose", BooleanValue(true));
+
+    nearRtRicE2Terminator->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    nearRtRicE2Terminator->SetAttribute("DataRepository", PointerValue(dataRepository));
+    nearRtRicE2Terminator->SetAttribute("TransmissionDelayRv",
+                                        StringValue("ns3::ConstantRandomVariable[Constant=0.001]"));
+
+    nearRtRic->SetAttribute("DefaultLogicModule", PointerValue(defaultLm));
+    nearRtRic->SetAttribute("E2Terminator", PointerValue(nearRtRicE2Terminator));
+    nearRtRic->SetAttribute("DataRepository", PointerValue(dataRepository));
+    nearRtRic->SetAttribute("LmQueryInterval", TimeValue(Seconds(5)));
+    nearRtRic->SetAttribute("ConflictMitigationModule", PointerValue(cmm));
+    nearRtRic->SetAttribute("E2NodeInactivityThreshold", TimeValue(Seconds(2)));
+    nearRtRic->SetAttribute("E2NodeInactivityIntervalRv",
+                            StringValue("ns3::ConstantRandomVariable[Constant=2]"));
+    nearRtRic->SetAttribute("LmQueryMaxWaitTime", TimeValue(Seconds(0)));
+    nearRtRic->SetAttribute("LmQueryLateCommandPolicy", EnumValue(OranNearRtRic::DROP));
+
+    Simulator::Schedule(Seconds(1), &OranNearRtRic::Start, nearRtRic);
+
+    // The recorded E2 nodes.
+    Ptr<OranReportReplayer> replayer = CreateObject<OranReportReplayer>();
+    replayer->SetAttribute("DatabaseFile", StringValue(traceDb));
+    replayer->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    replayer->TraceConnectWithoutContext("CommandReceived", MakeCallback(&CommandSink));
+    replayer->Activate();
+
+    auto start = std::chrono::steady_clock::now();
+
+    Simulator::Stop(simTime);
+    Simulator::Run();
+
+    double wallSeconds =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Replayed " << replayer->GetNReportsReplayed() << " Reports, "
+              << replayer->GetNCommandsReceived() << " Commands issued, in " << wallSeconds
+              << " s" << std::endl;
+
+    replayer->Deactivate();
+    Simulator::Destroy();
+
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+/**
+ * RSRP surrogate benchmark.
+ *
+ * Drops cells on a square grid and UEs at random, and generates RSRP reports
+ * of every cell above a sensitivity from a path loss model with a random
+ * offset per cell and log-normal shadowing. OranRsrpSurrogate is fitted to
+ * the reports, and the fitted path loss exponent and RMS error are printed.
+ *
+ * It then scores every candidate configuration of one cell: TxPower offsets
+ * from -max-offset to +max-offset dB in 1 dB steps, and switching the cell
+ * off, for every cell, the way the CCO and ES Logic Modules check their
+ * TxPower changes. It prints the time per candidate and the number of
+ * candidates scored within the default LM query interval. Every score is
+ * checked against applying the offset and counting the covered UEs, which
+ * is also timed.
+ *
+ * Usage:
+ *   ./ns3 run "oran-rsrp-surrogate-benchmark --ues=5000 --cells=100"
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/oran-module.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("OranRsrpSurrogateBenchmark");
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t numUes = 5000;
+    uint32_t numCells = 100;
+    uint32_t seed = 1;
+    uint32_t maxOffset = 6;
+    double isd = 500.0;
+    double shadowingDb = 4.0;
+    double thresholdDbm = -90.0;
+    double sensitivityDbm = -140.0;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("ues", "Number of UEs", numUes);
+    cmd.AddValue("cells", "Number of cells", numCells);
+    cmd.AddValue("seed", "Seed of the layout", seed);
+    cmd.AddValue("max-offset", "Largest TxPower offset tried, in dB", maxOffset);
+    cmd.AddValue("isd", "Distance between cells in m", isd);
+    cmd.AddValue("shadowing", "Standard deviation of the shadowing in dB", shadowingDb);
+    cmd.AddValue("threshold", "RSRP a UE needs to be covered, in dBm", thresholdDbm);
+    cmd.AddValue("sensitivity",
+                 "RSRP a UE needs to report a cell, in dBm. -140 is the bottom of the LTE "
+                 "RSRP range; a higher one biases the fit, as only lucky far cells are reported.",
+                 sensitivityDbm);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(numUes == 0 || numCells == 0, "At least one UE and one cell are needed");
+
+    std::mt19937 rng(seed);
+    const uint32_t side = static_cast<uint32_t>(std::ceil(std::sqrt(numCells)));
+    std::uniform_real_distribution<double> uniform(0.0, side * isd);
+    std::normal_distribution<double> shadowing(0.0, shadowingDb);
+    std::normal_distribution<double> cellOffset(0.0, 3.0);
+
+    std::vector<Vector> cells(numCells);
+    std::vector<double> intercepts(numCells);
+    for (uint32_t c = 0; c < numCells; c++)
+    {
+        cells[c] = Vector(((c % side) + 0.5) * isd, ((c / side) + 0.5) * isd, 30.0);
+        intercepts[c] = cellOffset(rng);
+    }
+    std::vector<Vector> ues(numUes);
+    for (auto& ue : ues)
+    {
+        ue = Vector(uniform(rng), uniform(rng), 1.5);
+    }
+
+    // Every UE reports the cells it detects.
+    const double trueExponent = 3.5;
+    std::vector<std::tuple<uint32_t, uint32_t, double>> samples;
+    for (uint32_t u = 0; u < numUes; u++)
+    {
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            double d = std::max(1.0, CalculateDistance(cells[c], ues[u]));
+            double rsrp = intercepts[c] - 10.0 * trueExponent * std::log10(d) + shadowing(rng);
+            if (rsrp >= sensitivityDbm)
+            {
+                samples.emplace_back(u, c, rsrp);
+            }
+        }
+    }
+
+    OranRsrpSurrogate surrogate;
+    auto start = std::chrono::steady_clock::now();
+    surrogate.SetLayout(cells, ues);
+    double rms = surrogate.Calibrate(samples);
+    double fitMs =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+            .count();
+
+    const uint32_t covered = surrogate.CountCovered(thresholdDbm);
+    std::cout << numUes << " UEs, " << numCells << " cells, " << samples.size() << " reports"
+              << std::endl
+              << std::fixed << std::setprecision(2)
+              << "fit: exponent " << surrogate.GetPathLossExponent() << " (true " << trueExponent
+              << "), RMS error " << rms << " dB, " << fitMs << " ms" << std::endl
+              << "covered: " << covered << " UEs at " << thresholdDbm << " dBm" << std::endl;
+
+    // Score every candidate, then check it by applying it.
+    std::vector<double> offsets;
+    for (int32_t o = -static_cast<int32_t>(maxOffset); o <= static_cast<int32_t>(maxOffset); o++)
+    {
+        offsets.push_back(o);
+    }
+    offsets.push_back(-std::numeric_limits<double>::infinity());
+
+    std::vector<uint32_t> scores;
+    scores.reserve(numCells * offsets.size());
+    start = std::chrono::steady_clock::now();
+    for (uint32_t c = 0; c < numCells; c++)
+    {
+        for (double offset : offsets)
+        {
+            scores.push_back(surrogate.EvaluatePowerOffset(c, offset, thresholdDbm));
+        }
+    }
+    double scoreUs =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+            .count() /
+        scores.size();
+
+    start = std::chrono::steady_clock::now();
+    std::size_t i = 0;
+    uint32_t bestGain = 0;
+    for (uint32_t c = 0; c < numCells; c++)
+    {
+        for (double offset : offsets)
+        {
+            surrogate.SetPowerOffset(c, offset);
+            uint32_t applied = surrogate.CountCovered(thresholdDbm);
+            NS_ABORT_MSG_IF(applied != scores[i],
+                            "Cell " << c << " offset " << offset << ": scored " << scores[i]
+                                    << " UEs, applied " << applied);
+            bestGain = std::max(bestGain, applied > covered ? applied - covered : 0);
+            i++;
+        }
+        surrogate.SetPowerOffset(c, 0.0);
+    }
+    double applyUs =
+        std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+            .count() /
+        scores.size();
+
+    const double intervalUs = 5e6;
+    std::cout << "score: " << scoreUs << " us per candidate, " << std::setprecision(0)
+              << intervalUs / scoreUs << " candidates per 5 s LM query interval" << std::endl
+              << std::setprecision(2) << "apply and count: " << applyUs
+              << " us per candidate, all " << scores.size() << " scores match" << std::endl
+              << "best single-cell gain: " << bestGain << " UEs" << std::endl;
+
+    return 0;
+}
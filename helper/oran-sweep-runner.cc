@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-sweep-runner.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranSweepRunner");
+
+const std::string&
+OranSweepPoint::Get(const std::string& name) const
+{
+    for (const auto& value : values)
+    {
+        if (value.first == name)
+        {
+            return value.second;
+        }
+    }
+
+    NS_ABORT_MSG("Sweep point has no axis \"" << name << "\"");
+}
+
+std::string
+OranSweepPoint::ToString() const
+{
+    std::ostringstream ss;
+    for (std::size_t i = 0; i < values.size(); i++)
+    {
+        ss << (i == 0 ? "" : ",") << values[i].first << "=" << values[i].second;
+    }
+    return ss.str();
+}
+
+OranSweepRunner::OranSweepRunner()
+    : m_maxWorkers(0)
+{
+    NS_LOG_FUNCTION(this);
+
+    SetMaxWorkers(0);
+}
+
+void
+OranSweepRunner::AddAxis(const std::string& name, const std::vector<std::string>& values)
+{
+    NS_LOG_FUNCTION(this << name << values.size());
+
+    NS_ABORT_MSG_IF(values.empty(), "Sweep axis \"" << name << "\" has no values");
+
+    m_axes.emplace_back(name, values);
+}
+
+void
+OranSweepRunner::SetMaxWorkers(uint32_t maxWorkers)
+{
+    NS_LOG_FUNCTION(this << maxWorkers);
+
+    if (maxWorkers == 0)
+    {
+        maxWorkers = std::thread::hardware_concurrency();
+    }
+    m_maxWorkers = std::max<uint32_t>(maxWorkers, 1);
+}
+
+uint32_t
+OranSweepRunner::GetMaxWorkers() const
+{
+    return m_maxWorkers;
+}
+
+std::vector<OranSweepPoint>
+OranSweepRunner::GetPoints() const
+{
+    std::vector<OranSweepPoint> points(1);
+    for (const auto& axis : m_axes)
+    {
+        std::vector<OranSweepPoint> expanded;
+        expanded.reserve(points.size() * axis.second.size());
+        for (const auto& point : points)
+        {
+            for (const auto& value : axis.second)
+            {
+                OranSweepPoint next = point;
+                next.values.emplace_back(axis.first, value);
+                expanded.push_back(std::move(next));
+            }
+        }
+        points = std::move(expanded);
+    }
+
+    for (uint32_t i = 0; i < points.size(); i++)
+    {
+        points[i].index = i;
+    }
+    return points;
+}
+
+bool
+OranSweepRunner::ForkWorkers(OranSweepPoint& point)
+{
+    NS_LOG_FUNCTION(this);
+
+    const std::vector<OranSweepPoint> points = GetPoints();
+    m_exitStatus.assign(points.size(), -1);
+
+    // Anything still buffered would be written once by every worker.
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    std::map<pid_t, uint32_t> running;
+    uint32_t next = 0;
+    while (next < points.size() || !running.empty())
+    {
+        while (next < points.size() && running.size() < m_maxWorkers)
+        {
+            pid_t pid = fork();
+            NS_ABORT_MSG_IF(pid < 0, "Could not fork a sweep worker, errno=" << errno);
+            if (pid == 0)
+            {
+                point = points[next];
+                m_exitStatus.clear();
+                return true;
+            }
+
+            NS_LOG_INFO("Sweep worker " << pid << " runs " << points[next].ToString());
+            running.emplace(pid, next);
+            next++;
+        }
+
+        int status = 0;
+        pid_t pid = waitpid(-1, &status, 0);
+        if (pid < 0)
+        {
+            NS_ABORT_MSG_IF(errno != EINTR, "Could not wait for sweep workers, errno=" << errno);
+            continue;
+        }
+
+        auto it = running.find(pid);
+        if (it == running.end())
+        {
+            continue;
+        }
+
+        int exitStatus = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+        m_exitStatus[it->second] = exitStatus;
+        if (exitStatus != 0)
+        {
+            NS_LOG_WARN("Sweep point " << points[it->second].ToString() << " failed with status "
+                                       << exitStatus);
+        }
+        running.erase(it);
+    }
+
+    return false;
+}
+
+uint32_t
+OranSweepRunner::GetNFailed() const
+{
+    uint32_t nFailed = 0;
+    for (int exitStatus : m_exitStatus)
+    {
+        if (exitStatus != 0)
+        {
+            nFailed++;
+        }
+    }
+    return nFailed;
+}
+
+uint32_t
+OranSweepRunner::MergeCsv(const std::function<std::string(const OranSweepPoint&)>& pathOf,
+                          const std::string& outputPath) const
+{
+    NS_LOG_FUNCTION(this << outputPath);
+
+    std::ofstream out(outputPath.c_str());
+    NS_ABORT_MSG_IF(!out.is_open(), "Cannot open merged sweep output " << outputPath);
+
+    uint32_t nMerged = 0;
+    for (const auto& point : GetPoints())
+    {
+        if (point.index >= m_exitStatus.size() || m_exitStatus[point.index] != 0)
+        {
+            continue;
+        }
+
+        const std::string path = pathOf(point);
+        std::ifstream in(path.c_str());
+        std::string line;
+        if (!in.is_open() || !std::getline(in, line))
+        {
+            NS_LOG_WARN("Skipping missing sweep output " << path);
+            continue;
+        }
+
+        std::ostringstream prefix;
+        for (const auto& value : point.values)
+        {
+            prefix << value.second << ',';
+        }
+
+        if (nMerged == 0)
+        {
+            for (const auto& axis : m_axes)
+            {
+                out << axis.first << ',';
+            }
+            out << line << '\n';
+        }
+        while (std::getline(in, line))
+        {
+            if (!line.empty())
+            {
+                out << prefix.str() << line << '\n';
+            }
+        }
+        nMerged++;
+    }
+
+    return nMerged;
+}
+
+} // namespace ns3
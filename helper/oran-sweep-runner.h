@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_SWEEP_RUNNER_H
+#define ORAN_SWEEP_RUNNER_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * One point of a parameter sweep: a value for every axis of the sweep.
+ */
+struct OranSweepPoint
+{
+    uint32_t index = 0; //!< The index of the point in the sweep.
+    std::vector<std::pair<std::string, std::string>> values; //!< Axis name and value pairs.
+
+    /**
+     * Get the value of an axis. Aborts if the sweep has no such axis.
+     *
+     * @param name The name of the axis.
+     * @return The value.
+     */
+    const std::string& Get(const std::string& name) const;
+    /**
+     * @return The point formatted as "name1=value1,name2=value2".
+     */
+    std::string ToString() const;
+};
+
+/**
+ * @ingroup oran
+ *
+ * Runs a parameter sweep of a scenario in forked worker processes.
+ *
+ * The scenario's main() does its expensive setup that does not depend on
+ * the sweep point and then calls ForkWorkers(). The parent process forks
+ * one worker per sweep point, at most GetMaxWorkers() at a time, and the
+ * workers inherit the setup copy-on-write instead of redoing it.
+ * ForkWorkers() returns true in each worker with the point it must run, so
+ * the rest of main() runs the scenario for that point. In the parent, it
+ * returns false once every worker has exited, and the per-point outputs
+ * can be merged with MergeCsv().
+ *
+ * Safe to do before forking:
+ * - reading input files, e.g., topology files;
+ * - preloading ONNX models with OranOnnxModel::Preload(), which imports
+ *   them with the built-in engine and starts no threads. The Logic Modules
+ *   the workers create share the imported models, which are never
+ *   modified, each with its own scratch rows.
+ *
+ * Creating Nodes or other Objects before forking is safe too, but objects
+ * take automatically assigned random streams in creation order, so moving
+ * their creation ahead of the fork changes the results of the scenario
+ * compared to running it without a sweep.
+ *
+ * Not safe before forking:
+ * - starting the simulator;
+ * - creating random variables, since their streams take the run number
+ *   when they are created, and every worker would draw the same numbers;
+ * - creating threads, e.g., ONNX Runtime sessions, as a worker only
+ *   inherits the thread that forked it. Models the built-in engine does not
+ *   support are loaded by ONNX Runtime in each worker;
+ * - opening databases or output files, whose descriptors the workers
+ *   would share.
+ */
+class OranSweepRunner
+{
+  public:
+    /**
+     * Create an empty sweep that runs as many workers as there are cores.
+     */
+    OranSweepRunner();
+    /**
+     * Add an axis to the sweep. The points of the sweep are all the
+     * combinations of the axis values, with the last axis varying fastest.
+     *
+     * @param name The name of the axis.
+     * @param values The values of the axis.
+     */
+    void AddAxis(const std::string& name, const std::vector<std::string>& values);
+    /**
+     * Set the maximum number of workers running at the same time.
+     *
+     * @param maxWorkers The number of workers, or 0 for the number of cores.
+     */
+    void SetMaxWorkers(uint32_t maxWorkers);
+    /**
+     * @return The maximum number of workers running at the same time.
+     */
+    uint32_t GetMaxWorkers() const;
+    /**
+     * @return The points of the sweep.
+     */
+    std::vector<OranSweepPoint> GetPoints() const;
+    /**
+     * Fork a worker for every point of the sweep.
+     *
+     * @param point Set to the point to run, in a worker.
+     * @return True in a worker; false in the parent once all workers have
+     *         exited.
+     */
+    bool ForkWorkers(OranSweepPoint& point);
+    /**
+     * @return The number of points whose worker did not exit with status 0,
+     *         after ForkWorkers() returned in the parent.
+     */
+    uint32_t GetNFailed() const;
+    /**
+     * Merge the CSV files written by the workers into one file. The header
+     * is taken from the first file, and every line is prefixed with the
+     * values of the point that wrote it, in one column per axis. Points
+     * whose worker failed or whose file is missing are skipped.
+     *
+     * @param pathOf Returns the path of the CSV file written for a point.
+     * @param outputPath The path of the merged file.
+     * @return The number of files merged.
+     */
+    uint32_t MergeCsv(const std::function<std::string(const OranSweepPoint&)>& pathOf,
+                      const std::string& outputPath) const;
+
+  private:
+    /**
+     * The axes of the sweep, with their values.
+     */
+    std::vector<std::pair<std::string, std::vector<std::string>>> m_axes;
+    /**
+     * The maximum number of workers running at the same time.
+     */
+    uint32_t m_maxWorkers;
+    /**
+     * The exit status of the worker of each point, -1 until it has exited.
+     */
+    std::vector<int> m_exitStatus;
+}; // class OranSweepRunner
+
+} // namespace ns3
+
+#endif // ORAN_SWEEP_RUNNER_H
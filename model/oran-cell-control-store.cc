@@ -0,0 +1,200 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-cell-control-store.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranCellControlStore");
+
+NS_OBJECT_ENSURE_REGISTERED(OranCellControlStore);
+
+std::string
+CellControlParamsToString(const OranCellControlParams& params)
+{
+    std::ostringstream ss;
+    ss << "CIO=" << params.cioDb << ";TTT=" << params.tttSec << ";HYS=" << params.hysDb
+       << ";RET=" << params.retDeg;
+    return ss.str();
+}
+
+TypeId
+OranCellControlStore::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranCellControlStore")
+            .SetParent<Object>()
+            .AddConstructor<OranCellControlStore>()
+            .AddTraceSource("ParameterChanged",
+                            "Trace fired when a cell-control parameter is applied.",
+                            MakeTraceSourceAccessor(&OranCellControlStore::m_parameterChangedTrace),
+                            "ns3::OranCellControlStore::ParameterChangedTracedCallback");
+
+    return tid;
+}
+
+OranCellControlStore::OranCellControlStore()
+    : Object()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranCellControlStore::~OranCellControlStore()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+bool
+OranCellControlStore::Apply(uint64_t e2NodeId,
+                            OranCellControlParameter parameter,
+                            double value,
+                            bool isDelta)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << static_cast<uint32_t>(parameter) << value << isDelta);
+
+    if (parameter == OranCellControlParameter::UNKNOWN)
+    {
+        return false;
+    }
+
+    if (e2NodeId >= m_params.size())
+    {
+        m_params.resize(e2NodeId + 1);
+        m_written.resize(e2NodeId + 1, false);
+    }
+    m_written[e2NodeId] = true;
+
+    OranCellControlParams& params = m_params[e2NodeId];
+    double* target = nullptr;
+    switch (parameter)
+    {
+    case OranCellControlParameter::CIO:
+        target = &params.cioDb;
+        break;
+    case OranCellControlParameter::TTT:
+        target = &params.tttSec;
+        break;
+    case OranCellControlParameter::HYS:
+        target = &params.hysDb;
+        break;
+    default:
+        target = &params.retDeg;
+        break;
+    }
+
+    double oldValue = *target;
+    *target = isDelta ? *target + value : value;
+    m_parameterChangedTrace(e2NodeId, parameter, oldValue, *target);
+
+    return true;
+}
+
+const OranCellControlParams&
+OranCellControlStore::Get(uint64_t e2NodeId) const
+{
+    static const OranCellControlParams defaultParams;
+
+    return e2NodeId < m_params.size() ? m_params[e2NodeId] : defaultParams;
+}
+
+double
+OranCellControlStore::Get(uint64_t e2NodeId, OranCellControlParameter parameter) const
+{
+    const OranCellControlParams& params = Get(e2NodeId);
+    switch (parameter)
+    {
+    case OranCellControlParameter::CIO:
+        return params.cioDb;
+    case OranCellControlParameter::TTT:
+        return params.tttSec;
+    case OranCellControlParameter::HYS:
+        return params.hysDb;
+    case OranCellControlParameter::RET:
+        return params.retDeg;
+    default:
+        return 0.0;
+    }
+}
+
+std::map<uint64_t, OranCellControlParams>
+OranCellControlStore::GetAll() const
+{
+    std::map<uint64_t, OranCellControlParams> all;
+    for (uint64_t e2NodeId = 0; e2NodeId < m_params.size(); e2NodeId++)
+    {
+        if (m_written[e2NodeId])
+        {
+            all.emplace(e2NodeId, m_params[e2NodeId]);
+        }
+    }
+    return all;
+}
+
+void
+OranCellControlStore::Clear()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_params.clear();
+    m_written.clear();
+}
+
+void
+OranCellControlStore::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    const std::map<uint64_t, OranCellControlParams> all = GetAll();
+    os << all.size() << '\n' << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& [e2NodeId, params] : all)
+    {
+        os << e2NodeId << ' ' << params.cioDb << ' ' << params.tttSec << ' ' << params.hysDb << ' '
+           << params.retDeg << '\n';
+    }
+}
+
+void
+OranCellControlStore::RestoreState(std::istream& is)
+{
+    NS_LOG_FUNCTION(this);
+
+    std::size_t n = 0;
+    is >> n;
+    Clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t e2NodeId = 0;
+        OranCellControlParams params;
+        is >> e2NodeId >> params.cioDb >> params.tttSec >> params.hysDb >> params.retDeg;
+        NS_ABORT_MSG_IF(is.fail(), "Malformed cell-control parameters in checkpoint");
+
+        m_params.resize(std::max<std::size_t>(m_params.size(), e2NodeId + 1));
+        m_written.resize(m_params.size(), false);
+        m_params[e2NodeId] = params;
+        m_written[e2NodeId] = true;
+    }
+}
+
+void
+OranCellControlStore::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Clear();
+
+    Object::DoDispose();
+}
+
+} // namespace ns3
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_CELL_CONTROL_STORE_H
+#define ORAN_CELL_CONTROL_STORE_H
+
+#include "oran-command-payload.h"
+
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The cell-control parameters of one cell.
+ */
+struct OranCellControlParams
+{
+    double cioDb = 0.0;  //!< Cell individual offset (dB).
+    double tttSec = 0.0; //!< Time to trigger (s).
+    double hysDb = 0.0;  //!< Handover hysteresis (dB).
+    double retDeg = 0.0; //!< Remote electrical tilt (degrees).
+};
+
+/**
+ * @param params The parameters.
+ * @return The parameters formatted as "CIO=..;TTT=..;HYS=..;RET=..".
+ */
+std::string CellControlParamsToString(const OranCellControlParams& params);
+
+/**
+ * @ingroup oran
+ *
+ * The cell-control parameters (see OranCellControlParameter) applied to the
+ * cells of one Near-RT RIC. The E2 Node Terminators of the cells write to it
+ * when they receive cell-parameter commands, and the Logic Modules and
+ * Conflict Mitigation Modules of the RIC read from it.
+ *
+ * The parameters are kept in a dense array indexed by E2 Node ID, which the
+ * data repository assigns sequentially, so reading the parameters of a cell
+ * is a bounds check and an index. Cells that were never written read as all
+ * zero.
+ */
+class OranCellControlStore : public Object
+{
+  public:
+    /**
+     * Get the TypeId of the OranCellControlStore class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranCellControlStore class.
+     */
+    OranCellControlStore();
+    /**
+     * Destructor of the OranCellControlStore class.
+     */
+    ~OranCellControlStore() override;
+    /**
+     * Set or adjust a parameter of a cell.
+     *
+     * @param e2NodeId The E2 Node ID of the cell.
+     * @param parameter The parameter.
+     * @param value The value, or the delta if isDelta is true.
+     * @param isDelta Whether value is added to the current value.
+     * @return False if the parameter is OranCellControlParameter::UNKNOWN;
+     *         otherwise, true.
+     */
+    bool Apply(uint64_t e2NodeId, OranCellControlParameter parameter, double value, bool isDelta);
+    /**
+     * Get the parameters of a cell.
+     *
+     * @param e2NodeId The E2 Node ID of the cell.
+     * @return The parameters. The reference is valid until the next call to
+     *         Apply or Clear.
+     */
+    const OranCellControlParams& Get(uint64_t e2NodeId) const;
+    /**
+     * Get one parameter of a cell.
+     *
+     * @param e2NodeId The E2 Node ID of the cell.
+     * @param parameter The parameter.
+     * @return The value, or 0 for OranCellControlParameter::UNKNOWN.
+     */
+    double Get(uint64_t e2NodeId, OranCellControlParameter parameter) const;
+    /**
+     * Get the parameters of every cell that was written.
+     *
+     * @return The parameters, indexed by E2 Node ID.
+     */
+    std::map<uint64_t, OranCellControlParams> GetAll() const;
+    /**
+     * Reset the parameters of every cell.
+     */
+    void Clear();
+    /**
+     * Write the parameters of every cell that was written to a checkpoint of
+     * the Near-RT RIC.
+     *
+     * @param os The stream to write to.
+     */
+    void SaveState(std::ostream& os) const;
+    /**
+     * Replace the parameters of every cell with the ones written by SaveState.
+     *
+     * @param is The stream to read from.
+     */
+    void RestoreState(std::istream& is);
+
+    /**
+     * TracedCallback signature for parameter changes.
+     *
+     * @param [in] e2NodeId The E2 Node ID of the cell.
+     * @param [in] parameter The parameter.
+     * @param [in] oldValue The value before the change.
+     * @param [in] newValue The value after the change.
+     */
+    typedef void (*ParameterChangedTracedCallback)(uint64_t e2NodeId,
+                                                   OranCellControlParameter parameter,
+                                                   double oldValue,
+                                                   double newValue);
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * The parameters of each cell, indexed by E2 Node ID.
+     */
+    std::vector<OranCellControlParams> m_params;
+    /**
+     * Whether each entry of m_params was written.
+     */
+    std::vector<bool> m_written;
+    /**
+     * Fired every time a parameter is applied.
+     */
+    TracedCallback<uint64_t, OranCellControlParameter, double, double> m_parameterChangedTrace;
+}; // class OranCellControlStore
+
+} // namespace ns3
+
+#endif // ORAN_CELL_CONTROL_STORE_H
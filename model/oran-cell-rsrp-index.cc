@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-cell-rsrp-index.h"
+
+namespace ns3
+{
+
+void
+OranCellRsrpIndex::UpdateServingCell(uint64_t ueId, uint16_t cellId, Time t)
+{
+    UeEntry& ue = m_ues[ueId];
+    if (ue.hasCell && t < ue.cellTime)
+    {
+        return;
+    }
+
+    ue.active = true;
+    ue.hasCell = true;
+    ue.cellId = cellId;
+    ue.cellTime = t;
+    Reindex(ue);
+}
+
+void
+OranCellRsrpIndex::UpdateRsrp(uint64_t ueId, Time t, uint16_t cellId, double rsrp)
+{
+    UeEntry& ue = m_ues[ueId];
+    if (!ue.rsrp.empty() && t < ue.rsrpTime)
+    {
+        return;
+    }
+
+    if (ue.rsrp.empty() || t > ue.rsrpTime)
+    {
+        ue.rsrp.clear();
+        ue.rsrpTime = t;
+    }
+    ue.active = true;
+    ue.rsrp.emplace_back(cellId, rsrp);
+    Reindex(ue);
+}
+
+void
+OranCellRsrpIndex::Suspend(uint64_t ueId)
+{
+    auto it = m_ues.find(ueId);
+    if (it != m_ues.end())
+    {
+        it->second.active = false;
+        Reindex(it->second);
+    }
+}
+
+std::tuple<bool, double>
+OranCellRsrpIndex::GetWorstServingRsrp(uint16_t cellId) const
+{
+    auto it = m_cells.find(cellId);
+    if (it == m_cells.end() || it->second.empty())
+    {
+        return std::make_tuple(false, 0.0);
+    }
+    return std::make_tuple(true, *it->second.begin());
+}
+
+void
+OranCellRsrpIndex::Clear()
+{
+    m_ues.clear();
+    m_cells.clear();
+}
+
+void
+OranCellRsrpIndex::Reindex(UeEntry& ue)
+{
+    bool found = false;
+    double worst = 0.0;
+    if (ue.active && ue.hasCell)
+    {
+        for (const auto& row : ue.rsrp)
+        {
+            if (row.first == ue.cellId && (!found || row.second < worst))
+            {
+                worst = row.second;
+                found = true;
+            }
+        }
+    }
+
+    if (ue.indexed && found && ue.indexedCell == ue.cellId && ue.indexedRsrp == worst)
+    {
+        return;
+    }
+
+    if (ue.indexed)
+    {
+        auto cellIt = m_cells.find(ue.indexedCell);
+        cellIt->second.erase(cellIt->second.find(ue.indexedRsrp));
+        if (cellIt->second.empty())
+        {
+            m_cells.erase(cellIt);
+        }
+        ue.indexed = false;
+    }
+
+    if (found)
+    {
+        m_cells[ue.cellId].insert(worst);
+        ue.indexed = true;
+        ue.indexedCell = ue.cellId;
+        ue.indexedRsrp = worst;
+    }
+}
+
+} // namespace ns3
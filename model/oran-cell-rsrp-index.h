@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_CELL_RSRP_INDEX_H
+#define ORAN_CELL_RSRP_INDEX_H
+
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Incremental per-cell index of the worst RSRP reported by served UEs.
+ *
+ * Kept by the data repository alongside the stored UE cell info and RSRP
+ * reports so that the worst serving-cell RSRP of a cell can be read without
+ * scanning every UE. For each UE it keeps the latest serving cell and the
+ * RSRP rows of its latest report time, mirroring what GetLteUeCellInfo() and
+ * GetLteUeRsrpRsrq() would return. The UE contributes the lowest RSRP it
+ * reports for its serving cell, and each cell keeps a sorted multiset of its
+ * UEs' contributions, so updates are O(log n) and queries O(1).
+ */
+class OranCellRsrpIndex
+{
+  public:
+    /**
+     * Records the cell a UE is attached to.
+     *
+     * \param ueId The E2 Node ID of the UE.
+     * \param cellId The serving cell ID.
+     * \param t The time of the report. Older reports than the latest one are
+     *          ignored.
+     */
+    void UpdateServingCell(uint64_t ueId, uint16_t cellId, Time t);
+    /**
+     * Records one RSRP row of a UE measurement report. Rows with a newer time
+     * replace the UE's previous rows; rows with the same time are added to
+     * them; older rows are ignored.
+     *
+     * \param ueId The E2 Node ID of the UE.
+     * \param t The time of the report.
+     * \param cellId The measured cell ID.
+     * \param rsrp The RSRP of the measured cell.
+     */
+    void UpdateRsrp(uint64_t ueId, Time t, uint16_t cellId, double rsrp);
+    /**
+     * Stops counting a UE, e.g. when it is deregistered. The UE counts again
+     * the next time it reports.
+     *
+     * \param ueId The E2 Node ID of the UE.
+     */
+    void Suspend(uint64_t ueId);
+    /**
+     * Gets the lowest RSRP a UE served by the cell reports for that cell.
+     *
+     * \param cellId The cell ID.
+     * \return A tuple with a boolean indicating if any UE served by the cell
+     *         reported it, and the lowest RSRP.
+     */
+    std::tuple<bool, double> GetWorstServingRsrp(uint16_t cellId) const;
+    /**
+     * Removes all entries.
+     */
+    void Clear();
+
+  private:
+    /**
+     * The latest data known for one UE.
+     */
+    struct UeEntry
+    {
+        bool active = true;        //!< Whether the UE is counted.
+        bool hasCell = false;      //!< Whether a serving cell was reported.
+        uint16_t cellId = 0;       //!< The serving cell ID.
+        Time cellTime;             //!< The time of the serving cell report.
+        Time rsrpTime;             //!< The time of the RSRP rows.
+        std::vector<std::pair<uint16_t, double>> rsrp; //!< Cell ID and RSRP rows.
+        bool indexed = false;      //!< Whether the UE is in m_cells.
+        uint16_t indexedCell = 0;  //!< The cell the UE is indexed under.
+        double indexedRsrp = 0.0;  //!< The RSRP the UE is indexed with.
+    };
+
+    /**
+     * Moves the UE's contribution in m_cells to match its latest data.
+     *
+     * \param ue The UE.
+     */
+    void Reindex(UeEntry& ue);
+
+    std::unordered_map<uint64_t, UeEntry> m_ues;                //!< Entries by UE ID.
+    std::unordered_map<uint16_t, std::multiset<double>> m_cells; //!< Contributions by cell.
+};
+
+} // namespace ns3
+
+#endif // ORAN_CELL_RSRP_INDEX_H
@@ -0,0 +1,118 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-cell-slots.h"
+
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace ns3
+{
+
+void
+OranCellSlots::Assign(const std::vector<Vector>& positions,
+                      std::size_t numSlots,
+                      std::size_t neighbourCount)
+{
+    NS_ABORT_MSG_IF(numSlots == 0, "A model needs at least one cell slot");
+
+    const std::size_t numCells = positions.size();
+    neighbourCount = std::max(neighbourCount, numSlots - 1);
+
+    m_numSlots = numSlots;
+    m_slotCells.assign(numCells * numSlots, {});
+
+    std::vector<std::pair<double, std::size_t>> others;
+    for (std::size_t cell = 0; cell < numCells; ++cell)
+    {
+        others.clear();
+        for (std::size_t other = 0; other < numCells; ++other)
+        {
+            if (other != cell)
+            {
+                double dx = positions[other].x - positions[cell].x;
+                double dy = positions[other].y - positions[cell].y;
+                others.emplace_back(dx * dx + dy * dy, other);
+            }
+        }
+        std::size_t count = numSlots > 1 ? std::min(neighbourCount, others.size()) : 0;
+        std::partial_sort(others.begin(), others.begin() + count, others.end());
+
+        // The nearest neighbours get a slot each and the others share the last one.
+        std::vector<std::vector<std::size_t>> groups;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (groups.size() < numSlots - 1)
+            {
+                groups.push_back({others[i].second});
+            }
+            else
+            {
+                groups.back().push_back(others[i].second);
+            }
+        }
+        std::sort(groups.begin(), groups.end(), [](const auto& a, const auto& b) {
+            return *std::min_element(a.begin(), a.end()) < *std::min_element(b.begin(), b.end());
+        });
+
+        std::vector<std::size_t>* slots = &m_slotCells[cell * numSlots];
+        std::size_t ownSlot = GetOwnSlot(cell);
+        slots[ownSlot].push_back(cell);
+        std::size_t slot = 0;
+        for (auto& group : groups)
+        {
+            slot += slot == ownSlot ? 1 : 0;
+            slots[slot++] = std::move(group);
+        }
+    }
+}
+
+std::size_t
+OranCellSlots::GetNumSlots() const
+{
+    return m_numSlots;
+}
+
+std::size_t
+OranCellSlots::GetOwnSlot(std::size_t cell) const
+{
+    return cell % m_numSlots;
+}
+
+void
+OranCellSlots::Pool(std::size_t cell,
+                    const std::vector<float>& features,
+                    const std::vector<float>& empty,
+                    float* row) const
+{
+    const std::size_t size = empty.size();
+    for (std::size_t slot = 0; slot < m_numSlots; ++slot)
+    {
+        const std::vector<std::size_t>& cells = m_slotCells[cell * m_numSlots + slot];
+        float* out = row + slot * size;
+        if (cells.empty())
+        {
+            std::copy(empty.begin(), empty.end(), out);
+            continue;
+        }
+        std::fill(out, out + size, 0.0f);
+        for (std::size_t other : cells)
+        {
+            for (std::size_t f = 0; f < size; ++f)
+            {
+                out[f] += features[other * size + f];
+            }
+        }
+        for (std::size_t f = 0; f < size; ++f)
+        {
+            out[f] /= static_cast<float>(cells.size());
+        }
+    }
+}
+
+} // namespace ns3
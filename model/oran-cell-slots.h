@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_CELL_SLOTS_H
+#define ORAN_CELL_SLOTS_H
+
+#include "ns3/vector.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Maps any number of cells onto the fixed cell slots of a model.
+ *
+ * The DQN models of the Logic Modules were trained on a fixed number of
+ * cells, with the features of every cell in its own slot of the input row.
+ * To run such a model on a network of any size, every cell gets its own
+ * input row, in which it sits in slot (cell index % slots), and the other
+ * slots hold its neighbours: the nearest ones one per slot, and the
+ * features of the remaining nearest neighbours, up to the neighbour count,
+ * averaged into the last slot. The neighbour slots are filled in ascending
+ * cell index order, so that when there are as many cells as slots every row
+ * is the row the model was trained on, and the output for a cell is read
+ * from its own slot. Slots left without a neighbour in smaller networks
+ * hold the features given for an empty slot.
+ *
+ * The rows of all the cells can then be run as one batch.
+ */
+class OranCellSlots
+{
+  public:
+    /**
+     * Computes the neighbours of every cell.
+     *
+     * \param positions The positions of the cells, in model order. Cells at
+     *                  the same distance are taken in index order.
+     * \param numSlots The number of cell slots of the model.
+     * \param neighbourCount The number of nearest neighbours put in the
+     *                       other slots. At least numSlots - 1 are used.
+     */
+    void Assign(const std::vector<Vector>& positions,
+                std::size_t numSlots,
+                std::size_t neighbourCount);
+    /**
+     * \return The number of cell slots.
+     */
+    std::size_t GetNumSlots() const;
+    /**
+     * Gets the slot in which a cell sits in its own row.
+     *
+     * \param cell The index of the cell.
+     * \return The slot.
+     */
+    std::size_t GetOwnSlot(std::size_t cell) const;
+    /**
+     * Fills the cell slots of the row of a cell.
+     *
+     * \param cell The index of the cell.
+     * \param features The features of every cell, one cell after the other.
+     * \param empty The features of an empty slot, which also give the
+     *              number of features of a cell.
+     * \param row Set to the features of every slot, one slot after the other.
+     */
+    void Pool(std::size_t cell,
+              const std::vector<float>& features,
+              const std::vector<float>& empty,
+              float* row) const;
+
+  private:
+    std::size_t m_numSlots = 0; //!< The number of cell slots.
+    /**
+     * The cells in every slot of the row of every cell, at index
+     * cell * m_numSlots + slot.
+     */
+    std::vector<std::vector<std::size_t>> m_slotCells;
+};
+
+} // namespace ns3
+
+#endif // ORAN_CELL_SLOTS_H
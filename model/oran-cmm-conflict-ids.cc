@@ -0,0 +1,154 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-cmm-conflict-ids.h"
+
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <bitset>
+
+namespace ns3
+{
+
+OranConflictIdTable::Id
+OranConflictIdTable::Intern(const std::string& name)
+{
+    auto it = m_ids.find(name);
+    if (it != m_ids.end())
+    {
+        return it->second;
+    }
+
+    NS_ABORT_MSG_IF(m_names.size() >= kMaxIds,
+                    "Conflict ID table is full (" << kMaxIds << " IDs); cannot intern \""
+                                                  << name << "\"");
+
+    Id id = static_cast<Id>(m_names.size());
+    m_names.push_back(name);
+    m_ids.emplace(name, id);
+    return id;
+}
+
+OranConflictIdTable::Id
+OranConflictIdTable::Find(const std::string& name) const
+{
+    auto it = m_ids.find(name);
+    return it == m_ids.end() ? kInvalidId : it->second;
+}
+
+const std::string&
+OranConflictIdTable::GetName(Id id) const
+{
+    NS_ABORT_MSG_IF(id >= m_names.size(), "Unknown conflict ID " << +id);
+    return m_names[id];
+}
+
+uint32_t
+OranConflictIdTable::GetN() const
+{
+    return m_names.size();
+}
+
+std::vector<std::string>
+OranConflictIdTable::GetNames(Mask mask) const
+{
+    std::vector<std::string> names;
+    for (Id id = 0; id < m_names.size(); id++)
+    {
+        if (mask & Bit(id))
+        {
+            names.push_back(m_names[id]);
+        }
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+std::set<std::string>
+OranConflictIdTable::GetNameSet(Mask mask) const
+{
+    std::vector<std::string> names = GetNames(mask);
+    return std::set<std::string>(names.begin(), names.end());
+}
+
+OranConflictIdTable::Mask
+OranConflictIdTable::Bit(Id id)
+{
+    return Mask(1) << id;
+}
+
+uint32_t
+OranConflictIdTable::Count(Mask mask)
+{
+    return std::bitset<kMaxIds>(mask).count();
+}
+
+void
+OranIcpCellCounters::Record(OranConflictIdTable::Id icp, OranConflictIdTable::Id role)
+{
+    counts[icp]++;
+    actors[icp] |= OranConflictIdTable::Bit(role);
+}
+
+void
+OranIcpCellCounters::RecordUnknown(OranConflictIdTable::Id role)
+{
+    unknownCount++;
+    unknownActors |= OranConflictIdTable::Bit(role);
+}
+
+void
+OranIcpCellCounters::ResetCounts()
+{
+    counts.fill(0);
+    unknownCount = 0;
+}
+
+void
+OranIcpCellCounters::ResetActors()
+{
+    actors.fill(0);
+    unknownActors = 0;
+}
+
+std::map<std::string, uint32_t>
+OranIcpCellCounters::GetCounts(const OranConflictIdTable& icps) const
+{
+    std::map<std::string, uint32_t> out;
+    for (OranConflictIdTable::Id icp = 0; icp < icps.GetN(); icp++)
+    {
+        if (counts[icp] > 0)
+        {
+            out[icps.GetName(icp)] = counts[icp];
+        }
+    }
+    if (unknownCount > 0)
+    {
+        out[kUnknownIcp] = unknownCount;
+    }
+    return out;
+}
+
+std::map<std::string, std::set<std::string>>
+OranIcpCellCounters::GetActors(const OranConflictIdTable& icps,
+                               const OranConflictIdTable& roles) const
+{
+    std::map<std::string, std::set<std::string>> out;
+    for (OranConflictIdTable::Id icp = 0; icp < icps.GetN(); icp++)
+    {
+        if (actors[icp] != 0)
+        {
+            out[icps.GetName(icp)] = roles.GetNameSet(actors[icp]);
+        }
+    }
+    if (unknownActors != 0)
+    {
+        out[kUnknownIcp] = roles.GetNameSet(unknownActors);
+    }
+    return out;
+}
+
+} // namespace ns3
@@ -0,0 +1,129 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_CMM_CONFLICT_IDS_H
+#define ORAN_CMM_CONFLICT_IDS_H
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Interning table mapping xApp role and ICP names to small dense IDs.
+ *
+ * Used by the conflict triage CMMs so that Filter() can keep per-cell
+ * bookkeeping in flat arrays indexed by ID, and sets of roles or ICPs as a
+ * single bitmask word, instead of nested string-keyed maps. IDs are handed
+ * out in insertion order starting at zero and are bounded by kMaxIds.
+ */
+class OranConflictIdTable
+{
+  public:
+    typedef uint8_t Id;   //!< Dense identifier, in [0, kMaxIds).
+    typedef uint32_t Mask; //!< Bitmask of IDs, bit i set for ID i.
+
+    static constexpr uint32_t kMaxIds = 32;  //!< Capacity of the table (bits in a Mask).
+    static constexpr Id kInvalidId = 0xff;   //!< Returned by Find() for unknown names.
+
+    /**
+     * Returns the ID for the name, assigning the next free one if the name
+     * has not been seen before. Aborts if the table is full.
+     */
+    Id Intern(const std::string& name);
+    /**
+     * Returns the ID for the name, or kInvalidId if it was never interned.
+     */
+    Id Find(const std::string& name) const;
+    /**
+     * Returns the name the ID was interned from.
+     */
+    const std::string& GetName(Id id) const;
+    /**
+     * Returns the number of IDs handed out so far.
+     */
+    uint32_t GetN() const;
+    /**
+     * Returns the names of every ID set in the mask, sorted the same way a
+     * std::set<std::string> of them would iterate.
+     */
+    std::vector<std::string> GetNames(Mask mask) const;
+    /**
+     * Returns the names of every ID set in the mask as a set.
+     */
+    std::set<std::string> GetNameSet(Mask mask) const;
+
+    /**
+     * Returns the mask with only the bit for the given ID set.
+     */
+    static Mask Bit(Id id);
+    /**
+     * Returns the number of IDs set in the mask.
+     */
+    static uint32_t Count(Mask mask);
+
+  private:
+    std::vector<std::string> m_names;           //!< Name of each ID, indexed by ID.
+    std::unordered_map<std::string, Id> m_ids;  //!< ID of each name.
+};
+
+/**
+ * \brief Per-cell ICP command counters kept by the conflict triage CMMs.
+ *
+ * One counter and one actor bitmask per ICP ID, so recording a command is
+ * two array writes. Converted back to the string-keyed maps the scenario
+ * scripts poll only when GetCounts() / GetActors() are called. An ICP with
+ * a zero count (or an empty actor mask) is treated as absent.
+ */
+struct OranIcpCellCounters
+{
+    std::array<uint32_t, OranConflictIdTable::kMaxIds> counts{}; //!< Commands per ICP.
+    std::array<OranConflictIdTable::Mask, OranConflictIdTable::kMaxIds>
+        actors{}; //!< Role IDs that issued a command, per ICP.
+    uint32_t unknownCount = 0;                   //!< Commands for unrecognised parameters.
+    OranConflictIdTable::Mask unknownActors = 0; //!< Role IDs that issued them.
+
+    static constexpr const char* kUnknownIcp = "UNKNOWN"; //!< Key of unrecognised parameters.
+
+    /**
+     * Records one command for the ICP issued by the role.
+     */
+    void Record(OranConflictIdTable::Id icp, OranConflictIdTable::Id role);
+    /**
+     * Records one command for a parameter that is not an ICP, issued by the
+     * role. These are reported under kUnknownIcp rather than interned.
+     */
+    void RecordUnknown(OranConflictIdTable::Id role);
+    /**
+     * Zeroes the command counts, leaving the actors.
+     */
+    void ResetCounts();
+    /**
+     * Clears the actors, leaving the command counts.
+     */
+    void ResetActors();
+    /**
+     * Returns the nonzero command counts keyed by ICP name, with commands
+     * for unrecognised parameters under kUnknownIcp.
+     */
+    std::map<std::string, uint32_t> GetCounts(const OranConflictIdTable& icps) const;
+    /**
+     * Returns the issuing role names keyed by ICP name, for ICPs with any,
+     * with the issuers of unrecognised parameters under kUnknownIcp.
+     */
+    std::map<std::string, std::set<std::string>> GetActors(
+        const OranConflictIdTable& icps,
+        const OranConflictIdTable& roles) const;
+};
+
+} // namespace ns3
+
+#endif // ORAN_CMM_CONFLICT_IDS_H
@@ -0,0 +1,381 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-cmm-conflict-policy.h"
+
+#include "oran-conflict-policy-default.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranCmmConflictPolicy");
+
+static const std::string kUnknownRole = "Unknown";
+
+OranCmmConflictPolicy::OranCmmConflictPolicy()
+{
+    LoadDefaults();
+}
+
+void
+OranCmmConflictPolicy::Clear()
+{
+    m_roles = OranConflictIdTable();
+    m_icps = OranConflictIdTable();
+    m_kpis = OranConflictIdTable();
+    m_rolePatterns.clear();
+    m_rolePriority.clear();
+    m_unknownRole = OranConflictIdTable::kInvalidId;
+    m_icpOwners.fill(0);
+    m_icpKpis.fill(0);
+    m_icpKpiManagers.fill(0);
+    m_kpiManager.clear();
+    for (uint32_t i = 0; i < OranConflictIdTable::kMaxIds; i++)
+    {
+        m_icpKpiOrder[i].clear();
+        m_icpKpiManagerList[i].clear();
+    }
+    m_detectImplicit = false;
+}
+
+void
+OranCmmConflictPolicy::LoadDefaults()
+{
+    std::istringstream in(kOranDefaultConflictPolicy);
+    Load(in, "built-in conflict policy");
+}
+
+void
+OranCmmConflictPolicy::LoadFile(const std::string& path)
+{
+    std::ifstream in(path);
+    NS_ABORT_MSG_IF(!in.is_open(), "Could not open conflict policy file \"" << path << "\"");
+    Load(in, path);
+}
+
+void
+OranCmmConflictPolicy::Load(std::istream& in, const std::string& source)
+{
+    struct RoleDecl
+    {
+        std::string name;
+        int priority;
+        std::vector<std::string> patterns;
+    };
+
+    std::vector<RoleDecl> roles;
+    std::map<std::string, std::vector<std::string>> owners;
+    std::vector<std::pair<std::string, std::vector<std::string>>> influences;
+    std::vector<std::pair<std::string, std::vector<std::string>>> manages;
+    bool detectImplicit = false;
+
+    std::string line;
+    uint32_t lineNo = 0;
+    while (std::getline(in, line))
+    {
+        lineNo++;
+        line = line.substr(0, line.find('#'));
+        std::istringstream tokens(line);
+        std::string directive;
+        if (!(tokens >> directive))
+        {
+            continue;
+        }
+
+        std::vector<std::string> args;
+        for (std::string arg; tokens >> arg;)
+        {
+            args.push_back(arg);
+        }
+
+        if (directive == "role")
+        {
+            NS_ABORT_MSG_IF(args.size() < 2,
+                            source << ":" << lineNo
+                                   << ": expected 'role <name> <priority> [<lm-pattern> ...]'");
+            RoleDecl decl;
+            decl.name = args[0];
+            std::istringstream priority(args[1]);
+            NS_ABORT_MSG_IF(!(priority >> decl.priority) || !priority.eof(),
+                            source << ":" << lineNo << ": invalid priority \"" << args[1]
+                                   << "\"");
+            decl.patterns.assign(args.begin() + 2, args.end());
+            for (const auto& other : roles)
+            {
+                NS_ABORT_MSG_IF(other.name == decl.name,
+                                source << ":" << lineNo << ": role \"" << decl.name
+                                       << "\" declared twice");
+            }
+            roles.push_back(decl);
+        }
+        else if (directive == "icp")
+        {
+            NS_ABORT_MSG_IF(args.empty(),
+                            source << ":" << lineNo << ": expected 'icp <name> [<role> ...]'");
+            NS_ABORT_MSG_IF(owners.count(args[0]),
+                            source << ":" << lineNo << ": ICP \"" << args[0]
+                                   << "\" declared twice");
+            owners[args[0]].assign(args.begin() + 1, args.end());
+        }
+        else if (directive == "influences" || directive == "manages")
+        {
+            NS_ABORT_MSG_IF(args.size() < 2,
+                            source << ":" << lineNo << ": expected '" << directive
+                                   << " <name> <kpi> [<kpi> ...]'");
+            auto& target = directive == "influences" ? influences : manages;
+            target.emplace_back(args[0], std::vector<std::string>(args.begin() + 1, args.end()));
+        }
+        else if (directive == "detect")
+        {
+            NS_ABORT_MSG_IF(args.size() != 1 || args[0] != "implicit",
+                            source << ":" << lineNo << ": expected 'detect implicit'");
+            detectImplicit = true;
+        }
+        else
+        {
+            NS_ABORT_MSG(source << ":" << lineNo << ": unknown directive \"" << directive << "\"");
+        }
+    }
+
+    NS_ABORT_MSG_IF(!owners.count("TxPower"),
+                    source << ": the TxPower ICP must be declared");
+
+    // ── Compile ──────────────────────────────────────────────────────────────
+    Clear();
+    m_detectImplicit = detectImplicit;
+
+    int lowestPriority = -1;
+    for (const auto& decl : roles)
+    {
+        m_roles.Intern(decl.name);
+        m_rolePatterns.push_back(decl.patterns);
+        m_rolePriority.push_back(decl.priority);
+        lowestPriority = std::max(lowestPriority, decl.priority);
+    }
+    m_unknownRole = m_roles.Find(kUnknownRole);
+    if (m_unknownRole == OranConflictIdTable::kInvalidId)
+    {
+        m_unknownRole = m_roles.Intern(kUnknownRole);
+        m_rolePatterns.emplace_back();
+        m_rolePriority.push_back(lowestPriority + 1);
+    }
+
+    auto findRole = [this, &source](const std::string& role) {
+        Id id = m_roles.Find(role);
+        NS_ABORT_MSG_IF(id == OranConflictIdTable::kInvalidId,
+                        source << ": undeclared role \"" << role << "\"");
+        return id;
+    };
+
+    // std::map iterates lexicographically, which fixes the ICP ID order.
+    for (const auto& entry : owners)
+    {
+        Id icp = m_icps.Intern(entry.first);
+        for (const auto& owner : entry.second)
+        {
+            m_icpOwners[icp] |= OranConflictIdTable::Bit(findRole(owner));
+        }
+    }
+
+    std::vector<Id> kpiManager;
+    auto internKpi = [this, &kpiManager](const std::string& kpi) {
+        Id id = m_kpis.Intern(kpi);
+        if (id >= kpiManager.size())
+        {
+            kpiManager.resize(id + 1, OranConflictIdTable::kInvalidId);
+        }
+        return id;
+    };
+
+    for (const auto& entry : influences)
+    {
+        for (const auto& kpi : entry.second)
+        {
+            internKpi(kpi);
+        }
+    }
+    for (const auto& entry : manages)
+    {
+        Id role = findRole(entry.first);
+        for (const auto& kpi : entry.second)
+        {
+            Id id = internKpi(kpi);
+            NS_ABORT_MSG_IF(kpiManager[id] != OranConflictIdTable::kInvalidId &&
+                                kpiManager[id] != role,
+                            source << ": KPI \"" << kpi << "\" is managed by both \""
+                                   << m_roles.GetName(kpiManager[id]) << "\" and \""
+                                   << entry.first << "\"");
+            kpiManager[id] = role;
+        }
+    }
+
+    for (const auto& entry : influences)
+    {
+        Id icp = m_icps.Find(entry.first);
+        NS_ABORT_MSG_IF(icp == OranConflictIdTable::kInvalidId,
+                        source << ": undeclared ICP \"" << entry.first << "\"");
+        for (const auto& kpi : entry.second)
+        {
+            Id id = m_kpis.Find(kpi);
+            Id manager = kpiManager[id];
+            m_icpKpiOrder[icp].push_back(id);
+            m_icpKpis[icp] |= OranConflictIdTable::Bit(id);
+            m_icpKpiManagerList[icp].push_back(manager);
+            if (manager != OranConflictIdTable::kInvalidId)
+            {
+                m_icpKpiManagers[icp] |= OranConflictIdTable::Bit(manager);
+            }
+        }
+    }
+
+    m_kpiManager = kpiManager;
+
+    NS_LOG_INFO("Loaded conflict policy from " << source << ": " << m_roles.GetN() << " roles, "
+                                               << m_icps.GetN() << " ICPs, " << m_kpis.GetN()
+                                               << " KPIs");
+}
+
+OranCmmConflictPolicy::Id
+OranCmmConflictPolicy::ClassifyLm(const std::string& lmName) const
+{
+    for (Id role = 0; role < m_rolePatterns.size(); role++)
+    {
+        for (const auto& pattern : m_rolePatterns[role])
+        {
+            if (lmName.find(pattern) != std::string::npos)
+            {
+                return role;
+            }
+        }
+    }
+    return m_unknownRole;
+}
+
+int
+OranCmmConflictPolicy::GetPriority(Id role) const
+{
+    return m_rolePriority.at(role);
+}
+
+const OranConflictIdTable&
+OranCmmConflictPolicy::GetRoles() const
+{
+    return m_roles;
+}
+
+const OranConflictIdTable&
+OranCmmConflictPolicy::GetIcps() const
+{
+    return m_icps;
+}
+
+OranCmmConflictPolicy::Id
+OranCmmConflictPolicy::InternIcp(const std::string& icp)
+{
+    return m_icps.Intern(icp);
+}
+
+OranCmmConflictPolicy::Mask
+OranCmmConflictPolicy::GetOwners(Id icp) const
+{
+    return m_icpOwners[icp];
+}
+
+OranCmmConflictPolicy::Mask
+OranCmmConflictPolicy::GetKpiManagers(Id icp) const
+{
+    return m_icpKpiManagers[icp];
+}
+
+const std::vector<OranCmmConflictPolicy::Id>&
+OranCmmConflictPolicy::GetKpiManagerList(Id icp) const
+{
+    return m_icpKpiManagerList[icp];
+}
+
+OranCmmConflictPolicy::Mask
+OranCmmConflictPolicy::GetManagers(Mask kpis) const
+{
+    Mask managers = 0;
+    for (Id kpi = 0; kpi < m_kpiManager.size(); kpi++)
+    {
+        if ((kpis & OranConflictIdTable::Bit(kpi)) &&
+            m_kpiManager[kpi] != OranConflictIdTable::kInvalidId)
+        {
+            managers |= OranConflictIdTable::Bit(m_kpiManager[kpi]);
+        }
+    }
+    return managers;
+}
+
+std::vector<std::string>
+OranCmmConflictPolicy::GetIcpKpiNames(Id icp) const
+{
+    std::vector<std::string> names;
+    for (Id kpi : m_icpKpiOrder[icp])
+    {
+        names.push_back(m_kpis.GetName(kpi));
+    }
+    return names;
+}
+
+std::vector<std::string>
+OranCmmConflictPolicy::GetKpiNames(Mask kpis) const
+{
+    std::vector<std::string> names;
+    for (Id kpi = 0; kpi < m_kpis.GetN(); kpi++)
+    {
+        if (kpis & OranConflictIdTable::Bit(kpi))
+        {
+            names.push_back(m_kpis.GetName(kpi));
+        }
+    }
+    return names;
+}
+
+bool
+OranCmmConflictPolicy::IsImplicitDetectionEnabled() const
+{
+    return m_detectImplicit;
+}
+
+std::vector<OranCmmConflictPolicy::ImplicitConflict>
+OranCmmConflictPolicy::DetectImplicit(
+    const std::array<Mask, OranConflictIdTable::kMaxIds>& issuersByIcp) const
+{
+    std::vector<ImplicitConflict> conflicts;
+    for (Id a = 0; a < m_icps.GetN(); a++)
+    {
+        if (issuersByIcp[a] == 0 || m_icpOwners[a] == 0)
+        {
+            continue;
+        }
+        for (Id b = a + 1; b < m_icps.GetN(); b++)
+        {
+            if (issuersByIcp[b] == 0 || m_icpOwners[b] == 0)
+            {
+                continue;
+            }
+            Mask roles = issuersByIcp[a] | issuersByIcp[b];
+            Mask shared = m_icpKpis[a] & m_icpKpis[b];
+            if (shared != 0 && OranConflictIdTable::Count(roles) > 1)
+            {
+                conflicts.push_back(ImplicitConflict{a, b, roles, shared});
+            }
+        }
+    }
+    return conflicts;
+}
+
+} // namespace ns3
@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_CMM_CONFLICT_POLICY_H
+#define ORAN_CMM_CONFLICT_POLICY_H
+
+#include "oran-cmm-conflict-ids.h"
+
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Compiled xApp / ICP / KPI conflict graph used by the triage CMMs.
+ *
+ * Replaces the hard-coded LM-name matching and the static P2X / P2K / K2X
+ * tables with a policy read from a small line-based text file, so a new
+ * xApp or ICP is a config edit rather than a code change. Each line is one
+ * directive; '#' starts a comment:
+ *
+ *   role <name> <priority> [<lm-name-substring> ...]
+ *       Declares an xApp role. Lower priority wins. An LM whose name
+ *       contains one of the substrings maps to this role; roles are tried
+ *       in declaration order and the first match wins.
+ *   icp <name> [<owner-role> ...]
+ *       Declares an ICP and the roles that own (control) it (P2X).
+ *   influences <icp> <kpi> [<kpi> ...]
+ *       KPIs the ICP directly influences (P2K), in display order.
+ *   manages <role> <kpi> [<kpi> ...]
+ *       KPIs the role is responsible for (K2X).
+ *   detect implicit
+ *       Also report Implicit conflicts (see DetectImplicit()).
+ *
+ * LMs that match no role map to the implicit "Unknown" role, ranked below
+ * every declared role. The "TxPower" ICP must be declared since the CMMs
+ * arbitrate it directly.
+ *
+ * After loading, names are interned (ICPs in lexicographic order) and the
+ * graph is compiled to per-ICP role bitmasks, so conflict classification in
+ * Filter() is a handful of mask operations independent of name lengths.
+ */
+class OranCmmConflictPolicy
+{
+  public:
+    typedef OranConflictIdTable::Id Id;     //!< Role, ICP, or KPI ID.
+    typedef OranConflictIdTable::Mask Mask; //!< Set of role, ICP, or KPI IDs.
+
+    /**
+     * An Implicit conflict: two ICPs of the same cell set by different
+     * roles in one cycle that influence a common KPI.
+     */
+    struct ImplicitConflict
+    {
+        Id icpA;   //!< First ICP.
+        Id icpB;   //!< Second ICP (icpA < icpB).
+        Mask roles; //!< Roles that issued either ICP.
+        Mask kpis;  //!< KPIs both ICPs influence.
+    };
+
+    /**
+     * Constructs a policy holding the built-in defaults.
+     */
+    OranCmmConflictPolicy();
+
+    /**
+     * Replaces the policy with the built-in defaults, which reproduce the
+     * four-xApp (ES, CCO, MRO, MLB) scenario tables. The defaults are
+     * examples/oran-conflict-policy.conf, compiled in at build time.
+     */
+    void LoadDefaults();
+    /**
+     * Replaces the policy with the contents of the file. Aborts on a
+     * missing file or malformed directive.
+     *
+     * \param path The policy file.
+     */
+    void LoadFile(const std::string& path);
+    /**
+     * Replaces the policy with directives read from the stream.
+     *
+     * \param in The directives.
+     * \param source Name used in error messages.
+     */
+    void Load(std::istream& in, const std::string& source);
+
+    /**
+     * Returns the role an LM maps to, by LM name.
+     */
+    Id ClassifyLm(const std::string& lmName) const;
+    /**
+     * Returns the priority rank of a role (lower = higher priority).
+     */
+    int GetPriority(Id role) const;
+    /**
+     * Returns the interned role names.
+     */
+    const OranConflictIdTable& GetRoles() const;
+    /**
+     * Returns the interned ICP names.
+     */
+    const OranConflictIdTable& GetIcps() const;
+    /**
+     * Returns the ID for an ICP name, interning names the policy does not
+     * declare. Undeclared ICPs have no owners and are never classified.
+     */
+    Id InternIcp(const std::string& icp);
+    /**
+     * Returns the roles that own the ICP (P2X), or 0 if it is undeclared.
+     */
+    Mask GetOwners(Id icp) const;
+    /**
+     * Returns the roles managing any KPI the ICP influences (P2K then K2X).
+     */
+    Mask GetKpiManagers(Id icp) const;
+    /**
+     * Returns the managing role of each KPI the ICP influences, in P2K
+     * order, with OranConflictIdTable::kInvalidId for unmanaged KPIs.
+     */
+    const std::vector<Id>& GetKpiManagerList(Id icp) const;
+    /**
+     * Returns the roles managing any of the KPIs in the mask (K2X).
+     */
+    Mask GetManagers(Mask kpis) const;
+    /**
+     * Returns the names of the KPIs the ICP influences, in P2K order.
+     */
+    std::vector<std::string> GetIcpKpiNames(Id icp) const;
+    /**
+     * Returns the names of the KPIs in the mask, in declaration order.
+     */
+    std::vector<std::string> GetKpiNames(Mask kpis) const;
+    /**
+     * Returns true if the policy asks for Implicit conflict detection.
+     */
+    bool IsImplicitDetectionEnabled() const;
+    /**
+     * Finds Implicit conflicts among the ICPs set on one cell this cycle.
+     *
+     * \param issuersByIcp Roles that issued each ICP, indexed by ICP ID.
+     * \return One entry per conflicting ICP pair.
+     */
+    std::vector<ImplicitConflict> DetectImplicit(
+        const std::array<Mask, OranConflictIdTable::kMaxIds>& issuersByIcp) const;
+
+  private:
+    /**
+     * Clears all state.
+     */
+    void Clear();
+
+    OranConflictIdTable m_roles; //!< Role names.
+    OranConflictIdTable m_icps;  //!< ICP names.
+    OranConflictIdTable m_kpis;  //!< KPI names.
+    std::vector<std::vector<std::string>> m_rolePatterns; //!< LM-name substrings per role.
+    std::vector<int> m_rolePriority;                      //!< Priority per role.
+    Id m_unknownRole;                                     //!< ID of the "Unknown" role.
+    std::array<Mask, OranConflictIdTable::kMaxIds> m_icpOwners;      //!< P2X.
+    std::array<Mask, OranConflictIdTable::kMaxIds> m_icpKpis;        //!< P2K.
+    std::array<Mask, OranConflictIdTable::kMaxIds> m_icpKpiManagers; //!< P2K then K2X.
+    std::array<std::vector<Id>, OranConflictIdTable::kMaxIds> m_icpKpiOrder; //!< P2K, ordered.
+    std::array<std::vector<Id>, OranConflictIdTable::kMaxIds>
+        m_icpKpiManagerList;        //!< Manager per P2K entry.
+    std::vector<Id> m_kpiManager; //!< Managing role per KPI (K2X).
+    bool m_detectImplicit;   //!< Whether Implicit conflicts are reported.
+};
+
+} // namespace ns3
+
+#endif // ORAN_CMM_CONFLICT_POLICY_H
@@ -5,13 +5,18 @@
  */
 #include "oran-cmm-conflict-triage-nr.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-nr-2-nr-cell-parameter.h"
 #include "oran-command-nr-2-nr-handover.h"
 #include "oran-command-nr-2-nr-tx-power.h"
 #include "oran-command.h"
 #include "oran-data-repository.h"
+#include "oran-lm-nr-2-nr-kpi-prediction.h"
 #include "oran-near-rt-ric.h"
-#include "oran-nr-cell-control-state.h"
+#include "oran-report-location.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
 #include "ns3/double.h"
@@ -19,11 +24,13 @@
 #include "ns3/nstime.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/type-id.h"
 #include "ns3/uinteger.h"
 #include "ns3/vector.h"
 
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
 #include <limits>
 #include <map>
 #include <set>
@@ -37,28 +44,6 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("OranCmmConflictTriageNr");
 NS_OBJECT_ENSURE_REGISTERED(OranCmmConflictTriageNr);
 
-// ── CDC relationship tables (Algorithm 1 from Computer Networks manuscript) ──
-static const std::map<std::string, std::set<std::string>> kP2X = {
-    {"TxPower", {"ES", "MRO", "CCO", "MLB"}},
-    {"CIO",     {"MRO", "MLB"}},
-    {"TTT",     {"MRO", "MLB"}},
-    {"RET",     {"CCO", "MLB"}},
-};
-
-static const std::map<std::string, std::vector<std::string>> kP2K = {
-    {"TxPower", {"RSRP", "SINR", "Throughput", "EE", "CDR", "HSR"}},
-    {"CIO",     {"CDR", "HSR", "TL", "RSRP-bias"}},
-    {"TTT",     {"CDR", "HSR", "TL"}},
-    {"RET",     {"RSRP", "SINR", "CDR", "HSR"}},
-};
-
-static const std::map<std::string, std::string> kK2X = {
-    {"EE",        "ES"},
-    {"SINR",      "CCO"}, {"Throughput", "CCO"}, {"RSRP", "CCO"},
-    {"CDR",       "MRO"}, {"HSR",        "MRO"}, {"CBR",  "MRO"}, {"RSRP-bias", "MRO"},
-    {"TL",        "MLB"}, {"RUR",        "MLB"},
-};
-
 static double
 Distance2d(const Vector& a, const Vector& b)
 {
@@ -160,6 +145,20 @@ OranCmmConflictTriageNr::GetTypeId()
                           DoubleValue(3.0),
                           MakeDoubleAccessor(&OranCmmConflictTriageNr::m_rsrpPathlossExponent),
                           MakeDoubleChecker<double>(1.0, 6.0))
+            .AddAttribute("PredictorLmType",
+                          "Type of the KPI-prediction Logic Module whose TX power increases "
+                          "gate Energy Saving reductions when Method is proactive-gate. "
+                          "LMs of this type or a subclass of it count as predictors.",
+                          TypeIdValue(OranLmNr2NrKpiPrediction::GetTypeId()),
+                          MakeTypeIdAccessor(&OranCmmConflictTriageNr::m_predictorLmType),
+                          MakeTypeIdChecker())
+            .AddAttribute("PolicyFile",
+                          "Path to the conflict policy file declaring xApp roles, priorities, "
+                          "ICP owners, and ICP/KPI relationships (empty = built-in defaults). "
+                          "Loaded when the CMM is activated.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranCmmConflictTriageNr::m_policyFile),
+                          MakeStringChecker())
             .AddAttribute("ConflictLogFile",
                           "Path to CDC CSV output file (empty = disabled). "
                           "Columns: time_s,enb_e2id,icp,type,conflicting,affected,winner.",
@@ -174,6 +173,8 @@ OranCmmConflictTriageNr::OranCmmConflictTriageNr()
 {
     NS_LOG_FUNCTION(this);
     m_name = "CmmConflictTriageNr";
+    m_txPowerIcp = m_policy.GetIcps().Find("TxPower");
+    m_esRole     = m_policy.GetRoles().Find("ES");
 }
 
 OranCmmConflictTriageNr::~OranCmmConflictTriageNr()
@@ -181,29 +182,81 @@ OranCmmConflictTriageNr::~OranCmmConflictTriageNr()
     NS_LOG_FUNCTION(this);
 }
 
+void
+OranCmmConflictTriageNr::Activate()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_policyFile.empty())
+        m_policy.LoadDefaults();
+    else
+        m_policy.LoadFile(m_policyFile);
+
+    // Role and ICP IDs may have changed; re-resolve LMs on next sight.
+    m_lmInfo.clear();
+    m_txPowerIcp = m_policy.GetIcps().Find("TxPower");
+    m_esRole     = m_policy.GetRoles().Find("ES");
+
+    OranCmm::Activate();
+}
+
+void
+OranCmmConflictTriageNr::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    // Sorted, so that the same state always gives the same checkpoint.
+    std::map<uint64_t, ConflictRecord> sorted(m_txpConflicts.begin(), m_txpConflicts.end());
+    os << sorted.size() << '\n' << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& [e2NodeId, rec] : sorted)
+    {
+        os << e2NodeId << ' ' << rec.persistenceCount << ' ' << rec.deferCount << ' '
+           << rec.harmfulCount << ' ' << rec.benignCount << ' ' << rec.lastSeverity << '\n';
+    }
+}
+
+void
+OranCmmConflictTriageNr::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+
+    std::size_t n = 0;
+    is >> n;
+    m_txpConflicts.clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t e2NodeId = 0;
+        ConflictRecord rec;
+        is >> e2NodeId >> rec.persistenceCount >> rec.deferCount >> rec.harmfulCount >>
+            rec.benignCount >> rec.lastSeverity;
+        NS_ABORT_MSG_IF(is.fail(), "Malformed conflict records in checkpoint for " << m_name);
+        m_txpConflicts[e2NodeId] = rec;
+    }
+}
+
 std::map<std::string, uint32_t>
 OranCmmConflictTriageNr::GetAndResetIcpCounts(uint64_t e2NodeId)
 {
-    auto it = m_icpCounts.find(e2NodeId);
-    if (it == m_icpCounts.end())
+    auto it = m_icpCounters.find(e2NodeId);
+    if (it == m_icpCounters.end())
     {
         return {};
     }
-    std::map<std::string, uint32_t> counts = it->second;
-    m_icpCounts.erase(it);
+    std::map<std::string, uint32_t> counts = it->second.GetCounts(m_policy.GetIcps());
+    it->second.ResetCounts();
     return counts;
 }
 
 std::map<std::string, std::set<std::string>>
 OranCmmConflictTriageNr::GetAndResetIcpActors(uint64_t e2NodeId)
 {
-    auto it = m_icpActors.find(e2NodeId);
-    if (it == m_icpActors.end())
+    auto it = m_icpCounters.find(e2NodeId);
+    if (it == m_icpCounters.end())
     {
         return {};
     }
-    std::map<std::string, std::set<std::string>> actors = it->second;
-    m_icpActors.erase(it);
+    std::map<std::string, std::set<std::string>> actors = it->second.GetActors(m_policy.GetIcps(), m_policy.GetRoles());
+    it->second.ResetActors();
     return actors;
 }
 
@@ -221,20 +274,6 @@ OranCmmConflictTriageNr::GetAndResetConflictEvents(uint64_t e2NodeId)
 }
 
 // ── CDC helpers ───────────────────────────────────────────────────────────────
-std::string
-OranCmmConflictTriageNr::LmToXappRole(const std::string& lmName) const
-{
-    if (lmName.find("EnergySaving")         != std::string::npos) return "ES";
-    if (lmName.find("CoverageCapacity")      != std::string::npos) return "CCO";
-    if (lmName.find("OnnxCco")               != std::string::npos) return "CCO";
-    if (lmName.find("KpiPrediction")         != std::string::npos) return "CCO";  // proactive ≡ CCO role
-    if (lmName.find("RsrpHandover")          != std::string::npos) return "MRO";
-    if (lmName.find("OnnxMro")               != std::string::npos) return "MRO";
-    if (lmName.find("MobilityLoadBalancing") != std::string::npos) return "MLB";
-    if (lmName.find("OnnxMlb")               != std::string::npos) return "MLB";
-    return "Unknown";
-}
-
 void
 OranCmmConflictTriageNr::EmitConflictEvent(uint64_t          enbE2Id,
                                             const std::string& icp,
@@ -262,10 +301,13 @@ OranCmmConflictTriageNr::EmitConflictEvent(uint64_t          enbE2Id,
         oss << "]";
     }
     oss << " kpis=[";
-    auto pit = kP2K.find(icp);
-    if (pit != kP2K.end())
-        for (size_t i = 0; i < pit->second.size(); i++)
-            oss << (i ? "," : "") << pit->second[i];
+    OranConflictIdTable::Id icpId = m_policy.GetIcps().Find(icp);
+    if (icpId != OranConflictIdTable::kInvalidId)
+    {
+        std::vector<std::string> kpis = m_policy.GetIcpKpiNames(icpId);
+        for (size_t i = 0; i < kpis.size(); i++)
+            oss << (i ? "," : "") << kpis[i];
+    }
     oss << "] winner=" << winnerRole;
 
     std::cout << oss.str() << "\n";
@@ -294,26 +336,18 @@ OranCmmConflictTriageNr::EmitConflictEvent(uint64_t          enbE2Id,
     }
 }
 
-int
-OranCmmConflictTriageNr::LmPriority(const std::string& lmName) const
+const OranCmmConflictTriageNr::LmInfo&
+OranCmmConflictTriageNr::ResolveLm(const std::string& lmName)
 {
-    if (lmName.find("RsrpHandover") != std::string::npos)
-        return 0; // MRO
-    if (lmName.find("OnnxMro") != std::string::npos)
-        return 0; // MRO (ONNX)
-    if (lmName.find("CoverageCapacity") != std::string::npos)
-        return 1; // CCO
-    if (lmName.find("OnnxCco") != std::string::npos)
-        return 1; // CCO (ONNX)
-    if (lmName.find("KpiPrediction") != std::string::npos)
-        return 1; // Proactive predictor — same priority as CCO
-    if (lmName.find("MobilityLoadBalancing") != std::string::npos)
-        return 2; // MLB
-    if (lmName.find("OnnxMlb") != std::string::npos)
-        return 2; // MLB (ONNX)
-    if (lmName.find("EnergySaving") != std::string::npos)
-        return 3; // ES
-    return 4; // unknown → lowest priority
+    auto it = m_lmInfo.find(lmName);
+    if (it == m_lmInfo.end())
+    {
+        LmInfo info;
+        info.role     = m_policy.ClassifyLm(lmName);
+        info.priority = m_policy.GetPriority(info.role);
+        it = m_lmInfo.emplace(lmName, info).first;
+    }
+    return it->second;
 }
 
 double
@@ -345,23 +379,11 @@ OranCmmConflictTriageNr::GetWorstServingRsrpForEnb(uint64_t e2NodeId) const
     if (!foundCell)
         return kRsrpQosThresholdDbm - 1.0;
 
+    // The repository keeps this per cell as RSRP reports arrive, so the
+    // lookup does not depend on how many UEs are registered.
+    bool hasRsrp = false;
     double worstRsrp = 0.0;
-    bool   hasRsrp   = false;
-    for (auto ueId : data->GetNrUeE2NodeIds())
-    {
-        bool ufound = false; uint16_t ueCell = 0, ueRnti = 0;
-        std::tie(ufound, ueCell, ueRnti) = data->GetNrUeCellInfo(ueId);
-        if (!ufound || ueCell != cellId)
-            continue;
-        for (const auto& meas : data->GetNrUeRsrpRsrq(ueId))
-        {
-            uint16_t r = 0, c = 0; double rsrp = 0.0, rsrq = 0.0;
-            bool serving = false; uint8_t ccid = 0;
-            std::tie(r, c, rsrp, rsrq, serving, ccid) = meas;
-            if (c != cellId) continue;
-            if (!hasRsrp || rsrp < worstRsrp) { worstRsrp = rsrp; hasRsrp = true; }
-        }
-    }
+    std::tie(hasRsrp, worstRsrp) = data->GetNrCellWorstServingRsrp(cellId);
     return hasRsrp ? worstRsrp : (kRsrpQosThresholdDbm - 1.0);
 }
 
@@ -456,7 +478,7 @@ OranCmmConflictTriageNr::PredictFutureCellState(uint64_t e2NodeId, double propos
         if (!foundCell)
             continue;
 
-        auto posHist = data->GetNodePositions(gnbId, Seconds(0), now, 1);
+        auto posHist = data->GetNodePositions(gnbId, Time::Min(), now, 1);
         if (posHist.empty())
             continue;
         cellToE2[cellId] = gnbId;
@@ -472,7 +494,7 @@ OranCmmConflictTriageNr::PredictFutureCellState(uint64_t e2NodeId, double propos
     uint32_t totalUes = 0;
     for (auto ueId : data->GetNrUeE2NodeIds())
     {
-        const Time from = now.GetSeconds() > m_positionLookbackSec ? now - lookback : Seconds(0);
+        const Time from = now - lookback;
         auto uePosHist = data->GetNodePositions(ueId, from, now, 2);
         if (uePosHist.empty())
             continue;
@@ -535,7 +557,7 @@ OranCmmConflictTriageNr::PredictFutureCellState(uint64_t e2NodeId, double propos
             if (candidateE2 == e2NodeId)
                 predictedRsrp += proposedDeltaDb;
 
-            const OranNrCellControlParams cp = GetNrCellControlParameters(candidateE2);
+            const OranCellControlParams cp = m_nearRtRic->GetCellControlStore()->Get(candidateE2);
             const double effectiveRsrp = predictedRsrp + cp.cioDb;
             if (effectiveRsrp > bestEffectiveRsrp)
             {
@@ -578,59 +600,47 @@ OranCmmConflictTriageNr::ComputeNoisyOr(const std::vector<double>& evidence) con
 
 double
 OranCmmConflictTriageNr::ComputeStructuralIcpEvidence(
-    const std::string& icp,
-    const std::string& issuingRole,
-    const std::set<std::string>& activeRoles) const
+    OranConflictIdTable::Id icp,
+    OranConflictIdTable::Id issuingRole,
+    OranConflictIdTable::Mask activeRoles) const
 {
-    auto it = kP2X.find(icp);
-    if (it == kP2X.end())
-        return 0.0;
-
-    uint32_t competingActiveOwners = 0;
-    uint32_t possibleCompetingOwners = 0;
-    for (const auto& owner : it->second)
-    {
-        if (owner == issuingRole)
-            continue;
-        possibleCompetingOwners++;
-        if (activeRoles.count(owner))
-            competingActiveOwners++;
-    }
+    OranConflictIdTable::Mask competing =
+        m_policy.GetOwners(icp) & ~OranConflictIdTable::Bit(issuingRole);
 
+    uint32_t possibleCompetingOwners = OranConflictIdTable::Count(competing);
     if (possibleCompetingOwners == 0)
         return 0.0;
+    uint32_t competingActiveOwners = OranConflictIdTable::Count(competing & activeRoles);
     return static_cast<double>(competingActiveOwners) / possibleCompetingOwners;
 }
 
 double
-OranCmmConflictTriageNr::ComputeKpiEvidence(const std::string& icp,
-                                            const std::string& issuingRole,
-                                            const std::set<std::string>& activeRoles) const
+OranCmmConflictTriageNr::ComputeKpiEvidence(OranConflictIdTable::Id icp,
+                                            OranConflictIdTable::Id issuingRole,
+                                            OranConflictIdTable::Mask activeRoles) const
 {
-    auto it = kP2K.find(icp);
-    if (it == kP2K.end() || it->second.empty())
+    const auto& kpiRoles = m_policy.GetKpiManagerList(icp);
+    if (kpiRoles.empty())
         return 0.0;
 
     uint32_t affectedManagedKpis = 0;
-    for (const auto& kpi : it->second)
+    for (OranConflictIdTable::Id managingRole : kpiRoles)
     {
-        auto xit = kK2X.find(kpi);
-        if (xit == kK2X.end())
+        if (managingRole == OranConflictIdTable::kInvalidId)
             continue;
-        const std::string& managingRole = xit->second;
-        if (managingRole != issuingRole && activeRoles.count(managingRole))
+        if (managingRole != issuingRole && (activeRoles & OranConflictIdTable::Bit(managingRole)))
             affectedManagedKpis++;
     }
-    return static_cast<double>(affectedManagedKpis) / it->second.size();
+    return static_cast<double>(affectedManagedKpis) / kpiRoles.size();
 }
 
 double
 OranCmmConflictTriageNr::ComputeProactiveConflictLikelihood(
     uint64_t e2NodeId,
-    const std::string& issuingRole,
-    const std::string& icp,
+    OranConflictIdTable::Id issuingRole,
+    OranConflictIdTable::Id icp,
     double proposedDeltaDb,
-    const std::set<std::string>& activeRoles,
+    OranConflictIdTable::Mask activeRoles,
     std::vector<double>* evidenceOut) const
 {
     std::vector<double> evidence;
@@ -679,27 +689,32 @@ OranCmmConflictTriageNr::ComputeProactiveConflictLikelihood(
     return structuralPrior * pRuntime;
 }
 
+bool
+OranCmmConflictTriageNr::IsPredictor(const OranLmCommandSlot& entry) const
+{
+    return entry.lm != nullptr && entry.lm->GetInstanceTypeId().IsChildOf(m_predictorLmType);
+}
+
 // ── Main Filter ───────────────────────────────────────────────────────────────
 std::vector<Ptr<OranCommand>>
-OranCmmConflictTriageNr::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmConflictTriageNr::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
     NS_ABORT_MSG_IF(m_nearRtRic == nullptr,
                     "Attempting to run ConflictTriageNr CMM with NULL Near-RT RIC");
 
-    std::set<std::string> allActiveRoles;
+    OranConflictIdTable::Mask allActiveRoles = 0;
     for (const auto& entry : inputCommands)
-        allActiveRoles.insert(LmToXappRole(std::get<0>(entry.first)));
+        allActiveRoles |= OranConflictIdTable::Bit(ResolveLm(entry.lmName).role);
 
     if (m_method == "proactive-gate")
     {
         std::set<uint64_t> predictorTargets;
         for (const auto& entry : inputCommands)
         {
-            if (std::get<0>(entry.first).find("KpiPrediction") == std::string::npos)
+            if (!IsPredictor(entry))
                 continue;
-            for (auto cmd : entry.second)
+            for (const auto& cmd : entry.commands)
             {
                 Ptr<OranCommandNr2NrTxPower> txp = cmd->GetObject<OranCommandNr2NrTxPower>();
                 if (txp && txp->GetPowerDeltaDb() > 0.0)
@@ -709,9 +724,9 @@ OranCmmConflictTriageNr::Filter(
         uint32_t suppressed = 0;
         for (auto& entry : inputCommands)
         {
-            if (LmToXappRole(std::get<0>(entry.first)) != "ES")
+            if (ResolveLm(entry.lmName).role != m_esRole)
                 continue;
-            auto& cmds = entry.second;
+            auto& cmds = entry.commands;
             cmds.erase(
                 std::remove_if(cmds.begin(), cmds.end(),
                     [this, &predictorTargets, &suppressed](Ptr<OranCommand> cmd) {
@@ -737,15 +752,16 @@ OranCmmConflictTriageNr::Filter(
         uint32_t priorSuppressed = 0;
         for (auto& entry : inputCommands)
         {
-            const std::string role = LmToXappRole(std::get<0>(entry.first));
-            if (role != "ES")
+            const OranConflictIdTable::Id roleId = ResolveLm(entry.lmName).role;
+            if (roleId != m_esRole)
                 continue;
+            const std::string& role = m_policy.GetRoles().GetName(roleId);
 
-            auto& cmds = entry.second;
+            auto& cmds = entry.commands;
             cmds.erase(
                 std::remove_if(cmds.begin(),
                                cmds.end(),
-                               [this, &allActiveRoles, &priorSuppressed, role](Ptr<OranCommand> cmd) {
+                               [this, allActiveRoles, &priorSuppressed, roleId, &role](Ptr<OranCommand> cmd) {
                                    Ptr<OranCommandNr2NrTxPower> txp =
                                        cmd->GetObject<OranCommandNr2NrTxPower>();
                                    if (!txp || txp->GetPowerDeltaDb() >= 0.0)
@@ -754,8 +770,8 @@ OranCmmConflictTriageNr::Filter(
                                    std::vector<double> evidence;
                                    double likelihood = ComputeProactiveConflictLikelihood(
                                        txp->GetTargetE2NodeId(),
-                                       role,
-                                       "TxPower",
+                                       roleId,
+                                       m_txPowerIcp,
                                        txp->GetPowerDeltaDb(),
                                        allActiveRoles,
                                        &evidence);
@@ -779,12 +795,8 @@ OranCmmConflictTriageNr::Filter(
                                        std::cout << msg.str() << "\n";
                                        NS_LOG_INFO(msg.str());
                                        LogLogicToStorage(msg.str());
-                                       std::vector<std::string> affected;
-                                       for (const auto& activeRole : allActiveRoles)
-                                       {
-                                           if (activeRole != role)
-                                               affected.push_back(activeRole);
-                                       }
+                                       std::vector<std::string> affected = m_policy.GetRoles().GetNames(
+                                           allActiveRoles & ~OranConflictIdTable::Bit(roleId));
                                        EmitConflictEvent(txp->GetTargetE2NodeId(),
                                                          "TxPower",
                                                          "Prevented",
@@ -824,11 +836,16 @@ OranCmmConflictTriageNr::Filter(
         }
     }
 
-    std::map<uint64_t, std::vector<std::pair<std::string, Ptr<OranCommandNr2NrTxPower>>>>
-        txpByNode;
+    struct TxpEntry
+    {
+        const std::string* lmName;
+        LmInfo lm;
+        Ptr<OranCommandNr2NrTxPower> cmd;
+    };
+
+    std::map<uint64_t, std::vector<TxpEntry>> txpByNode;
 
-    std::map<std::pair<uint64_t, std::string>,
-             std::vector<std::pair<std::string, Ptr<OranCommandNr2NrCellParameter>>>>
+    std::map<std::pair<uint64_t, OranConflictIdTable::Id>, OranConflictIdTable::Mask>
         cellParamByNodeAndParam;
 
     std::vector<Ptr<OranCommand>> passThrough;
@@ -836,9 +853,10 @@ OranCmmConflictTriageNr::Filter(
     double nowCmdLog = Simulator::Now().GetSeconds();
     for (const auto& entry : inputCommands)
     {
-        const std::string& lmName = std::get<0>(entry.first);
-        const std::string  role   = LmToXappRole(lmName);
-        for (auto cmd : entry.second)
+        const std::string& lmName = entry.lmName;
+        const LmInfo       lm     = ResolveLm(lmName);
+        const std::string& role   = m_policy.GetRoles().GetName(lm.role);
+        for (const auto& cmd : entry.commands)
         {
             uint64_t e2id = cmd->GetTargetE2NodeId();
             Ptr<OranCommandNr2NrTxPower> txp = cmd->GetObject<OranCommandNr2NrTxPower>();
@@ -850,9 +868,8 @@ OranCmmConflictTriageNr::Filter(
                           << " icp=TxPower"
                           << " delta=" << std::showpos << txp->GetPowerDeltaDb()
                           << std::noshowpos << "\n";
-                txpByNode[e2id].emplace_back(lmName, txp);
-                m_icpCounts[e2id]["TxPower"]++;
-                m_icpActors[e2id]["TxPower"].insert(role);
+                txpByNode[e2id].push_back(TxpEntry{&lmName, lm, txp});
+                m_icpCounters[e2id].Record(m_txPowerIcp, lm.role);
             }
             else
             {
@@ -865,10 +882,25 @@ OranCmmConflictTriageNr::Filter(
                               << " xapp=" << role
                               << " icp=" << cp->GetParameterName()
                               << " value=" << cp->GetValue() << "\n";
-                    auto key = std::make_pair(e2id, cp->GetParameterName());
-                    cellParamByNodeAndParam[key].emplace_back(lmName, cp);
-                    m_icpCounts[e2id][cp->GetParameterName()]++;
-                    m_icpActors[e2id][cp->GetParameterName()].insert(role);
+                    // Intern the canonical name, so that names differing only
+                    // in case are one ICP. Unknown names are not ICPs, and
+                    // interning them could exhaust the ID table, so they are
+                    // only counted together.
+                    if (cp->GetParameter() != OranCellControlParameter::UNKNOWN)
+                    {
+                        OranConflictIdTable::Id icp = m_policy.InternIcp(
+                            CellControlParameterToString(cp->GetParameter()));
+                        cellParamByNodeAndParam[std::make_pair(e2id, icp)] |=
+                            OranConflictIdTable::Bit(lm.role);
+                        m_icpCounters[e2id].Record(icp, lm.role);
+                    }
+                    else
+                    {
+                        NS_LOG_WARN("Unrecognised cell parameter \""
+                                    << cp->GetParameterName() << "\" from " << lmName
+                                    << " for E2 node " << e2id);
+                        m_icpCounters[e2id].RecordUnknown(lm.role);
+                    }
                 }
                 passThrough.push_back(cmd);
             }
@@ -885,7 +917,7 @@ OranCmmConflictTriageNr::Filter(
         if (cmds.size() <= 1)
         {
             for (auto& pr : cmds)
-                result.push_back(pr.second);
+                result.push_back(pr.cmd);
             if (m_txpConflicts.count(e2NodeId))
             {
                 m_txpConflicts[e2NodeId].persistenceCount = 0;
@@ -894,13 +926,13 @@ OranCmmConflictTriageNr::Filter(
             continue;
         }
 
-        std::set<std::string> txpRoles;
+        OranConflictIdTable::Mask txpRoles = 0;
         for (auto& pr : cmds)
-            txpRoles.insert(LmToXappRole(pr.first));
-        if (txpRoles.size() <= 1)
+            txpRoles |= OranConflictIdTable::Bit(pr.lm.role);
+        if (OranConflictIdTable::Count(txpRoles) <= 1)
         {
             for (auto& pr : cmds)
-                result.push_back(pr.second);
+                result.push_back(pr.cmd);
             if (m_txpConflicts.count(e2NodeId))
             {
                 m_txpConflicts[e2NodeId].persistenceCount = 0;
@@ -913,7 +945,7 @@ OranCmmConflictTriageNr::Filter(
         double posSum = 0.0;
         for (auto& pr : cmds)
         {
-            double d = pr.second->GetPowerDeltaDb();
+            double d = pr.cmd->GetPowerDeltaDb();
             if (d < 0.0) negSum += d;
             else          posSum += d;
         }
@@ -928,15 +960,15 @@ OranCmmConflictTriageNr::Filter(
         {
             std::vector<std::string> conflictingRoles;
             int bestPriCdc = std::numeric_limits<int>::max();
-            std::string winnerLmCdc;
+            OranConflictIdTable::Id winnerRoleCdc = 0;
             for (auto& pr : cmds)
             {
-                conflictingRoles.push_back(LmToXappRole(pr.first));
-                int pri = LmPriority(pr.first);
-                if (pri < bestPriCdc) { bestPriCdc = pri; winnerLmCdc = pr.first; }
+                conflictingRoles.push_back(m_policy.GetRoles().GetName(pr.lm.role));
+                int pri = pr.lm.priority;
+                if (pri < bestPriCdc) { bestPriCdc = pri; winnerRoleCdc = pr.lm.role; }
             }
             EmitConflictEvent(e2NodeId, "TxPower", "Direct",
-                              conflictingRoles, {}, LmToXappRole(winnerLmCdc));
+                              conflictingRoles, {}, m_policy.GetRoles().GetName(winnerRoleCdc));
         }
 
         std::ostringstream msg;
@@ -956,8 +988,8 @@ OranCmmConflictTriageNr::Filter(
             Ptr<OranCommandNr2NrTxPower> esCmd = nullptr;
             for (auto& pr : cmds)
             {
-                int pri = LmPriority(pr.first);
-                if (pri > worstPri) { worstPri = pri; esCmd = pr.second; }
+                int pri = pr.lm.priority;
+                if (pri > worstPri) { worstPri = pri; esCmd = pr.cmd; }
             }
             if (esCmd)
                 result.push_back(esCmd);
@@ -970,7 +1002,7 @@ OranCmmConflictTriageNr::Filter(
             rec.benignCount++;
             rec.deferCount = 0;
             for (auto& pr : cmds)
-                result.push_back(pr.second);
+                result.push_back(pr.cmd);
         }
         else if (triageScore < m_deferThresh && rec.deferCount < m_deferMax)
         {
@@ -982,11 +1014,11 @@ OranCmmConflictTriageNr::Filter(
             Ptr<OranCommandNr2NrTxPower> bestCmd = nullptr;
             for (auto& pr : cmds)
             {
-                int pri = LmPriority(pr.first);
+                int pri = pr.lm.priority;
                 if (pri < bestPri)
                 {
                     bestPri = pri;
-                    bestCmd = pr.second;
+                    bestCmd = pr.cmd;
                 }
             }
             if (bestCmd)
@@ -1007,12 +1039,12 @@ OranCmmConflictTriageNr::Filter(
                 std::string bestLm;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
-                        bestLm  = pr.first;
+                        bestCmd = pr.cmd;
+                        bestLm  = *pr.lmName;
                     }
                 }
                 if (bestCmd)
@@ -1026,25 +1058,22 @@ OranCmmConflictTriageNr::Filter(
             {
                 int bestPri = std::numeric_limits<int>::max();
                 for (auto& pr : cmds)
-                    bestPri = std::min(bestPri, LmPriority(pr.first));
+                    bestPri = std::min(bestPri, pr.lm.priority);
 
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri == bestPri)
                     {
-                        result.push_back(pr.second);
+                        result.push_back(pr.cmd);
                     }
                     else
                     {
-                        double scaledDelta = pr.second->GetPowerDeltaDb() * (1.0 - m_dampFraction);
+                        double scaledDelta = pr.cmd->GetPowerDeltaDb() * (1.0 - m_dampFraction);
                         if (std::abs(scaledDelta) > 1e-9)
                         {
                             Ptr<OranCommandNr2NrTxPower> dampened =
-                                CreateObject<OranCommandNr2NrTxPower>();
-                            dampened->SetAttribute("TargetE2NodeId",
-                                                   UintegerValue(e2NodeId));
-                            dampened->SetAttribute("PowerDeltaDb", DoubleValue(scaledDelta));
+                                OranCommandNr2NrTxPower::Create(e2NodeId, scaledDelta);
                             result.push_back(dampened);
                         }
                     }
@@ -1056,11 +1085,11 @@ OranCmmConflictTriageNr::Filter(
                 Ptr<OranCommandNr2NrTxPower> bestCmd = nullptr;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
+                        bestCmd = pr.cmd;
                     }
                 }
                 if (bestCmd)
@@ -1075,14 +1104,12 @@ OranCmmConflictTriageNr::Filter(
                             << " margin=" << margin << " p=" << p);
                 for (auto& pr : cmds)
                 {
-                    double d = pr.second->GetPowerDeltaDb();
+                    double d = pr.cmd->GetPowerDeltaDb();
                     double scaledD = (d < 0.0) ? d * p : d * (1.0 - p);
                     if (std::abs(scaledD) > 1e-9)
                     {
                         Ptr<OranCommandNr2NrTxPower> scaled =
-                            CreateObject<OranCommandNr2NrTxPower>();
-                        scaled->SetAttribute("TargetE2NodeId", UintegerValue(e2NodeId));
-                        scaled->SetAttribute("PowerDeltaDb", DoubleValue(scaledD));
+                            OranCommandNr2NrTxPower::Create(e2NodeId, scaledD);
                         result.push_back(scaled);
                     }
                 }
@@ -1095,11 +1122,11 @@ OranCmmConflictTriageNr::Filter(
                 Ptr<OranCommandNr2NrTxPower> bestCmd = nullptr;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
+                        bestCmd = pr.cmd;
                     }
                 }
                 if (bestCmd)
@@ -1111,39 +1138,19 @@ OranCmmConflictTriageNr::Filter(
     for (auto& entry : cellParamByNodeAndParam)
     {
         uint64_t   nodeId    = entry.first.first;
-        const std::string& paramName = entry.first.second;
-        auto& pCmds = entry.second;
+        OranConflictIdTable::Id icp = entry.first.second;
+        const std::string& paramName = m_policy.GetIcps().GetName(icp);
 
-        if (kP2X.find(paramName) == kP2X.end())
+        if (m_policy.GetOwners(icp) == 0)
             continue;
 
-        std::set<std::string> issuingSet;
-        for (auto& pr : pCmds)
-            issuingSet.insert(LmToXappRole(pr.first));
+        OranConflictIdTable::Mask issuing = entry.second;
+        OranConflictIdTable::Mask affectedRoles =
+            m_policy.GetKpiManagers(icp) & ~issuing & allActiveRoles;
 
-        std::set<std::string> affectedRoles;
+        std::vector<std::string> issuingVec = m_policy.GetRoles().GetNames(issuing);
 
-        auto kpit = kP2K.find(paramName);
-        if (kpit != kP2K.end())
-        {
-            for (const auto& kpi : kpit->second)
-            {
-                auto kxit = kK2X.find(kpi);
-                if (kxit == kK2X.end())
-                    continue;
-                const std::string& managingRole = kxit->second;
-                if (issuingSet.count(managingRole))
-                    continue;
-                if (!allActiveRoles.count(managingRole))
-                    continue;
-
-                affectedRoles.insert(managingRole);
-            }
-        }
-
-        std::vector<std::string> issuingVec(issuingSet.begin(), issuingSet.end());
-
-        if (issuingSet.size() > 1)
+        if (issuingVec.size() > 1)
         {
             if (IsRsrpKpiViolated(nodeId))
             {
@@ -1152,11 +1159,43 @@ OranCmmConflictTriageNr::Filter(
         }
         else
         {
-            if (!affectedRoles.empty() && IsRsrpKpiViolated(nodeId))
+            if (affectedRoles != 0 && IsRsrpKpiViolated(nodeId))
             {
-                std::vector<std::string> indVec(affectedRoles.begin(), affectedRoles.end());
                 EmitConflictEvent(nodeId, paramName, "Indirect",
-                                  issuingVec, indVec, issuingVec[0]);
+                                  issuingVec, m_policy.GetRoles().GetNames(affectedRoles), issuingVec[0]);
+            }
+        }
+    }
+
+    // Implicit conflicts, only when the policy enables them.
+    if (m_policy.IsImplicitDetectionEnabled())
+    {
+        std::map<uint64_t,
+                 std::array<OranConflictIdTable::Mask, OranConflictIdTable::kMaxIds>>
+            issuersByCell;
+        for (const auto& nodeEntry : txpByNode)
+            for (const auto& pr : nodeEntry.second)
+                issuersByCell[nodeEntry.first][m_txPowerIcp] |=
+                    OranConflictIdTable::Bit(pr.lm.role);
+        for (const auto& entry : cellParamByNodeAndParam)
+            issuersByCell[entry.first.first][entry.first.second] |= entry.second;
+
+        const OranConflictIdTable& roles = m_policy.GetRoles();
+        const OranConflictIdTable& icps  = m_policy.GetIcps();
+        for (auto& cellEntry : issuersByCell)
+        {
+            for (const auto& implicit : m_policy.DetectImplicit(cellEntry.second))
+            {
+                if (!IsRsrpKpiViolated(cellEntry.first))
+                    continue;
+                OranConflictIdTable::Mask affected =
+                    m_policy.GetManagers(implicit.kpis) & ~implicit.roles & allActiveRoles;
+                EmitConflictEvent(cellEntry.first,
+                                  icps.GetName(implicit.icpA) + "+" + icps.GetName(implicit.icpB),
+                                  "Implicit",
+                                  roles.GetNames(implicit.roles),
+                                  roles.GetNames(affected),
+                                  "");
             }
         }
     }
@@ -1164,4 +1203,23 @@ OranCmmConflictTriageNr::Filter(
     return result;
 }
 
+std::vector<OranSubscription>
+OranCmmConflictTriageNr::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::NRUE, OranNearRtRic::NRGNB},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeAppDemand::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -6,13 +6,16 @@
 #ifndef ORAN_CMM_CONFLICT_TRIAGE_NR_H
 #define ORAN_CMM_CONFLICT_TRIAGE_NR_H
 
+#include "oran-cmm-conflict-policy.h"
 #include "oran-cmm.h"
 
+#include <array>
 #include <cstdint>
 #include <fstream>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -34,9 +37,12 @@ class OranCmmConflictTriageNr : public OranCmm
     OranCmmConflictTriageNr();
     ~OranCmmConflictTriageNr() override;
 
-    std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
-        override;
+    std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
+
+    void Activate() override;
+    void SaveState(std::ostream& os) const override;
+    void RestoreState(std::istream& is, Time timeShift) override;
 
     std::map<std::string, uint32_t> GetAndResetIcpCounts(uint64_t e2NodeId);
 
@@ -84,22 +90,28 @@ class OranCmmConflictTriageNr : public OranCmm
     FutureCellPrediction PredictFutureCellState(uint64_t e2NodeId,
                                                 double proposedDeltaDb) const;
     double ComputeNoisyOr(const std::vector<double>& evidence) const;
-    double ComputeStructuralIcpEvidence(const std::string& icp,
-                                        const std::string& issuingRole,
-                                        const std::set<std::string>& activeRoles) const;
-    double ComputeKpiEvidence(const std::string& icp,
-                              const std::string& issuingRole,
-                              const std::set<std::string>& activeRoles) const;
+    double ComputeStructuralIcpEvidence(OranConflictIdTable::Id icp,
+                                        OranConflictIdTable::Id issuingRole,
+                                        OranConflictIdTable::Mask activeRoles) const;
+    double ComputeKpiEvidence(OranConflictIdTable::Id icp,
+                              OranConflictIdTable::Id issuingRole,
+                              OranConflictIdTable::Mask activeRoles) const;
     double ComputeProactiveConflictLikelihood(uint64_t e2NodeId,
-                                              const std::string& issuingRole,
-                                              const std::string& icp,
+                                              OranConflictIdTable::Id issuingRole,
+                                              OranConflictIdTable::Id icp,
                                               double proposedDeltaDb,
-                                              const std::set<std::string>& activeRoles,
+                                              OranConflictIdTable::Mask activeRoles,
                                               std::vector<double>* evidenceOut) const;
 
-    int LmPriority(const std::string& lmName) const;
+    struct LmInfo
+    {
+        OranConflictIdTable::Id role = 0;
+        int priority = 0;
+    };
 
-    std::string LmToXappRole(const std::string& lmName) const;
+    const LmInfo& ResolveLm(const std::string& lmName);
+
+    bool IsPredictor(const OranLmCommandSlot& entry) const;
 
     void EmitConflictEvent(uint64_t          enbE2Id,
                            const std::string& icp,
@@ -122,10 +134,14 @@ class OranCmmConflictTriageNr : public OranCmm
      */
     bool IsRsrpKpiViolated(uint64_t e2NodeId) const;
 
-    std::map<uint64_t, ConflictRecord> m_txpConflicts;
-    std::map<uint64_t, std::map<std::string, uint32_t>> m_icpCounts;
-    std::map<uint64_t, std::map<std::string, std::set<std::string>>> m_icpActors;
-    std::map<uint64_t, std::vector<ConflictEventRecord>> m_conflictEvents;
+    OranCmmConflictPolicy m_policy;
+    OranConflictIdTable::Id m_txPowerIcp;
+    OranConflictIdTable::Id m_esRole;
+    std::unordered_map<std::string, LmInfo> m_lmInfo;
+
+    std::unordered_map<uint64_t, ConflictRecord> m_txpConflicts;
+    std::unordered_map<uint64_t, OranIcpCellCounters> m_icpCounters;
+    std::unordered_map<uint64_t, std::vector<ConflictEventRecord>> m_conflictEvents;
 
     static constexpr double kRsrpQosThresholdDbm = -95.0;
 
@@ -145,6 +161,8 @@ class OranCmmConflictTriageNr : public OranCmm
     double      m_lmIntervalSec;
     double      m_positionLookbackSec;
     double      m_rsrpPathlossExponent;
+    TypeId      m_predictorLmType;
+    std::string m_policyFile;
     std::string m_conflictLogFile;
     std::ofstream m_logStream;
 };
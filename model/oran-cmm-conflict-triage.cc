@@ -10,17 +10,22 @@
 #include "oran-command-lte-2-lte-tx-power.h"
 #include "oran-command.h"
 #include "oran-data-repository.h"
+#include "oran-lm-lte-2-lte-kpi-prediction.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/type-id.h"
 #include "ns3/uinteger.h"
 
 #include <algorithm>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <set>
 #include <sstream>
@@ -33,31 +38,6 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("OranCmmConflictTriage");
 NS_OBJECT_ENSURE_REGISTERED(OranCmmConflictTriage);
 
-// ── CDC relationship tables (Algorithm 1 from Computer Networks manuscript) ──
-// P2X: which xApp roles own/control each ICP
-static const std::map<std::string, std::set<std::string>> kP2X = {
-    {"TxPower", {"ES", "MRO", "CCO", "MLB"}},
-    {"CIO",     {"MRO", "MLB"}},
-    {"TTT",     {"MRO", "MLB"}},
-    {"RET",     {"CCO", "MLB"}},
-};
-
-// P2K: which KPIs an ICP directly influences
-static const std::map<std::string, std::vector<std::string>> kP2K = {
-    {"TxPower", {"RSRP", "SINR", "Throughput", "EE", "CDR", "HSR"}},
-    {"CIO",     {"CDR", "HSR", "TL", "RSRP-bias"}},
-    {"TTT",     {"CDR", "HSR", "TL"}},
-    {"RET",     {"RSRP", "SINR", "CDR", "HSR"}},
-};
-
-// K2X: which xApp role manages each KPI
-static const std::map<std::string, std::string> kK2X = {
-    {"EE",        "ES"},
-    {"SINR",      "CCO"}, {"Throughput", "CCO"}, {"RSRP", "CCO"},
-    {"CDR",       "MRO"}, {"HSR",        "MRO"}, {"CBR",  "MRO"}, {"RSRP-bias", "MRO"},
-    {"TL",        "MLB"}, {"RUR",        "MLB"},
-};
-
 TypeId
 OranCmmConflictTriage::GetTypeId()
 {
@@ -110,6 +90,20 @@ OranCmmConflictTriage::GetTypeId()
                           DoubleValue(0.2),
                           MakeDoubleAccessor(&OranCmmConflictTriage::m_wScope),
                           MakeDoubleChecker<double>(0.0))
+            .AddAttribute("PredictorLmType",
+                          "Type of the KPI-prediction Logic Module whose TX power increases "
+                          "gate Energy Saving reductions when Method is proactive-gate. "
+                          "LMs of this type or a subclass of it count as predictors.",
+                          TypeIdValue(OranLmLte2LteKpiPrediction::GetTypeId()),
+                          MakeTypeIdAccessor(&OranCmmConflictTriage::m_predictorLmType),
+                          MakeTypeIdChecker())
+            .AddAttribute("PolicyFile",
+                          "Path to the conflict policy file declaring xApp roles, priorities, "
+                          "ICP owners, and ICP/KPI relationships (empty = built-in defaults). "
+                          "Loaded when the CMM is activated.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranCmmConflictTriage::m_policyFile),
+                          MakeStringChecker())
             .AddAttribute("ConflictLogFile",
                           "Path to CDC CSV output file (empty = disabled). "
                           "Columns: time_s,enb_e2id,icp,type,conflicting,affected,winner.",
@@ -124,6 +118,8 @@ OranCmmConflictTriage::OranCmmConflictTriage()
 {
     NS_LOG_FUNCTION(this);
     m_name = "CmmConflictTriage";
+    m_txPowerIcp = m_policy.GetIcps().Find("TxPower");
+    m_esRole     = m_policy.GetRoles().Find("ES");
 }
 
 OranCmmConflictTriage::~OranCmmConflictTriage()
@@ -131,29 +127,82 @@ OranCmmConflictTriage::~OranCmmConflictTriage()
     NS_LOG_FUNCTION(this);
 }
 
+void
+OranCmmConflictTriage::Activate()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_policyFile.empty())
+        m_policy.LoadDefaults();
+    else
+        m_policy.LoadFile(m_policyFile);
+
+    // Role and ICP IDs may have changed; re-resolve LMs on next sight.
+    m_lmInfo.clear();
+    m_txPowerIcp = m_policy.GetIcps().Find("TxPower");
+    m_esRole     = m_policy.GetRoles().Find("ES");
+
+    OranCmm::Activate();
+}
+
+void
+OranCmmConflictTriage::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    // Sorted, so that the same state always gives the same checkpoint.
+    std::map<uint64_t, ConflictRecord> sorted(m_txpConflicts.begin(), m_txpConflicts.end());
+    os << sorted.size() << '\n' << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& [e2NodeId, rec] : sorted)
+    {
+        os << e2NodeId << ' ' << rec.persistenceCount << ' ' << rec.deferCount << ' '
+           << rec.harmfulCount << ' ' << rec.benignCount << ' ' << rec.lastSeverity << '\n';
+    }
+}
+
+void
+OranCmmConflictTriage::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+
+    std::size_t n = 0;
+    is >> n;
+    m_txpConflicts.clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t e2NodeId = 0;
+        ConflictRecord rec;
+        is >> e2NodeId >> rec.persistenceCount >> rec.deferCount >> rec.harmfulCount >>
+            rec.benignCount >> rec.lastSeverity;
+        NS_ABORT_MSG_IF(is.fail(), "Malformed conflict records in checkpoint for " << m_name);
+        m_txpConflicts[e2NodeId] = rec;
+    }
+}
+
 std::map<std::string, uint32_t>
 OranCmmConflictTriage::GetAndResetIcpCounts(uint64_t e2NodeId)
 {
-    auto it = m_icpCounts.find(e2NodeId);
-    if (it == m_icpCounts.end())
+    auto it = m_icpCounters.find(e2NodeId);
+    if (it == m_icpCounters.end())
     {
         return {};
     }
-    std::map<std::string, uint32_t> counts = it->second;
-    m_icpCounts.erase(it);
+    std::map<std::string, uint32_t> counts = it->second.GetCounts(m_policy.GetIcps());
+    // Counts and actors are polled independently; clear only this half.
+    it->second.ResetCounts();
     return counts;
 }
 
 std::map<std::string, std::set<std::string>>
 OranCmmConflictTriage::GetAndResetIcpActors(uint64_t e2NodeId)
 {
-    auto it = m_icpActors.find(e2NodeId);
-    if (it == m_icpActors.end())
+    auto it = m_icpCounters.find(e2NodeId);
+    if (it == m_icpCounters.end())
     {
         return {};
     }
-    std::map<std::string, std::set<std::string>> actors = it->second;
-    m_icpActors.erase(it);
+    std::map<std::string, std::set<std::string>> actors = it->second.GetActors(m_policy.GetIcps(), m_policy.GetRoles());
+    it->second.ResetActors();
     return actors;
 }
 
@@ -171,23 +220,6 @@ OranCmmConflictTriage::GetAndResetConflictEvents(uint64_t e2NodeId)
 }
 
 // ── CDC helpers ───────────────────────────────────────────────────────────────
-std::string
-OranCmmConflictTriage::LmToXappRole(const std::string& lmName) const
-{
-    // Each check also matches the ONNX-inference counterpart's class name
-    // (OranLmLte2LteOnnx{EnergySaving,Cco,Mro,Mlb}), which swaps in for the
-    // rule-based LM at the same xApp role without changing role semantics.
-    if (lmName.find("EnergySaving")         != std::string::npos) return "ES";
-    if (lmName.find("CoverageCapacity")      != std::string::npos) return "CCO";
-    if (lmName.find("OnnxCco")               != std::string::npos) return "CCO";
-    if (lmName.find("KpiPrediction")         != std::string::npos) return "CCO";  // proactive ≡ CCO role
-    if (lmName.find("RsrpHandover")          != std::string::npos) return "MRO";
-    if (lmName.find("OnnxMro")               != std::string::npos) return "MRO";
-    if (lmName.find("MobilityLoadBalancing") != std::string::npos) return "MLB";
-    if (lmName.find("OnnxMlb")               != std::string::npos) return "MLB";
-    return "Unknown";
-}
-
 void
 OranCmmConflictTriage::EmitConflictEvent(uint64_t          enbE2Id,
                                           const std::string& icp,
@@ -198,8 +230,8 @@ OranCmmConflictTriage::EmitConflictEvent(uint64_t          enbE2Id,
 {
     double now = Simulator::Now().GetSeconds();
 
-    // Record for GetAndResetConflictEvents() -- type is always "Direct" or
-    // "Indirect" here (this taxonomy has no "Implicit" category).
+    // Record for GetAndResetConflictEvents() -- type is "Direct" or "Indirect"
+    // here ("Implicit" only if the conflict policy enables it).
     m_conflictEvents[enbE2Id].push_back(
         ConflictEventRecord{icp, type, conflicting, affected, winnerRole});
 
@@ -218,10 +250,13 @@ OranCmmConflictTriage::EmitConflictEvent(uint64_t          enbE2Id,
         oss << "]";
     }
     oss << " kpis=[";
-    auto pit = kP2K.find(icp);
-    if (pit != kP2K.end())
-        for (size_t i = 0; i < pit->second.size(); i++)
-            oss << (i ? "," : "") << pit->second[i];
+    OranConflictIdTable::Id icpId = m_policy.GetIcps().Find(icp);
+    if (icpId != OranConflictIdTable::kInvalidId)
+    {
+        std::vector<std::string> kpis = m_policy.GetIcpKpiNames(icpId);
+        for (size_t i = 0; i < kpis.size(); i++)
+            oss << (i ? "," : "") << kpis[i];
+    }
     oss << "] winner=" << winnerRole;
 
     std::cout << oss.str() << "\n";
@@ -251,29 +286,19 @@ OranCmmConflictTriage::EmitConflictEvent(uint64_t          enbE2Id,
     }
 }
 
-// ── Priority rank: lower value = higher priority ──────────────────────────────
-int
-OranCmmConflictTriage::LmPriority(const std::string& lmName) const
+// ── Role and priority rank (lower = higher priority) from the policy ──────────
+const OranCmmConflictTriage::LmInfo&
+OranCmmConflictTriage::ResolveLm(const std::string& lmName)
 {
-    // Priority order (lower = higher priority):
-    // MRO > CCO = KpiPrediction > MLB > ES
-    if (lmName.find("RsrpHandover") != std::string::npos)
-        return 0; // MRO
-    if (lmName.find("OnnxMro") != std::string::npos)
-        return 0; // MRO (ONNX)
-    if (lmName.find("CoverageCapacity") != std::string::npos)
-        return 1; // CCO
-    if (lmName.find("OnnxCco") != std::string::npos)
-        return 1; // CCO (ONNX)
-    if (lmName.find("KpiPrediction") != std::string::npos)
-        return 1; // Proactive predictor — same priority as CCO
-    if (lmName.find("MobilityLoadBalancing") != std::string::npos)
-        return 2; // MLB
-    if (lmName.find("OnnxMlb") != std::string::npos)
-        return 2; // MLB (ONNX)
-    if (lmName.find("EnergySaving") != std::string::npos)
-        return 3; // ES
-    return 4; // unknown → lowest priority
+    auto it = m_lmInfo.find(lmName);
+    if (it == m_lmInfo.end())
+    {
+        LmInfo info;
+        info.role     = m_policy.ClassifyLm(lmName);
+        info.priority = m_policy.GetPriority(info.role);
+        it = m_lmInfo.emplace(lmName, info).first;
+    }
+    return it->second;
 }
 
 double
@@ -308,23 +333,11 @@ OranCmmConflictTriage::GetWorstServingRsrpForEnb(uint64_t e2NodeId) const
     if (!foundCell)
         return kRsrpQosThresholdDbm - 1.0;
 
+    // The repository keeps this per cell as RSRP reports arrive, so the
+    // lookup does not depend on how many UEs are registered.
+    bool hasRsrp = false;
     double worstRsrp = 0.0;
-    bool   hasRsrp   = false;
-    for (auto ueId : data->GetLteUeE2NodeIds())
-    {
-        bool ufound = false; uint16_t ueCell = 0, ueRnti = 0;
-        std::tie(ufound, ueCell, ueRnti) = data->GetLteUeCellInfo(ueId);
-        if (!ufound || ueCell != cellId)
-            continue;
-        for (const auto& meas : data->GetLteUeRsrpRsrq(ueId))
-        {
-            uint16_t r = 0, c = 0; double rsrp = 0.0, rsrq = 0.0;
-            bool serving = false; uint8_t ccid = 0;
-            std::tie(r, c, rsrp, rsrq, serving, ccid) = meas;
-            if (c != cellId) continue;
-            if (!hasRsrp || rsrp < worstRsrp) { worstRsrp = rsrp; hasRsrp = true; }
-        }
-    }
+    std::tie(hasRsrp, worstRsrp) = data->GetLteCellWorstServingRsrp(cellId);
     return hasRsrp ? worstRsrp : (kRsrpQosThresholdDbm - 1.0);
 }
 
@@ -342,17 +355,22 @@ OranCmmConflictTriage::SelectQacmFraction(double /*severity*/, double rsrpMargin
     return std::max(0.0, std::min(1.0, rsrpMarginDb / 20.0));
 }
 
+bool
+OranCmmConflictTriage::IsPredictor(const OranLmCommandSlot& entry) const
+{
+    return entry.lm != nullptr && entry.lm->GetInstanceTypeId().IsChildOf(m_predictorLmType);
+}
+
 // ── Main Filter ───────────────────────────────────────────────────────────────
 std::vector<Ptr<OranCommand>>
-OranCmmConflictTriage::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmConflictTriage::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
     NS_ABORT_MSG_IF(m_nearRtRic == nullptr,
                     "Attempting to run ConflictTriage CMM with NULL Near-RT RIC");
 
     // ── Proactive-Gate pre-processing ─────────────────────────────────────────
-    // When method=="proactive-gate": scan for KpiPrediction TXP+ commands.
+    // When method=="proactive-gate": scan for predictor (PredictorLmType) TXP+ commands.
     // For every eNB where the predictor issued a TXP increase (flagging predicted
     // RSRP risk), SUPPRESS ES's TXP reduction for that eNB BEFORE CDC detection.
     // This means the CDC never sees a conflict for those eNBs — the harmful ES
@@ -364,9 +382,9 @@ OranCmmConflictTriage::Filter(
         std::set<uint64_t> predictorTargets;
         for (const auto& entry : inputCommands)
         {
-            if (std::get<0>(entry.first).find("KpiPrediction") == std::string::npos)
+            if (!IsPredictor(entry))
                 continue;
-            for (auto cmd : entry.second)
+            for (const auto& cmd : entry.commands)
             {
                 Ptr<OranCommandLte2LteTxPower> txp = cmd->GetObject<OranCommandLte2LteTxPower>();
                 if (txp && txp->GetPowerDeltaDb() > 0.0)
@@ -377,9 +395,9 @@ OranCmmConflictTriage::Filter(
         uint32_t suppressed = 0;
         for (auto& entry : inputCommands)
         {
-            if (LmToXappRole(std::get<0>(entry.first)) != "ES")
+            if (ResolveLm(entry.lmName).role != m_esRole)
                 continue;
-            auto& cmds = entry.second;
+            auto& cmds = entry.commands;
             cmds.erase(
                 std::remove_if(cmds.begin(), cmds.end(),
                     [&predictorTargets, &suppressed](Ptr<OranCommand> cmd) {
@@ -408,18 +426,24 @@ OranCmmConflictTriage::Filter(
     }
 
     // ── Step 0: collect all active xApp roles (for indirect conflict detection) ─
-    std::set<std::string> allActiveRoles;
+    OranConflictIdTable::Mask allActiveRoles = 0;
     for (const auto& entry : inputCommands)
-        allActiveRoles.insert(LmToXappRole(std::get<0>(entry.first)));
+        allActiveRoles |= OranConflictIdTable::Bit(ResolveLm(entry.lmName).role);
 
     // ── Step 1: bucket TXP and cell-parameter commands by target eNB ──────────
-    // TXP bucket: Key = e2NodeId, Value = [(lmName, cmd)]
-    std::map<uint64_t, std::vector<std::pair<std::string, Ptr<OranCommandLte2LteTxPower>>>>
-        txpByNode;
+    // A bucketed command tagged with its issuing LM's resolved role and priority.
+    struct TxpEntry
+    {
+        const std::string* lmName;
+        LmInfo lm;
+        Ptr<OranCommandLte2LteTxPower> cmd;
+    };
+
+    // TXP bucket: Key = e2NodeId, Value = [(lm, cmd)]
+    std::map<uint64_t, std::vector<TxpEntry>> txpByNode;
 
-    // Cell-parameter bucket: Key = (e2NodeId, paramName), Value = [(lmName, cmd)]
-    std::map<std::pair<uint64_t, std::string>,
-             std::vector<std::pair<std::string, Ptr<OranCommandLte2LteCellParameter>>>>
+    // Cell-parameter bucket: Key = (e2NodeId, ICP ID), Value = issuing role mask
+    std::map<std::pair<uint64_t, OranConflictIdTable::Id>, OranConflictIdTable::Mask>
         cellParamByNodeAndParam;
 
     // All non-TXP commands pass through (cell-param commands are also bucketed above)
@@ -428,9 +452,10 @@ OranCmmConflictTriage::Filter(
     double nowCmdLog = Simulator::Now().GetSeconds();
     for (const auto& entry : inputCommands)
     {
-        const std::string& lmName = std::get<0>(entry.first);
-        const std::string  role   = LmToXappRole(lmName);
-        for (auto cmd : entry.second)
+        const std::string& lmName = entry.lmName;
+        const LmInfo       lm     = ResolveLm(lmName);
+        const std::string& role   = m_policy.GetRoles().GetName(lm.role);
+        for (const auto& cmd : entry.commands)
         {
             uint64_t e2id = cmd->GetTargetE2NodeId();
             Ptr<OranCommandLte2LteTxPower> txp = cmd->GetObject<OranCommandLte2LteTxPower>();
@@ -443,9 +468,8 @@ OranCmmConflictTriage::Filter(
                           << " icp=TxPower"
                           << " delta=" << std::showpos << txp->GetPowerDeltaDb()
                           << std::noshowpos << "\n";
-                txpByNode[e2id].emplace_back(lmName, txp);
-                m_icpCounts[e2id]["TxPower"]++;
-                m_icpActors[e2id]["TxPower"].insert(role);
+                txpByNode[e2id].push_back(TxpEntry{&lmName, lm, txp});
+                m_icpCounters[e2id].Record(m_txPowerIcp, lm.role);
             }
             else
             {
@@ -459,10 +483,25 @@ OranCmmConflictTriage::Filter(
                               << " xapp=" << role
                               << " icp=" << cp->GetParameterName()
                               << " value=" << cp->GetValue() << "\n";
-                    auto key = std::make_pair(e2id, cp->GetParameterName());
-                    cellParamByNodeAndParam[key].emplace_back(lmName, cp);
-                    m_icpCounts[e2id][cp->GetParameterName()]++;
-                    m_icpActors[e2id][cp->GetParameterName()].insert(role);
+                    // Intern the canonical name, so that names differing only
+                    // in case are one ICP. Unknown names are not ICPs, and
+                    // interning them could exhaust the ID table, so they are
+                    // only counted together.
+                    if (cp->GetParameter() != OranCellControlParameter::UNKNOWN)
+                    {
+                        OranConflictIdTable::Id icp = m_policy.InternIcp(
+                            CellControlParameterToString(cp->GetParameter()));
+                        cellParamByNodeAndParam[std::make_pair(e2id, icp)] |=
+                            OranConflictIdTable::Bit(lm.role);
+                        m_icpCounters[e2id].Record(icp, lm.role);
+                    }
+                    else
+                    {
+                        NS_LOG_WARN("Unrecognised cell parameter \""
+                                    << cp->GetParameterName() << "\" from " << lmName
+                                    << " for E2 node " << e2id);
+                        m_icpCounters[e2id].RecordUnknown(lm.role);
+                    }
                 }
                 // All non-TXP commands (handover, cell-parameter, etc.) pass through
                 passThrough.push_back(cmd);
@@ -482,7 +521,7 @@ OranCmmConflictTriage::Filter(
         {
             // No conflict — pass through
             for (auto& pr : cmds)
-                result.push_back(pr.second);
+                result.push_back(pr.cmd);
             // Reset persistence since no conflict this cycle
             if (m_txpConflicts.count(e2NodeId))
             {
@@ -497,7 +536,7 @@ OranCmmConflictTriage::Filter(
         double posSum = 0.0; // sum of positive deltas (CCO wants TXP+)
         for (auto& pr : cmds)
         {
-            double d = pr.second->GetPowerDeltaDb();
+            double d = pr.cmd->GetPowerDeltaDb();
             if (d < 0.0) negSum += d;
             else          posSum += d;
         }
@@ -517,15 +556,15 @@ OranCmmConflictTriage::Filter(
         {
             std::vector<std::string> conflictingRoles;
             int bestPriCdc = std::numeric_limits<int>::max();
-            std::string winnerLmCdc;
+            OranConflictIdTable::Id winnerRoleCdc = 0;
             for (auto& pr : cmds)
             {
-                conflictingRoles.push_back(LmToXappRole(pr.first));
-                int pri = LmPriority(pr.first);
-                if (pri < bestPriCdc) { bestPriCdc = pri; winnerLmCdc = pr.first; }
+                conflictingRoles.push_back(m_policy.GetRoles().GetName(pr.lm.role));
+                int pri = pr.lm.priority;
+                if (pri < bestPriCdc) { bestPriCdc = pri; winnerRoleCdc = pr.lm.role; }
             }
             EmitConflictEvent(e2NodeId, "TxPower", "Direct",
-                              conflictingRoles, {}, LmToXappRole(winnerLmCdc));
+                              conflictingRoles, {}, m_policy.GetRoles().GetName(winnerRoleCdc));
         }
 
         std::ostringstream msg;
@@ -549,8 +588,8 @@ OranCmmConflictTriage::Filter(
             Ptr<OranCommandLte2LteTxPower> esCmd = nullptr;
             for (auto& pr : cmds)
             {
-                int pri = LmPriority(pr.first);
-                if (pri > worstPri) { worstPri = pri; esCmd = pr.second; }
+                int pri = pr.lm.priority;
+                if (pri > worstPri) { worstPri = pri; esCmd = pr.cmd; }
             }
             if (esCmd)
                 result.push_back(esCmd); // only ES's TXP- passes
@@ -564,7 +603,7 @@ OranCmmConflictTriage::Filter(
             rec.benignCount++;
             rec.deferCount = 0;
             for (auto& pr : cmds)
-                result.push_back(pr.second);
+                result.push_back(pr.cmd);
         }
         else if (triageScore < m_deferThresh && rec.deferCount < m_deferMax)
         {
@@ -578,11 +617,11 @@ OranCmmConflictTriage::Filter(
             Ptr<OranCommandLte2LteTxPower> bestCmd = nullptr;
             for (auto& pr : cmds)
             {
-                int pri = LmPriority(pr.first);
+                int pri = pr.lm.priority;
                 if (pri < bestPri)
                 {
                     bestPri = pri;
-                    bestCmd = pr.second;
+                    bestCmd = pr.cmd;
                 }
             }
             if (bestCmd)
@@ -605,12 +644,12 @@ OranCmmConflictTriage::Filter(
                 std::string bestLm;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
-                        bestLm  = pr.first;
+                        bestCmd = pr.cmd;
+                        bestLm  = *pr.lmName;
                     }
                 }
                 if (bestCmd)
@@ -625,25 +664,22 @@ OranCmmConflictTriage::Filter(
                 // Scale lower-priority TXP deltas; keep highest-priority unchanged
                 int bestPri = std::numeric_limits<int>::max();
                 for (auto& pr : cmds)
-                    bestPri = std::min(bestPri, LmPriority(pr.first));
+                    bestPri = std::min(bestPri, pr.lm.priority);
 
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri == bestPri)
                     {
-                        result.push_back(pr.second); // highest priority unchanged
+                        result.push_back(pr.cmd); // highest priority unchanged
                     }
                     else
                     {
-                        double scaledDelta = pr.second->GetPowerDeltaDb() * (1.0 - m_dampFraction);
+                        double scaledDelta = pr.cmd->GetPowerDeltaDb() * (1.0 - m_dampFraction);
                         if (std::abs(scaledDelta) > 1e-9)
                         {
                             Ptr<OranCommandLte2LteTxPower> dampened =
-                                CreateObject<OranCommandLte2LteTxPower>();
-                            dampened->SetAttribute("TargetE2NodeId",
-                                                   UintegerValue(e2NodeId));
-                            dampened->SetAttribute("PowerDeltaDb", DoubleValue(scaledDelta));
+                                OranCommandLte2LteTxPower::Create(e2NodeId, scaledDelta);
                             result.push_back(dampened);
                         }
                     }
@@ -656,11 +692,11 @@ OranCmmConflictTriage::Filter(
                 Ptr<OranCommandLte2LteTxPower> bestCmd = nullptr;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
+                        bestCmd = pr.cmd;
                     }
                 }
                 if (bestCmd)
@@ -680,14 +716,12 @@ OranCmmConflictTriage::Filter(
                             << " margin=" << margin << " p=" << p);
                 for (auto& pr : cmds)
                 {
-                    double d = pr.second->GetPowerDeltaDb();
+                    double d = pr.cmd->GetPowerDeltaDb();
                     double scaledD = (d < 0.0) ? d * p : d * (1.0 - p);
                     if (std::abs(scaledD) > 1e-9)
                     {
                         Ptr<OranCommandLte2LteTxPower> scaled =
-                            CreateObject<OranCommandLte2LteTxPower>();
-                        scaled->SetAttribute("TargetE2NodeId", UintegerValue(e2NodeId));
-                        scaled->SetAttribute("PowerDeltaDb", DoubleValue(scaledD));
+                            OranCommandLte2LteTxPower::Create(e2NodeId, scaledD);
                         result.push_back(scaled);
                     }
                 }
@@ -701,11 +735,11 @@ OranCmmConflictTriage::Filter(
                 Ptr<OranCommandLte2LteTxPower> bestCmd = nullptr;
                 for (auto& pr : cmds)
                 {
-                    int pri = LmPriority(pr.first);
+                    int pri = pr.lm.priority;
                     if (pri < bestPri)
                     {
                         bestPri = pri;
-                        bestCmd = pr.second;
+                        bestCmd = pr.cmd;
                     }
                 }
                 if (bestCmd)
@@ -719,69 +753,77 @@ OranCmmConflictTriage::Filter(
     for (auto& entry : cellParamByNodeAndParam)
     {
         uint64_t   nodeId    = entry.first.first;
-        const std::string& paramName = entry.first.second;
-        auto& pCmds = entry.second;
+        OranConflictIdTable::Id icp = entry.first.second;
+        const std::string& paramName = m_policy.GetIcps().GetName(icp);
 
         // xApp roles that own this ICP
-        auto ownerIt = kP2X.find(paramName);
-        if (ownerIt == kP2X.end())
+        OranConflictIdTable::Mask owners = m_policy.GetOwners(icp);
+        if (owners == 0)
             continue;
-        const std::set<std::string>& owners = ownerIt->second;
 
         // Roles that issued commands for this (eNB, paramName) this cycle
-        std::set<std::string> issuingSet;
-        for (auto& pr : pCmds)
-            issuingSet.insert(LmToXappRole(pr.first));
+        OranConflictIdTable::Mask issuing = entry.second;
 
         // ── Determine conflict type for each affected KPI ────────────────────
-        std::set<std::string> directStructural;   // other owners of ICP (KPI affected)
-        std::set<std::string> indirectAffected;   // non-owners whose KPI is affected
-
-        auto kpit = kP2K.find(paramName);
-        if (kpit != kP2K.end())
-        {
-            for (const auto& kpi : kpit->second)
-            {
-                auto kxit = kK2X.find(kpi);
-                if (kxit == kK2X.end())
-                    continue;
-                const std::string& managingRole = kxit->second;
-                if (issuingSet.count(managingRole))
-                    continue;  // same xApp that issued — not a conflict
-                if (!allActiveRoles.count(managingRole))
-                    continue;  // managing xApp not active this run
-
-                if (owners.count(managingRole))
-                    directStructural.insert(managingRole);   // owns ICP → Direct
-                else
-                    indirectAffected.insert(managingRole);   // doesn't own ICP → Indirect
-            }
-        }
+        // Managing roles of the ICP's KPIs, excluding the issuers themselves
+        // (not a conflict) and xApps not active this run.
+        OranConflictIdTable::Mask affected = m_policy.GetKpiManagers(icp) & ~issuing & allActiveRoles;
+        OranConflictIdTable::Mask directStructural = affected & owners;  // owns ICP → Direct
+        OranConflictIdTable::Mask indirectAffected = affected & ~owners; // doesn't own ICP → Indirect
 
-        std::vector<std::string> issuingVec(issuingSet.begin(), issuingSet.end());
+        std::vector<std::string> issuingVec = m_policy.GetRoles().GetNames(issuing);
 
         // ── Multiple issuers for same ICP → command-level Direct conflict ─────
-        if (issuingSet.size() > 1)
+        if (issuingVec.size() > 1)
         {
             EmitConflictEvent(nodeId, paramName, "Direct", issuingVec, {}, issuingVec[0]);
         }
         else
         {
             // ── Structural Direct: one issuer, but another owner's KPI affected ─
-            if (!directStructural.empty())
+            if (directStructural != 0)
             {
-                std::vector<std::string> structVec(directStructural.begin(),
-                                                    directStructural.end());
                 EmitConflictEvent(nodeId, paramName, "Direct",
-                                  issuingVec, structVec, issuingVec[0]);
+                                  issuingVec, m_policy.GetRoles().GetNames(directStructural), issuingVec[0]);
             }
             // ── Indirect: non-owner's KPI affected ────────────────────────────
-            if (!indirectAffected.empty())
+            if (indirectAffected != 0)
             {
-                std::vector<std::string> indVec(indirectAffected.begin(),
-                                                 indirectAffected.end());
                 EmitConflictEvent(nodeId, paramName, "Indirect",
-                                  issuingVec, indVec, issuingVec[0]);
+                                  issuingVec, m_policy.GetRoles().GetNames(indirectAffected), issuingVec[0]);
+            }
+        }
+    }
+
+    // ── Step 4: Implicit conflicts (only when the policy enables them) ───────
+    // Different ICPs on the same eNB, set this cycle by different xApps, that
+    // influence a common KPI.
+    if (m_policy.IsImplicitDetectionEnabled())
+    {
+        std::map<uint64_t,
+                 std::array<OranConflictIdTable::Mask, OranConflictIdTable::kMaxIds>>
+            issuersByCell;
+        for (const auto& nodeEntry : txpByNode)
+            for (const auto& pr : nodeEntry.second)
+                issuersByCell[nodeEntry.first][m_txPowerIcp] |=
+                    OranConflictIdTable::Bit(pr.lm.role);
+        for (const auto& entry : cellParamByNodeAndParam)
+            issuersByCell[entry.first.first][entry.first.second] |= entry.second;
+
+        const OranConflictIdTable& roles = m_policy.GetRoles();
+        const OranConflictIdTable& icps  = m_policy.GetIcps();
+        for (auto& cellEntry : issuersByCell)
+        {
+            for (const auto& implicit : m_policy.DetectImplicit(cellEntry.second))
+            {
+                OranConflictIdTable::Mask affected =
+                    m_policy.GetManagers(implicit.kpis) & ~implicit.roles & allActiveRoles;
+                EmitConflictEvent(cellEntry.first,
+                                  icps.GetName(implicit.icpA) + "+" + icps.GetName(implicit.icpB),
+                                  "Implicit",
+                                  roles.GetNames(implicit.roles),
+                                  roles.GetNames(affected),
+                                  "");
             }
         }
     }
@@ -789,4 +831,14 @@ OranCmmConflictTriage::Filter(
     return result;
 }
 
+std::vector<OranSubscription>
+OranCmmConflictTriage::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -6,13 +6,16 @@
 #ifndef ORAN_CMM_CONFLICT_TRIAGE_H
 #define ORAN_CMM_CONFLICT_TRIAGE_H
 
+#include "oran-cmm-conflict-policy.h"
 #include "oran-cmm.h"
 
+#include <array>
 #include <cstdint>
 #include <fstream>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -43,6 +46,10 @@ namespace ns3
  *   dampen   — scale the lower-priority command by (1-dampFraction)
  *   priority — MRO > CCO > MLB > ES; only highest-priority passes
  *   qacm     — game-theoretic sweep of fraction p in [0,1]
+ *
+ * xApp roles, their priority order, and the ICP/KPI relationship graph the
+ * CDC classifies against come from an OranCmmConflictPolicy (PolicyFile
+ * attribute; built-in defaults otherwise).
  */
 class OranCmmConflictTriage : public OranCmm
 {
@@ -51,14 +58,22 @@ class OranCmmConflictTriage : public OranCmm
     OranCmmConflictTriage();
     ~OranCmmConflictTriage() override;
 
-    std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
-        override;
+    std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
+
+    /**
+     * Loads the conflict policy (PolicyFile, or the built-in defaults) and
+     * activates the CMM.
+     */
+    void Activate() override;
+    void SaveState(std::ostream& os) const override;
+    void RestoreState(std::istream& is, Time timeShift) override;
 
     /**
      * Returns, and resets to zero, the per-parameter command counts issued
      * for the given eNB since the last call (or since the start of the
-     * simulation). Keys are ICP names ("TxPower", "CIO", "RET", "TTT", ...).
+     * simulation). Keys are ICP names ("TxPower", "CIO", "RET", "TTT", ...),
+     * with commands for unrecognised parameters counted under "UNKNOWN".
      * Intended to be polled once per LM cycle by the scenario driving this
      * CMM, so its own per-cycle KPI CSV can report real parameter-update
      * frequencies instead of a placeholder.
@@ -77,8 +92,10 @@ class OranCmmConflictTriage : public OranCmm
 
     /**
      * One CDC-classified conflict event (see EmitConflictEvent) recorded
-     * against a specific eNB. `type` is always "Direct" or "Indirect" --
-     * this scenario's taxonomy deliberately has no "Implicit" category.
+     * against a specific eNB. `type` is "Direct" or "Indirect"; this
+     * scenario's taxonomy has no "Implicit" category unless the conflict
+     * policy opts in with `detect implicit`, in which case `icp` names the
+     * two ICPs involved ("CIO+TTT") and `winner` is empty.
      */
     struct ConflictEventRecord
     {
@@ -119,16 +136,26 @@ class OranCmmConflictTriage : public OranCmm
     // Query worst (minimum) serving-cell RSRP for an eNB from the data repository.
     double GetWorstServingRsrpForEnb(uint64_t e2NodeId) const;
 
-    // ── Priority rank (lower = higher priority) ──────────────────────────────
-    int LmPriority(const std::string& lmName) const;
+    // ── xApp role and priority rank (lower = higher priority) ────────────────
+    // Role ID and priority of an LM, resolved once per LM name.
+    struct LmInfo
+    {
+        OranConflictIdTable::Id role = 0;
+        int priority = 0;
+    };
 
-    // ── CDC: rule-based conflict classification (Algorithm 1) ────────────────
-    // Map an LM name to its xApp role label (ES | MRO | CCO | MLB | Unknown).
-    std::string LmToXappRole(const std::string& lmName) const;
+    // Returns the cached LmInfo for an LM name, classifying it against the
+    // policy on first sight.
+    const LmInfo& ResolveLm(const std::string& lmName);
+
+    // Returns whether the LM that filled a command slot is a KPI predictor,
+    // i.e. of PredictorLmType or a subclass of it.
+    bool IsPredictor(const OranLmCommandSlot& entry) const;
 
+    // ── CDC: rule-based conflict classification (Algorithm 1) ────────────────
     // Classify and emit a conflict event.
     //   icp         — the controlled parameter (e.g. "TxPower", "CIO", "TTT", "RET")
-    //   type        — "Direct" or "Indirect"
+    //   type        — "Direct", "Indirect", or "Implicit"
     //   conflicting — xApp roles that issued commands for this ICP
     //   affected    — xApp roles whose KPIs are affected but did not issue a command
     //   winnerRole  — xApp role whose command the CMM kept (empty for Indirect)
@@ -139,18 +166,22 @@ class OranCmmConflictTriage : public OranCmm
                            const std::vector<std::string>& affected,
                            const std::string& winnerRole);
 
+    // ── Compiled conflict policy ─────────────────────────────────────────────
+    OranCmmConflictPolicy m_policy;       //!< Roles, priorities, and CDC graph
+    OranConflictIdTable::Id m_txPowerIcp; //!< ICP ID of "TxPower"
+    OranConflictIdTable::Id m_esRole;     //!< Role ID of "ES" (kInvalidId if undeclared)
+    // Key: LM name -> cached role ID and priority.
+    std::unordered_map<std::string, LmInfo> m_lmInfo;
+
     // ── State ────────────────────────────────────────────────────────────────
     // Key: e2NodeId of the conflicting eNB
-    std::map<uint64_t, ConflictRecord> m_txpConflicts;
-
-    // Key: e2NodeId -> (ICP name -> command count since last reset).
-    std::map<uint64_t, std::map<std::string, uint32_t>> m_icpCounts;
+    std::unordered_map<uint64_t, ConflictRecord> m_txpConflicts;
 
-    // Key: e2NodeId -> (ICP name -> set of xApp roles that acted on it since last reset).
-    std::map<uint64_t, std::map<std::string, std::set<std::string>>> m_icpActors;
+    // Key: e2NodeId -> per-ICP command counts and issuing roles since last reset.
+    std::unordered_map<uint64_t, OranIcpCellCounters> m_icpCounters;
 
     // Key: e2NodeId -> conflict events classified since last reset.
-    std::map<uint64_t, std::vector<ConflictEventRecord>> m_conflictEvents;
+    std::unordered_map<uint64_t, std::vector<ConflictEventRecord>> m_conflictEvents;
 
     // ── Configuration ────────────────────────────────────────────────────────
     static constexpr double kRsrpQosThresholdDbm = -95.0; //!< Coverage QoS floor (dBm)
@@ -164,6 +195,8 @@ class OranCmmConflictTriage : public OranCmm
     double      m_wSeverity;       //!< Feature weight: severity
     double      m_wPersistence;    //!< Feature weight: persistence
     double      m_wScope;          //!< Feature weight: scope
+    TypeId      m_predictorLmType; //!< LM type whose TXP+ gates ES (proactive-gate)
+    std::string m_policyFile;      //!< Conflict policy file (empty = built-in defaults)
     std::string m_conflictLogFile; //!< Path for CDC CSV output (empty = disabled)
     std::ofstream m_logStream;     //!< CDC CSV output stream (opened lazily)
 };
@@ -78,8 +78,7 @@ OranCmmHandover::DoDispose()
 }
 
 std::vector<Ptr<OranCommand>>
-OranCmmHandover::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmHandover::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
 
@@ -93,9 +92,9 @@ OranCmmHandover::Filter(
                     "Attempting to run Conflict Mitigation Module with NULL Near-RT RIC");
 
     std::vector<Ptr<OranCommand>> commands;
-    for (auto commandSet : inputCommands)
+    for (auto& commandSet : inputCommands)
     {
-        for (auto cmd : commandSet.second)
+        for (const auto& cmd : commandSet.commands)
         {
             Ptr<OranCommandLte2LteHandover> handoverCmd =
                 cmd->GetObject<OranCommandLte2LteHandover>();
@@ -131,4 +130,12 @@ OranCmmHandover::Filter(
     return commands;
 }
 
+std::vector<OranSubscription>
+OranCmmHandover::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
 } // namespace ns3
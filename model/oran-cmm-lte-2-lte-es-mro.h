@@ -9,6 +9,8 @@
 #include "oran-cmm.h"
 
 #include <cstdint>
+#include <map>
+#include <string>
 
 namespace ns3
 {
@@ -34,14 +36,44 @@ class OranCmmLte2LteEsMro : public OranCmm
     OranCmmLte2LteEsMro();
     ~OranCmmLte2LteEsMro() override;
 
-    std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
-        override;
+    std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
+    /**
+     * The game-theoretic mitigation methods.
+     */
+    enum class GameMethod : uint8_t
+    {
+        NSWF,
+        EG,
+        QACM,
+    };
+
+    /**
+     * Everything a game solution depends on.
+     */
+    struct GameKey
+    {
+        GameMethod method;
+        uint32_t sweepPoints;
+        double esPriority;
+        double mroPriority;
+        double utilitySigma;
+        double qosThreshold;
+        double qacmZeta;
+
+        bool operator==(const GameKey& other) const;
+    };
+
     bool ShouldForwardHandover(Ptr<OranCommand> command);
-    double SelectFraction(double requestedDeltaDb) const;
-    double SolveGame(const std::string& method) const;
+    double SelectFraction(double requestedDeltaDb);
+    /**
+     * Returns the game solution for the current attributes, solving the game
+     * only when they differ from the ones of the cached solution.
+     */
+    double GetGameSolution(GameMethod method);
+    static double SolveGame(const GameKey& key);
 
     std::string m_method;
     uint32_t m_sweepPoints;
@@ -52,6 +84,10 @@ class OranCmmLte2LteEsMro : public OranCmm
     double m_qacmZeta;
     double m_handoverHoldoffSec;
     std::map<uint64_t, double> m_lastHandoverByUe;
+
+    bool m_gameCached;
+    GameKey m_gameKey;
+    double m_gameFraction;
 };
 
 } // namespace ns3
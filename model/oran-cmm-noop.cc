@@ -36,6 +36,8 @@
 #include "ns3/abort.h"
 #include "ns3/log.h"
 
+#include <iterator>
+
 namespace ns3
 {
 
@@ -74,8 +76,7 @@ OranCmmNoop::DoDispose()
 }
 
 std::vector<Ptr<OranCommand>>
-OranCmmNoop::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmNoop::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
 
@@ -91,12 +92,22 @@ OranCmmNoop::Filter(
     LogLogicToStorage("No action taken");
 
     std::vector<Ptr<OranCommand>> commands;
-    for (auto commandSet : inputCommands)
+    for (auto& commandSet : inputCommands)
     {
-        commands.insert(commands.end(), commandSet.second.begin(), commandSet.second.end());
+        commands.insert(commands.end(),
+                        std::make_move_iterator(commandSet.commands.begin()),
+                        std::make_move_iterator(commandSet.commands.end()));
     }
 
     return commands;
 }
 
+std::vector<OranSubscription>
+OranCmmNoop::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
 } // namespace ns3
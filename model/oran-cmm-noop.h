@@ -68,13 +68,18 @@ class OranCmmNoop : public OranCmm
      * and filter the input commands. This is a No Operation module,
      * so the input set of commands will be returned without filtering.
      *
-     * @param inputCommands A map with the input commands generated by all the LMs.
+     * @param inputCommands The input commands generated by all the LMs.
      *
      * @return A vector with the commands filtered by this module.
      */
-    std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
-        override;
+    std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) override;
+    /**
+     * Get the Reports this module reads. It only filters Commands, so it
+     * subscribes to none.
+     *
+     * @return An empty vector.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   protected:
     void DoDispose() override;
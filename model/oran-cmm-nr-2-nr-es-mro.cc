@@ -10,6 +10,7 @@
 #include "oran-command.h"
 #include "oran-data-repository.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-nr-ue-cell-info.h"
 
 #include "ns3/abort.h"
 #include "ns3/double.h"
@@ -20,7 +21,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <limits>
 #include <sstream>
 #include <tuple>
 #include <vector>
@@ -34,8 +34,12 @@ NS_OBJECT_ENSURE_REGISTERED(OranCmmNr2NrEsMro);
 namespace
 {
 
-std::vector<double>
-ZScore(const std::vector<double>& values)
+/**
+ * Z-scores values in place. Leaves all zeros if the values are (almost)
+ * constant.
+ */
+void
+ZScore(std::vector<double>& values)
 {
     double sum = 0.0;
     for (double v : values)
@@ -52,22 +56,15 @@ ZScore(const std::vector<double>& values)
     }
     const double stddev = values.size() > 1 ? std::sqrt(ss / (values.size() - 1)) : 0.0;
 
-    std::vector<double> out(values.size(), 0.0);
     if (stddev < 1e-9)
     {
-        return out;
+        std::fill(values.begin(), values.end(), 0.0);
+        return;
     }
-    for (std::size_t i = 0; i < values.size(); ++i)
+    for (double& v : values)
     {
-        out[i] = (values[i] - mean) / stddev;
+        v = (v - mean) / stddev;
     }
-    return out;
-}
-
-double
-DistanceFromThreshold(double utility, double threshold)
-{
-    return utility >= threshold ? 0.0 : threshold - utility;
 }
 
 } // namespace
@@ -124,7 +121,10 @@ OranCmmNr2NrEsMro::GetTypeId()
 }
 
 OranCmmNr2NrEsMro::OranCmmNr2NrEsMro()
-    : OranCmm()
+    : OranCmm(),
+      m_gameCached(false),
+      m_gameKey(),
+      m_gameFraction(1.0)
 {
     NS_LOG_FUNCTION(this);
     m_name = "CmmNr2NrEsMro";
@@ -136,8 +136,7 @@ OranCmmNr2NrEsMro::~OranCmmNr2NrEsMro()
 }
 
 std::vector<Ptr<OranCommand>>
-OranCmmNr2NrEsMro::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmNr2NrEsMro::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
     NS_ABORT_MSG_IF(m_nearRtRic == nullptr,
@@ -146,7 +145,7 @@ OranCmmNr2NrEsMro::Filter(
     std::vector<Ptr<OranCommand>> commands;
     for (const auto& commandSet : inputCommands)
     {
-        for (auto command : commandSet.second)
+        for (const auto& command : commandSet.commands)
         {
             Ptr<OranCommandNr2NrHandover> handover =
                 command->GetObject<OranCommandNr2NrHandover>();
@@ -184,10 +183,7 @@ OranCmmNr2NrEsMro::Filter(
             }
 
             Ptr<OranCommandNr2NrTxPower> mitigated =
-                CreateObject<OranCommandNr2NrTxPower>();
-            mitigated->SetAttribute("TargetE2NodeId",
-                                    UintegerValue(command->GetTargetE2NodeId()));
-            mitigated->SetAttribute("PowerDeltaDb", DoubleValue(mitigatedDeltaDb));
+                OranCommandNr2NrTxPower::Create(command->GetTargetE2NodeId(), mitigatedDeltaDb);
             commands.push_back(mitigated);
         }
     }
@@ -246,7 +242,7 @@ OranCmmNr2NrEsMro::ShouldForwardHandover(Ptr<OranCommand> command)
 }
 
 double
-OranCmmNr2NrEsMro::SelectFraction(double requestedDeltaDb) const
+OranCmmNr2NrEsMro::SelectFraction(double requestedDeltaDb)
 {
     if (requestedDeltaDb >= 0.0 || m_method == "none")
     {
@@ -264,83 +260,124 @@ OranCmmNr2NrEsMro::SelectFraction(double requestedDeltaDb) const
     {
         return m_mroPriority >= m_esPriority ? 0.0 : 1.0;
     }
-    if (m_method == "nswf" || m_method == "eg" || m_method == "qacm")
+    if (m_method == "nswf")
+    {
+        return GetGameSolution(GameMethod::NSWF);
+    }
+    if (m_method == "eg")
+    {
+        return GetGameSolution(GameMethod::EG);
+    }
+    if (m_method == "qacm")
     {
-        return SolveGame(m_method);
+        return GetGameSolution(GameMethod::QACM);
     }
 
     NS_LOG_WARN("Unknown ES/MRO mitigation method '" << m_method << "'; passing command through.");
     return 1.0;
 }
 
-double
-OranCmmNr2NrEsMro::SolveGame(const std::string& method) const
+bool
+OranCmmNr2NrEsMro::GameKey::operator==(const GameKey& other) const
 {
-    const uint32_t n = std::max<uint32_t>(m_sweepPoints, 3);
-    const double wSum = std::max(1e-9, m_esPriority + m_mroPriority);
-    const double wEs = m_esPriority / wSum;
-    const double wMro = m_mroPriority / wSum;
+    return method == other.method && sweepPoints == other.sweepPoints &&
+           esPriority == other.esPriority && mroPriority == other.mroPriority &&
+           utilitySigma == other.utilitySigma && qosThreshold == other.qosThreshold &&
+           qacmZeta == other.qacmZeta;
+}
 
-    std::vector<double> p(n);
-    std::vector<double> esRaw(n);
-    std::vector<double> mroRaw(n);
+double
+OranCmmNr2NrEsMro::GetGameSolution(GameMethod method)
+{
+    const GameKey key{method,
+                      m_sweepPoints,
+                      m_esPriority,
+                      m_mroPriority,
+                      m_utilitySigma,
+                      m_qosThreshold,
+                      m_qacmZeta};
+    if (!m_gameCached || !(key == m_gameKey))
+    {
+        m_gameFraction = SolveGame(key);
+        m_gameKey = key;
+        m_gameCached = true;
+        NS_LOG_LOGIC("Solved ES/MRO game over " << key.sweepPoints
+                                                << " points: fraction=" << m_gameFraction);
+    }
+    return m_gameFraction;
+}
 
+double
+OranCmmNr2NrEsMro::SolveGame(const GameKey& key)
+{
+    const uint32_t n = std::max<uint32_t>(key.sweepPoints, 3);
+    const double wSum = std::max(1e-9, key.esPriority + key.mroPriority);
+    const double wEs = key.esPriority / wSum;
+    const double wMro = key.mroPriority / wSum;
+    const double twoSigmaSq = 2.0 * key.utilitySigma * key.utilitySigma;
+
+    // Each loop below is branch-free over the sweep, so it vectorizes, and
+    // the scores are reduced with a single arg-max/arg-min pass.
+    std::vector<double> es(n);
+    std::vector<double> mro(n);
     for (uint32_t i = 0; i < n; ++i)
     {
-        p[i] = static_cast<double>(i) / static_cast<double>(n - 1);
-        esRaw[i] = m_esPriority *
-                   std::exp(-std::pow(p[i] - 1.0, 2.0) / (2.0 * m_utilitySigma * m_utilitySigma));
-        mroRaw[i] = m_mroPriority *
-                    std::exp(-std::pow(p[i], 2.0) / (2.0 * m_utilitySigma * m_utilitySigma));
+        const double p = static_cast<double>(i) / static_cast<double>(n - 1);
+        const double q = p - 1.0;
+        es[i] = key.esPriority * std::exp(-(q * q) / twoSigmaSq);
+        mro[i] = key.mroPriority * std::exp(-(p * p) / twoSigmaSq);
     }
 
-    const std::vector<double> es = ZScore(esRaw);
-    const std::vector<double> mro = ZScore(mroRaw);
+    ZScore(es);
+    ZScore(mro);
 
-    double bestScore = method == "qacm" ? std::numeric_limits<double>::infinity()
-                                        : -std::numeric_limits<double>::infinity();
+    // The score of every point is written over es.
+    std::vector<double>& score = es;
     uint32_t bestIdx = 0;
-
-    for (uint32_t i = 0; i < n; ++i)
+    switch (key.method)
     {
-        double score = 0.0;
-        if (method == "nswf")
+    case GameMethod::NSWF: {
+        const double esMin = *std::min_element(es.begin(), es.end());
+        const double mroMin = *std::min_element(mro.begin(), mro.end());
+        for (uint32_t i = 0; i < n; ++i)
         {
-            const double esPos = es[i] - *std::min_element(es.begin(), es.end()) + 1e-6;
-            const double mroPos = mro[i] - *std::min_element(mro.begin(), mro.end()) + 1e-6;
-            score = esPos * mroPos;
-            if (score > bestScore)
-            {
-                bestScore = score;
-                bestIdx = i;
-            }
+            score[i] = (es[i] - esMin + 1e-6) * (mro[i] - mroMin + 1e-6);
         }
-        else if (method == "eg")
+        bestIdx = std::max_element(score.begin(), score.end()) - score.begin();
+        break;
+    }
+    case GameMethod::EG:
+        for (uint32_t i = 0; i < n; ++i)
         {
-            score = wEs * es[i] + wMro * mro[i];
-            if (score > bestScore)
-            {
-                bestScore = score;
-                bestIdx = i;
-            }
+            score[i] = wEs * es[i] + wMro * mro[i];
         }
-        else
+        bestIdx = std::max_element(score.begin(), score.end()) - score.begin();
+        break;
+    case GameMethod::QACM:
+        for (uint32_t i = 0; i < n; ++i)
         {
-            const double esDist = DistanceFromThreshold(es[i], m_qosThreshold);
-            const double mroDist = DistanceFromThreshold(mro[i], m_qosThreshold);
-            const double esSat = esDist == 0.0 ? 1.0 : 0.0;
-            const double mroSat = mroDist == 0.0 ? 1.0 : 0.0;
-            score = (wEs * esDist + wMro * mroDist) * m_qacmZeta -
-                    std::pow(esSat + mroSat, 2.0);
-            if (score < bestScore)
-            {
-                bestScore = score;
-                bestIdx = i;
-            }
+            // Distance below the QoS threshold, zero once it is met.
+            const double esDist = std::max(0.0, key.qosThreshold - es[i]);
+            const double mroDist = std::max(0.0, key.qosThreshold - mro[i]);
+            const double nSat =
+                (es[i] >= key.qosThreshold ? 1.0 : 0.0) + (mro[i] >= key.qosThreshold ? 1.0 : 0.0);
+            score[i] = (wEs * esDist + wMro * mroDist) * key.qacmZeta - nSat * nSat;
         }
+        bestIdx = std::min_element(score.begin(), score.end()) - score.begin();
+        break;
     }
 
-    return p[bestIdx];
+    return static_cast<double>(bestIdx) / static_cast<double>(n - 1);
+}
+
+std::vector<OranSubscription>
+OranCmmNr2NrEsMro::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
 }
 
 } // namespace ns3
@@ -38,6 +38,8 @@
 #include "ns3/abort.h"
 #include "ns3/log.h"
 
+#include <iterator>
+
 namespace ns3
 {
 
@@ -77,8 +79,7 @@ OranCmmSingleCommandPerNode::DoDispose()
 }
 
 std::vector<Ptr<OranCommand>>
-OranCmmSingleCommandPerNode::Filter(
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
+OranCmmSingleCommandPerNode::Filter(OranLmCommandArena& inputCommands)
 {
     NS_LOG_FUNCTION(this);
 
@@ -91,13 +92,13 @@ OranCmmSingleCommandPerNode::Filter(
     {
         std::map<uint64_t, bool> affectedNodes;
         std::map<uint64_t, Ptr<OranCommand>> selectedCommands;
-        for (auto commandSet : inputCommands)
+        for (auto& commandSet : inputCommands)
         {
-            bool defaultLm = std::get<1>(commandSet.first);
+            bool defaultLm = commandSet.isDefault;
             uint64_t affectedNodeId;
 
-            LogLogicToStorage("Checking commands from LM " + std::get<0>(commandSet.first));
-            for (auto command : commandSet.second)
+            LogLogicToStorage("Checking commands from LM " + commandSet.lmName);
+            for (const auto& command : commandSet.commands)
             {
                 // Get the affected node E2 Node Id depending on the command type
                 if (command->GetInstanceTypeId() == OranCommandLte2LteHandover::GetTypeId())
@@ -163,13 +164,23 @@ OranCmmSingleCommandPerNode::Filter(
     else
     {
         // This module is not active. Just copy the same set of commands as output
-        for (auto commandSet : inputCommands)
+        for (auto& commandSet : inputCommands)
         {
-            commands.insert(commands.end(), commandSet.second.begin(), commandSet.second.end());
+            commands.insert(commands.end(),
+                        std::make_move_iterator(commandSet.commands.begin()),
+                        std::make_move_iterator(commandSet.commands.end()));
         }
     }
 
     return commands;
 }
 
+std::vector<OranSubscription>
+OranCmmSingleCommandPerNode::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
 } // namespace ns3
@@ -77,13 +77,18 @@ class OranCmmSingleCommandPerNode : public OranCmm
      * by the default LM takes precedence. If both (or none of the) commands are being
      * issued by the default LM, the first one processed takes precedence.
      *
-     * @param inputCommands A map with the input commands generated by all the LMs.
+     * @param inputCommands The input commands generated by all the LMs.
      *
      * @return A vector with the commands that passed the filter.
      */
-    std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands)
-        override;
+    std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) override;
+    /**
+     * Get the Reports this module reads. It only filters Commands, so it
+     * subscribes to none.
+     *
+     * @return An empty vector.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   protected:
     void DoDispose() override;
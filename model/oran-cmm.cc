@@ -33,6 +33,7 @@
 #include "oran-command.h"
 #include "oran-data-repository.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report.h"
 
 #include "ns3/abort.h"
 #include "ns3/boolean.h"
@@ -121,6 +122,26 @@ OranCmm::SetName(const std::string& name)
     m_name = name;
 }
 
+void
+OranCmm::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranCmm::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+}
+
+std::vector<OranSubscription>
+OranCmm::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReport::GetTypeId(), {}, Seconds(0)}};
+}
+
 void
 OranCmm::DoDispose()
 {
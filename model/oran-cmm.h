@@ -31,8 +31,13 @@
 #ifndef ORAN_CMM_H
 #define ORAN_CMM_H
 
+#include "oran-lm-command-arena.h"
+#include "oran-subscription.h"
+
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 
+#include <iostream>
 #include <map>
 #include <string>
 #include <vector>
@@ -106,12 +111,38 @@ class OranCmm : public Object
      * Module is active; otherwise, the input set of commands will be
      * returned without filtering.
      *
-     * @param inputCommands A map with the input commands generated by all the LMs.
+     * @param inputCommands The input commands generated by all the LMs in this
+     * cycle. The module may modify or move from them, as the Near-RT RIC
+     * discards them once filtering is done.
      *
      * @return A vector with the commands that passed the filter.
      */
-    virtual std::vector<Ptr<OranCommand>> Filter(
-        std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> inputCommands) = 0;
+    virtual std::vector<Ptr<OranCommand>> Filter(OranLmCommandArena& inputCommands) = 0;
+    /**
+     * Write the internal state of this Conflict Mitigation Module to a checkpoint of the
+     * Near-RT RIC (see OranNearRtRic::SaveCheckpoint). The default writes
+     * nothing, for modules that keep no state outside the Data Repository.
+     *
+     * @param os The stream to write to.
+     */
+    virtual void SaveState(std::ostream& os) const;
+    /**
+     * Restore the internal state written by SaveState.
+     *
+     * @param is The stream to read from.
+     * @param timeShift The time to add to the simulation times in the state,
+     *        i.e., the time of the restore minus the time of the checkpoint.
+     */
+    virtual void RestoreState(std::istream& is, Time timeShift);
+    /**
+     * Get the Reports this Conflict Mitigation Module reads from the Data Repository. When
+     * the Near-RT RIC enforces subscriptions, Reporters whose Reports no
+     * module subscribes to are suspended. The default subscribes to every
+     * Report from every node, at the configured intervals.
+     *
+     * @return The subscriptions.
+     */
+    virtual std::vector<OranSubscription> GetSubscriptions() const;
 
   protected:
     /**
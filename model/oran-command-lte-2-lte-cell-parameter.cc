@@ -11,6 +11,7 @@
 #include "ns3/string.h"
 
 #include <sstream>
+#include <utility>
 
 namespace ns3
 {
@@ -28,17 +29,20 @@ OranCommandLte2LteCellParameter::GetTypeId()
             .AddAttribute("ParameterName",
                           "LTE cell-control parameter name: CIO, TTT, HYS, or RET.",
                           StringValue("CIO"),
-                          MakeStringAccessor(&OranCommandLte2LteCellParameter::m_parameterName),
+                          MakeStringAccessor(&OranCommandLte2LteCellParameter::SetParameterName,
+                                             &OranCommandLte2LteCellParameter::GetParameterName),
                           MakeStringChecker())
             .AddAttribute("Value",
                           "Parameter value or delta.",
                           DoubleValue(0.0),
-                          MakeDoubleAccessor(&OranCommandLte2LteCellParameter::m_value),
+                          MakeDoubleAccessor(&OranCommandLte2LteCellParameter::SetValue,
+                                             &OranCommandLte2LteCellParameter::GetValue),
                           MakeDoubleChecker<double>())
             .AddAttribute("IsDelta",
                           "Whether Value is a delta to add to the current parameter.",
                           BooleanValue(false),
-                          MakeBooleanAccessor(&OranCommandLte2LteCellParameter::m_isDelta),
+                          MakeBooleanAccessor(&OranCommandLte2LteCellParameter::SetIsDelta,
+                                              &OranCommandLte2LteCellParameter::IsDelta),
                           MakeBooleanChecker());
     return tid;
 }
@@ -46,6 +50,8 @@ OranCommandLte2LteCellParameter::GetTypeId()
 OranCommandLte2LteCellParameter::OranCommandLte2LteCellParameter()
 {
     NS_LOG_FUNCTION(this);
+    m_data.rat = OranCommandRat::LTE;
+    m_data.payload = OranCellParameterPayload();
 }
 
 OranCommandLte2LteCellParameter::~OranCommandLte2LteCellParameter()
@@ -59,7 +65,7 @@ OranCommandLte2LteCellParameter::ToString() const
     std::ostringstream ss;
     ss << "OranCommandLte2LteCellParameter("
        << "TargetE2NodeId=" << GetTargetE2NodeId() << ";ParameterName=" << m_parameterName
-       << ";Value=" << m_value << ";IsDelta=" << m_isDelta << ")";
+       << ";Value=" << GetValue() << ";IsDelta=" << IsDelta() << ")";
     return ss.str();
 }
 
@@ -69,16 +75,69 @@ OranCommandLte2LteCellParameter::GetParameterName() const
     return m_parameterName;
 }
 
+OranCellControlParameter
+OranCommandLte2LteCellParameter::GetParameter() const
+{
+    return std::get<OranCellParameterPayload>(m_data.payload).parameter;
+}
+
 double
 OranCommandLte2LteCellParameter::GetValue() const
 {
-    return m_value;
+    return std::get<OranCellParameterPayload>(m_data.payload).value;
 }
 
 bool
 OranCommandLte2LteCellParameter::IsDelta() const
 {
-    return m_isDelta;
+    return std::get<OranCellParameterPayload>(m_data.payload).isDelta;
+}
+
+void
+OranCommandLte2LteCellParameter::SetParameterName(std::string parameterName)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).parameter =
+        ParseCellControlParameter(parameterName);
+    m_parameterName = std::move(parameterName);
+}
+
+void
+OranCommandLte2LteCellParameter::SetValue(double value)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).value = value;
+}
+
+void
+OranCommandLte2LteCellParameter::SetIsDelta(bool isDelta)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).isDelta = isDelta;
+}
+
+Ptr<OranCommandLte2LteCellParameter>
+OranCommandLte2LteCellParameter::Create(uint64_t targetE2NodeId,
+                                         const std::string& parameterName,
+                                         double value,
+                                         bool isDelta)
+{
+    Ptr<OranCommandLte2LteCellParameter> command = Acquire<OranCommandLte2LteCellParameter>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload =
+        OranCellParameterPayload{ParseCellControlParameter(parameterName), value, isDelta};
+    command->m_parameterName = parameterName;
+    return command;
+}
+
+Ptr<OranCommandLte2LteCellParameter>
+OranCommandLte2LteCellParameter::Create(uint64_t targetE2NodeId,
+                                        OranCellControlParameter parameter,
+                                        double value,
+                                        bool isDelta)
+{
+    Ptr<OranCommandLte2LteCellParameter> command = Acquire<OranCommandLte2LteCellParameter>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload = OranCellParameterPayload{parameter, value, isDelta};
+    command->m_parameterName = CellControlParameterToString(parameter);
+    return command;
 }
 
 } // namespace ns3
@@ -22,13 +22,25 @@ class OranCommandLte2LteCellParameter : public OranCommand
 
     std::string ToString() const override;
     std::string GetParameterName() const;
+    OranCellControlParameter GetParameter() const;
     double GetValue() const;
     bool IsDelta() const;
 
+    static Ptr<OranCommandLte2LteCellParameter> Create(uint64_t targetE2NodeId,
+                                                       const std::string& parameterName,
+                                                       double value,
+                                                       bool isDelta);
+    static Ptr<OranCommandLte2LteCellParameter> Create(uint64_t targetE2NodeId,
+                                                       OranCellControlParameter parameter,
+                                                       double value,
+                                                       bool isDelta);
+
   private:
+    void SetParameterName(std::string parameterName);
+    void SetValue(double value);
+    void SetIsDelta(bool isDelta);
+
     std::string m_parameterName;
-    double m_value;
-    bool m_isDelta;
 };
 
 } // namespace ns3
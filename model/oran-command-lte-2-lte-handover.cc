@@ -50,12 +50,14 @@ OranCommandLte2LteHandover::GetTypeId()
             .AddAttribute("TargetCellId",
                           "The ID of the LTE cell to handover to.",
                           UintegerValue(0),
-                          MakeUintegerAccessor(&OranCommandLte2LteHandover::m_targetCellId),
+                          MakeUintegerAccessor(&OranCommandLte2LteHandover::SetTargetCellId,
+                                               &OranCommandLte2LteHandover::GetTargetCellId),
                           MakeUintegerChecker<uint16_t>())
             .AddAttribute("TargetRnti",
                           "The current RNTI of the UE to handover.",
                           UintegerValue(0),
-                          MakeUintegerAccessor(&OranCommandLte2LteHandover::m_targetRnti),
+                          MakeUintegerAccessor(&OranCommandLte2LteHandover::SetTargetRnti,
+                                               &OranCommandLte2LteHandover::GetTargetRnti),
                           MakeUintegerChecker<uint16_t>());
 
     return tid;
@@ -65,6 +67,10 @@ OranCommandLte2LteHandover::OranCommandLte2LteHandover()
     : OranCommand()
 {
     NS_LOG_FUNCTION(this);
+
+    m_data.rat = OranCommandRat::LTE;
+
+    m_data.payload = OranHandoverPayload();
 }
 
 OranCommandLte2LteHandover::~OranCommandLte2LteHandover()
@@ -80,18 +86,32 @@ OranCommandLte2LteHandover::ToString() const
     std::stringstream ss;
 
     ss << "OranCommandLte2LteHandover("
-       << "TargetE2NodeId = " << GetTargetE2NodeId() << "; TargetCellId = " << m_targetCellId
-       << "; TargetRnti = " << m_targetRnti << ")";
+       << "TargetE2NodeId = " << GetTargetE2NodeId() << "; TargetCellId = " << GetTargetCellId()
+       << "; TargetRnti = " << GetTargetRnti() << ")";
 
     return ss.str();
 }
 
+Ptr<OranCommandLte2LteHandover>
+OranCommandLte2LteHandover::Create(uint64_t targetE2NodeId,
+                                   uint16_t targetCellId,
+                                   uint16_t targetRnti)
+{
+    NS_LOG_FUNCTION(targetE2NodeId << targetCellId << targetRnti);
+
+    Ptr<OranCommandLte2LteHandover> command = Acquire<OranCommandLte2LteHandover>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload = OranHandoverPayload{targetCellId, targetRnti};
+
+    return command;
+}
+
 uint16_t
 OranCommandLte2LteHandover::GetTargetCellId() const
 {
     NS_LOG_FUNCTION(this);
 
-    return m_targetCellId;
+    return std::get<OranHandoverPayload>(m_data.payload).targetCellId;
 }
 
 uint16_t
@@ -99,7 +119,23 @@ OranCommandLte2LteHandover::GetTargetRnti() const
 {
     NS_LOG_FUNCTION(this);
 
-    return m_targetRnti;
+    return std::get<OranHandoverPayload>(m_data.payload).targetRnti;
+}
+
+void
+OranCommandLte2LteHandover::SetTargetCellId(uint16_t targetCellId)
+{
+    NS_LOG_FUNCTION(this << targetCellId);
+
+    std::get<OranHandoverPayload>(m_data.payload).targetCellId = targetCellId;
+}
+
+void
+OranCommandLte2LteHandover::SetTargetRnti(uint16_t targetRnti)
+{
+    NS_LOG_FUNCTION(this << targetRnti);
+
+    std::get<OranHandoverPayload>(m_data.payload).targetRnti = targetRnti;
 }
 
 } // namespace ns3
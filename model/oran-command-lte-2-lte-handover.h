@@ -63,15 +63,31 @@ class OranCommandLte2LteHandover : public OranCommand
 
     std::string ToString() const override;
 
+    /**
+     * Creates a handover command without going through the attribute system.
+     *
+     * @param targetE2NodeId The E2 Node ID of the serving eNB.
+     * @param targetCellId The ID of the cell to handover to.
+     * @param targetRnti The RNTI of the UE to handover.
+     * @return The command.
+     */
+    static Ptr<OranCommandLte2LteHandover> Create(uint64_t targetE2NodeId,
+                                                  uint16_t targetCellId,
+                                                  uint16_t targetRnti);
+
   private:
     /**
-     * The ID of the cell to handover to.
+     * Sets the ID of the cell to handover to.
+     *
+     * @param targetCellId The cell ID.
      */
-    uint16_t m_targetCellId;
+    void SetTargetCellId(uint16_t targetCellId);
     /**
-     * The RNTI of the UE to handover.
+     * Sets the RNTI of the UE to handover.
+     *
+     * @param targetRnti The RNTI.
      */
-    uint16_t m_targetRnti;
+    void SetTargetRnti(uint16_t targetRnti);
 
   public:
     /**
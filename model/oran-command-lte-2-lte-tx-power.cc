@@ -19,7 +19,8 @@ OranCommandLte2LteTxPower::GetTypeId()
     .AddAttribute("PowerDeltaDb",
                   "Adjustment in dB to apply to TxPower",
                   DoubleValue(0.0),
-                  MakeDoubleAccessor(&OranCommandLte2LteTxPower::m_powerDeltaDb),
+                  MakeDoubleAccessor(&OranCommandLte2LteTxPower::SetPowerDeltaDb,
+                                     &OranCommandLte2LteTxPower::GetPowerDeltaDb),
                   MakeDoubleChecker<double>());
   return tid;
 }
@@ -27,6 +28,8 @@ OranCommandLte2LteTxPower::GetTypeId()
 OranCommandLte2LteTxPower::OranCommandLte2LteTxPower()
 {
   NS_LOG_FUNCTION(this);
+  m_data.rat = OranCommandRat::LTE;
+  m_data.payload = OranTxPowerPayload();
 }
 
 OranCommandLte2LteTxPower::~OranCommandLte2LteTxPower()
@@ -37,7 +40,22 @@ OranCommandLte2LteTxPower::~OranCommandLte2LteTxPower()
 double
 OranCommandLte2LteTxPower::GetPowerDeltaDb() const
 {
-  return m_powerDeltaDb;
+  return std::get<OranTxPowerPayload>(m_data.payload).powerDeltaDb;
+}
+
+void
+OranCommandLte2LteTxPower::SetPowerDeltaDb(double powerDeltaDb)
+{
+  std::get<OranTxPowerPayload>(m_data.payload).powerDeltaDb = powerDeltaDb;
+}
+
+Ptr<OranCommandLte2LteTxPower>
+OranCommandLte2LteTxPower::Create(uint64_t targetE2NodeId, double powerDeltaDb)
+{
+  Ptr<OranCommandLte2LteTxPower> command = Acquire<OranCommandLte2LteTxPower>();
+  command->m_data.targetE2NodeId = targetE2NodeId;
+  command->m_data.payload = OranTxPowerPayload{powerDeltaDb};
+  return command;
 }
 
 } // namespace ns3
@@ -11,6 +11,7 @@
 #include "ns3/string.h"
 
 #include <sstream>
+#include <utility>
 
 namespace ns3
 {
@@ -28,17 +29,20 @@ OranCommandNr2NrCellParameter::GetTypeId()
             .AddAttribute("ParameterName",
                           "NR cell-control parameter name: CIO, TTT, HYS, or RET.",
                           StringValue("CIO"),
-                          MakeStringAccessor(&OranCommandNr2NrCellParameter::m_parameterName),
+                          MakeStringAccessor(&OranCommandNr2NrCellParameter::SetParameterName,
+                                             &OranCommandNr2NrCellParameter::GetParameterName),
                           MakeStringChecker())
             .AddAttribute("Value",
                           "Parameter value or delta.",
                           DoubleValue(0.0),
-                          MakeDoubleAccessor(&OranCommandNr2NrCellParameter::m_value),
+                          MakeDoubleAccessor(&OranCommandNr2NrCellParameter::SetValue,
+                                             &OranCommandNr2NrCellParameter::GetValue),
                           MakeDoubleChecker<double>())
             .AddAttribute("IsDelta",
                           "Whether Value is a delta to add to the current parameter.",
                           BooleanValue(false),
-                          MakeBooleanAccessor(&OranCommandNr2NrCellParameter::m_isDelta),
+                          MakeBooleanAccessor(&OranCommandNr2NrCellParameter::SetIsDelta,
+                                              &OranCommandNr2NrCellParameter::IsDelta),
                           MakeBooleanChecker());
     return tid;
 }
@@ -46,6 +50,8 @@ OranCommandNr2NrCellParameter::GetTypeId()
 OranCommandNr2NrCellParameter::OranCommandNr2NrCellParameter()
 {
     NS_LOG_FUNCTION(this);
+    m_data.rat = OranCommandRat::NR;
+    m_data.payload = OranCellParameterPayload();
 }
 
 OranCommandNr2NrCellParameter::~OranCommandNr2NrCellParameter()
@@ -59,7 +65,7 @@ OranCommandNr2NrCellParameter::ToString() const
     std::ostringstream ss;
     ss << "OranCommandNr2NrCellParameter("
        << "TargetE2NodeId=" << GetTargetE2NodeId() << ";ParameterName=" << m_parameterName
-       << ";Value=" << m_value << ";IsDelta=" << m_isDelta << ")";
+       << ";Value=" << GetValue() << ";IsDelta=" << IsDelta() << ")";
     return ss.str();
 }
 
@@ -69,16 +75,69 @@ OranCommandNr2NrCellParameter::GetParameterName() const
     return m_parameterName;
 }
 
+OranCellControlParameter
+OranCommandNr2NrCellParameter::GetParameter() const
+{
+    return std::get<OranCellParameterPayload>(m_data.payload).parameter;
+}
+
 double
 OranCommandNr2NrCellParameter::GetValue() const
 {
-    return m_value;
+    return std::get<OranCellParameterPayload>(m_data.payload).value;
 }
 
 bool
 OranCommandNr2NrCellParameter::IsDelta() const
 {
-    return m_isDelta;
+    return std::get<OranCellParameterPayload>(m_data.payload).isDelta;
+}
+
+void
+OranCommandNr2NrCellParameter::SetParameterName(std::string parameterName)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).parameter =
+        ParseCellControlParameter(parameterName);
+    m_parameterName = std::move(parameterName);
+}
+
+void
+OranCommandNr2NrCellParameter::SetValue(double value)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).value = value;
+}
+
+void
+OranCommandNr2NrCellParameter::SetIsDelta(bool isDelta)
+{
+    std::get<OranCellParameterPayload>(m_data.payload).isDelta = isDelta;
+}
+
+Ptr<OranCommandNr2NrCellParameter>
+OranCommandNr2NrCellParameter::Create(uint64_t targetE2NodeId,
+                                       const std::string& parameterName,
+                                       double value,
+                                       bool isDelta)
+{
+    Ptr<OranCommandNr2NrCellParameter> command = Acquire<OranCommandNr2NrCellParameter>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload =
+        OranCellParameterPayload{ParseCellControlParameter(parameterName), value, isDelta};
+    command->m_parameterName = parameterName;
+    return command;
+}
+
+Ptr<OranCommandNr2NrCellParameter>
+OranCommandNr2NrCellParameter::Create(uint64_t targetE2NodeId,
+                                      OranCellControlParameter parameter,
+                                      double value,
+                                      bool isDelta)
+{
+    Ptr<OranCommandNr2NrCellParameter> command = Acquire<OranCommandNr2NrCellParameter>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload = OranCellParameterPayload{parameter, value, isDelta};
+    command->m_parameterName = CellControlParameterToString(parameter);
+    return command;
 }
 
 } // namespace ns3
@@ -25,12 +25,14 @@ OranCommandNr2NrHandover::GetTypeId()
             .AddAttribute("TargetCellId",
                           "The ID of the NR cell to handover to.",
                           UintegerValue(0),
-                          MakeUintegerAccessor(&OranCommandNr2NrHandover::m_targetCellId),
+                          MakeUintegerAccessor(&OranCommandNr2NrHandover::SetTargetCellId,
+                                               &OranCommandNr2NrHandover::GetTargetCellId),
                           MakeUintegerChecker<uint16_t>())
             .AddAttribute("TargetRnti",
                           "The current RNTI of the UE to handover.",
                           UintegerValue(0),
-                          MakeUintegerAccessor(&OranCommandNr2NrHandover::m_targetRnti),
+                          MakeUintegerAccessor(&OranCommandNr2NrHandover::SetTargetRnti,
+                                               &OranCommandNr2NrHandover::GetTargetRnti),
                           MakeUintegerChecker<uint16_t>());
 
     return tid;
@@ -40,6 +42,10 @@ OranCommandNr2NrHandover::OranCommandNr2NrHandover()
     : OranCommand()
 {
     NS_LOG_FUNCTION(this);
+
+    m_data.rat = OranCommandRat::NR;
+
+    m_data.payload = OranHandoverPayload();
 }
 
 OranCommandNr2NrHandover::~OranCommandNr2NrHandover()
@@ -55,18 +61,32 @@ OranCommandNr2NrHandover::ToString() const
     std::stringstream ss;
 
     ss << "OranCommandNr2NrHandover("
-       << "TargetE2NodeId = " << GetTargetE2NodeId() << "; TargetCellId = " << m_targetCellId
-       << "; TargetRnti = " << m_targetRnti << ")";
+       << "TargetE2NodeId = " << GetTargetE2NodeId() << "; TargetCellId = " << GetTargetCellId()
+       << "; TargetRnti = " << GetTargetRnti() << ")";
 
     return ss.str();
 }
 
+Ptr<OranCommandNr2NrHandover>
+OranCommandNr2NrHandover::Create(uint64_t targetE2NodeId,
+                                 uint16_t targetCellId,
+                                 uint16_t targetRnti)
+{
+    NS_LOG_FUNCTION(targetE2NodeId << targetCellId << targetRnti);
+
+    Ptr<OranCommandNr2NrHandover> command = Acquire<OranCommandNr2NrHandover>();
+    command->m_data.targetE2NodeId = targetE2NodeId;
+    command->m_data.payload = OranHandoverPayload{targetCellId, targetRnti};
+
+    return command;
+}
+
 uint16_t
 OranCommandNr2NrHandover::GetTargetCellId() const
 {
     NS_LOG_FUNCTION(this);
 
-    return m_targetCellId;
+    return std::get<OranHandoverPayload>(m_data.payload).targetCellId;
 }
 
 uint16_t
@@ -74,7 +94,23 @@ OranCommandNr2NrHandover::GetTargetRnti() const
 {
     NS_LOG_FUNCTION(this);
 
-    return m_targetRnti;
+    return std::get<OranHandoverPayload>(m_data.payload).targetRnti;
+}
+
+void
+OranCommandNr2NrHandover::SetTargetCellId(uint16_t targetCellId)
+{
+    NS_LOG_FUNCTION(this << targetCellId);
+
+    std::get<OranHandoverPayload>(m_data.payload).targetCellId = targetCellId;
+}
+
+void
+OranCommandNr2NrHandover::SetTargetRnti(uint16_t targetRnti)
+{
+    NS_LOG_FUNCTION(this << targetRnti);
+
+    std::get<OranHandoverPayload>(m_data.payload).targetRnti = targetRnti;
 }
 
 } // namespace ns3
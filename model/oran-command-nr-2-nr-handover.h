@@ -38,15 +38,31 @@ class OranCommandNr2NrHandover : public OranCommand
 
     std::string ToString() const override;
 
+    /**
+     * Creates a handover command without going through the attribute system.
+     *
+     * @param targetE2NodeId The E2 Node ID of the serving gNB.
+     * @param targetCellId The ID of the cell to handover to.
+     * @param targetRnti The RNTI of the UE to handover.
+     * @return The command.
+     */
+    static Ptr<OranCommandNr2NrHandover> Create(uint64_t targetE2NodeId,
+                                                uint16_t targetCellId,
+                                                uint16_t targetRnti);
+
   private:
     /**
-     * The ID of the cell to handover to.
+     * Sets the ID of the cell to handover to.
+     *
+     * @param targetCellId The cell ID.
      */
-    uint16_t m_targetCellId;
+    void SetTargetCellId(uint16_t targetCellId);
     /**
-     * The RNTI of the UE to handover.
+     * Sets the RNTI of the UE to handover.
+     *
+     * @param targetRnti The RNTI.
      */
-    uint16_t m_targetRnti;
+    void SetTargetRnti(uint16_t targetRnti);
 
   public:
     /**
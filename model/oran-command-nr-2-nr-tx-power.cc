@@ -19,7 +19,8 @@ OranCommandNr2NrTxPower::GetTypeId()
     .AddAttribute("PowerDeltaDb",
                   "Adjustment in dB to apply to TxPower",
                   DoubleValue(0.0),
-                  MakeDoubleAccessor(&OranCommandNr2NrTxPower::m_powerDeltaDb),
+                  MakeDoubleAccessor(&OranCommandNr2NrTxPower::SetPowerDeltaDb,
+                                     &OranCommandNr2NrTxPower::GetPowerDeltaDb),
                   MakeDoubleChecker<double>());
   return tid;
 }
@@ -27,6 +28,8 @@ OranCommandNr2NrTxPower::GetTypeId()
 OranCommandNr2NrTxPower::OranCommandNr2NrTxPower()
 {
   NS_LOG_FUNCTION(this);
+  m_data.rat = OranCommandRat::NR;
+  m_data.payload = OranTxPowerPayload();
 }
 
 OranCommandNr2NrTxPower::~OranCommandNr2NrTxPower()
@@ -37,7 +40,22 @@ OranCommandNr2NrTxPower::~OranCommandNr2NrTxPower()
 double
 OranCommandNr2NrTxPower::GetPowerDeltaDb() const
 {
-  return m_powerDeltaDb;
+  return std::get<OranTxPowerPayload>(m_data.payload).powerDeltaDb;
+}
+
+void
+OranCommandNr2NrTxPower::SetPowerDeltaDb(double powerDeltaDb)
+{
+  std::get<OranTxPowerPayload>(m_data.payload).powerDeltaDb = powerDeltaDb;
+}
+
+Ptr<OranCommandNr2NrTxPower>
+OranCommandNr2NrTxPower::Create(uint64_t targetE2NodeId, double powerDeltaDb)
+{
+  Ptr<OranCommandNr2NrTxPower> command = Acquire<OranCommandNr2NrTxPower>();
+  command->m_data.targetE2NodeId = targetE2NodeId;
+  command->m_data.payload = OranTxPowerPayload{powerDeltaDb};
+  return command;
 }
 
 } // namespace ns3
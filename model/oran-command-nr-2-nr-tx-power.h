@@ -23,8 +23,15 @@ public:
 
   double GetPowerDeltaDb() const;
 
+  /**
+   * \brief Creates a TxPower command without going through the attribute system.
+   * \param targetE2NodeId E2 Node ID of the gNB.
+   * \param powerDeltaDb dB to add (can be negative).
+   */
+  static Ptr<OranCommandNr2NrTxPower> Create(uint64_t targetE2NodeId, double powerDeltaDb);
+
 private:
-  double m_powerDeltaDb; //!< dB to add (can be negative)
+  void SetPowerDeltaDb(double powerDeltaDb);
 };
 
 } // namespace ns3
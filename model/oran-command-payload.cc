@@ -0,0 +1,69 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-command-payload.h"
+
+#include <cctype>
+
+namespace ns3
+{
+
+namespace
+{
+
+/**
+ * Compares two names ignoring case.
+ */
+bool
+EqualsIgnoreCase(const std::string& name, const char* expected)
+{
+    std::size_t i = 0;
+    for (; i < name.size() && expected[i] != '\0'; i++)
+    {
+        if (std::toupper(static_cast<unsigned char>(name[i])) != expected[i])
+        {
+            return false;
+        }
+    }
+    return i == name.size() && expected[i] == '\0';
+}
+
+} // namespace
+
+OranCellControlParameter
+ParseCellControlParameter(const std::string& name)
+{
+    for (auto parameter : {OranCellControlParameter::CIO,
+                           OranCellControlParameter::TTT,
+                           OranCellControlParameter::HYS,
+                           OranCellControlParameter::RET})
+    {
+        if (EqualsIgnoreCase(name, CellControlParameterToString(parameter)))
+        {
+            return parameter;
+        }
+    }
+    return OranCellControlParameter::UNKNOWN;
+}
+
+const char*
+CellControlParameterToString(OranCellControlParameter parameter)
+{
+    switch (parameter)
+    {
+    case OranCellControlParameter::CIO:
+        return "CIO";
+    case OranCellControlParameter::TTT:
+        return "TTT";
+    case OranCellControlParameter::HYS:
+        return "HYS";
+    case OranCellControlParameter::RET:
+        return "RET";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+} // namespace ns3
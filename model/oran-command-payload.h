@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_COMMAND_PAYLOAD_H
+#define ORAN_COMMAND_PAYLOAD_H
+
+#include <cstdint>
+#include <string>
+#include <variant>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Cell-control parameters a cell-parameter command can set, resolved from
+ * the parameter name when the command is built.
+ */
+enum class OranCellControlParameter : uint8_t
+{
+    CIO,     //!< Cell individual offset (dB).
+    TTT,     //!< Time to trigger (s).
+    HYS,     //!< Handover hysteresis (dB).
+    RET,     //!< Remote electrical tilt (degrees).
+    UNKNOWN, //!< A name that is not a known parameter.
+};
+
+/**
+ * Resolves a cell-control parameter name, ignoring case.
+ *
+ * @param name The parameter name ("CIO", "TTT", "HYS", or "RET").
+ * @return The parameter, or OranCellControlParameter::UNKNOWN.
+ */
+OranCellControlParameter ParseCellControlParameter(const std::string& name);
+
+/**
+ * @param parameter The parameter.
+ * @return The canonical name of the parameter.
+ */
+const char* CellControlParameterToString(OranCellControlParameter parameter);
+
+/**
+ * Payload of a handover command: hand the UE over to another cell.
+ */
+struct OranHandoverPayload
+{
+    uint16_t targetCellId = 0; //!< The ID of the cell to handover to.
+    uint16_t targetRnti = 0;   //!< The RNTI of the UE to handover.
+};
+
+/**
+ * Payload of a TxPower command: change the cell's TxPower by a delta.
+ */
+struct OranTxPowerPayload
+{
+    double powerDeltaDb = 0.0; //!< dB to add (can be negative).
+};
+
+/**
+ * Payload of a cell-parameter command: set or adjust a cell-control
+ * parameter.
+ */
+struct OranCellParameterPayload
+{
+    OranCellControlParameter parameter = OranCellControlParameter::CIO; //!< The parameter.
+    double value = 0.0;   //!< The value or delta.
+    bool isDelta = false; //!< Whether value is added to the current value.
+};
+
+/**
+ * The action a command carries, tagged by type. std::monostate marks a
+ * command without an action the E2 nodes act on.
+ */
+typedef std::variant<std::monostate, OranHandoverPayload, OranTxPowerPayload, OranCellParameterPayload>
+    OranCommandPayload;
+
+/**
+ * The radio access technology of the E2 nodes a command is for. The
+ * payloads are the same for LTE and NR, so the E2 node terminators check it
+ * before acting on one.
+ */
+enum class OranCommandRat : uint8_t
+{
+    NONE, //!< A command without an action the E2 nodes act on.
+    LTE,  //!< LTE eNBs.
+    NR,   //!< NR gNBs.
+};
+
+/**
+ * @ingroup oran
+ *
+ * Compact, trivially copyable form of a RIC command: the target E2 node,
+ * its RAT, and the tagged action. Every OranCommand carries one, so the E2
+ * node terminators dispatch on it with std::visit instead of comparing
+ * TypeIds.
+ */
+struct OranCommandData
+{
+    uint64_t targetE2NodeId = 0;              //!< The E2 Node ID of the recipient.
+    OranCommandRat rat = OranCommandRat::NONE; //!< The RAT of the recipient.
+    OranCommandPayload payload;               //!< The action.
+};
+
+/**
+ * Builds a std::visit visitor out of lambdas, one per payload type.
+ */
+template <class... Ts>
+struct OranPayloadVisitor : Ts...
+{
+    using Ts::operator()...;
+};
+
+/**
+ * Deduction guide for OranPayloadVisitor.
+ */
+template <class... Ts>
+OranPayloadVisitor(Ts...) -> OranPayloadVisitor<Ts...>;
+
+} // namespace ns3
+
+#endif // ORAN_COMMAND_PAYLOAD_H
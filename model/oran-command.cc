@@ -49,7 +49,8 @@ OranCommand::GetTypeId()
                             .AddAttribute("TargetE2NodeId",
                                           "The E2 Node ID of the recipient of this command",
                                           UintegerValue(0),
-                                          MakeUintegerAccessor(&OranCommand::m_targetE2NodeId),
+                                          MakeUintegerAccessor(&OranCommand::SetTargetE2NodeId,
+                                                               &OranCommand::GetTargetE2NodeId),
                                           MakeUintegerChecker<uint64_t>());
 
     return tid;
@@ -79,7 +80,23 @@ OranCommand::GetTargetE2NodeId() const
 {
     NS_LOG_FUNCTION(this);
 
-    return m_targetE2NodeId;
+    return m_data.targetE2NodeId;
+}
+
+const OranCommandData&
+OranCommand::GetData() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_data;
+}
+
+void
+OranCommand::SetTargetE2NodeId(uint64_t targetE2NodeId)
+{
+    NS_LOG_FUNCTION(this << targetE2NodeId);
+
+    m_data.targetE2NodeId = targetE2NodeId;
 }
 
 } // namespace ns3
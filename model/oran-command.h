@@ -31,9 +31,13 @@
 #ifndef ORAN_COMMAND_H
 #define ORAN_COMMAND_H
 
+#include "oran-command-payload.h"
+
 #include "ns3/object.h"
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -45,6 +49,10 @@ namespace ns3
  * the GetTargetE2NodeId method for all the Commands. This base class can
  * be instantiated, but the Command issued lacks any meaning and will be
  * silently ignored by the E2 Node Terminators.
+ *
+ * Every Command keeps its target and action in a compact OranCommandData,
+ * which subclasses fill in and the E2 Node Terminators dispatch on, so the
+ * Object is only a thin wrapper kept for the attribute and Ptr based API.
  */
 class OranCommand : public Object
 {
@@ -75,14 +83,72 @@ class OranCommand : public Object
      * @return The target E2 Node Id.
      */
     uint64_t GetTargetE2NodeId() const;
+    /**
+     * Get the compact form of this command.
+     *
+     * @return The target E2 Node ID and the action of this command.
+     */
+    const OranCommandData& GetData() const;
+
+  protected:
+    /**
+     * The most Commands of one type kept for reuse by Acquire.
+     */
+    static constexpr std::size_t kMaxPooledCommands = 4096;
+
+    /**
+     * Get a Command of type T for a factory to fill in. Commands rarely
+     * outlive the LM query cycle they are built in, so a Command that only
+     * the pool of its type still references is reused, and a new one is
+     * created only when all of them are in use.
+     *
+     * @tparam T The Command type.
+     * @return The Command, holding whatever its last user set.
+     */
+    template <typename T>
+    static Ptr<T> Acquire();
+
+    /**
+     * The target E2 Node Id and the action of this command.
+     */
+    OranCommandData m_data;
 
   private:
     /**
-     * The target E2 Node Id
+     * Set the target E2 Node ID.
+     *
+     * @param targetE2NodeId The target E2 Node Id.
      */
-    uint64_t m_targetE2NodeId;
+    void SetTargetE2NodeId(uint64_t targetE2NodeId);
 }; // class OranCommand
 
+template <typename T>
+Ptr<T>
+OranCommand::Acquire()
+{
+    static std::vector<Ptr<T>> pool;
+    static std::size_t next = 0;
+
+    // Start after the Command handed out last, at the oldest one, which is
+    // the most likely to be free.
+    for (std::size_t i = 0; i < pool.size(); i++)
+    {
+        Ptr<T>& command = pool[next];
+        next = (next + 1) % pool.size();
+        if (command->GetReferenceCount() == 1)
+        {
+            return command;
+        }
+    }
+
+    Ptr<T> command = CreateObject<T>();
+    if (pool.size() < kMaxPooledCommands)
+    {
+        pool.push_back(command);
+    }
+    return command;
+}
+
 } // namespace ns3
 
 #endif /* ORAN_COMMAND_H */
@@ -36,6 +36,9 @@
 #include "ns3/string.h"
 
 #include <limits>
+#include <string>
+#include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -44,6 +47,32 @@ NS_LOG_COMPONENT_DEFINE("OranDataRepositorySqlite");
 
 NS_OBJECT_ENSURE_REGISTERED(OranDataRepositorySqlite);
 
+namespace
+{
+
+/**
+ * Copy every page of one database into another with the SQLite online
+ * backup API, aborting on failure.
+ *
+ * @param from The source database.
+ * @param to The destination database.
+ * @param path The path of the checkpoint, for error messages.
+ */
+void
+CopyDb(sqlite3* from, sqlite3* to, const std::string& path)
+{
+    sqlite3_backup* backup = sqlite3_backup_init(to, "main", from, "main");
+    NS_ABORT_MSG_IF(backup == nullptr,
+                    "Could not copy checkpoint \"" << path << "\": " << sqlite3_errmsg(to));
+
+    sqlite3_backup_step(backup, -1);
+    int rc = sqlite3_backup_finish(backup);
+    NS_ABORT_MSG_IF(rc != SQLITE_OK,
+                    "Could not copy checkpoint \"" << path << "\": " << sqlite3_errstr(rc));
+}
+
+} // namespace
+
 TypeId
 OranDataRepositorySqlite::GetTypeId()
 {
@@ -68,7 +97,9 @@ OranDataRepositorySqlite::GetTypeId()
 
 OranDataRepositorySqlite::OranDataRepositorySqlite()
     : OranDataRepository(),
-      m_db(nullptr)
+      m_db(nullptr),
+      m_transactionDepth(0),
+      m_checkpointLoaded(false)
 {
     NS_LOG_FUNCTION(this);
 
@@ -106,6 +137,97 @@ OranDataRepositorySqlite::Deactivate()
     OranDataRepository::Deactivate();
 }
 
+void
+OranDataRepositorySqlite::BeginTransaction()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_active && m_transactionDepth++ == 0)
+    {
+        RunStatement("BEGIN TRANSACTION;");
+    }
+}
+
+void
+OranDataRepositorySqlite::CommitTransaction()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_transactionDepth > 0 && --m_transactionDepth == 0 && IsDbOpen())
+    {
+        RunStatement("COMMIT TRANSACTION;");
+    }
+}
+
+void
+OranDataRepositorySqlite::SaveCheckpoint(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+
+    NS_ABORT_MSG_IF(!IsDbOpen(), "Attempting to checkpoint a repository with no open database");
+
+    sqlite3* file = nullptr;
+    if (sqlite3_open(path.c_str(), &file) != SQLITE_OK)
+    {
+        NS_ABORT_MSG("Could not open checkpoint \"" << path << "\": " << sqlite3_errmsg(file));
+    }
+
+    CopyDb(m_db, file, path);
+    sqlite3_close(file);
+}
+
+void
+OranDataRepositorySqlite::LoadCheckpoint(const std::string& path, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << path << timeShift);
+
+    NS_ABORT_MSG_IF(!IsDbOpen(), "Attempting to load a checkpoint with no open database");
+    NS_ABORT_MSG_IF(m_transactionDepth > 0, "Attempting to load a checkpoint in a transaction");
+
+    sqlite3* file = nullptr;
+    if (sqlite3_open_v2(path.c_str(), &file, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK)
+    {
+        NS_ABORT_MSG("Could not open checkpoint \"" << path << "\": " << sqlite3_errmsg(file));
+    }
+
+    CopyDb(file, m_db, path);
+    sqlite3_close(file);
+
+    // The checkpoint may have been written before some tables existed.
+    InitDb();
+
+    if (!timeShift.IsZero())
+    {
+        std::vector<std::string> tables;
+        sqlite3_stmt* stmt = nullptr;
+        sqlite3_prepare_v2(m_db,
+                           "SELECT m.name FROM sqlite_master AS m "
+                           "JOIN pragma_table_info(m.name) AS p "
+                           "WHERE m.type = 'table' AND p.name = 'simulationtime';",
+                           -1,
+                           &stmt,
+                           0);
+        int rc;
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            tables.emplace_back(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0)));
+        }
+        CheckQueryReturnCode(stmt, rc);
+        sqlite3_finalize(stmt);
+
+        BeginTransaction();
+        for (const auto& table : tables)
+        {
+            RunStatement("UPDATE " + table + " SET simulationtime = simulationtime + " +
+                         std::to_string(timeShift.GetTimeStep()) + ";");
+        }
+        CommitTransaction();
+    }
+
+    RebuildCellRsrpIndexes();
+    m_checkpointLoaded = true;
+}
+
 bool
 OranDataRepositorySqlite::IsNodeRegistered(uint64_t e2NodeId)
 {
@@ -205,6 +327,10 @@ OranDataRepositorySqlite::RegisterNodeLteUe(uint64_t id, uint64_t imsi)
     {
         int rc;
         sqlite3_stmt* stmt = nullptr;
+        if (id == 0 && m_checkpointLoaded)
+        {
+            id = GetRestoredE2NodeId(GET_LTE_UE_E2NODEID_FROM_IMSI, imsi);
+        }
         e2NodeId = RegisterNode(OranNearRtRic::NodeType::LTEUE, id);
 
         sqlite3_prepare_v2(m_db, m_queryStmtsStrings[INSERT_LTE_UE_NODE].c_str(), -1, &stmt, 0);
@@ -229,6 +355,10 @@ OranDataRepositorySqlite::RegisterNodeNrUe(uint64_t id, uint64_t imsi)
     {
         int rc;
         sqlite3_stmt* stmt = nullptr;
+        if (id == 0 && m_checkpointLoaded)
+        {
+            id = GetRestoredE2NodeId(GET_NR_UE_E2NODEID_FROM_IMSI, imsi);
+        }
         e2NodeId = RegisterNode(OranNearRtRic::NodeType::NRUE, id);
 
         sqlite3_prepare_v2(m_db, m_queryStmtsStrings[INSERT_NR_UE_NODE].c_str(), -1, &stmt, 0);
@@ -254,6 +384,10 @@ OranDataRepositorySqlite::RegisterNodeLteEnb(uint64_t id, uint16_t cellId)
     {
         int rc;
         sqlite3_stmt* stmt = nullptr;
+        if (id == 0 && m_checkpointLoaded)
+        {
+            id = GetRestoredE2NodeId(GET_LTE_ENB_E2NODEID_FROM_CELLID, cellId);
+        }
         e2NodeId = RegisterNode(OranNearRtRic::NodeType::LTEENB, id);
 
         sqlite3_prepare_v2(m_db, m_queryStmtsStrings[INSERT_LTE_ENB_NODE].c_str(), -1, &stmt, 0);
@@ -279,6 +413,10 @@ OranDataRepositorySqlite::RegisterNodeNrGnb(uint64_t id, uint16_t cellId)
     {
         int rc;
         sqlite3_stmt* stmt = nullptr;
+        if (id == 0 && m_checkpointLoaded)
+        {
+            id = GetRestoredE2NodeId(GET_NR_GNB_E2NODEID_FROM_CELLID, cellId);
+        }
         e2NodeId = RegisterNode(OranNearRtRic::NodeType::NRGNB, id);
 
         sqlite3_prepare_v2(m_db, m_queryStmtsStrings[INSERT_NR_GNB_NODE].c_str(), -1, &stmt, 0);
@@ -321,6 +459,9 @@ OranDataRepositorySqlite::DeregisterNode(uint64_t e2NodeId)
                              rc,
                              FormatBoundArgsList(e2NodeId, false, Simulator::Now().GetTimeStep()));
         sqlite3_finalize(stmt);
+
+        m_lteCellRsrpIndex.Suspend(e2NodeId);
+        m_nrCellRsrpIndex.Suspend(e2NodeId);
     }
     return retVal;
 }
@@ -386,6 +527,8 @@ OranDataRepositorySqlite::SaveLteUeCellInfo(uint64_t e2NodeId,
                                  rc,
                                  FormatBoundArgsList(e2NodeId, cellId, rnti, t.GetTimeStep()));
             sqlite3_finalize(stmt);
+
+            m_lteCellRsrpIndex.UpdateServingCell(e2NodeId, cellId, t);
         }
     }
 }
@@ -417,6 +560,8 @@ OranDataRepositorySqlite::SaveNrUeCellInfo(uint64_t e2NodeId,
                                  rc,
                                  FormatBoundArgsList(e2NodeId, cellId, rnti, t.GetTimeStep()));
             sqlite3_finalize(stmt);
+
+            m_nrCellRsrpIndex.UpdateServingCell(e2NodeId, cellId, t);
         }
     }
 }
@@ -717,6 +862,8 @@ OranDataRepositorySqlite::SaveLteUeRsrpRsrq(uint64_t e2NodeId,
                                                      isServing,
                                                      componentCarrierId));
             sqlite3_finalize(stmt);
+
+            m_lteCellRsrpIndex.UpdateRsrp(e2NodeId, t, cellId, rsrp);
         }
     }
 }
@@ -769,6 +916,122 @@ OranDataRepositorySqlite::SaveNrUeRsrpRsrq(uint64_t e2NodeId,
                                                      isServing,
                                                      componentCarrierId));
             sqlite3_finalize(stmt);
+
+            m_nrCellRsrpIndex.UpdateRsrp(e2NodeId, t, cellId, rsrp);
+        }
+    }
+}
+
+void
+OranDataRepositorySqlite::SaveLteUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                                     Time t,
+                                                     uint16_t rnti,
+                                                     const std::vector<OranUeCellRsrpRsrq>& measurements)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << t << +rnti << measurements.size());
+
+    if (m_active && !measurements.empty())
+    {
+        if (IsNodeRegistered(e2NodeId))
+        {
+            int rc;
+            sqlite3_stmt* stmt = nullptr;
+
+            BeginTransaction();
+            sqlite3_prepare_v2(m_db,
+                               m_queryStmtsStrings[INSERT_LTE_UE_RSRP_RSRQ].c_str(),
+                               -1,
+                               &stmt,
+                               0);
+
+            // The node, time and RNTI are the same for every cell, so only
+            // the per-cell columns are rebound between rows.
+            sqlite3_bind_int64(stmt, 1, e2NodeId);
+            sqlite3_bind_int64(stmt, 2, t.GetTimeStep());
+            sqlite3_bind_int(stmt, 3, rnti);
+            for (const auto& measurement : measurements)
+            {
+                sqlite3_bind_int(stmt, 4, measurement.cellId);
+                sqlite3_bind_double(stmt, 5, measurement.rsrp);
+                sqlite3_bind_double(stmt, 6, measurement.rsrq);
+                sqlite3_bind_int(stmt, 7, measurement.isServingCell);
+                sqlite3_bind_int(stmt, 8, measurement.componentCarrierId);
+
+                rc = sqlite3_step(stmt);
+
+                CheckQueryReturnCode(stmt,
+                                     rc,
+                                     FormatBoundArgsList(e2NodeId,
+                                                         t.GetTimeStep(),
+                                                         rnti,
+                                                         measurement.cellId,
+                                                         measurement.rsrp,
+                                                         measurement.rsrq,
+                                                         measurement.isServingCell,
+                                                         measurement.componentCarrierId));
+                sqlite3_reset(stmt);
+
+                m_lteCellRsrpIndex.UpdateRsrp(e2NodeId, t, measurement.cellId, measurement.rsrp);
+            }
+            sqlite3_finalize(stmt);
+            CommitTransaction();
+        }
+    }
+}
+
+void
+OranDataRepositorySqlite::SaveNrUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                                    Time t,
+                                                    uint16_t rnti,
+                                                    const std::vector<OranUeCellRsrpRsrq>& measurements)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << t << +rnti << measurements.size());
+
+    if (m_active && !measurements.empty())
+    {
+        if (IsNodeRegistered(e2NodeId))
+        {
+            int rc;
+            sqlite3_stmt* stmt = nullptr;
+
+            BeginTransaction();
+            sqlite3_prepare_v2(m_db,
+                               m_queryStmtsStrings[INSERT_NR_UE_RSRP_RSRQ].c_str(),
+                               -1,
+                               &stmt,
+                               0);
+
+            // The node, time and RNTI are the same for every cell, so only
+            // the per-cell columns are rebound between rows.
+            sqlite3_bind_int64(stmt, 1, e2NodeId);
+            sqlite3_bind_int64(stmt, 2, t.GetTimeStep());
+            sqlite3_bind_int(stmt, 3, rnti);
+            for (const auto& measurement : measurements)
+            {
+                sqlite3_bind_int(stmt, 4, measurement.cellId);
+                sqlite3_bind_double(stmt, 5, measurement.rsrp);
+                sqlite3_bind_double(stmt, 6, measurement.rsrq);
+                sqlite3_bind_int(stmt, 7, measurement.isServingCell);
+                sqlite3_bind_int(stmt, 8, measurement.componentCarrierId);
+
+                rc = sqlite3_step(stmt);
+
+                CheckQueryReturnCode(stmt,
+                                     rc,
+                                     FormatBoundArgsList(e2NodeId,
+                                                         t.GetTimeStep(),
+                                                         rnti,
+                                                         measurement.cellId,
+                                                         measurement.rsrp,
+                                                         measurement.rsrq,
+                                                         measurement.isServingCell,
+                                                         measurement.componentCarrierId));
+                sqlite3_reset(stmt);
+
+                m_nrCellRsrpIndex.UpdateRsrp(e2NodeId, t, measurement.cellId, measurement.rsrp);
+            }
+            sqlite3_finalize(stmt);
+            CommitTransaction();
         }
     }
 }
@@ -1293,6 +1556,22 @@ OranDataRepositorySqlite::GetNrUeRsrpRsrq(uint64_t e2NodeId)
     return retVal;
 }
 
+std::tuple<bool, double>
+OranDataRepositorySqlite::GetLteCellWorstServingRsrp(uint16_t cellId)
+{
+    NS_LOG_FUNCTION(this << +cellId);
+
+    return m_lteCellRsrpIndex.GetWorstServingRsrp(cellId);
+}
+
+std::tuple<bool, double>
+OranDataRepositorySqlite::GetNrCellWorstServingRsrp(uint16_t cellId)
+{
+    NS_LOG_FUNCTION(this << +cellId);
+
+    return m_nrCellRsrpIndex.GetWorstServingRsrp(cellId);
+}
+
 void
 OranDataRepositorySqlite::LogCommandE2Terminator(Ptr<OranCommand> cmd)
 {
@@ -1429,6 +1708,13 @@ OranDataRepositorySqlite::CloseDb()
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_transactionDepth > 0)
+    {
+        NS_LOG_WARN("Closing the database with an open transaction; committing it");
+        m_transactionDepth = 0;
+        RunStatement("COMMIT TRANSACTION;");
+    }
+
     sqlite3_close(m_db);
     m_db = nullptr;
 }
@@ -1972,6 +2258,16 @@ OranDataRepositorySqlite::InitStatements()
         "INSERT INTO nr_ue_app_demand "
         "(nodeid, simulationtime, demandmbps) VALUES (?, ?, ?);";
 
+    m_queryStmtsStrings[GET_LTE_UE_E2NODEID_FROM_IMSI] = "SELECT nodeid FROM lteue WHERE imsi = ?;";
+
+    m_queryStmtsStrings[GET_NR_UE_E2NODEID_FROM_IMSI] = "SELECT nodeid FROM nrue WHERE imsi = ?;";
+
+    m_queryStmtsStrings[GET_LTE_ENB_E2NODEID_FROM_CELLID] =
+        "SELECT nodeid FROM lteenb WHERE cellid = ?;";
+
+    m_queryStmtsStrings[GET_NR_GNB_E2NODEID_FROM_CELLID] =
+        "SELECT nodeid FROM nrgnb WHERE cellid = ?;";
+
     m_queryStmtsStrings[LOG_CMM_ACTION] =
         "INSERT INTO cmmaction "
         "(cmmname, simulationtime, description) VALUES (?, ?, ?);";
@@ -2004,4 +2300,123 @@ OranDataRepositorySqlite::RunCreateStatement(std::string statement)
     sqlite3_finalize(stmt);
 }
 
+void
+OranDataRepositorySqlite::RunStatement(const std::string& statement)
+{
+    NS_LOG_FUNCTION(this << statement);
+
+    int rc;
+    sqlite3_stmt* stmt = nullptr;
+
+    sqlite3_prepare_v2(m_db, statement.c_str(), -1, &stmt, 0);
+    rc = sqlite3_step(stmt);
+    CheckQueryReturnCode(stmt, rc);
+    sqlite3_finalize(stmt);
+}
+
+uint64_t
+OranDataRepositorySqlite::GetRestoredE2NodeId(StatementType query, uint64_t id)
+{
+    NS_LOG_FUNCTION(this << query << id);
+
+    uint64_t e2NodeId = 0;
+    sqlite3_stmt* stmt = nullptr;
+
+    sqlite3_prepare_v2(m_db, m_queryStmtsStrings[query].c_str(), -1, &stmt, 0);
+    sqlite3_bind_int64(stmt, 1, id);
+
+    int rc = sqlite3_step(stmt);
+    if (rc == SQLITE_ROW)
+    {
+        e2NodeId = sqlite3_column_int64(stmt, 0);
+        rc = SQLITE_DONE;
+    }
+    CheckQueryReturnCode(stmt, rc, FormatBoundArgsList(id));
+    sqlite3_finalize(stmt);
+
+    return e2NodeId;
+}
+
+void
+OranDataRepositorySqlite::RebuildCellRsrpIndexes()
+{
+    NS_LOG_FUNCTION(this);
+
+    RebuildCellRsrpIndex(m_lteCellRsrpIndex, "lteuecell", "lteuersrprsrq");
+    RebuildCellRsrpIndex(m_nrCellRsrpIndex, "nruecell", "nruersrprsrq");
+}
+
+void
+OranDataRepositorySqlite::RebuildCellRsrpIndex(OranCellRsrpIndex& index,
+                                               const std::string& cellTable,
+                                               const std::string& rsrpTable)
+{
+    NS_LOG_FUNCTION(this << cellTable << rsrpTable);
+
+    // The entries take the times of the rows they come from, not the time of
+    // the restore, so that a report older than the newest restored one is
+    // still ignored, as it would have been before the checkpoint.
+    const std::string ueQuery = "SELECT nodeid FROM " + cellTable + " "
+                                "UNION "
+                                "SELECT nodeid FROM " + rsrpTable + ";";
+    const std::string cellQuery = "SELECT cellid, simulationtime "
+                                  "FROM " + cellTable + " "
+                                  "WHERE nodeid = ? "
+                                  "ORDER BY simulationtime DESC, entryid DESC "
+                                  "LIMIT 1;";
+    const std::string rsrpQuery = "SELECT cellid, rsrp, simulationtime "
+                                  "FROM " + rsrpTable + " "
+                                  "WHERE nodeid = ? "
+                                  "AND simulationtime = ("
+                                  "SELECT MAX(simulationtime) "
+                                  "FROM " + rsrpTable + " "
+                                  "WHERE nodeid = ?"
+                                  ");";
+
+    int rc;
+    sqlite3_stmt* stmt = nullptr;
+
+    std::vector<uint64_t> ueIds;
+    sqlite3_prepare_v2(m_db, ueQuery.c_str(), -1, &stmt, 0);
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    {
+        ueIds.push_back(sqlite3_column_int64(stmt, 0));
+    }
+    CheckQueryReturnCode(stmt, rc);
+    sqlite3_finalize(stmt);
+
+    index.Clear();
+    for (uint64_t ueId : ueIds)
+    {
+        if (!IsNodeRegistered(ueId))
+        {
+            continue;
+        }
+
+        sqlite3_prepare_v2(m_db, cellQuery.c_str(), -1, &stmt, 0);
+        sqlite3_bind_int64(stmt, 1, ueId);
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            index.UpdateServingCell(ueId,
+                                    sqlite3_column_int(stmt, 0),
+                                    TimeStep(sqlite3_column_int64(stmt, 1)));
+        }
+        CheckQueryReturnCode(stmt, rc, FormatBoundArgsList(ueId));
+        sqlite3_finalize(stmt);
+
+        sqlite3_prepare_v2(m_db, rsrpQuery.c_str(), -1, &stmt, 0);
+        sqlite3_bind_int64(stmt, 1, ueId);
+        sqlite3_bind_int64(stmt, 2, ueId);
+        while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            index.UpdateRsrp(ueId,
+                             TimeStep(sqlite3_column_int64(stmt, 2)),
+                             sqlite3_column_int(stmt, 0),
+                             sqlite3_column_double(stmt, 1));
+        }
+        CheckQueryReturnCode(stmt, rc, FormatBoundArgsList(ueId, ueId));
+        sqlite3_finalize(stmt);
+    }
+}
+
 } // namespace ns3
@@ -31,6 +31,7 @@
 #ifndef ORAN_DATA_REPOSITORY_SQLITE_H
 #define ORAN_DATA_REPOSITORY_SQLITE_H
 
+#include "oran-cell-rsrp-index.h"
 #include "oran-data-repository.h"
 
 #include "ns3/traced-callback.h"
@@ -82,6 +83,30 @@ class OranDataRepositorySqlite : public OranDataRepository
      * this method will call CloseDb.
      */
     void Deactivate() override;
+    /**
+     * Begins an SQLite transaction, unless one is already open.
+     */
+    void BeginTransaction() override;
+    /**
+     * Commits the SQLite transaction when the outermost BeginTransaction()
+     * call is matched.
+     */
+    void CommitTransaction() override;
+    /**
+     * Copy the database to a file with the SQLite online backup API.
+     *
+     * @param path The path of the snapshot file.
+     */
+    void SaveCheckpoint(const std::string& path) override;
+    /**
+     * Copy a snapshot file over the database with the SQLite online backup
+     * API, shift the simulation time of every row, and rebuild the in-memory
+     * indexes from the restored rows.
+     *
+     * @param path The path of the snapshot file.
+     * @param timeShift The time to add to the simulation times in the snapshot.
+     */
+    void LoadCheckpoint(const std::string& path, Time timeShift) override;
 
     /* Data Storage API */
     bool IsNodeRegistered(uint64_t e2NodeId) override;
@@ -112,6 +137,31 @@ class OranDataRepositorySqlite : public OranDataRepository
                           double rsrq,
                           bool isServingCell,
                           uint8_t componentCarrierId) override;
+    /**
+     * Stores the measurements with one prepared statement, rebound for
+     * every cell, within one transaction.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     * @param t The time at which the measurements were reported by the node.
+     * @param rnti The RNTI assigned to the UE by the cell.
+     * @param measurements One measurement per cell and component carrier.
+     */
+    void SaveLteUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                    Time t,
+                                    uint16_t rnti,
+                                    const std::vector<OranUeCellRsrpRsrq>& measurements) override;
+    /**
+     * Mirrors SaveLteUeMultiCellRsrpRsrq for NR UEs.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     * @param t The time at which the measurements were reported by the node.
+     * @param rnti The RNTI assigned to the UE by the cell.
+     * @param measurements One measurement per cell and component carrier.
+     */
+    void SaveNrUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                   Time t,
+                                   uint16_t rnti,
+                                   const std::vector<OranUeCellRsrpRsrq>& measurements) override;
 
     std::map<Time, Vector> GetNodePositions(uint64_t e2NodeId,
                                             Time fromTime,
@@ -133,6 +183,8 @@ class OranDataRepositorySqlite : public OranDataRepository
         uint64_t e2NodeId) override;
     std::vector<std::tuple<uint16_t, uint16_t, double, double, bool, uint8_t>> GetNrUeRsrpRsrq(
         uint64_t e2NodeId) override;
+    std::tuple<bool, double> GetLteCellWorstServingRsrp(uint16_t cellId) override;
+    std::tuple<bool, double> GetNrCellWorstServingRsrp(uint16_t cellId) override;
     void SaveLteEnergyRemaining(uint64_t e2NodeId, Time t, double remaining) override;
     double GetLteEnergyRemaining(uint64_t e2NodeId) override;
     void SaveNrEnergyRemaining(uint64_t e2NodeId, Time t, double remaining) override;
@@ -202,7 +254,11 @@ class OranDataRepositorySqlite : public OranDataRepository
         INSERT_NR_UE_RSRP_RSRQ,            //!< Add NR UE RSRP and RSRQ
         INSERT_NR_ENERGY_REMAINING,        //!< Add remaining energy for a gNB
         GET_NR_UE_APP_DEMAND,              //!< Get the last reported UE application demand
-        INSERT_NR_UE_APP_DEMAND            //!< Add a UE application demand report
+        INSERT_NR_UE_APP_DEMAND,           //!< Add a UE application demand report
+        GET_LTE_UE_E2NODEID_FROM_IMSI,     //!< Get the E2 ID of an LTE UE from its IMSI
+        GET_NR_UE_E2NODEID_FROM_IMSI,      //!< Get the E2 ID of an NR UE from its IMSI
+        GET_LTE_ENB_E2NODEID_FROM_CELLID,  //!< Get the E2 ID of an LTE eNB from its cell ID
+        GET_NR_GNB_E2NODEID_FROM_CELLID    //!< Get the E2 ID of an NR gNB from its cell ID
     };
 
     /**
@@ -336,6 +392,11 @@ class OranDataRepositorySqlite : public OranDataRepository
      * The database.
      */
     sqlite3* m_db;
+    /**
+     * The number of BeginTransaction() calls not yet matched by
+     * CommitTransaction().
+     */
+    uint32_t m_transactionDepth;
     /**
      * The file path of the database.
      */
@@ -348,6 +409,21 @@ class OranDataRepositorySqlite : public OranDataRepository
      * Map with the table creation prepared statements' strings
      */
     std::map<CreateStatementType, std::string> m_createStmtsStrings;
+    /**
+     * Worst serving-cell RSRP per LTE cell, updated as LTE UE cell info and
+     * RSRP reports are saved.
+     */
+    OranCellRsrpIndex m_lteCellRsrpIndex;
+    /**
+     * Worst serving-cell RSRP per NR cell, updated as NR UE cell info and
+     * RSRP reports are saved.
+     */
+    OranCellRsrpIndex m_nrCellRsrpIndex;
+    /**
+     * Whether a checkpoint was loaded, so that nodes registering without an
+     * E2 Node ID get back the one they had in it.
+     */
+    bool m_checkpointLoaded;
 
     /**
      * Wrapper for the code needed to run the CREATE statements
@@ -357,6 +433,37 @@ class OranDataRepositorySqlite : public OranDataRepository
      * @param string The string with the SQL CREATE statement to run
      */
     void RunCreateStatement(std::string string);
+    /**
+     * Runs a statement that takes no parameters and returns no rows.
+     *
+     * @param statement The SQL statement.
+     */
+    void RunStatement(const std::string& statement);
+    /**
+     * Look up the E2 Node ID that a node had in a loaded checkpoint.
+     *
+     * @param query The query that maps the ID of the node to its E2 Node ID.
+     * @param id The IMSI or cell ID of the node.
+     *
+     * @return The E2 Node ID, or 0 if the checkpoint has no such node.
+     */
+    uint64_t GetRestoredE2NodeId(StatementType query, uint64_t id);
+    /**
+     * Rebuild the serving-cell RSRP indexes from the latest rows of the
+     * database, after it was replaced by a checkpoint.
+     */
+    void RebuildCellRsrpIndexes();
+    /**
+     * Rebuild one serving-cell RSRP index from the latest cell and RSRP rows
+     * of each registered UE in the tables, keeping the times of the rows.
+     *
+     * @param index The index to rebuild.
+     * @param cellTable The table with the UE cell information.
+     * @param rsrpTable The table with the UE RSRP and RSRQ measurements.
+     */
+    void RebuildCellRsrpIndex(OranCellRsrpIndex& index,
+                              const std::string& cellTable,
+                              const std::string& rsrpTable);
 
 }; // class OranDataRepositorySqlite
 
@@ -30,6 +30,7 @@
 
 #include "oran-data-repository.h"
 
+#include "ns3/abort.h"
 #include "ns3/log.h"
 
 namespace ns3
@@ -83,6 +84,80 @@ OranDataRepository::IsActive() const
     return m_active;
 }
 
+void
+OranDataRepository::BeginTransaction()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranDataRepository::CommitTransaction()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranDataRepository::SaveLteUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                               Time t,
+                                               uint16_t rnti,
+                                               const std::vector<OranUeCellRsrpRsrq>& measurements)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << t << +rnti << measurements.size());
+
+    BeginTransaction();
+    for (const auto& measurement : measurements)
+    {
+        SaveLteUeRsrpRsrq(e2NodeId,
+                          t,
+                          rnti,
+                          measurement.cellId,
+                          measurement.rsrp,
+                          measurement.rsrq,
+                          measurement.isServingCell,
+                          measurement.componentCarrierId);
+    }
+    CommitTransaction();
+}
+
+void
+OranDataRepository::SaveNrUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                              Time t,
+                                              uint16_t rnti,
+                                              const std::vector<OranUeCellRsrpRsrq>& measurements)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << t << +rnti << measurements.size());
+
+    BeginTransaction();
+    for (const auto& measurement : measurements)
+    {
+        SaveNrUeRsrpRsrq(e2NodeId,
+                         t,
+                         rnti,
+                         measurement.cellId,
+                         measurement.rsrp,
+                         measurement.rsrq,
+                         measurement.isServingCell,
+                         measurement.componentCarrierId);
+    }
+    CommitTransaction();
+}
+
+void
+OranDataRepository::SaveCheckpoint(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+
+    NS_ABORT_MSG(GetInstanceTypeId().GetName() << " does not support checkpoints");
+}
+
+void
+OranDataRepository::LoadCheckpoint(const std::string& path, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << path << timeShift);
+
+    NS_ABORT_MSG(GetInstanceTypeId().GetName() << " does not support checkpoints");
+}
+
 void
 OranDataRepository::DoDispose()
 {
@@ -34,13 +34,16 @@
 #include "oran-command.h"
 #include "oran-near-rt-ric.h"
 #include "oran-report.h"
+#include "oran-ue-rsrp-rsrq-aggregator.h"
 
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/vector.h"
 
 #include <map>
+#include <string>
 #include <tuple>
+#include <vector>
 
 namespace ns3
 {
@@ -88,6 +91,37 @@ class OranDataRepository : public Object
      * @return True, if the data storage is active; otherwise, false.
      */
     virtual bool IsActive() const;
+    /**
+     * Starts grouping the writes that follow into a single transaction, so
+     * that a batch of saves reaches the storage at once. Calls may be
+     * nested; only the outermost pair takes effect. The default does
+     * nothing.
+     */
+    virtual void BeginTransaction();
+    /**
+     * Ends a group of writes started with BeginTransaction(). The default
+     * does nothing.
+     */
+    virtual void CommitTransaction();
+    /**
+     * Write a snapshot of the contents of the repository to a file, so that
+     * another run can start from it with LoadCheckpoint(). The default aborts,
+     * for repositories that do not support checkpoints.
+     *
+     * @param path The path of the snapshot file.
+     */
+    virtual void SaveCheckpoint(const std::string& path);
+    /**
+     * Replace the contents of the repository with a snapshot written by
+     * SaveCheckpoint(), adding timeShift to every simulation time in it. Nodes
+     * that register afterwards without an E2 Node ID get back the ID they had
+     * in the snapshot, matched by IMSI or cell ID. The default aborts, for
+     * repositories that do not support checkpoints.
+     *
+     * @param path The path of the snapshot file.
+     * @param timeShift The time to add to the simulation times in the snapshot.
+     */
+    virtual void LoadCheckpoint(const std::string& path, Time timeShift);
 
     /* Data Storage API */
     /**
@@ -246,6 +280,34 @@ class OranDataRepository : public Object
                                   double rsrq,
                                   bool isServingCell,
                                   uint8_t componentCarrierId) = 0;
+    /**
+     * Store the RSRP and RSRQ an LTE UE measured for several cells at the
+     * same time, as in an OranReportLteUeMultiCellRsrpRsrq. The default
+     * implementation calls SaveLteUeRsrpRsrq for every cell within one
+     * transaction.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     * @param t The time at which the measurements were reported by the node.
+     * @param rnti The RNTI assigned to the UE by the cell.
+     * @param measurements One measurement per cell and component carrier.
+     */
+    virtual void SaveLteUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                            Time t,
+                                            uint16_t rnti,
+                                            const std::vector<OranUeCellRsrpRsrq>& measurements);
+    /**
+     * Store the RSRP and RSRQ an NR UE measured for several cells at the same
+     * time. Mirrors SaveLteUeMultiCellRsrpRsrq for NR UEs.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     * @param t The time at which the measurements were reported by the node.
+     * @param rnti The RNTI assigned to the UE by the cell.
+     * @param measurements One measurement per cell and component carrier.
+     */
+    virtual void SaveNrUeMultiCellRsrpRsrq(uint64_t e2NodeId,
+                                           Time t,
+                                           uint16_t rnti,
+                                           const std::vector<OranUeCellRsrpRsrq>& measurements);
 
     /* Data Access API */
     /**
@@ -371,6 +433,24 @@ class OranDataRepository : public Object
      */
     virtual std::vector<std::tuple<uint16_t, uint16_t, double, double, bool, uint8_t>>
     GetNrUeRsrpRsrq(uint64_t e2NodeId) = 0;
+    /**
+     * Gets the lowest RSRP that any registered LTE UE served by a cell reports
+     * for that cell, as found in each UE's last reported RSRP and RSRQ values.
+     *
+     * @param cellId The cell ID.
+     * @return A tuple with a boolean indicating if any served UE reported the
+     * cell, and the lowest RSRP.
+     */
+    virtual std::tuple<bool, double> GetLteCellWorstServingRsrp(uint16_t cellId) = 0;
+    /**
+     * Gets the lowest serving-cell RSRP for an NR cell. Mirrors
+     * GetLteCellWorstServingRsrp.
+     *
+     * @param cellId The cell ID.
+     * @return A tuple with a boolean indicating if any served UE reported the
+     * cell, and the lowest RSRP.
+     */
+    virtual std::tuple<bool, double> GetNrCellWorstServingRsrp(uint16_t cellId) = 0;
     /**
      * Saves the remaining energy for a node at a given time.
      *
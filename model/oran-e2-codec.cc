@@ -0,0 +1,858 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-codec.h"
+
+#include "oran-command-lte-2-lte-cell-parameter.h"
+#include "oran-command-lte-2-lte-handover.h"
+#include "oran-command-lte-2-lte-tx-power.h"
+#include "oran-command-nr-2-nr-cell-parameter.h"
+#include "oran-command-nr-2-nr-handover.h"
+#include "oran-command-nr-2-nr-tx-power.h"
+#include "oran-report-apploss.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-energy-efficiency.h"
+#include "oran-report-lte-ue-app-demand.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-multi-cell-rsrp-rsrq.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
+#include "oran-report-nr-energy-efficiency.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-multi-cell-rsrp-rsrq.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/uinteger.h"
+#include "ns3/vector.h"
+
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <variant>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranE2Codec");
+
+namespace
+{
+
+/**
+ * The first byte of every message.
+ */
+constexpr uint8_t MAGIC = 0xE2;
+
+/**
+ * @return The current value of the monotonic wall clock, in nanoseconds.
+ */
+uint64_t
+NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * Append an unsigned LEB128 varint.
+ *
+ * @param value The value.
+ * @param buffer The buffer.
+ */
+void
+PutVarint(uint64_t value, std::vector<uint8_t>& buffer)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * Append a signed value as a zigzag varint.
+ *
+ * @param value The value.
+ * @param buffer The buffer.
+ */
+void
+PutZigzag(int64_t value, std::vector<uint8_t>& buffer)
+{
+    PutVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63), buffer);
+}
+
+/**
+ * Append a double as 8 little-endian bytes.
+ *
+ * @param value The value.
+ * @param buffer The buffer.
+ */
+void
+PutDouble(double value, std::vector<uint8_t>& buffer)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+    }
+}
+
+/**
+ * Bounds-checked reader of an encoded message. Reading past the end or a
+ * malformed field fails the reader: the error is kept, the remaining bytes
+ * are skipped, and every later read returns zero.
+ */
+struct Reader
+{
+    const uint8_t* data; //!< The next byte.
+    const uint8_t* end;  //!< One past the last byte.
+    std::string error;   //!< The first error, or empty.
+
+    /**
+     * Fail the reader, keeping the first error.
+     *
+     * @param message The error.
+     */
+    void Fail(const std::string& message)
+    {
+        if (error.empty())
+        {
+            error = message;
+        }
+        data = end;
+    }
+
+    /**
+     * @return True if no read failed.
+     */
+    bool Ok() const
+    {
+        return error.empty();
+    }
+
+    /**
+     * @return The next byte.
+     */
+    uint8_t GetU8()
+    {
+        if (data >= end)
+        {
+            Fail("Truncated E2 message");
+            return 0;
+        }
+        return *data++;
+    }
+
+    /**
+     * @return The next unsigned varint.
+     */
+    uint64_t GetVarint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64 && Ok(); shift += 7)
+        {
+            uint8_t byte = GetU8();
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        Fail("Malformed varint in E2 message");
+        return 0;
+    }
+
+    /**
+     * @return The next zigzag varint.
+     */
+    int64_t GetZigzag()
+    {
+        uint64_t value = GetVarint();
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    /**
+     * @return The next unsigned varint, checked to fit 16 bits.
+     */
+    uint16_t GetU16()
+    {
+        uint64_t value = GetVarint();
+        if (value > UINT16_MAX)
+        {
+            Fail("Out of range 16-bit field in E2 message");
+            return 0;
+        }
+        return static_cast<uint16_t>(value);
+    }
+
+    /**
+     * @return The next double.
+     */
+    double GetDouble()
+    {
+        if (end - data < 8)
+        {
+            Fail("Truncated E2 message");
+            return 0.0;
+        }
+        uint64_t bits = 0;
+        for (int i = 0; i < 8; i++)
+        {
+            bits |= static_cast<uint64_t>(data[i]) << (8 * i);
+        }
+        data += 8;
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+/**
+ * Append the RNTI and the measurements of a multi-cell report.
+ *
+ * @param rnti The RNTI.
+ * @param measurements The measurements.
+ * @param buffer The buffer.
+ */
+void
+PutMeasurements(uint16_t rnti,
+                const std::vector<OranUeCellRsrpRsrq>& measurements,
+                std::vector<uint8_t>& buffer)
+{
+    PutVarint(rnti, buffer);
+    PutVarint(measurements.size(), buffer);
+    for (const auto& measurement : measurements)
+    {
+        PutVarint(measurement.cellId, buffer);
+        PutVarint(measurement.componentCarrierId, buffer);
+        buffer.push_back(measurement.isServingCell ? 1 : 0);
+        PutDouble(measurement.rsrp, buffer);
+        PutDouble(measurement.rsrq, buffer);
+    }
+}
+
+/**
+ * Read the measurements of a multi-cell report.
+ *
+ * @param reader The reader.
+ * @return The measurements.
+ */
+std::vector<OranUeCellRsrpRsrq>
+GetMeasurements(Reader& reader)
+{
+    uint64_t count = reader.GetVarint();
+    if (count > static_cast<uint64_t>(reader.end - reader.data))
+    {
+        reader.Fail("Malformed measurement count in E2 message");
+        return {};
+    }
+
+    std::vector<OranUeCellRsrpRsrq> measurements(count);
+    for (auto& measurement : measurements)
+    {
+        measurement.cellId = reader.GetU16();
+        uint64_t componentCarrierId = reader.GetVarint();
+        if (componentCarrierId > UINT8_MAX)
+        {
+            reader.Fail("Out of range component carrier ID in E2 message");
+        }
+        measurement.componentCarrierId = static_cast<uint8_t>(componentCarrierId);
+        measurement.isServingCell = reader.GetU8() != 0;
+        measurement.rsrp = reader.GetDouble();
+        measurement.rsrq = reader.GetDouble();
+    }
+    return measurements;
+}
+
+/**
+ * Read one Report element.
+ *
+ * @param reader The reader.
+ * @return The Report, or nullptr if the reader failed.
+ */
+Ptr<OranReport>
+DecodeReportIe(Reader& reader)
+{
+    auto type = static_cast<OranE2IeType>(reader.GetU8());
+    uint64_t e2NodeId = reader.GetVarint();
+    int64_t timeStep = reader.GetZigzag();
+
+    Ptr<OranReport> report;
+    switch (type)
+    {
+    case OranE2IeType::LOCATION: {
+        report = CreateObject<OranReportLocation>();
+        double x = reader.GetDouble();
+        double y = reader.GetDouble();
+        double z = reader.GetDouble();
+        report->SetAttribute("Location", VectorValue(Vector(x, y, z)));
+        break;
+    }
+    case OranE2IeType::APP_LOSS:
+        report = CreateObject<OranReportAppLoss>();
+        report->SetAttribute("Loss", DoubleValue(reader.GetDouble()));
+        break;
+    case OranE2IeType::LTE_UE_CELL_INFO:
+    case OranE2IeType::NR_UE_CELL_INFO:
+        if (type == OranE2IeType::LTE_UE_CELL_INFO)
+        {
+            report = CreateObject<OranReportLteUeCellInfo>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeCellInfo>();
+        }
+        report->SetAttribute("CellId", UintegerValue(reader.GetU16()));
+        report->SetAttribute("Rnti", UintegerValue(reader.GetU16()));
+        break;
+    case OranE2IeType::LTE_UE_RSRP_RSRQ:
+    case OranE2IeType::NR_UE_RSRP_RSRQ:
+        if (type == OranE2IeType::LTE_UE_RSRP_RSRQ)
+        {
+            report = CreateObject<OranReportLteUeRsrpRsrq>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeRsrpRsrq>();
+        }
+        report->SetAttribute("Rnti", UintegerValue(reader.GetU16()));
+        report->SetAttribute("CellId", UintegerValue(reader.GetU16()));
+        report->SetAttribute("ComponentCarrierId", UintegerValue(reader.GetU16()));
+        report->SetAttribute("IsServingCell", BooleanValue(reader.GetU8() != 0));
+        report->SetAttribute("Rsrp", DoubleValue(reader.GetDouble()));
+        report->SetAttribute("Rsrq", DoubleValue(reader.GetDouble()));
+        break;
+    case OranE2IeType::LTE_UE_MULTI_CELL_RSRP_RSRQ: {
+        Ptr<OranReportLteUeMultiCellRsrpRsrq> multiCell =
+            CreateObject<OranReportLteUeMultiCellRsrpRsrq>();
+        multiCell->SetAttribute("Rnti", UintegerValue(reader.GetU16()));
+        multiCell->SetMeasurements(GetMeasurements(reader));
+        report = multiCell;
+        break;
+    }
+    case OranE2IeType::NR_UE_MULTI_CELL_RSRP_RSRQ: {
+        Ptr<OranReportNrUeMultiCellRsrpRsrq> multiCell =
+            CreateObject<OranReportNrUeMultiCellRsrpRsrq>();
+        multiCell->SetAttribute("Rnti", UintegerValue(reader.GetU16()));
+        multiCell->SetMeasurements(GetMeasurements(reader));
+        report = multiCell;
+        break;
+    }
+    case OranE2IeType::LTE_ENERGY:
+    case OranE2IeType::NR_ENERGY:
+        if (type == OranE2IeType::LTE_ENERGY)
+        {
+            report = CreateObject<OranReportLteEnergyEfficiency>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrEnergyEfficiency>();
+        }
+        report->SetAttribute("EnergyRemaining", DoubleValue(reader.GetDouble()));
+        break;
+    case OranE2IeType::LTE_UE_APP_DEMAND:
+    case OranE2IeType::NR_UE_APP_DEMAND:
+        if (type == OranE2IeType::LTE_UE_APP_DEMAND)
+        {
+            report = CreateObject<OranReportLteUeAppDemand>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeAppDemand>();
+        }
+        report->SetAttribute("DemandMbps", DoubleValue(reader.GetDouble()));
+        break;
+    default: {
+        std::ostringstream error;
+        error << "Unknown Report element type " << static_cast<uint32_t>(type)
+              << " in E2 message";
+        reader.Fail(error.str());
+        return nullptr;
+    }
+    }
+    if (!reader.Ok())
+    {
+        return nullptr;
+    }
+
+    report->SetAttribute("ReporterE2NodeId", UintegerValue(e2NodeId));
+    report->SetAttribute("Time", TimeValue(TimeStep(timeStep)));
+
+    return report;
+}
+
+/**
+ * Read one Command element.
+ *
+ * @param reader The reader.
+ * @return The Command, or nullptr if the reader failed.
+ */
+Ptr<OranCommand>
+DecodeCommandIe(Reader& reader)
+{
+    auto type = static_cast<OranE2IeType>(reader.GetU8());
+    uint64_t e2NodeId = reader.GetVarint();
+
+    Ptr<OranCommand> command;
+    switch (type)
+    {
+    case OranE2IeType::LTE_HANDOVER:
+    case OranE2IeType::NR_HANDOVER: {
+        uint16_t cellId = reader.GetU16();
+        uint16_t rnti = reader.GetU16();
+        if (type == OranE2IeType::LTE_HANDOVER)
+        {
+            command = OranCommandLte2LteHandover::Create(e2NodeId, cellId, rnti);
+        }
+        else
+        {
+            command = OranCommandNr2NrHandover::Create(e2NodeId, cellId, rnti);
+        }
+        break;
+    }
+    case OranE2IeType::LTE_TX_POWER:
+        command = OranCommandLte2LteTxPower::Create(e2NodeId, reader.GetDouble());
+        break;
+    case OranE2IeType::NR_TX_POWER:
+        command = OranCommandNr2NrTxPower::Create(e2NodeId, reader.GetDouble());
+        break;
+    case OranE2IeType::LTE_CELL_PARAMETER:
+    case OranE2IeType::NR_CELL_PARAMETER: {
+        uint8_t parameter = reader.GetU8();
+        if (parameter > static_cast<uint8_t>(OranCellControlParameter::UNKNOWN))
+        {
+            std::ostringstream error;
+            error << "Unknown cell-control parameter " << static_cast<uint32_t>(parameter)
+                  << " in E2 message";
+            reader.Fail(error.str());
+            return nullptr;
+        }
+        bool isDelta = reader.GetU8() != 0;
+        double value = reader.GetDouble();
+        std::string name =
+            CellControlParameterToString(static_cast<OranCellControlParameter>(parameter));
+        if (type == OranE2IeType::LTE_CELL_PARAMETER)
+        {
+            command = OranCommandLte2LteCellParameter::Create(e2NodeId, name, value, isDelta);
+        }
+        else
+        {
+            command = OranCommandNr2NrCellParameter::Create(e2NodeId, name, value, isDelta);
+        }
+        break;
+    }
+    default: {
+        std::ostringstream error;
+        error << "Unknown Command element type " << static_cast<uint32_t>(type)
+              << " in E2 message";
+        reader.Fail(error.str());
+        break;
+    }
+    }
+    return reader.Ok() ? command : nullptr;
+}
+
+/**
+ * Check the header of a message.
+ *
+ * @param data The first byte of the message.
+ * @param size The number of bytes available at data.
+ * @return The error, or empty if the magic, version, and type are valid.
+ */
+std::string
+CheckHeader(const uint8_t* data, std::size_t size)
+{
+    std::ostringstream error;
+    if (size < 4)
+    {
+        error << "Truncated E2 message";
+    }
+    else if (data[0] != MAGIC)
+    {
+        error << "Not an E2 message";
+    }
+    else if (data[1] != OranE2Codec::VERSION)
+    {
+        error << "E2 message of version " << static_cast<uint32_t>(data[1])
+              << " cannot be decoded by version " << static_cast<uint32_t>(OranE2Codec::VERSION);
+    }
+    else if (data[2] < static_cast<uint8_t>(OranE2MessageType::REPORT) ||
+             data[2] > static_cast<uint8_t>(OranE2MessageType::COMMAND))
+    {
+        error << "Unknown E2 message type " << static_cast<uint32_t>(data[2]);
+    }
+    return error.str();
+}
+
+} // namespace
+
+void
+OranE2Codec::EncodeReport(Ptr<const OranReport> report, std::vector<uint8_t>& buffer)
+{
+    NS_LOG_FUNCTION(this << report);
+
+    uint64_t start = NowNs();
+    std::size_t messageStart = buffer.size();
+
+    EncodeReportIe(report, buffer);
+    FinishMessage(OranE2MessageType::REPORT, messageStart, buffer);
+
+    m_stats.nEncodedMessages++;
+    m_stats.nEncodedIes++;
+    m_stats.nEncodedBytes += buffer.size() - messageStart;
+    m_stats.encodeNs += NowNs() - start;
+}
+
+void
+OranE2Codec::EncodeReportBatch(const std::vector<Ptr<OranReport>>& reports,
+                               std::vector<uint8_t>& buffer)
+{
+    NS_LOG_FUNCTION(this << reports.size());
+
+    uint64_t start = NowNs();
+    std::size_t messageStart = buffer.size();
+
+    PutVarint(reports.size(), buffer);
+    for (const auto& report : reports)
+    {
+        EncodeReportIe(report, buffer);
+    }
+    FinishMessage(OranE2MessageType::REPORT_BATCH, messageStart, buffer);
+
+    m_stats.nEncodedMessages++;
+    m_stats.nEncodedIes += reports.size();
+    m_stats.nEncodedBytes += buffer.size() - messageStart;
+    m_stats.encodeNs += NowNs() - start;
+}
+
+void
+OranE2Codec::EncodeCommand(Ptr<const OranCommand> command, std::vector<uint8_t>& buffer)
+{
+    NS_LOG_FUNCTION(this << command);
+
+    uint64_t start = NowNs();
+    std::size_t messageStart = buffer.size();
+
+    // The E2 Node Terminators of each RAT only act on their own Commands,
+    // so the RAT is encoded with the action.
+    const OranCommandData& data = command->GetData();
+    bool isLte = data.rat == OranCommandRat::LTE;
+    NS_ABORT_MSG_IF(data.rat == OranCommandRat::NONE,
+                    "Cannot encode Command of type " << command->GetInstanceTypeId().GetName());
+    std::size_t typeOffset = buffer.size();
+    buffer.push_back(0);
+    PutVarint(data.targetE2NodeId, buffer);
+
+    OranE2IeType type = OranE2IeType::LTE_HANDOVER;
+    std::visit(OranPayloadVisitor{
+                   [&](const OranHandoverPayload& handover) {
+                       type = isLte ? OranE2IeType::LTE_HANDOVER : OranE2IeType::NR_HANDOVER;
+                       PutVarint(handover.targetCellId, buffer);
+                       PutVarint(handover.targetRnti, buffer);
+                   },
+                   [&](const OranTxPowerPayload& txPower) {
+                       type = isLte ? OranE2IeType::LTE_TX_POWER : OranE2IeType::NR_TX_POWER;
+                       PutDouble(txPower.powerDeltaDb, buffer);
+                   },
+                   [&](const OranCellParameterPayload& cellParameter) {
+                       type = isLte ? OranE2IeType::LTE_CELL_PARAMETER
+                                    : OranE2IeType::NR_CELL_PARAMETER;
+                       buffer.push_back(static_cast<uint8_t>(cellParameter.parameter));
+                       buffer.push_back(cellParameter.isDelta ? 1 : 0);
+                       PutDouble(cellParameter.value, buffer);
+                   },
+                   [&](std::monostate) {
+                       NS_ABORT_MSG("Cannot encode Command without an action");
+                   },
+               },
+               data.payload);
+    buffer[typeOffset] = static_cast<uint8_t>(type);
+
+    FinishMessage(OranE2MessageType::COMMAND, messageStart, buffer);
+
+    m_stats.nEncodedMessages++;
+    m_stats.nEncodedIes++;
+    m_stats.nEncodedBytes += buffer.size() - messageStart;
+    m_stats.encodeNs += NowNs() - start;
+}
+
+std::size_t
+OranE2Codec::Decode(const uint8_t* data,
+                    std::size_t size,
+                    std::vector<Ptr<OranReport>>& reports,
+                    std::vector<Ptr<OranCommand>>& commands)
+{
+    NS_LOG_FUNCTION(this << size);
+
+    std::string error;
+    std::size_t messageSize = TryDecode(data, size, reports, commands, &error);
+    NS_ABORT_MSG_IF(messageSize == 0, error);
+
+    return messageSize;
+}
+
+std::size_t
+OranE2Codec::TryDecode(const uint8_t* data,
+                       std::size_t size,
+                       std::vector<Ptr<OranReport>>& reports,
+                       std::vector<Ptr<OranCommand>>& commands,
+                       std::string* error)
+{
+    NS_LOG_FUNCTION(this << size);
+
+    uint64_t start = NowNs();
+
+    Reader header{data + 3, data + size, CheckHeader(data, size)};
+    if (!header.Ok())
+    {
+        header.data = header.end;
+    }
+    uint64_t length = header.GetVarint();
+    if (length > static_cast<uint64_t>(header.end - header.data))
+    {
+        header.Fail("Truncated E2 message");
+    }
+    if (!header.Ok())
+    {
+        NS_LOG_LOGIC("Rejected E2 message: " << header.error);
+        if (error != nullptr)
+        {
+            *error = header.error;
+        }
+        return 0;
+    }
+
+    Reader payload{header.data, header.data + length, {}};
+    std::vector<Ptr<OranReport>> decodedReports;
+    Ptr<OranCommand> command;
+    uint64_t nIes = 1;
+    switch (static_cast<OranE2MessageType>(data[2]))
+    {
+    case OranE2MessageType::REPORT:
+        decodedReports.push_back(DecodeReportIe(payload));
+        break;
+    case OranE2MessageType::REPORT_BATCH:
+        nIes = payload.GetVarint();
+        if (nIes > length)
+        {
+            payload.Fail("Malformed Report count in E2 message");
+            break;
+        }
+        decodedReports.reserve(nIes);
+        for (uint64_t i = 0; i < nIes && payload.Ok(); i++)
+        {
+            decodedReports.push_back(DecodeReportIe(payload));
+        }
+        break;
+    case OranE2MessageType::COMMAND:
+        command = DecodeCommandIe(payload);
+        break;
+    }
+    if (payload.Ok() && payload.data != payload.end)
+    {
+        payload.Fail("Trailing bytes in E2 message");
+    }
+    if (!payload.Ok())
+    {
+        NS_LOG_LOGIC("Rejected E2 message: " << payload.error);
+        if (error != nullptr)
+        {
+            *error = payload.error;
+        }
+        return 0;
+    }
+
+    reports.insert(reports.end(), decodedReports.begin(), decodedReports.end());
+    if (command)
+    {
+        commands.push_back(command);
+    }
+
+    std::size_t messageSize = payload.end - data;
+    m_stats.nDecodedMessages++;
+    m_stats.nDecodedIes += nIes;
+    m_stats.nDecodedBytes += messageSize;
+    m_stats.decodeNs += NowNs() - start;
+
+    return messageSize;
+}
+
+OranE2MessageType
+OranE2Codec::PeekType(const uint8_t* data, std::size_t size)
+{
+    std::string error = CheckHeader(data, size);
+    NS_ABORT_MSG_IF(!error.empty(), error);
+
+    return static_cast<OranE2MessageType>(data[2]);
+}
+
+const OranE2CodecStats&
+OranE2Codec::GetStats() const
+{
+    return m_stats;
+}
+
+void
+OranE2Codec::ResetStats()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_stats = OranE2CodecStats();
+}
+
+void
+OranE2Codec::EncodeReportIe(Ptr<const OranReport> report, std::vector<uint8_t>& buffer)
+{
+    static const TypeId locationTid = OranReportLocation::GetTypeId();
+    static const TypeId appLossTid = OranReportAppLoss::GetTypeId();
+    static const TypeId lteCellInfoTid = OranReportLteUeCellInfo::GetTypeId();
+    static const TypeId lteRsrpRsrqTid = OranReportLteUeRsrpRsrq::GetTypeId();
+    static const TypeId lteMultiCellTid = OranReportLteUeMultiCellRsrpRsrq::GetTypeId();
+    static const TypeId lteEnergyTid = OranReportLteEnergyEfficiency::GetTypeId();
+    static const TypeId lteDemandTid = OranReportLteUeAppDemand::GetTypeId();
+    static const TypeId nrCellInfoTid = OranReportNrUeCellInfo::GetTypeId();
+    static const TypeId nrRsrpRsrqTid = OranReportNrUeRsrpRsrq::GetTypeId();
+    static const TypeId nrMultiCellTid = OranReportNrUeMultiCellRsrpRsrq::GetTypeId();
+    static const TypeId nrEnergyTid = OranReportNrEnergyEfficiency::GetTypeId();
+    static const TypeId nrDemandTid = OranReportNrUeAppDemand::GetTypeId();
+
+    TypeId tid = report->GetInstanceTypeId();
+    std::size_t typeOffset = buffer.size();
+    buffer.push_back(0);
+    PutVarint(report->GetReporterE2NodeId(), buffer);
+    PutZigzag(report->GetTime().GetTimeStep(), buffer);
+
+    OranE2IeType type;
+    if (tid == locationTid)
+    {
+        type = OranE2IeType::LOCATION;
+        Vector location = StaticCast<const OranReportLocation>(report)->GetLocation();
+        PutDouble(location.x, buffer);
+        PutDouble(location.y, buffer);
+        PutDouble(location.z, buffer);
+    }
+    else if (tid == appLossTid)
+    {
+        type = OranE2IeType::APP_LOSS;
+        PutDouble(StaticCast<const OranReportAppLoss>(report)->GetLoss(), buffer);
+    }
+    else if (tid == lteCellInfoTid)
+    {
+        type = OranE2IeType::LTE_UE_CELL_INFO;
+        Ptr<const OranReportLteUeCellInfo> cellInfo =
+            StaticCast<const OranReportLteUeCellInfo>(report);
+        PutVarint(cellInfo->GetCellId(), buffer);
+        PutVarint(cellInfo->GetRnti(), buffer);
+    }
+    else if (tid == lteRsrpRsrqTid)
+    {
+        type = OranE2IeType::LTE_UE_RSRP_RSRQ;
+        Ptr<const OranReportLteUeRsrpRsrq> rsrpRsrq =
+            StaticCast<const OranReportLteUeRsrpRsrq>(report);
+        PutVarint(rsrpRsrq->GetRnti(), buffer);
+        PutVarint(rsrpRsrq->GetCellId(), buffer);
+        PutVarint(rsrpRsrq->GetComponentCarrierId(), buffer);
+        buffer.push_back(rsrpRsrq->GetIsServingCell() ? 1 : 0);
+        PutDouble(rsrpRsrq->GetRsrp(), buffer);
+        PutDouble(rsrpRsrq->GetRsrq(), buffer);
+    }
+    else if (tid == lteMultiCellTid)
+    {
+        type = OranE2IeType::LTE_UE_MULTI_CELL_RSRP_RSRQ;
+        Ptr<const OranReportLteUeMultiCellRsrpRsrq> multiCell =
+            StaticCast<const OranReportLteUeMultiCellRsrpRsrq>(report);
+        PutMeasurements(multiCell->GetRnti(), multiCell->GetMeasurements(), buffer);
+    }
+    else if (tid == lteEnergyTid)
+    {
+        type = OranE2IeType::LTE_ENERGY;
+        PutDouble(StaticCast<const OranReportLteEnergyEfficiency>(report)->GetLteEnergyRemaining(),
+                  buffer);
+    }
+    else if (tid == lteDemandTid)
+    {
+        type = OranE2IeType::LTE_UE_APP_DEMAND;
+        PutDouble(StaticCast<const OranReportLteUeAppDemand>(report)->GetDemandMbps(), buffer);
+    }
+    else if (tid == nrCellInfoTid)
+    {
+        type = OranE2IeType::NR_UE_CELL_INFO;
+        Ptr<const OranReportNrUeCellInfo> cellInfo =
+            StaticCast<const OranReportNrUeCellInfo>(report);
+        PutVarint(cellInfo->GetCellId(), buffer);
+        PutVarint(cellInfo->GetRnti(), buffer);
+    }
+    else if (tid == nrRsrpRsrqTid)
+    {
+        type = OranE2IeType::NR_UE_RSRP_RSRQ;
+        Ptr<const OranReportNrUeRsrpRsrq> rsrpRsrq =
+            StaticCast<const OranReportNrUeRsrpRsrq>(report);
+        PutVarint(rsrpRsrq->GetRnti(), buffer);
+        PutVarint(rsrpRsrq->GetCellId(), buffer);
+        PutVarint(rsrpRsrq->GetComponentCarrierId(), buffer);
+        buffer.push_back(rsrpRsrq->GetIsServingCell() ? 1 : 0);
+        PutDouble(rsrpRsrq->GetRsrp(), buffer);
+        PutDouble(rsrpRsrq->GetRsrq(), buffer);
+    }
+    else if (tid == nrMultiCellTid)
+    {
+        type = OranE2IeType::NR_UE_MULTI_CELL_RSRP_RSRQ;
+        Ptr<const OranReportNrUeMultiCellRsrpRsrq> multiCell =
+            StaticCast<const OranReportNrUeMultiCellRsrpRsrq>(report);
+        PutMeasurements(multiCell->GetRnti(), multiCell->GetMeasurements(), buffer);
+    }
+    else if (tid == nrEnergyTid)
+    {
+        type = OranE2IeType::NR_ENERGY;
+        PutDouble(StaticCast<const OranReportNrEnergyEfficiency>(report)->GetNrEnergyRemaining(),
+                  buffer);
+    }
+    else if (tid == nrDemandTid)
+    {
+        type = OranE2IeType::NR_UE_APP_DEMAND;
+        PutDouble(StaticCast<const OranReportNrUeAppDemand>(report)->GetDemandMbps(), buffer);
+    }
+    else
+    {
+        NS_ABORT_MSG("Cannot encode Report of type " << tid.GetName());
+    }
+
+    buffer[typeOffset] = static_cast<uint8_t>(type);
+}
+
+void
+OranE2Codec::FinishMessage(OranE2MessageType type,
+                           std::size_t payloadStart,
+                           std::vector<uint8_t>& buffer)
+{
+    std::vector<uint8_t> header{MAGIC, VERSION, static_cast<uint8_t>(type)};
+    PutVarint(buffer.size() - payloadStart, header);
+    buffer.insert(buffer.begin() + payloadStart, header.begin(), header.end());
+}
+
+const char*
+E2MessageTypeToString(OranE2MessageType type)
+{
+    switch (type)
+    {
+    case OranE2MessageType::REPORT:
+        return "REPORT";
+    case OranE2MessageType::REPORT_BATCH:
+        return "REPORT_BATCH";
+    case OranE2MessageType::COMMAND:
+        return "COMMAND";
+    }
+    return "UNKNOWN";
+}
+
+} // namespace ns3
@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_CODEC_H
+#define ORAN_E2_CODEC_H
+
+#include "oran-command.h"
+#include "oran-report.h"
+
+#include "ns3/ptr.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The kind of an encoded E2 message.
+ */
+enum class OranE2MessageType : uint8_t
+{
+    REPORT = 1,   //!< One Report.
+    REPORT_BATCH, //!< Any number of Reports, from a batching Node E2 Terminator.
+    COMMAND,      //!< One Command.
+};
+
+/**
+ * @ingroup oran
+ *
+ * The type of an information element (one Report or Command) in an encoded
+ * E2 message. The values are part of the wire format.
+ */
+enum class OranE2IeType : uint8_t
+{
+    LOCATION = 1,                  //!< OranReportLocation.
+    APP_LOSS,                      //!< OranReportAppLoss.
+    LTE_UE_CELL_INFO,              //!< OranReportLteUeCellInfo.
+    LTE_UE_RSRP_RSRQ,              //!< OranReportLteUeRsrpRsrq.
+    LTE_UE_MULTI_CELL_RSRP_RSRQ,   //!< OranReportLteUeMultiCellRsrpRsrq.
+    LTE_ENERGY,                    //!< OranReportLteEnergyEfficiency.
+    LTE_UE_APP_DEMAND,             //!< OranReportLteUeAppDemand.
+    NR_UE_CELL_INFO,               //!< OranReportNrUeCellInfo.
+    NR_UE_RSRP_RSRQ,               //!< OranReportNrUeRsrpRsrq.
+    NR_UE_MULTI_CELL_RSRP_RSRQ,    //!< OranReportNrUeMultiCellRsrpRsrq.
+    NR_ENERGY,                     //!< OranReportNrEnergyEfficiency.
+    NR_UE_APP_DEMAND,              //!< OranReportNrUeAppDemand.
+    LTE_HANDOVER = 64,             //!< OranCommandLte2LteHandover.
+    LTE_TX_POWER,                  //!< OranCommandLte2LteTxPower.
+    LTE_CELL_PARAMETER,            //!< OranCommandLte2LteCellParameter.
+    NR_HANDOVER,                   //!< OranCommandNr2NrHandover.
+    NR_TX_POWER,                   //!< OranCommandNr2NrTxPower.
+    NR_CELL_PARAMETER,             //!< OranCommandNr2NrCellParameter.
+};
+
+/**
+ * @ingroup oran
+ *
+ * Counters of an OranE2Codec.
+ */
+struct OranE2CodecStats
+{
+    uint64_t nEncodedMessages = 0; //!< The number of messages encoded.
+    uint64_t nEncodedIes = 0;      //!< The number of Reports and Commands encoded.
+    uint64_t nEncodedBytes = 0;    //!< The size of the messages encoded.
+    uint64_t encodeNs = 0;         //!< Wall-clock time spent encoding (ns).
+    uint64_t nDecodedMessages = 0; //!< The number of messages decoded.
+    uint64_t nDecodedIes = 0;      //!< The number of Reports and Commands decoded.
+    uint64_t nDecodedBytes = 0;    //!< The size of the messages decoded.
+    uint64_t decodeNs = 0;         //!< Wall-clock time spent decoding (ns).
+};
+
+/**
+ * @ingroup oran
+ *
+ * Encodes Reports and Commands into compact, versioned binary E2 messages
+ * and decodes them back, so that E2 message sizes can be measured and the
+ * messages can leave the simulation process (see OranE2SocketTransport).
+ *
+ * A message is a header followed by the information elements:
+ *
+ *   magic (0xE2) | version | OranE2MessageType | payload length (varint) | payload
+ *
+ * The payload of a REPORT or COMMAND message is one element, and the one
+ * of a REPORT_BATCH message is the number of elements (varint) followed by
+ * the elements. Every element starts with its OranE2IeType. Reports then
+ * carry the reporter's E2 Node ID (varint) and their time in time steps
+ * (zigzag varint); Commands carry the target E2 Node ID (varint). The
+ * remaining fields are type-specific: IDs are varints, flags are one byte,
+ * and measurements are little-endian IEEE 754 doubles, so a decoded
+ * Report or Command is identical to the encoded one.
+ *
+ * Decode aborts the simulation on malformed input, and TryDecode rejects
+ * it, for input that does not come from the simulation. Encoding a Report
+ * or Command of a type without an OranE2IeType aborts.
+ */
+class OranE2Codec
+{
+  public:
+    /**
+     * The version of the encoding written by this codec.
+     */
+    static constexpr uint8_t VERSION = 1;
+
+    /**
+     * Append a REPORT message to a buffer.
+     *
+     * @param report The Report.
+     * @param buffer The buffer.
+     */
+    void EncodeReport(Ptr<const OranReport> report, std::vector<uint8_t>& buffer);
+    /**
+     * Append a REPORT_BATCH message to a buffer.
+     *
+     * @param reports The Reports.
+     * @param buffer The buffer.
+     */
+    void EncodeReportBatch(const std::vector<Ptr<OranReport>>& reports,
+                           std::vector<uint8_t>& buffer);
+    /**
+     * Append a COMMAND message to a buffer.
+     *
+     * @param command The Command.
+     * @param buffer The buffer.
+     */
+    void EncodeCommand(Ptr<const OranCommand> command, std::vector<uint8_t>& buffer);
+    /**
+     * Decode one message.
+     *
+     * @param data The first byte of the message.
+     * @param size The number of bytes available at data.
+     * @param reports Set to the Reports of a REPORT or REPORT_BATCH message.
+     * @param commands Set to the Command of a COMMAND message.
+     * @return The number of bytes of the message.
+     */
+    std::size_t Decode(const uint8_t* data,
+                       std::size_t size,
+                       std::vector<Ptr<OranReport>>& reports,
+                       std::vector<Ptr<OranCommand>>& commands);
+    /**
+     * Decode one message, rejecting it instead of aborting if it is
+     * truncated, of another version, or otherwise malformed. Nothing is
+     * added to reports or commands when the message is rejected.
+     *
+     * @param data The first byte of the message.
+     * @param size The number of bytes available at data.
+     * @param reports Set to the Reports of a REPORT or REPORT_BATCH message.
+     * @param commands Set to the Command of a COMMAND message.
+     * @param error Set to the reason the message was rejected, if not null.
+     * @return The number of bytes of the message, or 0 if it was rejected.
+     */
+    std::size_t TryDecode(const uint8_t* data,
+                          std::size_t size,
+                          std::vector<Ptr<OranReport>>& reports,
+                          std::vector<Ptr<OranCommand>>& commands,
+                          std::string* error = nullptr);
+    /**
+     * @param data The first byte of the message.
+     * @param size The number of bytes available at data.
+     * @return The type of the message, aborting if its header is malformed.
+     */
+    static OranE2MessageType PeekType(const uint8_t* data, std::size_t size);
+    /**
+     * @return The counters of the codec.
+     */
+    const OranE2CodecStats& GetStats() const;
+    /**
+     * Reset the counters of the codec.
+     */
+    void ResetStats();
+
+  private:
+    /**
+     * Append the element of a Report.
+     *
+     * @param report The Report.
+     * @param buffer The buffer.
+     */
+    static void EncodeReportIe(Ptr<const OranReport> report, std::vector<uint8_t>& buffer);
+    /**
+     * Insert the message header before a payload written at the end of a
+     * buffer.
+     *
+     * @param type The message type.
+     * @param payloadStart The offset in the buffer at which the payload starts.
+     * @param buffer The buffer.
+     */
+    static void FinishMessage(OranE2MessageType type,
+                              std::size_t payloadStart,
+                              std::vector<uint8_t>& buffer);
+
+    /**
+     * The counters.
+     */
+    OranE2CodecStats m_stats;
+}; // class OranE2Codec
+
+/**
+ * @param type The message type.
+ * @return The name of the message type.
+ */
+const char* E2MessageTypeToString(OranE2MessageType type);
+
+} // namespace ns3
+
+#endif // ORAN_E2_CODEC_H
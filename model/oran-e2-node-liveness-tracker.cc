@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-node-liveness-tracker.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+void
+OranE2NodeLivenessTracker::Update(uint64_t e2NodeId, Time t)
+{
+    auto it = m_lastRegistration.find(e2NodeId);
+    if (it == m_lastRegistration.end())
+    {
+        m_lastRegistration.emplace(e2NodeId, t);
+    }
+    else if (it->second < t)
+    {
+        it->second = t;
+    }
+    else
+    {
+        return;
+    }
+    m_registrations.emplace(t, e2NodeId);
+}
+
+void
+OranE2NodeLivenessTracker::Remove(uint64_t e2NodeId)
+{
+    m_lastRegistration.erase(e2NodeId);
+    if (m_lastRegistration.empty())
+    {
+        m_registrations = decltype(m_registrations)();
+    }
+}
+
+std::vector<std::tuple<uint64_t, Time>>
+OranE2NodeLivenessTracker::PopInactive(Time cutoff)
+{
+    std::vector<std::tuple<uint64_t, Time>> inactive;
+    while (!m_registrations.empty() && m_registrations.top().first < cutoff)
+    {
+        Time t = m_registrations.top().first;
+        uint64_t e2NodeId = m_registrations.top().second;
+        m_registrations.pop();
+
+        // Entries left behind by a later registration or by a removal are
+        // simply dropped.
+        auto it = m_lastRegistration.find(e2NodeId);
+        if (it != m_lastRegistration.end() && it->second == t)
+        {
+            inactive.emplace_back(e2NodeId, t);
+            m_lastRegistration.erase(it);
+        }
+    }
+
+    std::sort(inactive.begin(), inactive.end());
+    return inactive;
+}
+
+uint32_t
+OranE2NodeLivenessTracker::GetNNodes() const
+{
+    return m_lastRegistration.size();
+}
+
+void
+OranE2NodeLivenessTracker::Clear()
+{
+    m_lastRegistration.clear();
+    m_registrations = decltype(m_registrations)();
+}
+
+} // namespace ns3
@@ -0,0 +1,87 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_NODE_LIVENESS_TRACKER_H
+#define ORAN_E2_NODE_LIVENESS_TRACKER_H
+
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The time each registered E2 Node last sent a registration request, kept by
+ * the Near-RT RIC to find inactive nodes without reading the registration
+ * history back from the data repository.
+ *
+ * Registrations go into a min-heap ordered by time. A node that registers
+ * again leaves its older entry behind in the heap; that entry is discarded
+ * when it reaches the top. Finding the inactive nodes therefore only visits
+ * entries older than the cutoff, and each entry is visited once.
+ */
+class OranE2NodeLivenessTracker
+{
+  public:
+    /**
+     * Records a registration request from an E2 Node.
+     *
+     * @param e2NodeId The E2 Node ID.
+     * @param t The time of the request.
+     */
+    void Update(uint64_t e2NodeId, Time t);
+    /**
+     * Stops tracking an E2 Node, e.g. when it deregisters.
+     *
+     * @param e2NodeId The E2 Node ID.
+     */
+    void Remove(uint64_t e2NodeId);
+    /**
+     * Stops tracking the E2 Nodes that have not registered since a cutoff.
+     *
+     * @param cutoff The cutoff. Nodes whose last registration is strictly
+     *               before it are inactive.
+     * @return The inactive nodes and their last registration time, ordered
+     *         by E2 Node ID.
+     */
+    std::vector<std::tuple<uint64_t, Time>> PopInactive(Time cutoff);
+    /**
+     * @return The number of E2 Nodes tracked.
+     */
+    uint32_t GetNNodes() const;
+    /**
+     * Stops tracking all E2 Nodes.
+     */
+    void Clear();
+
+  private:
+    /**
+     * A registration: its time and the E2 Node ID.
+     */
+    typedef std::pair<Time, uint64_t> Registration;
+
+    /**
+     * The last registration time of each tracked E2 Node.
+     */
+    std::unordered_map<uint64_t, Time> m_lastRegistration;
+    /**
+     * Every registration not yet discarded, earliest on top.
+     */
+    std::priority_queue<Registration, std::vector<Registration>, std::greater<Registration>>
+        m_registrations;
+};
+
+} // namespace ns3
+
+#endif // ORAN_E2_NODE_LIVENESS_TRACKER_H
@@ -30,10 +30,8 @@
 
 #include "oran-e2-node-terminator-lte-enb.h"
 
-#include "oran-command-lte-2-lte-cell-parameter.h"
-#include "oran-command-lte-2-lte-handover.h"
-#include "oran-command-lte-2-lte-tx-power.h"
-#include "oran-lte-cell-control-state.h"
+#include "oran-cell-control-store.h"
+#include "oran-near-rt-ric.h"
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
@@ -44,6 +42,8 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <variant>
+
 namespace ns3
 {
 
@@ -87,54 +87,57 @@ OranE2NodeTerminatorLteEnb::ReceiveCommand(Ptr<OranCommand> command)
 
     if (m_active)
     {
-        if (command->GetInstanceTypeId() == OranCommandLte2LteHandover::GetTypeId())
-        {
-            Ptr<OranCommandLte2LteHandover> handoverCommand =
-                command->GetObject<OranCommandLte2LteHandover>();
-            Ptr<LteEnbRrc> lteEnbRrc = GetNetDevice()->GetRrc();
-            lteEnbRrc->SendHandoverRequest(handoverCommand->GetTargetRnti(),
-                                           handoverCommand->GetTargetCellId());
-        }
-        else if (command->GetInstanceTypeId() == OranCommandLte2LteTxPower::GetTypeId())
-        {
-            Ptr<OranCommandLte2LteTxPower> txCmd =
-                command->GetObject<OranCommandLte2LteTxPower>();
-            Ptr<LteEnbPhy> phy = GetNetDevice()->GetPhy();
-            NS_ABORT_MSG_IF(phy == nullptr, "No LteEnbPhy on eNB; dropping TxPower cmd");
-
-            double deltaDb = txCmd->GetPowerDeltaDb();
-            double curDbm  = phy->GetTxPower();
-            double newDbm  = curDbm + deltaDb;
-            if (newDbm < 0.0) newDbm = 0.0;
-            if (newDbm > 70.0) newDbm = 70.0;
-            phy->SetTxPower(newDbm);
-
-            NS_LOG_INFO("eNB[E2=" << GetE2NodeId()
-                        << "] TxPower: " << curDbm << " dBm → " << newDbm
-                        << " dBm (Δ=" << deltaDb << " dB)");
-        }
-        else if (command->GetInstanceTypeId() == OranCommandLte2LteCellParameter::GetTypeId())
-        {
-            Ptr<OranCommandLte2LteCellParameter> paramCmd =
-                command->GetObject<OranCommandLte2LteCellParameter>();
-            const bool applied = ApplyLteCellControlParameter(GetE2NodeId(),
-                                                              paramCmd->GetParameterName(),
-                                                              paramCmd->GetValue(),
-                                                              paramCmd->IsDelta());
-            if (applied)
-            {
-                NS_LOG_INFO("eNB[E2=" << GetE2NodeId() << "] cell-control "
-                                      << paramCmd->GetParameterName() << "="
-                                      << paramCmd->GetValue()
-                                      << " isDelta=" << paramCmd->IsDelta());
-            }
-            else
-            {
-                NS_LOG_WARN("eNB[E2=" << GetE2NodeId()
-                                      << "] unknown cell-control parameter "
-                                      << paramCmd->GetParameterName());
-            }
-        }
+        // The payloads are shared by both RATs, so one meant for the other
+        // RAT would be applied to the wrong kind of cell.
+        const OranCommandData& data = command->GetData();
+        NS_ABORT_MSG_IF(data.rat != OranCommandRat::LTE &&
+                            !std::holds_alternative<std::monostate>(data.payload),
+                        "eNB[E2=" << GetE2NodeId() << "] received a Command for another RAT: "
+                                 << command->ToString());
+
+        std::visit(
+            OranPayloadVisitor{
+                [](const std::monostate&) {},
+                [this](const OranHandoverPayload& handover) {
+                    Ptr<LteEnbRrc> lteEnbRrc = GetNetDevice()->GetRrc();
+                    lteEnbRrc->SendHandoverRequest(handover.targetRnti, handover.targetCellId);
+                },
+                [this](const OranTxPowerPayload& txPower) {
+                    Ptr<LteEnbPhy> phy = GetNetDevice()->GetPhy();
+                    NS_ABORT_MSG_IF(phy == nullptr, "No LteEnbPhy on eNB; dropping TxPower cmd");
+
+                    double deltaDb = txPower.powerDeltaDb;
+                    double curDbm  = phy->GetTxPower();
+                    double newDbm  = curDbm + deltaDb;
+                    if (newDbm < 0.0) newDbm = 0.0;
+                    if (newDbm > 70.0) newDbm = 70.0;
+                    phy->SetTxPower(newDbm);
+
+                    NS_LOG_INFO("eNB[E2=" << GetE2NodeId()
+                                << "] TxPower: " << curDbm << " dBm → " << newDbm
+                                << " dBm (Δ=" << deltaDb << " dB)");
+                },
+                [this, &command](const OranCellParameterPayload& param) {
+                    const bool applied =
+                        GetNearRtRic()->GetCellControlStore()->Apply(GetE2NodeId(),
+                                                                     param.parameter,
+                                                                     param.value,
+                                                                     param.isDelta);
+                    if (applied)
+                    {
+                        NS_LOG_INFO("eNB[E2=" << GetE2NodeId() << "] cell-control "
+                                              << CellControlParameterToString(param.parameter)
+                                              << "=" << param.value
+                                              << " isDelta=" << param.isDelta);
+                    }
+                    else
+                    {
+                        NS_LOG_WARN("eNB[E2=" << GetE2NodeId()
+                                              << "] unknown cell-control parameter in "
+                                              << command->ToString());
+                    }
+                }},
+            data.payload);
     }
 }
 
@@ -5,10 +5,8 @@
  */
 #include "oran-e2-node-terminator-nr-gnb.h"
 
-#include "oran-command-nr-2-nr-cell-parameter.h"
-#include "oran-command-nr-2-nr-handover.h"
-#include "oran-command-nr-2-nr-tx-power.h"
-#include "oran-nr-cell-control-state.h"
+#include "oran-cell-control-store.h"
+#include "oran-near-rt-ric.h"
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
@@ -19,6 +17,8 @@
 #include "ns3/pointer.h"
 #include "ns3/string.h"
 
+#include <variant>
+
 namespace ns3
 {
 
@@ -62,60 +62,63 @@ OranE2NodeTerminatorNrGnb::ReceiveCommand(Ptr<OranCommand> command)
 
     if (m_active)
     {
-        if (command->GetInstanceTypeId() == OranCommandNr2NrHandover::GetTypeId())
-        {
-            Ptr<OranCommandNr2NrHandover> handoverCommand =
-                command->GetObject<OranCommandNr2NrHandover>();
-            Ptr<NrGnbRrc> nrGnbRrc = GetNetDevice()->GetRrc();
-            nrGnbRrc->SendHandoverRequest(handoverCommand->GetTargetRnti(),
-                                          handoverCommand->GetTargetCellId());
-        }
-        else if (command->GetInstanceTypeId() == OranCommandNr2NrTxPower::GetTypeId())
-        {
-            Ptr<OranCommandNr2NrTxPower> txCmd =
-                command->GetObject<OranCommandNr2NrTxPower>();
-            // NR gNBs may have multiple bandwidth parts (BWPs), each with
-            // its own PHY/TxPower; this scenario config uses a single band
-            // (BWP index 0), so that is the only PHY that needs updating.
-            Ptr<NrGnbPhy> phy = GetNetDevice()->GetPhy(0);
-            NS_ABORT_MSG_IF(phy == nullptr, "No NrGnbPhy on gNB; dropping TxPower cmd");
-
-            double deltaDb = txCmd->GetPowerDeltaDb();
-            double curDbm  = phy->GetTxPower();
-            double newDbm  = curDbm + deltaDb;
-            // NR small/macro-cell gNB TxPower is a much narrower range than
-            // LTE macro eNBs (0-70 dBm there); clamp to a generic sub-6GHz
-            // gNB range instead.
-            if (newDbm < 0.0) newDbm = 0.0;
-            if (newDbm > 50.0) newDbm = 50.0;
-            phy->SetTxPower(newDbm);
-
-            NS_LOG_INFO("gNB[E2=" << GetE2NodeId()
-                        << "] TxPower: " << curDbm << " dBm -> " << newDbm
-                        << " dBm (delta=" << deltaDb << " dB)");
-        }
-        else if (command->GetInstanceTypeId() == OranCommandNr2NrCellParameter::GetTypeId())
-        {
-            Ptr<OranCommandNr2NrCellParameter> paramCmd =
-                command->GetObject<OranCommandNr2NrCellParameter>();
-            const bool applied = ApplyNrCellControlParameter(GetE2NodeId(),
-                                                             paramCmd->GetParameterName(),
-                                                             paramCmd->GetValue(),
-                                                             paramCmd->IsDelta());
-            if (applied)
-            {
-                NS_LOG_INFO("gNB[E2=" << GetE2NodeId() << "] cell-control "
-                                      << paramCmd->GetParameterName() << "="
-                                      << paramCmd->GetValue()
-                                      << " isDelta=" << paramCmd->IsDelta());
-            }
-            else
-            {
-                NS_LOG_WARN("gNB[E2=" << GetE2NodeId()
-                                      << "] unknown cell-control parameter "
-                                      << paramCmd->GetParameterName());
-            }
-        }
+        // The payloads are shared by both RATs, so one meant for the other
+        // RAT would be applied to the wrong kind of cell.
+        const OranCommandData& data = command->GetData();
+        NS_ABORT_MSG_IF(data.rat != OranCommandRat::NR &&
+                            !std::holds_alternative<std::monostate>(data.payload),
+                        "gNB[E2=" << GetE2NodeId() << "] received a Command for another RAT: "
+                                 << command->ToString());
+
+        std::visit(
+            OranPayloadVisitor{
+                [](const std::monostate&) {},
+                [this](const OranHandoverPayload& handover) {
+                    Ptr<NrGnbRrc> nrGnbRrc = GetNetDevice()->GetRrc();
+                    nrGnbRrc->SendHandoverRequest(handover.targetRnti, handover.targetCellId);
+                },
+                [this](const OranTxPowerPayload& txPower) {
+                    // NR gNBs may have multiple bandwidth parts (BWPs), each with
+                    // its own PHY/TxPower; this scenario config uses a single band
+                    // (BWP index 0), so that is the only PHY that needs updating.
+                    Ptr<NrGnbPhy> phy = GetNetDevice()->GetPhy(0);
+                    NS_ABORT_MSG_IF(phy == nullptr, "No NrGnbPhy on gNB; dropping TxPower cmd");
+
+                    double deltaDb = txPower.powerDeltaDb;
+                    double curDbm  = phy->GetTxPower();
+                    double newDbm  = curDbm + deltaDb;
+                    // NR small/macro-cell gNB TxPower is a much narrower range than
+                    // LTE macro eNBs (0-70 dBm there); clamp to a generic sub-6GHz
+                    // gNB range instead.
+                    if (newDbm < 0.0) newDbm = 0.0;
+                    if (newDbm > 50.0) newDbm = 50.0;
+                    phy->SetTxPower(newDbm);
+
+                    NS_LOG_INFO("gNB[E2=" << GetE2NodeId()
+                                << "] TxPower: " << curDbm << " dBm -> " << newDbm
+                                << " dBm (delta=" << deltaDb << " dB)");
+                },
+                [this, &command](const OranCellParameterPayload& param) {
+                    const bool applied =
+                        GetNearRtRic()->GetCellControlStore()->Apply(GetE2NodeId(),
+                                                                     param.parameter,
+                                                                     param.value,
+                                                                     param.isDelta);
+                    if (applied)
+                    {
+                        NS_LOG_INFO("gNB[E2=" << GetE2NodeId() << "] cell-control "
+                                              << CellControlParameterToString(param.parameter)
+                                              << "=" << param.value
+                                              << " isDelta=" << param.isDelta);
+                    }
+                    else
+                    {
+                        NS_LOG_WARN("gNB[E2=" << GetE2NodeId()
+                                              << "] unknown cell-control parameter in "
+                                              << command->ToString());
+                    }
+                }},
+            data.payload);
     }
 }
 
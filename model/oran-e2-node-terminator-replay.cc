@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-node-terminator-replay.h"
+
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranE2NodeTerminatorReplay");
+
+NS_OBJECT_ENSURE_REGISTERED(OranE2NodeTerminatorReplay);
+
+TypeId
+OranE2NodeTerminatorReplay::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranE2NodeTerminatorReplay")
+            .SetParent<OranE2NodeTerminator>()
+            .AddConstructor<OranE2NodeTerminatorReplay>()
+            .AddAttribute("NodeType",
+                          "The E2 Node Type of the recorded node.",
+                          EnumValue(OranNearRtRic::WIRED),
+                          MakeEnumAccessor<OranNearRtRic::NodeType>(
+                              &OranE2NodeTerminatorReplay::m_nodeType),
+                          MakeEnumChecker(OranNearRtRic::WIRED,
+                                          "WIRED",
+                                          OranNearRtRic::LTEUE,
+                                          "LTEUE",
+                                          OranNearRtRic::LTEENB,
+                                          "LTEENB",
+                                          OranNearRtRic::NRUE,
+                                          "NRUE",
+                                          OranNearRtRic::NRGNB,
+                                          "NRGNB"))
+            .AddAttribute("CellId",
+                          "The cell ID of the recorded eNB or gNB.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&OranE2NodeTerminatorReplay::m_cellId),
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("Imsi",
+                          "The IMSI of the recorded UE.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&OranE2NodeTerminatorReplay::m_imsi),
+                          MakeUintegerChecker<uint64_t>())
+            .AddTraceSource("CommandReceived",
+                            "A Command received for the recorded node.",
+                            MakeTraceSourceAccessor(&OranE2NodeTerminatorReplay::m_commandTrace),
+                            "ns3::OranE2NodeTerminatorReplay::CommandTracedCallback");
+
+    return tid;
+}
+
+OranE2NodeTerminatorReplay::OranE2NodeTerminatorReplay()
+    : OranE2NodeTerminator(),
+      m_nodeType(OranNearRtRic::WIRED),
+      m_cellId(0),
+      m_imsi(0),
+      m_nCommandsReceived(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranE2NodeTerminatorReplay::~OranE2NodeTerminatorReplay()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranNearRtRic::NodeType
+OranE2NodeTerminatorReplay::GetNodeType() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nodeType;
+}
+
+void
+OranE2NodeTerminatorReplay::ReceiveCommand(Ptr<OranCommand> command)
+{
+    NS_LOG_FUNCTION(this << command);
+
+    NS_LOG_INFO(Simulator::Now().As(Time::S)
+                << " E2 Node " << GetE2NodeId() << " received " << command->ToString());
+
+    m_nCommandsReceived++;
+    m_commandTrace(GetE2NodeId(), command);
+}
+
+void
+OranE2NodeTerminatorReplay::ReceiveDeregistrationResponse(uint64_t e2NodeId)
+{
+    NS_LOG_FUNCTION(this << e2NodeId);
+}
+
+void
+OranE2NodeTerminatorReplay::ReceiveRegistrationResponse(uint64_t e2NodeId)
+{
+    NS_LOG_FUNCTION(this << e2NodeId);
+}
+
+uint16_t
+OranE2NodeTerminatorReplay::GetCellId() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_cellId;
+}
+
+uint64_t
+OranE2NodeTerminatorReplay::GetImsi() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_imsi;
+}
+
+uint64_t
+OranE2NodeTerminatorReplay::GetNCommandsReceived() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nCommandsReceived;
+}
+
+} // namespace ns3
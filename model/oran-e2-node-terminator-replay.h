@@ -0,0 +1,124 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_NODE_TERMINATOR_REPLAY_H
+#define ORAN_E2_NODE_TERMINATOR_REPLAY_H
+
+#include "oran-command.h"
+#include "oran-e2-node-terminator.h"
+
+#include "ns3/traced-callback.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * E2 Node Terminator that stands in for an E2 node of a recorded run during
+ * an offline replay (see OranReportReplayer). It carries the recorded node
+ * type, E2 Node ID, and cell ID or IMSI, so the Near-RT RIC can register it
+ * without a network device, and it logs the Commands it receives instead of
+ * applying them.
+ *
+ * The terminator is driven by the replayer and is never activated, so it
+ * runs no registration or report loops of its own.
+ */
+class OranE2NodeTerminatorReplay : public OranE2NodeTerminator
+{
+  public:
+    /**
+     * Get the TypeId of the OranE2NodeTerminatorReplay class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranE2NodeTerminatorReplay class.
+     */
+    OranE2NodeTerminatorReplay();
+    /**
+     * Destructor of the OranE2NodeTerminatorReplay class.
+     */
+    ~OranE2NodeTerminatorReplay() override;
+    /**
+     * Get the E2 Node Type of the recorded node.
+     *
+     * @return the E2 Node Type.
+     */
+    OranNearRtRic::NodeType GetNodeType() const override;
+    /**
+     * Receive a Command. The Command is logged and traced, but not applied.
+     *
+     * @param command The received command.
+     */
+    void ReceiveCommand(Ptr<OranCommand> command) override;
+    /**
+     * Receive a deregistration response. Ignored, as the terminator keeps
+     * the recorded E2 Node ID.
+     *
+     * @param e2NodeId The E2 Node ID.
+     */
+    void ReceiveDeregistrationResponse(uint64_t e2NodeId) override;
+    /**
+     * Receive a registration response. Ignored, as the terminator keeps the
+     * recorded E2 Node ID.
+     *
+     * @param e2NodeId The E2 Node ID.
+     */
+    void ReceiveRegistrationResponse(uint64_t e2NodeId) override;
+    /**
+     * Get the cell ID of the recorded eNB or gNB.
+     *
+     * @return The cell ID.
+     */
+    uint16_t GetCellId() const;
+    /**
+     * Get the IMSI of the recorded UE.
+     *
+     * @return The IMSI.
+     */
+    uint64_t GetImsi() const;
+    /**
+     * Get the number of Commands received so far.
+     *
+     * @return The number of Commands.
+     */
+    uint64_t GetNCommandsReceived() const;
+
+    /**
+     * TracedCallback signature for received Commands.
+     *
+     * @param [in] e2NodeId The E2 Node ID of the recorded node.
+     * @param [in] command The Command.
+     */
+    typedef void (*CommandTracedCallback)(uint64_t e2NodeId, Ptr<const OranCommand> command);
+
+  private:
+    /**
+     * The E2 Node Type of the recorded node.
+     */
+    OranNearRtRic::NodeType m_nodeType;
+    /**
+     * The cell ID of the recorded eNB or gNB.
+     */
+    uint16_t m_cellId;
+    /**
+     * The IMSI of the recorded UE.
+     */
+    uint64_t m_imsi;
+    /**
+     * The number of Commands received.
+     */
+    uint64_t m_nCommandsReceived;
+    /**
+     * The trace of received Commands.
+     */
+    TracedCallback<uint64_t, Ptr<const OranCommand>> m_commandTrace;
+}; // class OranE2NodeTerminatorReplay
+
+} // namespace ns3
+
+#endif // ORAN_E2_NODE_TERMINATOR_REPLAY_H
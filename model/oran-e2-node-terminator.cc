@@ -34,13 +34,19 @@
 #include "oran-reporter.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/object-vector.h"
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
 namespace ns3
 {
 
@@ -90,7 +96,37 @@ OranE2NodeTerminator::GetTypeId()
                           "delay for a report.",
                           StringValue("ns3::ConstantRandomVariable[Constant=0]"),
                           MakePointerAccessor(&OranE2NodeTerminator::m_transmissionDelayRv),
-                          MakePointerChecker<RandomVariableStream>());
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("BatchReports",
+                          "Flag to send all Reports buffered for a send interval to the "
+                          "Near-RT RIC as one batch with a single transmission delay, "
+                          "instead of one message with its own delay per Report.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OranE2NodeTerminator::m_batchReports),
+                          MakeBooleanChecker())
+            .AddAttribute("TickService",
+                          "The tick service that coalesces the registration and send timers. "
+                          "If null, every terminator schedules its own simulator events.",
+                          PointerValue(nullptr),
+                          MakePointerAccessor(&OranE2NodeTerminator::m_tickService),
+                          MakePointerChecker<OranTickService>())
+            .AddAttribute("CoalescedReportTypes",
+                          "Comma-separated list of Report TypeId names for which only the "
+                          "newest buffered Report of each coalescing key is sent.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranE2NodeTerminator::SetCoalescedReportTypes,
+                                             &OranE2NodeTerminator::GetCoalescedReportTypes),
+                          MakeStringChecker())
+            .AddAttribute("MaxBufferedReports",
+                          "The maximum number of Reports buffered between send events, or 0 "
+                          "for no limit. When full, the oldest buffered Report is dropped.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&OranE2NodeTerminator::m_maxBufferedReports),
+                          MakeUintegerChecker<uint32_t>())
+            .AddTraceSource("ReportDropped",
+                            "A buffered Report dropped because the buffer was full.",
+                            MakeTraceSourceAccessor(&OranE2NodeTerminator::m_droppedReportTrace),
+                            "ns3::OranE2NodeTerminator::ReportTracedCallback");
 
     return tid;
 }
@@ -99,9 +135,13 @@ OranE2NodeTerminator::OranE2NodeTerminator()
     : Object(),
       m_active(false),
       m_node(nullptr),
-      m_reports(std::vector<Ptr<OranReport>>()),
-      m_registrationEvent(EventId()),
-      m_sendEvent(EventId())
+      m_reports(std::deque<Ptr<OranReport>>()),
+      m_firstReportPosition(0),
+      m_nBufferedReports(0),
+      m_batchReports(false),
+      m_maxBufferedReports(0),
+      m_nCoalescedReports(0),
+      m_nDroppedReports(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -126,7 +166,7 @@ OranE2NodeTerminator::Activate()
         if (!m_active)
         {
             m_active = true;
-            m_reports.clear();
+            TakeBufferedReports();
 
             Register();
 
@@ -187,10 +227,208 @@ OranE2NodeTerminator::StoreReport(Ptr<OranReport> report)
 {
     NS_LOG_FUNCTION(this << report);
 
-    if (m_active)
+    if (!m_active)
+    {
+        return;
+    }
+
+    std::pair<uint16_t, uint64_t> key;
+    bool coalesced = GetCoalescedReportKey(report, key);
+    if (coalesced)
     {
-        m_reports.push_back(report);
+        auto it = m_coalescedReportIndex.find(key);
+        if (it != m_coalescedReportIndex.end())
+        {
+            // The newer Report goes to the back, as the newest one.
+            Ptr<OranReport>& replaced = m_reports[it->second - m_firstReportPosition];
+            NS_LOG_LOGIC("Replacing buffered " << replaced->ToString());
+            replaced = nullptr;
+            m_nBufferedReports--;
+            m_nCoalescedReports++;
+        }
     }
+
+    if (m_maxBufferedReports > 0 && m_nBufferedReports >= m_maxBufferedReports)
+    {
+        while (m_reports.front() == nullptr)
+        {
+            m_reports.pop_front();
+            m_firstReportPosition++;
+        }
+        Ptr<OranReport> oldest = m_reports.front();
+        m_reports.pop_front();
+        m_firstReportPosition++;
+        m_nBufferedReports--;
+
+        NS_LOG_LOGIC("Report buffer full; dropping " << oldest->ToString());
+        m_droppedReportTrace(oldest);
+        m_nDroppedReports++;
+
+        std::pair<uint16_t, uint64_t> oldestKey;
+        if (GetCoalescedReportKey(oldest, oldestKey))
+        {
+            m_coalescedReportIndex.erase(oldestKey);
+        }
+    }
+
+    if (coalesced)
+    {
+        m_coalescedReportIndex[key] = m_firstReportPosition + m_reports.size();
+    }
+    m_reports.push_back(report);
+    m_nBufferedReports++;
+}
+
+void
+OranE2NodeTerminator::ReceiveSubscriptions(OranSubscriptionSet subscriptions)
+{
+    NS_LOG_FUNCTION(this << subscriptions.ToString());
+
+    if (!m_active)
+    {
+        return;
+    }
+
+    for (const auto& reporter : m_reporters)
+    {
+        std::vector<TypeId> reportTypes = reporter->GetReportTypes();
+        if (reportTypes.empty())
+        {
+            continue;
+        }
+
+        bool covered = false;
+        Time minInterval = Seconds(0);
+        for (const auto& reportType : reportTypes)
+        {
+            Time maxInterval;
+            if (subscriptions.Covers(reportType, GetNodeType(), maxInterval))
+            {
+                // An interval of 0 keeps the configured one, so it wins.
+                if (!covered || maxInterval.IsZero() ||
+                    (!minInterval.IsZero() && maxInterval < minInterval))
+                {
+                    minInterval = maxInterval;
+                }
+                covered = true;
+            }
+        }
+
+        if (covered)
+        {
+            NS_LOG_LOGIC("Resuming " << reporter->GetInstanceTypeId().GetName()
+                                     << " with minimum interval " << minInterval.As(Time::S));
+            reporter->SetMinReportInterval(minInterval);
+            reporter->Resume();
+        }
+        else
+        {
+            NS_LOG_LOGIC("Suspending " << reporter->GetInstanceTypeId().GetName()
+                                       << " with no subscribers");
+            reporter->Suspend();
+        }
+    }
+}
+
+void
+OranE2NodeTerminator::SetCoalescedReportTypes(std::string reportTypes)
+{
+    NS_LOG_FUNCTION(this << reportTypes);
+
+    m_coalescedReportTypes.clear();
+    m_coalescedReportIndex.clear();
+
+    std::istringstream ss(reportTypes);
+    std::string name;
+    while (std::getline(ss, name, ','))
+    {
+        name.erase(0, name.find_first_not_of(" \t"));
+        name.erase(name.find_last_not_of(" \t") + 1);
+        if (name.empty())
+        {
+            continue;
+        }
+
+        TypeId tid;
+        NS_ABORT_MSG_IF(!TypeId::LookupByNameFailSafe(name, &tid),
+                        "Unknown Report type \"" << name << "\" to coalesce");
+        NS_ABORT_MSG_IF(!tid.IsChildOf(OranReport::GetTypeId()),
+                        "\"" << name << "\" is not a Report type");
+        m_coalescedReportTypes.push_back(tid);
+    }
+}
+
+std::string
+OranE2NodeTerminator::GetCoalescedReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string reportTypes;
+    for (const auto& tid : m_coalescedReportTypes)
+    {
+        reportTypes += (reportTypes.empty() ? "" : ",") + tid.GetName();
+    }
+    return reportTypes;
+}
+
+std::vector<Ptr<OranReport>>
+OranE2NodeTerminator::GetBufferedReports() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<Ptr<OranReport>> reports;
+    reports.reserve(m_nBufferedReports);
+    for (const auto& report : m_reports)
+    {
+        if (report != nullptr)
+        {
+            reports.push_back(report);
+        }
+    }
+    return reports;
+}
+
+uint64_t
+OranE2NodeTerminator::GetNCoalescedReports() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nCoalescedReports;
+}
+
+uint64_t
+OranE2NodeTerminator::GetNDroppedReports() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nDroppedReports;
+}
+
+bool
+OranE2NodeTerminator::GetCoalescedReportKey(Ptr<OranReport> report,
+                                            std::pair<uint16_t, uint64_t>& key) const
+{
+    TypeId tid = report->GetInstanceTypeId();
+    if (std::find(m_coalescedReportTypes.begin(), m_coalescedReportTypes.end(), tid) ==
+        m_coalescedReportTypes.end())
+    {
+        return false;
+    }
+    key = std::make_pair(tid.GetUid(), report->GetCoalescingKey());
+    return true;
+}
+
+std::vector<Ptr<OranReport>>
+OranE2NodeTerminator::TakeBufferedReports()
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<Ptr<OranReport>> reports = GetBufferedReports();
+    m_reports.clear();
+    m_firstReportPosition = 0;
+    m_nBufferedReports = 0;
+    m_coalescedReportIndex.clear();
+    return reports;
 }
 
 void
@@ -274,10 +512,11 @@ OranE2NodeTerminator::DoDispose()
 
     m_node = nullptr;
     m_nearRtRic = nullptr;
-    m_reports.clear();
+    TakeBufferedReports();
     m_reporters.clear();
     m_registrationIntervalRv = nullptr;
     m_sendIntervalRv = nullptr;
+    m_tickService = nullptr;
 
     Object::DoDispose();
 }
@@ -292,15 +531,28 @@ OranE2NodeTerminator::DoSendReports()
         NS_ABORT_MSG_IF(m_nearRtRic == nullptr,
                         "Attempting to send a report to a null Near-RT RIC");
 
-        for (const auto& r : m_reports)
+        std::vector<Ptr<OranReport>> reports = TakeBufferedReports();
+        if (m_batchReports)
         {
-            Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
-                                &OranNearRtRicE2Terminator::ReceiveReport,
-                                m_nearRtRic->GetE2Terminator(),
-                                r);
+            if (!reports.empty())
+            {
+                Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
+                                    &OranNearRtRicE2Terminator::ReceiveReportBatch,
+                                    m_nearRtRic->GetE2Terminator(),
+                                    std::move(reports));
+            }
+        }
+        else
+        {
+            for (const auto& r : reports)
+            {
+                Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
+                                    &OranNearRtRicE2Terminator::ReceiveReport,
+                                    m_nearRtRic->GetE2Terminator(),
+                                    r);
+            }
         }
 
-        m_reports.clear();
         ScheduleNextSend();
     }
 }
@@ -335,7 +587,9 @@ OranE2NodeTerminator::Register()
         }
 
         m_registrationEvent =
-            Simulator::Schedule(registrationDelay, &OranE2NodeTerminator::Register, this);
+            OranTickService::Schedule(m_tickService,
+                                      registrationDelay,
+                                      MakeCallback(&OranE2NodeTerminator::Register, this));
     }
 }
 
@@ -346,9 +600,10 @@ OranE2NodeTerminator::ScheduleNextSend()
 
     if (m_active)
     {
-        m_sendEvent = Simulator::Schedule(Seconds(m_sendIntervalRv->GetValue()),
-                                          &OranE2NodeTerminator::DoSendReports,
-                                          this);
+        m_sendEvent =
+            OranTickService::Schedule(m_tickService,
+                                      Seconds(m_sendIntervalRv->GetValue()),
+                                      MakeCallback(&OranE2NodeTerminator::DoSendReports, this));
     }
 }
 
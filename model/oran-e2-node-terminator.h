@@ -34,10 +34,19 @@
 #include "oran-command.h"
 #include "oran-near-rt-ric.h"
 #include "oran-report.h"
+#include "oran-subscription.h"
+#include "oran-tick-service.h"
 
 #include "ns3/node.h"
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/traced-callback.h"
+
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -111,11 +120,49 @@ class OranE2NodeTerminator : public Object
      */
     virtual bool IsActive() const;
     /**
-     * Store a Report generated by a Reporter.
+     * Store a Report generated by a Reporter until the next send event.
+     *
+     * If the type of the Report is one of the coalesced types, it replaces
+     * the buffered Report of the same type and coalescing key (see
+     * OranReport::GetCoalescingKey), if any, and goes to the back of the
+     * buffer, as the newest Report. If the buffer already holds
+     * MaxBufferedReports Reports, the oldest one is dropped.
      *
      * @param report The Report to store.
      */
     virtual void StoreReport(Ptr<OranReport> report);
+    /**
+     * Set the Report types whose buffered Reports are replaced by newer ones
+     * of the same type and coalescing key, instead of all being sent.
+     *
+     * @param reportTypes A comma-separated list of Report TypeId names, e.g.,
+     *        "ns3::OranReportLocation,ns3::OranReportAppLoss".
+     */
+    void SetCoalescedReportTypes(std::string reportTypes);
+    /**
+     * Get the Report types whose buffered Reports are coalesced.
+     *
+     * @return A comma-separated list of Report TypeId names.
+     */
+    std::string GetCoalescedReportTypes() const;
+    /**
+     * Get the buffered Reports, in the order they will be sent.
+     *
+     * @return The Reports, oldest first.
+     */
+    std::vector<Ptr<OranReport>> GetBufferedReports() const;
+    /**
+     * Get the number of buffered Reports that were replaced by newer ones.
+     *
+     * @return The number of coalesced Reports.
+     */
+    uint64_t GetNCoalescedReports() const;
+    /**
+     * Get the number of buffered Reports dropped because the buffer was full.
+     *
+     * @return The number of dropped Reports.
+     */
+    uint64_t GetNDroppedReports() const;
     /**
      * Receive and process a Command.
      *
@@ -136,6 +183,24 @@ class OranE2NodeTerminator : public Object
      * @param e2NodeId A valid E2 Node ID or 0 to indicate a failed registration request.
      */
     virtual void ReceiveRegistrationResponse(uint64_t e2NodeId);
+    /**
+     * Receive the subscriptions of the Near-RT RIC. Reporters whose Reports
+     * no subscription covers for this node type are suspended, and the
+     * others are resumed, with their trigger intervals relaxed to the
+     * shortest interval of the covering subscriptions. Reporters that do not
+     * declare their Report types are left as they are.
+     *
+     * @param subscriptions The union of the subscriptions of the modules of
+     *        the Near-RT RIC.
+     */
+    virtual void ReceiveSubscriptions(OranSubscriptionSet subscriptions);
+
+    /**
+     * TracedCallback signature for dropped Reports.
+     *
+     * @param [in] report The Report.
+     */
+    typedef void (*ReportTracedCallback)(Ptr<const OranReport> report);
 
   protected:
     /**
@@ -174,6 +239,21 @@ class OranE2NodeTerminator : public Object
     bool m_active;
 
   private:
+    /**
+     * Get the key of a Report in the index of coalesced Reports.
+     *
+     * @param report The Report.
+     * @param key Set to the Report type UID and the coalescing key.
+     * @return True if Reports of this type are coalesced.
+     */
+    bool GetCoalescedReportKey(Ptr<OranReport> report, std::pair<uint16_t, uint64_t>& key) const;
+    /**
+     * Take the buffered Reports, oldest first, and empty the buffer.
+     *
+     * @return The Reports.
+     */
+    std::vector<Ptr<OranReport>> TakeBufferedReports();
+
     /**
      * The E2 Node ID.
      */
@@ -195,9 +275,20 @@ class OranE2NodeTerminator : public Object
      */
     Ptr<OranNearRtRic> m_nearRtRic;
     /**
-     * The collection of Reports to send.
+     * The Reports to send, oldest first. A Report replaced by a coalesced
+     * one is left as a null entry until the next send, so that the others
+     * keep their positions.
+     */
+    std::deque<Ptr<OranReport>> m_reports;
+    /**
+     * The position of the first entry of m_reports, counted from the last
+     * time the buffer was emptied.
      */
-    std::vector<Ptr<OranReport>> m_reports;
+    uint64_t m_firstReportPosition;
+    /**
+     * The number of entries of m_reports that are not null.
+     */
+    std::size_t m_nBufferedReports;
     /**
      * The collection of Reporters.
      */
@@ -205,7 +296,7 @@ class OranE2NodeTerminator : public Object
     /**
      * The event with the next registration request.
      */
-    EventId m_registrationEvent;
+    OranTickEventId m_registrationEvent;
     /**
      * The random variable used to periodically send registration requests.
      */
@@ -213,7 +304,7 @@ class OranE2NodeTerminator : public Object
     /**
      * The event with the next Report transmission.
      */
-    EventId m_sendEvent;
+    OranTickEventId m_sendEvent;
     /**
      * The random variable used to send Reports to the Near-RT RIC.
      */
@@ -222,6 +313,40 @@ class OranE2NodeTerminator : public Object
      * The random variable used to to determine the transmission delay of a report.
      */
     Ptr<RandomVariableStream> m_transmissionDelayRv;
+    /**
+     * Flag to send the buffered Reports as one batch.
+     */
+    bool m_batchReports;
+    /**
+     * The tick service the registration and send timers are scheduled on, if any.
+     */
+    Ptr<OranTickService> m_tickService;
+    /**
+     * The Report types whose buffered Reports are coalesced.
+     */
+    std::vector<TypeId> m_coalescedReportTypes;
+    /**
+     * The position (see m_firstReportPosition) of the buffered Report of
+     * each coalesced Report type UID and coalescing key.
+     */
+    std::map<std::pair<uint16_t, uint64_t>, uint64_t> m_coalescedReportIndex;
+    /**
+     * The maximum number of buffered Reports, or 0 for no limit.
+     */
+    uint32_t m_maxBufferedReports;
+    /**
+     * The number of buffered Reports replaced by newer ones.
+     */
+    uint64_t m_nCoalescedReports;
+    /**
+     * The number of buffered Reports dropped because the buffer was full.
+     */
+    uint64_t m_nDroppedReports;
+    /**
+     * The trace fired when a buffered Report is dropped because the buffer
+     * was full.
+     */
+    TracedCallback<Ptr<const OranReport>> m_droppedReportTrace;
 
   public:
     /**
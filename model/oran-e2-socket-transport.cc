@@ -0,0 +1,337 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-socket-transport.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/string.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utility>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranE2SocketTransport");
+
+NS_OBJECT_ENSURE_REGISTERED(OranE2SocketTransport);
+
+namespace
+{
+
+/**
+ * @return The current value of the monotonic wall clock, in nanoseconds.
+ */
+int64_t
+NowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * Blocking read of exactly size bytes, for the loopback peer.
+ *
+ * @param fd The socket.
+ * @param data The destination.
+ * @param size The number of bytes.
+ * @return False on end of file or error.
+ */
+bool
+LoopbackRead(int fd, uint8_t* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = read(fd, data, size);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * Blocking write of exactly size bytes, for the loopback peer.
+ *
+ * @param fd The socket.
+ * @param data The source.
+ * @param size The number of bytes.
+ * @return False on error.
+ */
+bool
+LoopbackWrite(int fd, const uint8_t* data, std::size_t size)
+{
+    while (size > 0)
+    {
+        ssize_t n = write(fd, data, size);
+        if (n < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (n <= 0)
+        {
+            return false;
+        }
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * The loopback peer: return every frame unchanged until end of file.
+ *
+ * @param fd The socket.
+ */
+[[noreturn]] void
+RunLoopback(int fd)
+{
+    std::vector<uint8_t> frame;
+    uint8_t length[4];
+    while (LoopbackRead(fd, length, sizeof(length)))
+    {
+        uint32_t size = length[0] | (length[1] << 8) | (length[2] << 16) |
+                        (static_cast<uint32_t>(length[3]) << 24);
+        frame.resize(size);
+        if (!LoopbackRead(fd, frame.data(), size) ||
+            !LoopbackWrite(fd, length, sizeof(length)) || !LoopbackWrite(fd, frame.data(), size))
+        {
+            _exit(1);
+        }
+    }
+    _exit(0);
+}
+
+} // namespace
+
+TypeId
+OranE2SocketTransport::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranE2SocketTransport")
+            .SetParent<Object>()
+            .AddConstructor<OranE2SocketTransport>()
+            .AddAttribute("SocketPath",
+                          "The path of the Unix stream socket of the peer. If empty, a loopback "
+                          "peer that returns every message unchanged is started.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranE2SocketTransport::m_socketPath),
+                          MakeStringChecker())
+            .AddAttribute("Timeout",
+                          "The longest wall-clock time to wait for the peer to answer before "
+                          "aborting the simulation.",
+                          TimeValue(Seconds(30)),
+                          MakeTimeAccessor(&OranE2SocketTransport::m_timeout),
+                          MakeTimeChecker(Seconds(0)));
+
+    return tid;
+}
+
+OranE2SocketTransport::OranE2SocketTransport()
+    : Object(),
+      m_fd(-1),
+      m_pid(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranE2SocketTransport::~OranE2SocketTransport()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+const std::vector<uint8_t>&
+OranE2SocketTransport::Exchange(const std::vector<uint8_t>& message)
+{
+    NS_LOG_FUNCTION(this << message.size());
+
+    if (m_fd < 0)
+    {
+        Connect();
+    }
+
+    int64_t start = NowNs();
+    WriteFrame(message.data(), message.size());
+
+    int64_t deadline = start + m_timeout.GetNanoSeconds();
+    uint8_t length[4];
+    ReadExactly(length, sizeof(length), deadline);
+    uint32_t size = length[0] | (length[1] << 8) | (length[2] << 16) |
+                    (static_cast<uint32_t>(length[3]) << 24);
+    m_reply.resize(size);
+    ReadExactly(m_reply.data(), size, deadline);
+
+    m_stats.nExchanges++;
+    m_stats.nBytesSent += message.size();
+    m_stats.nBytesReceived += size;
+    m_stats.roundTripNs += NowNs() - start;
+
+    return m_reply;
+}
+
+void
+OranE2SocketTransport::Close()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_fd >= 0)
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+
+    if (m_pid > 0)
+    {
+        // The loopback peer sees the closed socket as end of file and exits.
+        waitpid(m_pid, nullptr, 0);
+        m_pid = 0;
+    }
+}
+
+const OranE2SocketTransportStats&
+OranE2SocketTransport::GetStats() const
+{
+    return m_stats;
+}
+
+void
+OranE2SocketTransport::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Close();
+    m_reply.clear();
+
+    Object::DoDispose();
+}
+
+void
+OranE2SocketTransport::Connect()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_socketPath.empty())
+    {
+        sockaddr_un address{};
+        NS_ABORT_MSG_IF(m_socketPath.size() >= sizeof(address.sun_path),
+                        "Socket path \"" << m_socketPath << "\" is too long");
+        address.sun_family = AF_UNIX;
+        std::strncpy(address.sun_path, m_socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+        m_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        NS_ABORT_MSG_IF(m_fd < 0, "Could not create a Unix socket, errno=" << errno);
+        NS_ABORT_MSG_IF(connect(m_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0,
+                        "Could not connect to \"" << m_socketPath << "\", errno=" << errno);
+
+        NS_LOG_LOGIC("Connected to the E2 peer at \"" << m_socketPath << "\"");
+        return;
+    }
+
+    int fds[2];
+    NS_ABORT_MSG_IF(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0,
+                    "Could not create a socket pair, errno=" << errno);
+
+    // Anything still buffered would be written once more by the child.
+    std::cout.flush();
+    std::cerr.flush();
+    std::fflush(nullptr);
+
+    pid_t pid = fork();
+    NS_ABORT_MSG_IF(pid < 0, "Could not fork the loopback E2 peer, errno=" << errno);
+    if (pid == 0)
+    {
+        close(fds[0]);
+        RunLoopback(fds[1]);
+    }
+
+    close(fds[1]);
+    m_fd = fds[0];
+    m_pid = pid;
+
+    NS_LOG_LOGIC("Started the loopback E2 peer as process " << pid);
+}
+
+void
+OranE2SocketTransport::WriteFrame(const uint8_t* data, std::size_t size)
+{
+    NS_LOG_FUNCTION(this << size);
+
+    NS_ABORT_MSG_IF(size > UINT32_MAX, "E2 message of " << size << " bytes is too long to send");
+    const uint8_t length[4] = {static_cast<uint8_t>(size),
+                               static_cast<uint8_t>(size >> 8),
+                               static_cast<uint8_t>(size >> 16),
+                               static_cast<uint8_t>(size >> 24)};
+
+    for (auto part : {std::make_pair(length, sizeof(length)), std::make_pair(data, size)})
+    {
+        const uint8_t* next = part.first;
+        std::size_t remaining = part.second;
+        while (remaining > 0)
+        {
+            // MSG_NOSIGNAL: a peer that went away aborts below, not with SIGPIPE.
+            ssize_t n = send(m_fd, next, remaining, MSG_NOSIGNAL);
+            if (n < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            NS_ABORT_MSG_IF(n <= 0, "Could not send to the E2 peer, errno=" << errno);
+            next += n;
+            remaining -= static_cast<std::size_t>(n);
+        }
+    }
+}
+
+void
+OranE2SocketTransport::ReadExactly(uint8_t* data, std::size_t size, int64_t deadline)
+{
+    NS_LOG_FUNCTION(this << size);
+
+    while (size > 0)
+    {
+        int64_t remainingMs = (deadline - NowNs()) / 1000000;
+        NS_ABORT_MSG_IF(remainingMs <= 0, "The E2 peer did not answer within " << m_timeout);
+
+        pollfd pfd{m_fd, POLLIN, 0};
+        int ready = poll(&pfd, 1, static_cast<int>(std::min<int64_t>(remainingMs, INT32_MAX)));
+        if (ready <= 0)
+        {
+            NS_ABORT_MSG_IF(ready < 0 && errno != EINTR,
+                            "Could not wait for the E2 peer, errno=" << errno);
+            continue;
+        }
+
+        ssize_t n = read(m_fd, data, size);
+        if (n < 0)
+        {
+            NS_ABORT_MSG_IF(errno != EAGAIN && errno != EINTR,
+                            "Could not read from the E2 peer, errno=" << errno);
+            continue;
+        }
+        NS_ABORT_MSG_IF(n == 0, "The E2 peer closed the connection");
+        data += n;
+        size -= static_cast<std::size_t>(n);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_SOCKET_TRANSPORT_H
+#define ORAN_E2_SOCKET_TRANSPORT_H
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Counters of an OranE2SocketTransport.
+ */
+struct OranE2SocketTransportStats
+{
+    uint64_t nExchanges = 0;     //!< The number of messages sent.
+    uint64_t nBytesSent = 0;     //!< The bytes sent, without framing.
+    uint64_t nBytesReceived = 0; //!< The bytes received, without framing.
+    uint64_t roundTripNs = 0;    //!< Wall-clock time spent in exchanges (ns).
+};
+
+/**
+ * @ingroup oran
+ *
+ * Carries encoded E2 messages (see OranE2Codec) over a local stream socket
+ * to a peer in another process on the same host, e.g., a Near-RT RIC
+ * running outside the simulation, and returns the peer's answer.
+ *
+ * Every exchange writes one frame and reads one frame back. A frame is a
+ * 32-bit little-endian length followed by that many bytes. The frame sent
+ * holds one encoded message, and the frame returned holds zero or more
+ * encoded messages for the Near-RT RIC E2 Terminator to act on, e.g., the
+ * Reports to store and the Commands to deliver. The exchange is
+ * synchronous: simulation time does not advance until the peer answers,
+ * and the simulation is aborted if it does not answer within Timeout.
+ *
+ * When SocketPath is set, the transport connects to a Unix stream socket
+ * at that path on first use. Otherwise, it creates a socket pair and forks
+ * a loopback peer that returns every frame unchanged, so that the cost of
+ * leaving the process can be measured without an external RIC.
+ */
+class OranE2SocketTransport : public Object
+{
+  public:
+    /**
+     * Get the TypeId of the OranE2SocketTransport class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranE2SocketTransport class.
+     */
+    OranE2SocketTransport();
+    /**
+     * Destructor of the OranE2SocketTransport class.
+     */
+    ~OranE2SocketTransport() override;
+    /**
+     * Send a message to the peer and wait for its answer, connecting first
+     * if needed.
+     *
+     * @param message The encoded message.
+     * @return The encoded messages returned by the peer. The reference is
+     *         valid until the next exchange.
+     */
+    const std::vector<uint8_t>& Exchange(const std::vector<uint8_t>& message);
+    /**
+     * Close the connection, and wait for the loopback peer if there is one.
+     */
+    void Close();
+    /**
+     * @return The counters of the transport.
+     */
+    const OranE2SocketTransportStats& GetStats() const;
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * Connect to the peer, or start the loopback peer.
+     */
+    void Connect();
+    /**
+     * Write a frame to the socket.
+     *
+     * @param data The bytes of the frame.
+     * @param size The number of bytes.
+     */
+    void WriteFrame(const uint8_t* data, std::size_t size);
+    /**
+     * Read exactly size bytes from the socket.
+     *
+     * @param data The destination.
+     * @param size The number of bytes.
+     * @param deadline The steady-clock time (ns) after which to abort.
+     */
+    void ReadExactly(uint8_t* data, std::size_t size, int64_t deadline);
+
+    /**
+     * The path of the Unix socket of the peer, or empty for the loopback.
+     */
+    std::string m_socketPath;
+    /**
+     * The longest wall-clock time to wait for the peer to answer.
+     */
+    Time m_timeout;
+    /**
+     * The connected socket, or -1.
+     */
+    int m_fd;
+    /**
+     * The process ID of the loopback peer, or 0.
+     */
+    pid_t m_pid;
+    /**
+     * The last answer of the peer.
+     */
+    std::vector<uint8_t> m_reply;
+    /**
+     * The counters.
+     */
+    OranE2SocketTransportStats m_stats;
+}; // class OranE2SocketTransport
+
+} // namespace ns3
+
+#endif // ORAN_E2_SOCKET_TRANSPORT_H
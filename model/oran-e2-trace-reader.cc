@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-trace-reader.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranE2TraceReader");
+
+OranE2TraceReader::OranE2TraceReader(const std::string& fileName)
+    : m_map(nullptr),
+      m_mapSize(0),
+      m_records(nullptr),
+      m_nRecords(0),
+      m_indexStride(0)
+{
+    NS_LOG_FUNCTION(this << fileName);
+
+    int fd = open(fileName.c_str(), O_RDONLY);
+    NS_ABORT_MSG_IF(fd < 0, "Could not open E2 trace file \"" << fileName << "\"");
+
+    struct stat st;
+    NS_ABORT_MSG_IF(fstat(fd, &st) != 0, "Could not stat E2 trace file \"" << fileName << "\"");
+    m_mapSize = st.st_size;
+    NS_ABORT_MSG_IF(m_mapSize < sizeof(OranE2TraceFileHeader),
+                    "E2 trace file \"" << fileName << "\" is too short");
+
+    m_map = mmap(nullptr, m_mapSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    NS_ABORT_MSG_IF(m_map == MAP_FAILED, "Could not map E2 trace file \"" << fileName << "\"");
+
+    const auto* header = static_cast<const OranE2TraceFileHeader*>(m_map);
+    NS_ABORT_MSG_IF(std::memcmp(header->magic, "ORANE2TR", sizeof(header->magic)) != 0,
+                    "\"" << fileName << "\" is not an E2 trace file");
+    NS_ABORT_MSG_IF(header->version != ORAN_E2_TRACE_VERSION,
+                    "Unsupported E2 trace version " << header->version);
+    NS_ABORT_MSG_IF(header->byteOrder != 0x01020304,
+                    "E2 trace file \"" << fileName << "\" was written with another byte order");
+    NS_ABORT_MSG_IF(header->recordSize != sizeof(OranE2TraceRecord),
+                    "Unexpected E2 trace record size " << header->recordSize);
+
+    // The header is 32 bytes, so the records stay 8-byte aligned in the map.
+    m_records = reinterpret_cast<const OranE2TraceRecord*>(static_cast<const char*>(m_map) +
+                                                           sizeof(OranE2TraceFileHeader));
+    m_nRecords = (m_mapSize - sizeof(OranE2TraceFileHeader)) / sizeof(OranE2TraceRecord);
+
+    ReadIndex(fileName + ".idx");
+
+    NS_LOG_INFO("Opened E2 trace \"" << fileName << "\" with " << m_nRecords << " records");
+}
+
+OranE2TraceReader::~OranE2TraceReader()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_map != nullptr)
+    {
+        munmap(m_map, m_mapSize);
+    }
+}
+
+uint64_t
+OranE2TraceReader::GetNRecords() const
+{
+    return m_nRecords;
+}
+
+const OranE2TraceRecord&
+OranE2TraceReader::GetRecord(uint64_t i) const
+{
+    NS_ABORT_MSG_IF(i >= m_nRecords, "E2 trace record " << i << " out of range");
+
+    return m_records[i];
+}
+
+const OranE2TraceRecord*
+OranE2TraceReader::begin() const
+{
+    return m_records;
+}
+
+const OranE2TraceRecord*
+OranE2TraceReader::end() const
+{
+    return m_records + m_nRecords;
+}
+
+uint64_t
+OranE2TraceReader::Seek(Time t) const
+{
+    NS_LOG_FUNCTION(this << t);
+
+    int64_t step = t.GetTimeStep();
+
+    // Narrow the search to the index block holding the first record at or
+    // after t, so only its pages of the trace are touched.
+    uint64_t first = 0;
+    uint64_t last = m_nRecords;
+    if (!m_index.empty())
+    {
+        auto it = std::lower_bound(m_index.begin(), m_index.end(), step);
+        uint64_t block = it - m_index.begin();
+        if (block > 0)
+        {
+            first = (block - 1) * m_indexStride;
+        }
+        last = std::min<uint64_t>(block * m_indexStride, m_nRecords);
+        if (last < first)
+        {
+            last = first;
+        }
+    }
+
+    const OranE2TraceRecord* record =
+        std::lower_bound(m_records + first,
+                         m_records + last,
+                         step,
+                         [](const OranE2TraceRecord& r, int64_t s) { return r.time < s; });
+    return record - m_records;
+}
+
+void
+OranE2TraceReader::WriteCsv(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    WriteE2TraceCsvHeader(os);
+    for (const auto& record : *this)
+    {
+        WriteE2TraceCsvLine(os, record);
+    }
+}
+
+void
+OranE2TraceReader::ReadIndex(const std::string& indexFileName)
+{
+    NS_LOG_FUNCTION(this << indexFileName);
+
+    std::FILE* file = std::fopen(indexFileName.c_str(), "rb");
+    if (file == nullptr)
+    {
+        NS_LOG_WARN("No index for the E2 trace; seeks will search the whole trace");
+        return;
+    }
+
+    OranE2TraceIndexHeader header{};
+    bool ok = std::fread(&header, sizeof(header), 1, file) == 1 &&
+              std::memcmp(header.magic, "ORANE2IX", sizeof(header.magic)) == 0 &&
+              header.nRecords == m_nRecords && header.stride > 0;
+    if (ok)
+    {
+        m_index.resize(header.nEntries);
+        ok = std::fread(m_index.data(), sizeof(int64_t), m_index.size(), file) ==
+             m_index.size();
+    }
+    std::fclose(file);
+
+    if (ok)
+    {
+        m_indexStride = header.stride;
+    }
+    else
+    {
+        NS_LOG_WARN("Ignoring the E2 trace index \"" << indexFileName
+                                                     << "\", which does not match the trace");
+        m_index.clear();
+    }
+}
+
+} // namespace ns3
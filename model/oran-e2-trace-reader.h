@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_TRACE_READER_H
+#define ORAN_E2_TRACE_READER_H
+
+#include "oran-e2-trace.h"
+
+#include "ns3/nstime.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Read-only view of an E2 trace file written by OranE2TraceRecorder. The
+ * file is memory-mapped, so records are accessed in place without being
+ * copied or parsed.
+ *
+ * The index written when the recorder was closed is used to seek by time.
+ * Without it (for example, if the recording run was interrupted), all the
+ * complete records in the file are still readable, and seeks search the
+ * whole trace.
+ */
+class OranE2TraceReader
+{
+  public:
+    /**
+     * Open and map an E2 trace file. Aborts if the file is not a valid
+     * trace written on a machine with the same byte order.
+     *
+     * @param fileName The path of the trace file.
+     */
+    explicit OranE2TraceReader(const std::string& fileName);
+    /**
+     * Unmap the trace file.
+     */
+    ~OranE2TraceReader();
+
+    OranE2TraceReader(const OranE2TraceReader&) = delete;
+    OranE2TraceReader& operator=(const OranE2TraceReader&) = delete;
+
+    /**
+     * @return The number of records in the trace.
+     */
+    uint64_t GetNRecords() const;
+    /**
+     * @param i The index of the record.
+     * @return The record.
+     */
+    const OranE2TraceRecord& GetRecord(uint64_t i) const;
+    /**
+     * @return The first record.
+     */
+    const OranE2TraceRecord* begin() const;
+    /**
+     * @return The end of the records.
+     */
+    const OranE2TraceRecord* end() const;
+    /**
+     * Find the first record at or after a time.
+     *
+     * @param t The time.
+     * @return The index of the record, or GetNRecords() if there is none.
+     */
+    uint64_t Seek(Time t) const;
+    /**
+     * Write the trace as CSV, with a header line.
+     *
+     * @param os The stream.
+     */
+    void WriteCsv(std::ostream& os) const;
+
+  private:
+    /**
+     * Read the index file, if there is a valid one for this trace.
+     *
+     * @param indexFileName The path of the index file.
+     */
+    void ReadIndex(const std::string& indexFileName);
+
+    void* m_map;                                //!< The mapped file.
+    std::size_t m_mapSize;                      //!< The size of the mapping.
+    const OranE2TraceRecord* m_records;         //!< The records in the mapping.
+    uint64_t m_nRecords;                        //!< The number of records.
+    uint32_t m_indexStride;                     //!< The records between index entries.
+    std::vector<int64_t> m_index;               //!< The time of every stride-th record.
+}; // class OranE2TraceReader
+
+} // namespace ns3
+
+#endif // ORAN_E2_TRACE_READER_H
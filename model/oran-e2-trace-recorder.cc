@@ -0,0 +1,392 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-trace-recorder.h"
+
+#include "oran-report-apploss.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-energy-efficiency.h"
+#include "oran-report-lte-ue-app-demand.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-multi-cell-rsrp-rsrq.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
+#include "oran-report-nr-energy-efficiency.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-multi-cell-rsrp-rsrq.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include <cstring>
+#include <variant>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranE2TraceRecorder");
+
+NS_OBJECT_ENSURE_REGISTERED(OranE2TraceRecorder);
+
+TypeId
+OranE2TraceRecorder::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranE2TraceRecorder")
+            .SetParent<Object>()
+            .AddConstructor<OranE2TraceRecorder>()
+            .AddAttribute("FileName",
+                          "The path of the trace file. The index is written to the same path "
+                          "with the \".idx\" suffix.",
+                          StringValue("oran-e2-trace.bin"),
+                          MakeStringAccessor(&OranE2TraceRecorder::m_fileName),
+                          MakeStringChecker())
+            .AddAttribute("IndexStride",
+                          "The number of records between entries of the index.",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&OranE2TraceRecorder::m_indexStride),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("BufferSize",
+                          "The number of records buffered before they are written to the file.",
+                          UintegerValue(4096),
+                          MakeUintegerAccessor(&OranE2TraceRecorder::m_bufferSize),
+                          MakeUintegerChecker<uint32_t>(1));
+
+    return tid;
+}
+
+OranE2TraceRecorder::OranE2TraceRecorder()
+    : Object(),
+      m_file(nullptr),
+      m_nRecords(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranE2TraceRecorder::~OranE2TraceRecorder()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranE2TraceRecorder::Attach(Ptr<OranNearRtRicE2Terminator> e2Terminator)
+{
+    NS_LOG_FUNCTION(this << e2Terminator);
+
+    NS_ABORT_MSG_IF(e2Terminator == nullptr, "Attempting to record a null E2 Terminator");
+
+    if (m_file == nullptr)
+    {
+        Open();
+    }
+
+    e2Terminator->TraceConnectWithoutContext(
+        "RxReport",
+        MakeCallback(&OranE2TraceRecorder::RecordReport, this));
+    e2Terminator->TraceConnectWithoutContext(
+        "TxCommand",
+        MakeCallback(&OranE2TraceRecorder::RecordCommand, this));
+}
+
+void
+OranE2TraceRecorder::Close()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_file != nullptr)
+    {
+        Flush();
+        std::fclose(m_file);
+        m_file = nullptr;
+
+        WriteIndex();
+
+        NS_LOG_INFO("Closed E2 trace \"" << m_fileName << "\" with " << m_nRecords
+                                         << " records");
+    }
+}
+
+void
+OranE2TraceRecorder::RecordReport(Ptr<const OranReport> report)
+{
+    NS_LOG_FUNCTION(this << report);
+
+    static const TypeId locationTid = OranReportLocation::GetTypeId();
+    static const TypeId appLossTid = OranReportAppLoss::GetTypeId();
+    static const TypeId lteCellInfoTid = OranReportLteUeCellInfo::GetTypeId();
+    static const TypeId lteRsrpRsrqTid = OranReportLteUeRsrpRsrq::GetTypeId();
+    static const TypeId lteEnergyTid = OranReportLteEnergyEfficiency::GetTypeId();
+    static const TypeId lteDemandTid = OranReportLteUeAppDemand::GetTypeId();
+    static const TypeId nrCellInfoTid = OranReportNrUeCellInfo::GetTypeId();
+    static const TypeId nrRsrpRsrqTid = OranReportNrUeRsrpRsrq::GetTypeId();
+    static const TypeId nrEnergyTid = OranReportNrEnergyEfficiency::GetTypeId();
+    static const TypeId nrDemandTid = OranReportNrUeAppDemand::GetTypeId();
+    static const TypeId lteMultiCellTid = OranReportLteUeMultiCellRsrpRsrq::GetTypeId();
+    static const TypeId nrMultiCellTid = OranReportNrUeMultiCellRsrpRsrq::GetTypeId();
+
+    OranE2TraceRecord record{};
+    record.time = Simulator::Now().GetTimeStep();
+    record.reportTime = report->GetTime().GetTimeStep();
+    record.e2NodeId = report->GetReporterE2NodeId();
+
+    OranE2TraceRecordType type = OranE2TraceRecordType::REPORT_OTHER;
+    TypeId tid = report->GetInstanceTypeId();
+
+    // A multi-cell report is recorded as one *_UE_RSRP_RSRQ record per cell,
+    // so the trace format and its readers stay the same.
+    if (tid == lteMultiCellTid || tid == nrMultiCellTid)
+    {
+        uint16_t rnti = 0;
+        const std::vector<OranUeCellRsrpRsrq>* measurements = nullptr;
+        if (tid == lteMultiCellTid)
+        {
+            type = OranE2TraceRecordType::LTE_UE_RSRP_RSRQ;
+            Ptr<const OranReportLteUeMultiCellRsrpRsrq> multiCell =
+                StaticCast<const OranReportLteUeMultiCellRsrpRsrq>(report);
+            rnti = multiCell->GetRnti();
+            measurements = &multiCell->GetMeasurements();
+        }
+        else
+        {
+            type = OranE2TraceRecordType::NR_UE_RSRP_RSRQ;
+            Ptr<const OranReportNrUeMultiCellRsrpRsrq> multiCell =
+                StaticCast<const OranReportNrUeMultiCellRsrpRsrq>(report);
+            rnti = multiCell->GetRnti();
+            measurements = &multiCell->GetMeasurements();
+        }
+
+        record.type = static_cast<uint8_t>(type);
+        record.rnti = rnti;
+        for (const auto& measurement : *measurements)
+        {
+            record.cellId = measurement.cellId;
+            record.flags = measurement.isServingCell ? 1 : 0;
+            record.parameter = measurement.componentCarrierId;
+            record.value[0] = measurement.rsrp;
+            record.value[1] = measurement.rsrq;
+            Append(record);
+        }
+        return;
+    }
+
+    if (tid == locationTid)
+    {
+        type = OranE2TraceRecordType::LOCATION;
+        Vector location = StaticCast<const OranReportLocation>(report)->GetLocation();
+        record.value[0] = location.x;
+        record.value[1] = location.y;
+        record.value[2] = location.z;
+    }
+    else if (tid == appLossTid)
+    {
+        type = OranE2TraceRecordType::APP_LOSS;
+        record.value[0] = StaticCast<const OranReportAppLoss>(report)->GetLoss();
+    }
+    else if (tid == lteCellInfoTid)
+    {
+        type = OranE2TraceRecordType::LTE_UE_CELL_INFO;
+        Ptr<const OranReportLteUeCellInfo> cellInfo =
+            StaticCast<const OranReportLteUeCellInfo>(report);
+        record.cellId = cellInfo->GetCellId();
+        record.rnti = cellInfo->GetRnti();
+    }
+    else if (tid == lteRsrpRsrqTid)
+    {
+        type = OranE2TraceRecordType::LTE_UE_RSRP_RSRQ;
+        Ptr<const OranReportLteUeRsrpRsrq> rsrpRsrq =
+            StaticCast<const OranReportLteUeRsrpRsrq>(report);
+        record.cellId = rsrpRsrq->GetCellId();
+        record.rnti = rsrpRsrq->GetRnti();
+        record.flags = rsrpRsrq->GetIsServingCell() ? 1 : 0;
+        record.parameter = rsrpRsrq->GetComponentCarrierId();
+        record.value[0] = rsrpRsrq->GetRsrp();
+        record.value[1] = rsrpRsrq->GetRsrq();
+    }
+    else if (tid == lteEnergyTid)
+    {
+        type = OranE2TraceRecordType::LTE_ENERGY;
+        record.value[0] =
+            StaticCast<const OranReportLteEnergyEfficiency>(report)->GetLteEnergyRemaining();
+    }
+    else if (tid == lteDemandTid)
+    {
+        type = OranE2TraceRecordType::LTE_UE_APP_DEMAND;
+        record.value[0] = StaticCast<const OranReportLteUeAppDemand>(report)->GetDemandMbps();
+    }
+    else if (tid == nrCellInfoTid)
+    {
+        type = OranE2TraceRecordType::NR_UE_CELL_INFO;
+        Ptr<const OranReportNrUeCellInfo> cellInfo =
+            StaticCast<const OranReportNrUeCellInfo>(report);
+        record.cellId = cellInfo->GetCellId();
+        record.rnti = cellInfo->GetRnti();
+    }
+    else if (tid == nrRsrpRsrqTid)
+    {
+        type = OranE2TraceRecordType::NR_UE_RSRP_RSRQ;
+        Ptr<const OranReportNrUeRsrpRsrq> rsrpRsrq =
+            StaticCast<const OranReportNrUeRsrpRsrq>(report);
+        record.cellId = rsrpRsrq->GetCellId();
+        record.rnti = rsrpRsrq->GetRnti();
+        record.flags = rsrpRsrq->GetIsServingCell() ? 1 : 0;
+        record.parameter = rsrpRsrq->GetComponentCarrierId();
+        record.value[0] = rsrpRsrq->GetRsrp();
+        record.value[1] = rsrpRsrq->GetRsrq();
+    }
+    else if (tid == nrEnergyTid)
+    {
+        type = OranE2TraceRecordType::NR_ENERGY;
+        record.value[0] =
+            StaticCast<const OranReportNrEnergyEfficiency>(report)->GetNrEnergyRemaining();
+    }
+    else if (tid == nrDemandTid)
+    {
+        type = OranE2TraceRecordType::NR_UE_APP_DEMAND;
+        record.value[0] = StaticCast<const OranReportNrUeAppDemand>(report)->GetDemandMbps();
+    }
+    record.type = static_cast<uint8_t>(type);
+
+    Append(record);
+}
+
+void
+OranE2TraceRecorder::RecordCommand(Ptr<const OranCommand> command)
+{
+    NS_LOG_FUNCTION(this << command);
+
+    const OranCommandData& data = command->GetData();
+
+    OranE2TraceRecord record{};
+    record.time = Simulator::Now().GetTimeStep();
+    record.reportTime = record.time;
+    record.e2NodeId = data.targetE2NodeId;
+    record.type = static_cast<uint8_t>(OranE2TraceRecordType::COMMAND_OTHER);
+
+    std::visit(OranPayloadVisitor{
+                   [&record](const OranHandoverPayload& handover) {
+                       record.type = static_cast<uint8_t>(OranE2TraceRecordType::COMMAND_HANDOVER);
+                       record.cellId = handover.targetCellId;
+                       record.rnti = handover.targetRnti;
+                   },
+                   [&record](const OranTxPowerPayload& txPower) {
+                       record.type = static_cast<uint8_t>(OranE2TraceRecordType::COMMAND_TX_POWER);
+                       record.value[0] = txPower.powerDeltaDb;
+                   },
+                   [&record](const OranCellParameterPayload& cellParameter) {
+                       record.type =
+                           static_cast<uint8_t>(OranE2TraceRecordType::COMMAND_CELL_PARAMETER);
+                       record.flags = cellParameter.isDelta ? 1 : 0;
+                       record.parameter = static_cast<uint8_t>(cellParameter.parameter);
+                       record.value[0] = cellParameter.value;
+                   },
+                   [](std::monostate) {},
+               },
+               data.payload);
+
+    Append(record);
+}
+
+uint64_t
+OranE2TraceRecorder::GetNRecords() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nRecords;
+}
+
+void
+OranE2TraceRecorder::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Close();
+
+    Object::DoDispose();
+}
+
+void
+OranE2TraceRecorder::Open()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_file = std::fopen(m_fileName.c_str(), "wb");
+    NS_ABORT_MSG_IF(m_file == nullptr, "Could not open E2 trace file \"" << m_fileName << "\"");
+
+    OranE2TraceFileHeader header{};
+    std::memcpy(header.magic, "ORANE2TR", sizeof(header.magic));
+    header.version = ORAN_E2_TRACE_VERSION;
+    header.recordSize = sizeof(OranE2TraceRecord);
+    header.byteOrder = 0x01020304;
+    NS_ABORT_MSG_IF(std::fwrite(&header, sizeof(header), 1, m_file) != 1,
+                    "Could not write to E2 trace file \"" << m_fileName << "\"");
+
+    m_buffer.clear();
+    m_buffer.reserve(m_bufferSize);
+    m_index.clear();
+    m_nRecords = 0;
+}
+
+void
+OranE2TraceRecorder::Append(const OranE2TraceRecord& record)
+{
+    if (m_file == nullptr)
+    {
+        return;
+    }
+
+    if (m_nRecords % m_indexStride == 0)
+    {
+        m_index.push_back(record.time);
+    }
+    m_nRecords++;
+
+    m_buffer.push_back(record);
+    if (m_buffer.size() >= m_bufferSize)
+    {
+        Flush();
+    }
+}
+
+void
+OranE2TraceRecorder::Flush()
+{
+    NS_LOG_FUNCTION(this << m_buffer.size());
+
+    if (!m_buffer.empty())
+    {
+        NS_ABORT_MSG_IF(std::fwrite(m_buffer.data(), sizeof(OranE2TraceRecord), m_buffer.size(),
+                                    m_file) != m_buffer.size(),
+                        "Could not write to E2 trace file \"" << m_fileName << "\"");
+        m_buffer.clear();
+    }
+}
+
+void
+OranE2TraceRecorder::WriteIndex() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::string indexFileName = m_fileName + ".idx";
+    std::FILE* file = std::fopen(indexFileName.c_str(), "wb");
+    NS_ABORT_MSG_IF(file == nullptr, "Could not open E2 trace index \"" << indexFileName << "\"");
+
+    OranE2TraceIndexHeader header{};
+    std::memcpy(header.magic, "ORANE2IX", sizeof(header.magic));
+    header.nRecords = m_nRecords;
+    header.stride = m_indexStride;
+    header.nEntries = m_index.size();
+
+    bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+              std::fwrite(m_index.data(), sizeof(int64_t), m_index.size(), file) ==
+                  m_index.size();
+    std::fclose(file);
+    NS_ABORT_MSG_IF(!ok, "Could not write E2 trace index \"" << indexFileName << "\"");
+}
+
+} // namespace ns3
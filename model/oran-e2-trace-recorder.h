@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_TRACE_RECORDER_H
+#define ORAN_E2_TRACE_RECORDER_H
+
+#include "oran-command.h"
+#include "oran-e2-trace.h"
+#include "oran-near-rt-ric-e2terminator.h"
+#include "oran-report.h"
+
+#include "ns3/object.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Records the E2 traffic of a Near-RT RIC E2 Terminator, every Report it
+ * receives and every Command it sends, to a compact binary trace file
+ * (see OranE2TraceRecord). Records are buffered and appended to the file
+ * in blocks. When the recorder is closed, it writes a small index of the
+ * record times next to the trace, for OranE2TraceReader::Seek.
+ */
+class OranE2TraceRecorder : public Object
+{
+  public:
+    /**
+     * Get the TypeId of the OranE2TraceRecorder class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranE2TraceRecorder class.
+     */
+    OranE2TraceRecorder();
+    /**
+     * Destructor of the OranE2TraceRecorder class.
+     */
+    ~OranE2TraceRecorder() override;
+    /**
+     * Start recording the traffic of a Near-RT RIC E2 Terminator, opening
+     * the trace file if it is not open yet.
+     *
+     * @param e2Terminator The Near-RT RIC E2 Terminator.
+     */
+    void Attach(Ptr<OranNearRtRicE2Terminator> e2Terminator);
+    /**
+     * Flush the buffered records, write the index, and close the trace file.
+     */
+    void Close();
+    /**
+     * Record a Report received by the Near-RT RIC.
+     *
+     * @param report The Report.
+     */
+    void RecordReport(Ptr<const OranReport> report);
+    /**
+     * Record a Command sent by the Near-RT RIC.
+     *
+     * @param command The Command.
+     */
+    void RecordCommand(Ptr<const OranCommand> command);
+    /**
+     * Get the number of records written so far.
+     *
+     * @return The number of records.
+     */
+    uint64_t GetNRecords() const;
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * Open the trace file and write its header.
+     */
+    void Open();
+    /**
+     * Append a record to the buffer, flushing it when full.
+     *
+     * @param record The record.
+     */
+    void Append(const OranE2TraceRecord& record);
+    /**
+     * Write the buffered records to the trace file.
+     */
+    void Flush();
+    /**
+     * Write the index file.
+     */
+    void WriteIndex() const;
+
+    /**
+     * The path of the trace file.
+     */
+    std::string m_fileName;
+    /**
+     * The number of records between index entries.
+     */
+    uint32_t m_indexStride;
+    /**
+     * The number of records buffered before writing them to the file.
+     */
+    uint32_t m_bufferSize;
+    /**
+     * The trace file, if open.
+     */
+    std::FILE* m_file;
+    /**
+     * The records not written yet.
+     */
+    std::vector<OranE2TraceRecord> m_buffer;
+    /**
+     * The time of every m_indexStride-th record.
+     */
+    std::vector<int64_t> m_index;
+    /**
+     * The number of records appended.
+     */
+    uint64_t m_nRecords;
+}; // class OranE2TraceRecorder
+
+} // namespace ns3
+
+#endif // ORAN_E2_TRACE_RECORDER_H
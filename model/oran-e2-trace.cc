@@ -0,0 +1,81 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-e2-trace.h"
+
+#include "ns3/nstime.h"
+
+#include <iomanip>
+
+namespace ns3
+{
+
+const char*
+E2TraceRecordTypeToString(OranE2TraceRecordType type)
+{
+    switch (type)
+    {
+    case OranE2TraceRecordType::LOCATION:
+        return "LOCATION";
+    case OranE2TraceRecordType::APP_LOSS:
+        return "APP_LOSS";
+    case OranE2TraceRecordType::LTE_UE_CELL_INFO:
+        return "LTE_UE_CELL_INFO";
+    case OranE2TraceRecordType::LTE_UE_RSRP_RSRQ:
+        return "LTE_UE_RSRP_RSRQ";
+    case OranE2TraceRecordType::LTE_ENERGY:
+        return "LTE_ENERGY";
+    case OranE2TraceRecordType::LTE_UE_APP_DEMAND:
+        return "LTE_UE_APP_DEMAND";
+    case OranE2TraceRecordType::NR_UE_CELL_INFO:
+        return "NR_UE_CELL_INFO";
+    case OranE2TraceRecordType::NR_UE_RSRP_RSRQ:
+        return "NR_UE_RSRP_RSRQ";
+    case OranE2TraceRecordType::NR_ENERGY:
+        return "NR_ENERGY";
+    case OranE2TraceRecordType::NR_UE_APP_DEMAND:
+        return "NR_UE_APP_DEMAND";
+    case OranE2TraceRecordType::REPORT_OTHER:
+        return "REPORT_OTHER";
+    case OranE2TraceRecordType::COMMAND_HANDOVER:
+        return "COMMAND_HANDOVER";
+    case OranE2TraceRecordType::COMMAND_TX_POWER:
+        return "COMMAND_TX_POWER";
+    case OranE2TraceRecordType::COMMAND_CELL_PARAMETER:
+        return "COMMAND_CELL_PARAMETER";
+    case OranE2TraceRecordType::COMMAND_OTHER:
+        return "COMMAND_OTHER";
+    default:
+        return "UNKNOWN";
+    }
+}
+
+bool
+IsE2TraceCommand(const OranE2TraceRecord& record)
+{
+    return record.type >= static_cast<uint8_t>(OranE2TraceRecordType::COMMAND_HANDOVER);
+}
+
+void
+WriteE2TraceCsvHeader(std::ostream& os)
+{
+    os << "time_s,report_time_s,direction,type,e2_node_id,cell_id,rnti,flags,parameter,"
+          "value0,value1,value2\n";
+}
+
+void
+WriteE2TraceCsvLine(std::ostream& os, const OranE2TraceRecord& record)
+{
+    os << std::setprecision(9) << TimeStep(record.time).GetSeconds() << ','
+       << TimeStep(record.reportTime).GetSeconds() << ','
+       << (IsE2TraceCommand(record) ? "TX" : "RX") << ','
+       << E2TraceRecordTypeToString(static_cast<OranE2TraceRecordType>(record.type)) << ','
+       << record.e2NodeId << ',' << record.cellId << ',' << record.rnti << ','
+       << static_cast<uint32_t>(record.flags) << ',' << static_cast<uint32_t>(record.parameter)
+       << std::setprecision(17) << ',' << record.value[0] << ',' << record.value[1] << ','
+       << record.value[2] << '\n';
+}
+
+} // namespace ns3
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_E2_TRACE_H
+#define ORAN_E2_TRACE_H
+
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The kind of entry in an E2 trace: a Report type received by the Near-RT
+ * RIC, or a Command type sent by it.
+ */
+enum class OranE2TraceRecordType : uint8_t
+{
+    LOCATION = 1,            //!< OranReportLocation.
+    APP_LOSS,                //!< OranReportAppLoss.
+    LTE_UE_CELL_INFO,        //!< OranReportLteUeCellInfo.
+    LTE_UE_RSRP_RSRQ,        //!< OranReportLteUeRsrpRsrq.
+    LTE_ENERGY,              //!< OranReportLteEnergyEfficiency.
+    LTE_UE_APP_DEMAND,       //!< OranReportLteUeAppDemand.
+    NR_UE_CELL_INFO,         //!< OranReportNrUeCellInfo.
+    NR_UE_RSRP_RSRQ,         //!< OranReportNrUeRsrpRsrq.
+    NR_ENERGY,               //!< OranReportNrEnergyEfficiency.
+    NR_UE_APP_DEMAND,        //!< OranReportNrUeAppDemand.
+    REPORT_OTHER,            //!< Any other Report; only the common fields are kept.
+    COMMAND_HANDOVER = 32,   //!< A handover Command.
+    COMMAND_TX_POWER,        //!< A TxPower Command.
+    COMMAND_CELL_PARAMETER,  //!< A cell-parameter Command.
+    COMMAND_OTHER,           //!< Any other Command; only the common fields are kept.
+};
+
+/**
+ * @ingroup oran
+ *
+ * One entry of an E2 trace. Records have a fixed size, so a trace file is
+ * a header followed by an array of records that can be memory-mapped.
+ *
+ * The meaning of the type-specific fields:
+ *
+ * | Type              | cellId      | rnti       | flags       | parameter  | value[0..2]      |
+ * |-------------------|-------------|------------|-------------|------------|------------------|
+ * | LOCATION          |             |            |             |            | x, y, z          |
+ * | APP_LOSS          |             |            |             |            | loss             |
+ * | *_UE_CELL_INFO    | cell ID     | RNTI       |             |            |                  |
+ * | *_UE_RSRP_RSRQ    | cell ID     | RNTI       | serving     | CC ID      | RSRP, RSRQ       |
+ * | *_ENERGY          |             |            |             |            | energy remaining |
+ * | *_UE_APP_DEMAND   |             |            |             |            | demand (Mbps)    |
+ * | COMMAND_HANDOVER  | target cell | target RNTI|             |            |                  |
+ * | COMMAND_TX_POWER  |             |            |             |            | delta (dB)       |
+ * | COMMAND_CELL_PAR. |             |            | is delta    | parameter  | value            |
+ */
+struct OranE2TraceRecord
+{
+    int64_t time;       //!< Time (time steps) the RIC received the Report or sent the Command.
+    int64_t reportTime; //!< Time (time steps) the Report was generated; time for Commands.
+    uint64_t e2NodeId;  //!< The E2 Node ID of the reporter, or of the Command's target.
+    uint8_t type;       //!< The OranE2TraceRecordType.
+    uint8_t flags;      //!< Type-specific flag (bit 0).
+    uint8_t parameter;  //!< Type-specific small value.
+    uint8_t reserved0;  //!< Padding, zero.
+    uint16_t cellId;    //!< Type-specific cell ID.
+    uint16_t rnti;      //!< Type-specific RNTI.
+    double value[3];    //!< Type-specific values.
+    uint64_t reserved1; //!< Padding, zero.
+};
+
+static_assert(std::is_trivially_copyable<OranE2TraceRecord>::value,
+              "E2 trace records are written as raw bytes");
+static_assert(sizeof(OranE2TraceRecord) == 64, "E2 trace records are 64 bytes");
+
+/**
+ * @ingroup oran
+ *
+ * The header at the start of an E2 trace file.
+ */
+struct OranE2TraceFileHeader
+{
+    char magic[8];       //!< "ORANE2TR".
+    uint32_t version;    //!< The format version.
+    uint32_t recordSize; //!< sizeof(OranE2TraceRecord).
+    uint32_t byteOrder;  //!< 0x01020304 in the byte order of the writer.
+    uint32_t reserved0;  //!< Zero.
+    uint64_t reserved1;  //!< Zero.
+};
+
+static_assert(sizeof(OranE2TraceFileHeader) == 32, "E2 trace file headers are 32 bytes");
+
+/**
+ * @ingroup oran
+ *
+ * The header of the index file written next to an E2 trace file (with the
+ * ".idx" suffix) when the recorder is closed. It is followed by nEntries
+ * int64_t times: the time of every stride-th record.
+ */
+struct OranE2TraceIndexHeader
+{
+    char magic[8];     //!< "ORANE2IX".
+    uint64_t nRecords; //!< The number of records in the trace.
+    uint32_t stride;   //!< The number of records between index entries.
+    uint32_t nEntries; //!< The number of index entries.
+    uint64_t reserved; //!< Zero.
+};
+
+static_assert(sizeof(OranE2TraceIndexHeader) == 32, "E2 trace index headers are 32 bytes");
+
+/**
+ * The version of the E2 trace format.
+ */
+constexpr uint32_t ORAN_E2_TRACE_VERSION = 1;
+
+/**
+ * @param type The record type.
+ * @return The name of the record type.
+ */
+const char* E2TraceRecordTypeToString(OranE2TraceRecordType type);
+
+/**
+ * @param record The record.
+ * @return True if the record is a Command sent by the RIC.
+ */
+bool IsE2TraceCommand(const OranE2TraceRecord& record);
+
+/**
+ * Write the CSV column names of E2 trace records, with a trailing newline.
+ *
+ * @param os The stream.
+ */
+void WriteE2TraceCsvHeader(std::ostream& os);
+
+/**
+ * Write an E2 trace record as a CSV line, with a trailing newline.
+ *
+ * @param os The stream.
+ * @param record The record.
+ */
+void WriteE2TraceCsvLine(std::ostream& os, const OranE2TraceRecord& record);
+
+} // namespace ns3
+
+#endif // ORAN_E2_TRACE_H
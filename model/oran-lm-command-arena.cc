@@ -0,0 +1,189 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-lm-command-arena.h"
+
+#include "oran-lm.h"
+
+#include "ns3/abort.h"
+
+#include <iterator>
+#include <utility>
+
+namespace ns3
+{
+
+namespace
+{
+
+/**
+ * Calls fn(name, isDefault, lm) for every LM in slot order: by name, with the
+ * default LM after an additional LM of the same name.
+ */
+template <typename Fn>
+void
+ForEachLm(Ptr<OranLm> defaultLm, const std::map<std::string, Ptr<OranLm>>& additionalLms, Fn fn)
+{
+    bool defaultDone = (defaultLm == nullptr);
+    for (const auto& entry : additionalLms)
+    {
+        if (!defaultDone && defaultLm->GetName() < entry.first)
+        {
+            fn(defaultLm->GetName(), true, PeekPointer(defaultLm));
+            defaultDone = true;
+        }
+        fn(entry.first, false, PeekPointer(entry.second));
+    }
+    if (!defaultDone)
+    {
+        fn(defaultLm->GetName(), true, PeekPointer(defaultLm));
+    }
+}
+
+} // namespace
+
+void
+OranLmCommandArena::SetLms(Ptr<OranLm> defaultLm,
+                           const std::map<std::string, Ptr<OranLm>>& additionalLms)
+{
+    uint32_t nLms = additionalLms.size() + (defaultLm == nullptr ? 0 : 1);
+    bool unchanged = (m_slots.size() == nLms);
+    uint32_t lmId = 0;
+    ForEachLm(defaultLm,
+              additionalLms,
+              [&](const std::string& name, bool isDefault, const OranLm* lm) {
+                  if (unchanged)
+                  {
+                      const OranLmCommandSlot& slot = m_slots[lmId++];
+                      unchanged = (slot.lm == lm && slot.isDefault == isDefault &&
+                                   slot.lmName == name);
+                  }
+              });
+    if (unchanged)
+    {
+        return;
+    }
+
+    std::vector<OranLmCommandSlot> slots;
+    slots.reserve(nLms);
+    m_nReceived = 0;
+    ForEachLm(defaultLm,
+              additionalLms,
+              [&](const std::string& name, bool isDefault, const OranLm* lm) {
+                  OranLmCommandSlot slot;
+                  for (auto& old : m_slots)
+                  {
+                      if (old.lm == lm && old.isDefault == isDefault)
+                      {
+                          slot = std::move(old);
+                          break;
+                      }
+                  }
+                  slot.lmName = name;
+                  slot.isDefault = isDefault;
+                  slot.lm = lm;
+                  m_nReceived += slot.received;
+                  slots.push_back(std::move(slot));
+              });
+    m_slots = std::move(slots);
+}
+
+uint32_t
+OranLmCommandArena::GetLmId(Ptr<OranLm> lm) const
+{
+    for (uint32_t lmId = 0; lmId < m_slots.size(); lmId++)
+    {
+        if (m_slots[lmId].lm == PeekPointer(lm))
+        {
+            return lmId;
+        }
+    }
+    return kInvalidLmId;
+}
+
+OranLmCommandSlot&
+OranLmCommandArena::GetSlot(uint32_t lmId)
+{
+    NS_ABORT_MSG_IF(lmId >= m_slots.size(), "Unknown LM ID " << lmId);
+    return m_slots[lmId];
+}
+
+void
+OranLmCommandArena::Reset(uint32_t lmId)
+{
+    GetSlot(lmId).commands.clear();
+}
+
+void
+OranLmCommandArena::Store(uint32_t lmId, std::vector<Ptr<OranCommand>>&& commands)
+{
+    OranLmCommandSlot& slot = GetSlot(lmId);
+    if (!slot.received)
+    {
+        slot.received = true;
+        m_nReceived++;
+    }
+
+    if (slot.commands.empty() && slot.commands.capacity() < commands.size())
+    {
+        slot.commands = std::move(commands);
+    }
+    else
+    {
+        slot.commands.insert(slot.commands.end(),
+                             std::make_move_iterator(commands.begin()),
+                             std::make_move_iterator(commands.end()));
+    }
+    commands.clear();
+}
+
+uint32_t
+OranLmCommandArena::GetNLms() const
+{
+    return m_slots.size();
+}
+
+uint32_t
+OranLmCommandArena::GetNReceived() const
+{
+    return m_nReceived;
+}
+
+void
+OranLmCommandArena::Clear()
+{
+    for (auto& slot : m_slots)
+    {
+        slot.commands.clear();
+        slot.received = false;
+    }
+    m_nReceived = 0;
+}
+
+OranLmCommandArena::iterator
+OranLmCommandArena::begin()
+{
+    return iterator(m_slots.begin(), m_slots.end());
+}
+
+OranLmCommandArena::iterator
+OranLmCommandArena::end()
+{
+    return iterator(m_slots.end(), m_slots.end());
+}
+
+OranLmCommandArena::const_iterator
+OranLmCommandArena::begin() const
+{
+    return const_iterator(m_slots.begin(), m_slots.end());
+}
+
+OranLmCommandArena::const_iterator
+OranLmCommandArena::end() const
+{
+    return const_iterator(m_slots.end(), m_slots.end());
+}
+
+} // namespace ns3
@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_LM_COMMAND_ARENA_H
+#define ORAN_LM_COMMAND_ARENA_H
+
+#include "oran-command.h"
+
+#include "ns3/ptr.h"
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+class OranLm;
+
+/**
+ * @ingroup oran
+ *
+ * The commands one Logic Module returned in an LM query cycle.
+ */
+struct OranLmCommandSlot
+{
+    std::string lmName;                     //!< The name of the LM.
+    bool isDefault = false;                 //!< Whether the LM is the default LM.
+    const OranLm* lm = nullptr;             //!< The LM, used only to identify it.
+    bool received = false;                  //!< Whether the LM reported this cycle.
+    std::vector<Ptr<OranCommand>> commands; //!< The commands the LM generated.
+};
+
+/**
+ * @ingroup oran
+ *
+ * The commands collected by the Near-RT RIC in one LM query cycle, with one
+ * slot per Logic Module indexed by LM ID.
+ *
+ * The slots are laid out once for the RIC's set of LMs, ordered by LM name
+ * and then by whether the LM is the default LM, and only rebuilt when that
+ * set changes. Commands are moved into a slot as an LM finishes, the whole
+ * collection is handed to the Conflict Mitigation Module by reference, and
+ * Clear() empties the slots while keeping their storage for the next cycle.
+ *
+ * Iterating visits, in LM ID order, only the slots of LMs that reported in
+ * the current cycle.
+ */
+class OranLmCommandArena
+{
+  public:
+    static constexpr uint32_t kInvalidLmId = std::numeric_limits<uint32_t>::max(); //!< No LM.
+
+    /**
+     * Iterator over the slots of the LMs that reported this cycle.
+     */
+    template <typename Slot, typename It>
+    class ReceivedIterator
+    {
+      public:
+        /**
+         * Creates an iterator positioned at the first reported slot at or
+         * after it.
+         *
+         * @param it The slot to start at.
+         * @param end The end of the slots.
+         */
+        ReceivedIterator(It it, It end)
+            : m_it(it),
+              m_end(end)
+        {
+            Skip();
+        }
+
+        /**
+         * @return The slot.
+         */
+        Slot& operator*() const
+        {
+            return *m_it;
+        }
+
+        /**
+         * @return The slot.
+         */
+        Slot* operator->() const
+        {
+            return &*m_it;
+        }
+
+        /**
+         * Moves to the next reported slot.
+         *
+         * @return This iterator.
+         */
+        ReceivedIterator& operator++()
+        {
+            ++m_it;
+            Skip();
+            return *this;
+        }
+
+        /**
+         * @param other The iterator to compare with.
+         * @return True if both iterators point at the same slot.
+         */
+        bool operator==(const ReceivedIterator& other) const
+        {
+            return m_it == other.m_it;
+        }
+
+        /**
+         * @param other The iterator to compare with.
+         * @return True if the iterators point at different slots.
+         */
+        bool operator!=(const ReceivedIterator& other) const
+        {
+            return m_it != other.m_it;
+        }
+
+      private:
+        /**
+         * Advances past slots of LMs that have not reported.
+         */
+        void Skip()
+        {
+            while (m_it != m_end && !m_it->received)
+            {
+                ++m_it;
+            }
+        }
+
+        It m_it;  //!< The current slot.
+        It m_end; //!< The end of the slots.
+    };
+
+    /**
+     * Iterator over reported slots.
+     */
+    typedef ReceivedIterator<OranLmCommandSlot, std::vector<OranLmCommandSlot>::iterator>
+        iterator;
+    /**
+     * Const iterator over reported slots.
+     */
+    typedef ReceivedIterator<const OranLmCommandSlot,
+                             std::vector<OranLmCommandSlot>::const_iterator>
+        const_iterator;
+
+    /**
+     * Lays out one slot per Logic Module. Does nothing if the set of LMs is
+     * unchanged; otherwise slots of LMs that remain keep their commands.
+     *
+     * @param defaultLm The default LM, or nullptr.
+     * @param additionalLms The additional LMs, indexed by their names.
+     */
+    void SetLms(Ptr<OranLm> defaultLm, const std::map<std::string, Ptr<OranLm>>& additionalLms);
+    /**
+     * Gets the ID of a Logic Module.
+     *
+     * @param lm The LM.
+     * @return The LM ID, or kInvalidLmId if the LM has no slot.
+     */
+    uint32_t GetLmId(Ptr<OranLm> lm) const;
+    /**
+     * Gets the slot of a Logic Module.
+     *
+     * @param lmId The LM ID.
+     * @return The slot.
+     */
+    OranLmCommandSlot& GetSlot(uint32_t lmId);
+    /**
+     * Drops the commands already collected from a Logic Module in this
+     * cycle. The LM still counts as having reported.
+     *
+     * @param lmId The LM ID.
+     */
+    void Reset(uint32_t lmId);
+    /**
+     * Moves commands into the slot of a Logic Module, after any it already
+     * holds, and marks the LM as having reported.
+     *
+     * @param lmId The LM ID.
+     * @param commands The commands.
+     */
+    void Store(uint32_t lmId, std::vector<Ptr<OranCommand>>&& commands);
+    /**
+     * @return The number of Logic Modules with a slot.
+     */
+    uint32_t GetNLms() const;
+    /**
+     * @return The number of Logic Modules that reported this cycle.
+     */
+    uint32_t GetNReceived() const;
+    /**
+     * Empties all slots for the next cycle, keeping their storage.
+     */
+    void Clear();
+
+    /**
+     * @return An iterator to the first reported slot.
+     */
+    iterator begin();
+    /**
+     * @return The end iterator.
+     */
+    iterator end();
+    /**
+     * @return An iterator to the first reported slot.
+     */
+    const_iterator begin() const;
+    /**
+     * @return The end iterator.
+     */
+    const_iterator end() const;
+
+  private:
+    std::vector<OranLmCommandSlot> m_slots; //!< One slot per LM, indexed by LM ID.
+    uint32_t m_nReceived = 0;               //!< The number of slots marked received.
+};
+
+} // namespace ns3
+
+#endif // ORAN_LM_COMMAND_ARENA_H
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_LM_EXTERNAL_LAYOUT_H
+#define ORAN_LM_EXTERNAL_LAYOUT_H
+
+#include <cstdint>
+#include <type_traits>
+
+namespace ns3
+{
+
+/*
+ * The layout of the shared-memory region that OranLmExternal exchanges with
+ * an external xApp process. The region is a header followed by four tables
+ * of fixed-size records: UEs, cells, and RSRP/RSRQ measurements written by
+ * the simulator, and commands written by the xApp. The header gives the
+ * byte offset, capacity, and number of records of every table, so readers
+ * in other languages do not need to hard-code the capacities.
+ *
+ * All fields are in the byte order of the simulator (see byteOrder), and
+ * the structs have no implicit padding.
+ */
+
+/**
+ * The radio access technology of a UE, cell, or measurement.
+ */
+enum class OranLmExternalRat : uint8_t
+{
+    LTE = 0, //!< LTE UE or eNB.
+    NR = 1,  //!< NR UE or gNB.
+};
+
+/**
+ * The kind of command written by the xApp.
+ *
+ * | Type               | e2NodeId       | cellId      | rnti        | parameter | isDelta | value      |
+ * |--------------------|----------------|-------------|-------------|-----------|---------|------------|
+ * | *_HANDOVER         | serving cell   | target cell | UE RNTI     |           |         |            |
+ * | *_TX_POWER         | cell           |             |             |           |         | delta (dB) |
+ * | *_CELL_PARAMETER   | cell           |             |             | (1)       | 0 or 1  | value      |
+ *
+ * (1) The OranCellControlParameter value (CIO=0, TTT=1, HYS=2, RET=3).
+ */
+enum class OranLmExternalCommandType : uint8_t
+{
+    LTE_HANDOVER = 1,   //!< OranCommandLte2LteHandover.
+    NR_HANDOVER,        //!< OranCommandNr2NrHandover.
+    LTE_TX_POWER,       //!< OranCommandLte2LteTxPower.
+    NR_TX_POWER,        //!< OranCommandNr2NrTxPower.
+    LTE_CELL_PARAMETER, //!< OranCommandLte2LteCellParameter.
+    NR_CELL_PARAMETER,  //!< OranCommandNr2NrCellParameter.
+};
+
+/**
+ * The location and size of one table of the region.
+ */
+struct OranLmExternalTable
+{
+    uint32_t offset;   //!< Byte offset of the first record from the start of the region.
+    uint32_t capacity; //!< The maximum number of records.
+    uint32_t count;    //!< The number of valid records.
+    uint32_t reserved; //!< Zero.
+};
+
+static_assert(sizeof(OranLmExternalTable) == 16, "External LM tables are 16 bytes");
+
+/**
+ * The header at the start of the region.
+ *
+ * The simulator writes the tables and then sets sequence to the number of
+ * the cycle before signalling the xApp. The xApp writes the commands table
+ * and then sets responseSequence to the same number before answering.
+ */
+struct OranLmExternalHeader
+{
+    char magic[8];                    //!< "ORANXAPP".
+    uint32_t version;                 //!< The layout version.
+    uint32_t byteOrder;               //!< 0x01020304 in the byte order of the simulator.
+    uint64_t sequence;                //!< The number of the cycle, starting at 1.
+    int64_t timeNs;                   //!< The simulation time of the cycle (ns).
+    OranLmExternalTable ues;          //!< OranLmExternalUeRecord table.
+    OranLmExternalTable cells;        //!< OranLmExternalCellRecord table.
+    OranLmExternalTable measurements; //!< OranLmExternalMeasurementRecord table.
+    OranLmExternalTable commands;     //!< OranLmExternalCommandRecord table.
+    uint64_t responseSequence;        //!< The cycle the commands answer.
+    uint64_t reserved[3];             //!< Zero.
+};
+
+static_assert(sizeof(OranLmExternalHeader) == 128, "External LM headers are 128 bytes");
+
+/**
+ * One UE known to the Data Repository.
+ */
+struct OranLmExternalUeRecord
+{
+    uint64_t e2NodeId;   //!< The E2 Node ID of the UE.
+    uint16_t cellId;     //!< The serving cell ID, or 0 if unknown.
+    uint16_t rnti;       //!< The RNTI, or 0 if unknown.
+    uint8_t rat;         //!< The OranLmExternalRat.
+    uint8_t reserved[3]; //!< Zero.
+    double position[3];  //!< The last reported position (x, y, z).
+    double appDemand;    //!< The last reported application demand (Mbps).
+};
+
+static_assert(std::is_trivially_copyable<OranLmExternalUeRecord>::value,
+              "External LM records are shared as raw bytes");
+static_assert(sizeof(OranLmExternalUeRecord) == 48, "External LM UE records are 48 bytes");
+
+/**
+ * One cell known to the Data Repository.
+ */
+struct OranLmExternalCellRecord
+{
+    uint64_t e2NodeId;   //!< The E2 Node ID of the eNB or gNB.
+    uint16_t cellId;     //!< The cell ID.
+    uint8_t rat;         //!< The OranLmExternalRat.
+    uint8_t reserved[5]; //!< Zero.
+    double position[3];  //!< The last reported position (x, y, z).
+    double cioDb;        //!< Cell individual offset (dB).
+    double tttSec;       //!< Time to trigger (s).
+    double hysDb;        //!< Handover hysteresis (dB).
+    double retDeg;       //!< Remote electrical tilt (degrees).
+};
+
+static_assert(std::is_trivially_copyable<OranLmExternalCellRecord>::value,
+              "External LM records are shared as raw bytes");
+static_assert(sizeof(OranLmExternalCellRecord) == 72, "External LM cell records are 72 bytes");
+
+/**
+ * One RSRP/RSRQ measurement from the last report of a UE.
+ */
+struct OranLmExternalMeasurementRecord
+{
+    uint64_t ueE2NodeId;        //!< The E2 Node ID of the UE.
+    uint16_t cellId;            //!< The measured cell ID.
+    uint16_t rnti;              //!< The RNTI of the UE.
+    uint8_t isServing;          //!< 1 if the cell is the serving cell.
+    uint8_t componentCarrierId; //!< The component carrier ID.
+    uint8_t rat;                //!< The OranLmExternalRat.
+    uint8_t reserved;           //!< Zero.
+    double rsrp;                //!< RSRP (dBm).
+    double rsrq;                //!< RSRQ (dB).
+};
+
+static_assert(std::is_trivially_copyable<OranLmExternalMeasurementRecord>::value,
+              "External LM records are shared as raw bytes");
+static_assert(sizeof(OranLmExternalMeasurementRecord) == 32,
+              "External LM measurement records are 32 bytes");
+
+/**
+ * One command written by the xApp.
+ */
+struct OranLmExternalCommandRecord
+{
+    uint64_t e2NodeId;  //!< The E2 Node ID of the command's target.
+    uint8_t type;       //!< The OranLmExternalCommandType.
+    uint8_t parameter;  //!< Type-specific small value.
+    uint8_t isDelta;    //!< Type-specific flag.
+    uint8_t reserved0;  //!< Zero.
+    uint16_t cellId;    //!< Type-specific cell ID.
+    uint16_t rnti;      //!< Type-specific RNTI.
+    double value;       //!< Type-specific value.
+    uint64_t reserved1; //!< Zero.
+};
+
+static_assert(std::is_trivially_copyable<OranLmExternalCommandRecord>::value,
+              "External LM records are shared as raw bytes");
+static_assert(sizeof(OranLmExternalCommandRecord) == 32,
+              "External LM command records are 32 bytes");
+
+/**
+ * The version of the external LM layout.
+ */
+constexpr uint32_t ORAN_LM_EXTERNAL_VERSION = 1;
+
+} // namespace ns3
+
+#endif // ORAN_LM_EXTERNAL_LAYOUT_H
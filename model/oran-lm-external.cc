@@ -0,0 +1,705 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-lm-external.h"
+
+#include "oran-cell-control-store.h"
+#include "oran-command-lte-2-lte-cell-parameter.h"
+#include "oran-command-lte-2-lte-handover.h"
+#include "oran-command-lte-2-lte-tx-power.h"
+#include "oran-command-nr-2-nr-cell-parameter.h"
+#include "oran-command-nr-2-nr-handover.h"
+#include "oran-command-nr-2-nr-tx-power.h"
+#include "oran-data-repository.h"
+#include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-app-demand.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <limits>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranLmExternal");
+
+NS_OBJECT_ENSURE_REGISTERED(OranLmExternal);
+
+namespace
+{
+
+/**
+ * Write to a FIFO without raising SIGPIPE when the reader has gone, so that
+ * the write fails with EPIPE and the LM can report it, instead of the
+ * simulation being terminated. FIFOs do not take MSG_NOSIGNAL, so SIGPIPE
+ * is blocked in the calling thread during the write, and a SIGPIPE raised
+ * by the write is consumed before it is unblocked. The disposition of
+ * SIGPIPE for the rest of the process is left as it is.
+ *
+ * @param fd The write end of the FIFO.
+ * @param buffer The bytes to write.
+ * @param size The number of bytes.
+ * @return The result of write().
+ */
+ssize_t
+WriteNoSignal(int fd, const void* buffer, std::size_t size)
+{
+    sigset_t pipeSet;
+    sigset_t oldSet;
+    sigemptyset(&pipeSet);
+    sigaddset(&pipeSet, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSet, &oldSet);
+
+    sigset_t pending;
+    sigpending(&pending);
+    const bool wasPending = sigismember(&pending, SIGPIPE) == 1;
+
+    ssize_t written = write(fd, buffer, size);
+    const int writeErrno = errno;
+    if (written < 0 && writeErrno == EPIPE && !wasPending)
+    {
+        const timespec noWait{0, 0};
+        sigtimedwait(&pipeSet, nullptr, &noWait);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &oldSet, nullptr);
+    errno = writeErrno;
+    return written;
+}
+
+/**
+ * Fill the position of a record with the last reported position of a node.
+ *
+ * @param data The Data Repository.
+ * @param e2NodeId The E2 Node ID.
+ * @param position The position to fill; left at zero if none was reported.
+ */
+void
+GetLastPosition(Ptr<OranDataRepository> data, uint64_t e2NodeId, double position[3])
+{
+    auto positions = data->GetNodePositions(e2NodeId, Time::Min(), Simulator::Now());
+    if (!positions.empty())
+    {
+        const Vector& p = positions.rbegin()->second;
+        position[0] = p.x;
+        position[1] = p.y;
+        position[2] = p.z;
+    }
+}
+
+} // namespace
+
+TypeId
+OranLmExternal::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranLmExternal")
+            .SetParent<OranLm>()
+            .AddConstructor<OranLmExternal>()
+            .AddAttribute("RegionName",
+                          "The name of the shared-memory region (see shm_open).",
+                          StringValue("/oran-xapp"),
+                          MakeStringAccessor(&OranLmExternal::m_regionName),
+                          MakeStringChecker())
+            .AddAttribute("RequestFifo",
+                          "The path of the FIFO the LM signals new snapshots on.",
+                          StringValue("/tmp/oran-xapp.req"),
+                          MakeStringAccessor(&OranLmExternal::m_requestFifo),
+                          MakeStringChecker())
+            .AddAttribute("ResponseFifo",
+                          "The path of the FIFO the xApp signals its commands on.",
+                          StringValue("/tmp/oran-xapp.rsp"),
+                          MakeStringAccessor(&OranLmExternal::m_responseFifo),
+                          MakeStringChecker())
+            .AddAttribute("Command",
+                          "The shell command that starts the xApp when the LM is activated. "
+                          "If empty, the xApp must be started separately.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranLmExternal::m_command),
+                          MakeStringChecker())
+            .AddAttribute("Timeout",
+                          "The longest wall-clock time to wait for the xApp to connect or to "
+                          "answer a cycle before aborting the simulation.",
+                          TimeValue(Seconds(30)),
+                          MakeTimeAccessor(&OranLmExternal::m_timeout),
+                          MakeTimeChecker(Seconds(0)))
+            .AddAttribute("MaxUes",
+                          "The capacity of the UEs table of the region.",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&OranLmExternal::m_maxUes),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxCells",
+                          "The capacity of the cells table of the region.",
+                          UintegerValue(256),
+                          MakeUintegerAccessor(&OranLmExternal::m_maxCells),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxMeasurements",
+                          "The capacity of the measurements table of the region.",
+                          UintegerValue(16384),
+                          MakeUintegerAccessor(&OranLmExternal::m_maxMeasurements),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("MaxCommands",
+                          "The capacity of the commands table of the region.",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&OranLmExternal::m_maxCommands),
+                          MakeUintegerChecker<uint32_t>(1));
+
+    return tid;
+}
+
+OranLmExternal::OranLmExternal()
+    : OranLm(),
+      m_maxUes(1024),
+      m_maxCells(256),
+      m_maxMeasurements(16384),
+      m_maxCommands(1024),
+      m_region(nullptr),
+      m_regionSize(0),
+      m_layout(),
+      m_requestFd(-1),
+      m_responseFd(-1),
+      m_pid(0),
+      m_sequence(0)
+{
+    NS_LOG_FUNCTION(this);
+
+    m_name = "OranLmExternal";
+}
+
+OranLmExternal::~OranLmExternal()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranLmExternal::Activate()
+{
+    NS_LOG_FUNCTION(this);
+
+    OranLm::Activate();
+
+    MapRegion();
+
+    if (!m_command.empty() && m_pid == 0)
+    {
+        // Anything still buffered would be written once more by the child.
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+
+        pid_t pid = fork();
+        NS_ABORT_MSG_IF(pid < 0, "Could not fork the xApp of " << m_name << ", errno=" << errno);
+        if (pid == 0)
+        {
+            setenv("ORAN_XAPP_REGION", m_regionName.c_str(), 1);
+            setenv("ORAN_XAPP_REQUEST_FIFO", m_requestFifo.c_str(), 1);
+            setenv("ORAN_XAPP_RESPONSE_FIFO", m_responseFifo.c_str(), 1);
+            execl("/bin/sh", "sh", "-c", m_command.c_str(), static_cast<char*>(nullptr));
+            _exit(127);
+        }
+
+        NS_LOG_LOGIC("\"" << m_name << "\" started the xApp \"" << m_command << "\" as process "
+                          << pid);
+        m_pid = pid;
+    }
+}
+
+void
+OranLmExternal::Deactivate()
+{
+    NS_LOG_FUNCTION(this);
+
+    OranLm::Deactivate();
+
+    Disconnect();
+}
+
+void
+OranLmExternal::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Disconnect();
+    UnmapRegion();
+
+    OranLm::DoDispose();
+}
+
+std::vector<Ptr<OranCommand>>
+OranLmExternal::Run()
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<Ptr<OranCommand>> commands;
+
+    if (!m_active)
+    {
+        return commands;
+    }
+
+    NS_ABORT_MSG_IF(m_nearRtRic == nullptr,
+                    "Attempting to run LM (" + m_name + ") with NULL Near-RT RIC");
+
+    Ptr<OranDataRepository> data = m_nearRtRic->Data();
+
+    MapRegion();
+    if (m_requestFd < 0)
+    {
+        Connect();
+    }
+
+    WriteSnapshot(data);
+    m_region->commands.count = 0;
+    m_region->timeNs = Simulator::Now().GetNanoSeconds();
+    m_region->sequence = ++m_sequence;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    ssize_t written = WriteNoSignal(m_requestFd, &m_sequence, sizeof(m_sequence));
+    NS_ABORT_MSG_IF(written != static_cast<ssize_t>(sizeof(m_sequence)),
+                    "Could not signal the xApp of " << m_name << ", errno=" << errno);
+
+    WaitForResponse();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    commands = ReadCommands(data);
+
+    LogLogicToRepository("xApp returned " + std::to_string(commands.size()) +
+                         " command(s) for cycle " + std::to_string(m_sequence));
+
+    return commands;
+}
+
+template <typename Record>
+Record*
+OranLmExternal::GetRecords(const OranLmExternalTable& table, uint32_t count) const
+{
+    NS_ABORT_MSG_IF(count > table.capacity ||
+                        table.offset + static_cast<uint64_t>(count) * sizeof(Record) >
+                            m_regionSize,
+                    count << " records do not fit the table at offset " << table.offset
+                          << " of the region of " << m_name);
+    return reinterpret_cast<Record*>(reinterpret_cast<char*>(m_region) + table.offset);
+}
+
+void
+OranLmExternal::MapRegion()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_region != nullptr)
+    {
+        return;
+    }
+
+    OranLmExternalHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, "ORANXAPP", sizeof(header.magic));
+    header.version = ORAN_LM_EXTERNAL_VERSION;
+    header.byteOrder = 0x01020304;
+
+    uint64_t offset = sizeof(OranLmExternalHeader);
+    auto layOut = [&offset](OranLmExternalTable& table, uint32_t capacity, std::size_t size) {
+        table.offset = static_cast<uint32_t>(offset);
+        table.capacity = capacity;
+        offset += static_cast<uint64_t>(capacity) * size;
+    };
+    layOut(header.ues, m_maxUes, sizeof(OranLmExternalUeRecord));
+    layOut(header.cells, m_maxCells, sizeof(OranLmExternalCellRecord));
+    layOut(header.measurements, m_maxMeasurements, sizeof(OranLmExternalMeasurementRecord));
+    layOut(header.commands, m_maxCommands, sizeof(OranLmExternalCommandRecord));
+    NS_ABORT_MSG_IF(offset > std::numeric_limits<uint32_t>::max(),
+                    "The shared-memory region of " << m_name << " is larger than 4 GiB");
+
+    int fd = shm_open(m_regionName.c_str(), O_CREAT | O_RDWR, 0600);
+    NS_ABORT_MSG_IF(fd < 0,
+                    "Could not open the shared-memory region \"" << m_regionName
+                                                                 << "\", errno=" << errno);
+    NS_ABORT_MSG_IF(ftruncate(fd, static_cast<off_t>(offset)) != 0,
+                    "Could not size the shared-memory region \"" << m_regionName
+                                                                 << "\", errno=" << errno);
+    void* region = mmap(nullptr, offset, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    NS_ABORT_MSG_IF(region == MAP_FAILED,
+                    "Could not map the shared-memory region \"" << m_regionName
+                                                                << "\", errno=" << errno);
+
+    m_region = static_cast<OranLmExternalHeader*>(region);
+    m_regionSize = offset;
+    m_layout = header;
+    std::memcpy(m_region, &header, sizeof(header));
+
+    for (const std::string& path : {m_requestFifo, m_responseFifo})
+    {
+        NS_ABORT_MSG_IF(mkfifo(path.c_str(), 0600) != 0 && errno != EEXIST,
+                        "Could not create the FIFO \"" << path << "\", errno=" << errno);
+    }
+
+    NS_LOG_LOGIC("\"" << m_name << "\" mapped " << m_regionSize << " bytes at \"" << m_regionName
+                      << "\"");
+}
+
+void
+OranLmExternal::UnmapRegion()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_region == nullptr)
+    {
+        return;
+    }
+
+    munmap(m_region, m_regionSize);
+    shm_unlink(m_regionName.c_str());
+    unlink(m_requestFifo.c_str());
+    unlink(m_responseFifo.c_str());
+
+    m_region = nullptr;
+    m_regionSize = 0;
+}
+
+void
+OranLmExternal::Connect()
+{
+    NS_LOG_FUNCTION(this);
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::nanoseconds(m_timeout.GetNanoSeconds());
+
+    // Opening the write end of a FIFO without a reader fails with ENXIO, so
+    // this waits until the xApp has opened the request FIFO.
+    while ((m_requestFd = open(m_requestFifo.c_str(), O_WRONLY | O_NONBLOCK)) < 0)
+    {
+        NS_ABORT_MSG_IF(errno != ENXIO && errno != EINTR,
+                        "Could not open the FIFO \"" << m_requestFifo << "\", errno=" << errno);
+        NS_ABORT_MSG_IF(m_pid > 0 && waitpid(m_pid, nullptr, WNOHANG) == m_pid,
+                        "The xApp of " << m_name << " exited before connecting");
+        NS_ABORT_MSG_IF(std::chrono::steady_clock::now() > deadline,
+                        "The xApp of " << m_name << " did not connect within " << m_timeout);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    fcntl(m_requestFd, F_SETFL, fcntl(m_requestFd, F_GETFL) & ~O_NONBLOCK);
+
+    // The read end can be opened before the xApp opens its write end, and
+    // WaitForResponse polls it.
+    m_responseFd = open(m_responseFifo.c_str(), O_RDONLY | O_NONBLOCK);
+    NS_ABORT_MSG_IF(m_responseFd < 0,
+                    "Could not open the FIFO \"" << m_responseFifo << "\", errno=" << errno);
+
+    NS_LOG_LOGIC("\"" << m_name << "\" connected to its xApp");
+}
+
+void
+OranLmExternal::Disconnect()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_requestFd >= 0)
+    {
+        close(m_requestFd);
+        m_requestFd = -1;
+    }
+    if (m_responseFd >= 0)
+    {
+        close(m_responseFd);
+        m_responseFd = -1;
+    }
+
+    if (m_pid > 0)
+    {
+        // The xApp sees the closed request FIFO as end of file and exits.
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::nanoseconds(m_timeout.GetNanoSeconds());
+        while (waitpid(m_pid, nullptr, WNOHANG) == 0)
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                NS_LOG_WARN("The xApp of " << m_name << " did not exit; terminating it");
+                kill(m_pid, SIGTERM);
+                waitpid(m_pid, nullptr, 0);
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        m_pid = 0;
+    }
+}
+
+void
+OranLmExternal::WriteSnapshot(Ptr<OranDataRepository> data)
+{
+    NS_LOG_FUNCTION(this << data);
+
+    OranLmExternalUeRecord* ues = GetRecords<OranLmExternalUeRecord>(m_layout.ues, m_maxUes);
+    OranLmExternalCellRecord* cells =
+        GetRecords<OranLmExternalCellRecord>(m_layout.cells, m_maxCells);
+    OranLmExternalMeasurementRecord* measurements =
+        GetRecords<OranLmExternalMeasurementRecord>(m_layout.measurements, m_maxMeasurements);
+    uint32_t nUes = 0;
+    uint32_t nCells = 0;
+    uint32_t nMeasurements = 0;
+    bool truncated = false;
+
+    for (OranLmExternalRat rat : {OranLmExternalRat::LTE, OranLmExternalRat::NR})
+    {
+        const bool isLte = rat == OranLmExternalRat::LTE;
+
+        for (uint64_t ueId : isLte ? data->GetLteUeE2NodeIds() : data->GetNrUeE2NodeIds())
+        {
+            if (nUes == m_maxUes)
+            {
+                truncated = true;
+                break;
+            }
+
+            OranLmExternalUeRecord& ue = ues[nUes++];
+            std::memset(&ue, 0, sizeof(ue));
+            ue.e2NodeId = ueId;
+            ue.rat = static_cast<uint8_t>(rat);
+            bool found;
+            std::tie(found, ue.cellId, ue.rnti) =
+                isLte ? data->GetLteUeCellInfo(ueId) : data->GetNrUeCellInfo(ueId);
+            GetLastPosition(data, ueId, ue.position);
+            ue.appDemand = isLte ? data->GetLteUeAppDemand(ueId) : data->GetNrUeAppDemand(ueId);
+
+            for (const auto& meas :
+                 isLte ? data->GetLteUeRsrpRsrq(ueId) : data->GetNrUeRsrpRsrq(ueId))
+            {
+                if (nMeasurements == m_maxMeasurements)
+                {
+                    truncated = true;
+                    break;
+                }
+
+                OranLmExternalMeasurementRecord& m = measurements[nMeasurements++];
+                std::memset(&m, 0, sizeof(m));
+                m.ueE2NodeId = ueId;
+                bool isServing;
+                std::tie(m.rnti, m.cellId, m.rsrp, m.rsrq, isServing, m.componentCarrierId) =
+                    meas;
+                m.isServing = isServing ? 1 : 0;
+                m.rat = static_cast<uint8_t>(rat);
+            }
+        }
+
+        for (uint64_t cellE2NodeId :
+             isLte ? data->GetLteEnbE2NodeIds() : data->GetNrGnbE2NodeIds())
+        {
+            if (nCells == m_maxCells)
+            {
+                truncated = true;
+                break;
+            }
+
+            bool found;
+            uint16_t cellId;
+            std::tie(found, cellId) = isLte ? data->GetLteEnbCellInfo(cellE2NodeId)
+                                            : data->GetNrGnbCellInfo(cellE2NodeId);
+            if (!found)
+            {
+                continue;
+            }
+
+            OranLmExternalCellRecord& cell = cells[nCells++];
+            std::memset(&cell, 0, sizeof(cell));
+            cell.e2NodeId = cellE2NodeId;
+            cell.cellId = cellId;
+            cell.rat = static_cast<uint8_t>(rat);
+            GetLastPosition(data, cellE2NodeId, cell.position);
+            const OranCellControlParams& params =
+                m_nearRtRic->GetCellControlStore()->Get(cellE2NodeId);
+            cell.cioDb = params.cioDb;
+            cell.tttSec = params.tttSec;
+            cell.hysDb = params.hysDb;
+            cell.retDeg = params.retDeg;
+        }
+    }
+
+    if (truncated)
+    {
+        NS_LOG_WARN("The snapshot of " << m_name
+                                       << " does not fit the shared-memory region; increase "
+                                          "MaxUes, MaxCells, or MaxMeasurements");
+    }
+
+    m_region->ues.count = nUes;
+    m_region->cells.count = nCells;
+    m_region->measurements.count = nMeasurements;
+}
+
+void
+OranLmExternal::WaitForResponse()
+{
+    NS_LOG_FUNCTION(this);
+
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::nanoseconds(m_timeout.GetNanoSeconds());
+    uint64_t sequence = 0;
+    std::size_t nRead = 0;
+    while (nRead < sizeof(sequence))
+    {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now());
+        NS_ABORT_MSG_IF(remaining.count() <= 0,
+                        "The xApp of " << m_name << " did not answer cycle " << m_sequence
+                                       << " within " << m_timeout);
+
+        pollfd pfd{m_responseFd, POLLIN, 0};
+        int ready = poll(&pfd, 1, static_cast<int>(remaining.count()));
+        if (ready <= 0)
+        {
+            NS_ABORT_MSG_IF(ready < 0 && errno != EINTR,
+                            "Could not wait for the xApp of " << m_name << ", errno=" << errno);
+            continue;
+        }
+
+        ssize_t n = read(m_responseFd,
+                         reinterpret_cast<char*>(&sequence) + nRead,
+                         sizeof(sequence) - nRead);
+        if (n < 0)
+        {
+            NS_ABORT_MSG_IF(errno != EAGAIN && errno != EINTR,
+                            "Could not read from the xApp of " << m_name << ", errno=" << errno);
+            continue;
+        }
+        NS_ABORT_MSG_IF(n == 0, "The xApp of " << m_name << " exited during cycle " << m_sequence);
+        nRead += static_cast<std::size_t>(n);
+    }
+
+    NS_ABORT_MSG_IF(sequence != m_sequence || m_region->responseSequence != m_sequence,
+                    "The xApp of " << m_name << " answered cycle " << sequence << " ("
+                                   << m_region->responseSequence << " in the region) instead of "
+                                   << m_sequence);
+}
+
+std::vector<Ptr<OranCommand>>
+OranLmExternal::ReadCommands(Ptr<OranDataRepository> data)
+{
+    NS_LOG_FUNCTION(this << data);
+
+    // Read once, as the xApp could still change it.
+    const uint32_t count = m_region->commands.count;
+    NS_ABORT_MSG_IF(count > m_maxCommands,
+                    "The xApp of " << m_name << " wrote " << count << " commands to a table of "
+                                   << m_maxCommands);
+
+    std::vector<Ptr<OranCommand>> commands;
+    commands.reserve(count);
+
+    const OranLmExternalCommandRecord* records =
+        GetRecords<OranLmExternalCommandRecord>(m_layout.commands, count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const OranLmExternalCommandRecord& record = records[i];
+        const auto parameter = static_cast<OranCellControlParameter>(record.parameter);
+
+        Ptr<OranCommand> command;
+        switch (static_cast<OranLmExternalCommandType>(record.type))
+        {
+        case OranLmExternalCommandType::LTE_HANDOVER:
+            command = OranCommandLte2LteHandover::Create(record.e2NodeId, record.cellId, record.rnti);
+            break;
+        case OranLmExternalCommandType::NR_HANDOVER:
+            command = OranCommandNr2NrHandover::Create(record.e2NodeId, record.cellId, record.rnti);
+            break;
+        case OranLmExternalCommandType::LTE_TX_POWER:
+            command = OranCommandLte2LteTxPower::Create(record.e2NodeId, record.value);
+            break;
+        case OranLmExternalCommandType::NR_TX_POWER:
+            command = OranCommandNr2NrTxPower::Create(record.e2NodeId, record.value);
+            break;
+        case OranLmExternalCommandType::LTE_CELL_PARAMETER:
+        case OranLmExternalCommandType::NR_CELL_PARAMETER:
+            if (parameter >= OranCellControlParameter::UNKNOWN)
+            {
+                NS_LOG_WARN("Ignoring xApp command " << i << " with unknown cell parameter "
+                                                     << +record.parameter);
+                continue;
+            }
+            if (static_cast<OranLmExternalCommandType>(record.type) ==
+                OranLmExternalCommandType::LTE_CELL_PARAMETER)
+            {
+                command = OranCommandLte2LteCellParameter::Create(record.e2NodeId,
+                                                                  parameter,
+                                                                  record.value,
+                                                                  record.isDelta != 0);
+            }
+            else
+            {
+                command = OranCommandNr2NrCellParameter::Create(record.e2NodeId,
+                                                                parameter,
+                                                                record.value,
+                                                                record.isDelta != 0);
+            }
+            break;
+        default:
+            NS_LOG_WARN("Ignoring xApp command " << i << " with unknown type " << +record.type);
+            continue;
+        }
+
+        data->LogCommandLm(m_name, command);
+        commands.push_back(command);
+    }
+
+    return commands;
+}
+
+std::vector<OranSubscription>
+OranLmExternal::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::LTEUE,
+                              OranNearRtRic::LTEENB,
+                              OranNearRtRic::NRUE,
+                              OranNearRtRic::NRGNB},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeAppDemand::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeAppDemand::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
+} // namespace ns3
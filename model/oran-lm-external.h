@@ -0,0 +1,216 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_LM_EXTERNAL_H
+#define ORAN_LM_EXTERNAL_H
+
+#include "oran-lm-external-layout.h"
+#include "oran-lm.h"
+
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+namespace ns3
+{
+
+class OranDataRepository;
+
+/**
+ * @ingroup oran
+ *
+ * Logic Module that delegates its logic to an xApp running in another
+ * process on the same host, e.g., a Python prototype.
+ *
+ * Every time it runs, the LM writes a snapshot of the Data Repository (the
+ * UEs and cells, their positions, the cell-control parameters, and the last
+ * RSRP/RSRQ measurements) into a POSIX shared-memory region with the fixed
+ * layout described in oran-lm-external-layout.h, and writes the number of
+ * the cycle to a request FIFO. The xApp reads the snapshot in place, writes
+ * its commands into the commands table of the same region, and writes the
+ * number of the cycle back to a response FIFO. The FIFOs only carry these
+ * wake-ups; no record is copied or serialized.
+ *
+ * The LM blocks (in wall-clock time) until the xApp answers, so simulation
+ * time does not advance while the xApp runs and the commands it returns do
+ * not depend on how long it takes. The commands are then delivered after
+ * the LM's processing delay like those of any other LM. If the xApp does
+ * not answer within Timeout, or exits, the simulation is aborted rather
+ * than continued without its commands.
+ *
+ * When Command is set, the LM starts the xApp itself with "/bin/sh -c" on
+ * activation and passes the names of the region and the FIFOs in the
+ * ORAN_XAPP_REGION, ORAN_XAPP_REQUEST_FIFO, and ORAN_XAPP_RESPONSE_FIFO
+ * environment variables. Otherwise, the xApp must be started separately
+ * with the same names. When the LM is deactivated, it closes the request
+ * FIFO, which the xApp sees as end of file.
+ */
+class OranLmExternal : public OranLm
+{
+  public:
+    /**
+     * Get the TypeId of the OranLmExternal class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranLmExternal class.
+     */
+    OranLmExternal();
+    /**
+     * Destructor of the OranLmExternal class.
+     */
+    ~OranLmExternal() override;
+    /**
+     * Activate the Logic Module, and start the xApp if Command is set.
+     */
+    void Activate() override;
+    /**
+     * Deactivate the Logic Module, and disconnect from the xApp.
+     */
+    void Deactivate() override;
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+    /**
+     * Export the snapshot, wait for the xApp, and build its commands.
+     *
+     * @return The commands written by the xApp.
+     */
+    std::vector<Ptr<OranCommand>> Run() override;
+    /**
+     * Get the Reports exported to the xApp: the locations of every node, and
+     * the cell information, RSRP and RSRQ, and application demand of the UEs.
+     *
+     * @return The subscriptions.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
+
+  private:
+    /**
+     * Create and map the shared-memory region and create the FIFOs, if
+     * that was not done yet.
+     */
+    void MapRegion();
+    /**
+     * Unmap and remove the shared-memory region and the FIFOs.
+     */
+    void UnmapRegion();
+    /**
+     * Open the FIFOs, waiting for the xApp to open them on its side.
+     */
+    void Connect();
+    /**
+     * Close the FIFOs and wait for the xApp if the LM started it.
+     */
+    void Disconnect();
+    /**
+     * Write the UEs, cells, and measurements of the Data Repository into
+     * the region.
+     *
+     * @param data The Data Repository.
+     */
+    void WriteSnapshot(Ptr<OranDataRepository> data);
+    /**
+     * Wait for the xApp to answer the current cycle.
+     */
+    void WaitForResponse();
+    /**
+     * Build the commands in the commands table of the region.
+     *
+     * @param data The Data Repository, to log the commands to.
+     * @return The commands.
+     */
+    std::vector<Ptr<OranCommand>> ReadCommands(Ptr<OranDataRepository> data);
+    /**
+     * Get a pointer to the first record of a table of the region, checking
+     * that the records fit in the table and in the region.
+     *
+     * @tparam Record The record type.
+     * @param table The table, as laid out by MapRegion.
+     * @param count The number of records that will be accessed.
+     * @return The pointer.
+     */
+    template <typename Record>
+    Record* GetRecords(const OranLmExternalTable& table, uint32_t count) const;
+
+    /**
+     * The name of the shared-memory region (see shm_open).
+     */
+    std::string m_regionName;
+    /**
+     * The path of the FIFO the LM signals new snapshots on.
+     */
+    std::string m_requestFifo;
+    /**
+     * The path of the FIFO the xApp signals its commands on.
+     */
+    std::string m_responseFifo;
+    /**
+     * The shell command that starts the xApp, or empty.
+     */
+    std::string m_command;
+    /**
+     * The longest wall-clock time to wait for the xApp.
+     */
+    Time m_timeout;
+    /**
+     * The capacity of the UEs table.
+     */
+    uint32_t m_maxUes;
+    /**
+     * The capacity of the cells table.
+     */
+    uint32_t m_maxCells;
+    /**
+     * The capacity of the measurements table.
+     */
+    uint32_t m_maxMeasurements;
+    /**
+     * The capacity of the commands table.
+     */
+    uint32_t m_maxCommands;
+    /**
+     * The mapped region, or nullptr.
+     */
+    OranLmExternalHeader* m_region;
+    /**
+     * The size of the mapped region, in bytes.
+     */
+    std::size_t m_regionSize;
+    /**
+     * The header written when the region was mapped. The offsets and
+     * capacities of the tables are taken from here, and not from the
+     * region, which the xApp can write to.
+     */
+    OranLmExternalHeader m_layout;
+    /**
+     * The write end of the request FIFO, or -1.
+     */
+    int m_requestFd;
+    /**
+     * The read end of the response FIFO, or -1.
+     */
+    int m_responseFd;
+    /**
+     * The process ID of the xApp started by the LM, or 0.
+     */
+    pid_t m_pid;
+    /**
+     * The number of the last cycle sent to the xApp.
+     */
+    uint64_t m_sequence;
+}; // class OranLmExternal
+
+} // namespace ns3
+
+#endif // ORAN_LM_EXTERNAL_H
@@ -5,11 +5,14 @@
  */
 #include "oran-lm-lte-2-lte-coverage-capacity-optimization.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-lte-2-lte-cell-parameter.h"
 #include "oran-command-lte-2-lte-tx-power.h"
 #include "oran-data-repository.h"
-#include "oran-lte-cell-control-state.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
 #include "ns3/boolean.h"
 #include "ns3/double.h"
@@ -95,7 +98,21 @@ OranLmLte2LteCoverageCapacityOptimization::GetTypeId()
                           DoubleValue(1.0),
                           MakeDoubleAccessor(
                               &OranLmLte2LteCoverageCapacityOptimization::m_retStepDeg),
-                          MakeDoubleChecker<double>());
+                          MakeDoubleChecker<double>())
+            .AddAttribute("PredictCoverage",
+                          "Whether TxPower is only raised where the RSRP surrogate, fitted to "
+                          "the last UE positions and RSRP reports, predicts a coverage gain.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(
+                              &OranLmLte2LteCoverageCapacityOptimization::m_predictCoverage),
+                          MakeBooleanChecker())
+            .AddAttribute("MinPredictedCoverageGain",
+                          "UEs that a TxPower increase must be predicted to bring above "
+                          "LowRsrpThresholdDbm when PredictCoverage is enabled.",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&OranLmLte2LteCoverageCapacityOptimization::
+                                                   m_minPredictedCoverageGain),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
@@ -107,7 +124,9 @@ OranLmLte2LteCoverageCapacityOptimization::OranLmLte2LteCoverageCapacityOptimiza
       m_minSamplesPerCell(1),
       m_criticalRsrpThresholdDbm(-120.0),
       m_criticalFractionThreshold(0.30),
-      m_retStepDeg(1.0)
+      m_retStepDeg(1.0),
+      m_predictCoverage(false),
+      m_minPredictedCoverageGain(1)
 {
     m_name = "OranLmLte2LteCoverageCapacityOptimization";
 }
@@ -167,6 +186,8 @@ OranLmLte2LteCoverageCapacityOptimization::Run()
         }
     }
 
+    const bool predict = m_predictCoverage && m_surrogate.LoadLte(data);
+
     for (const auto& item : stats)
     {
         const uint16_t cellId = item.first;
@@ -180,11 +201,36 @@ OranLmLte2LteCoverageCapacityOptimization::Run()
         const double avgRsrp      = s.sumRsrpDbm / s.samples;
 
         // ── TxPower increase when low-RSRP fraction exceeds threshold ────────
-        if (lowFraction >= m_lowRsrpFractionThreshold)
+        // With PredictCoverage, the increases already chosen this cycle are
+        // applied to the surrogate, so each one is scored against the others.
+        const int32_t cell = predict ? m_surrogate.GetCellIndex(e2id) : OranRsrpSurrogate::NO_CELL;
+        bool raiseTxPower = lowFraction >= m_lowRsrpFractionThreshold;
+        int64_t predictedGain = 0;
+        if (raiseTxPower && cell != OranRsrpSurrogate::NO_CELL)
         {
-            Ptr<OranCommandLte2LteTxPower> txCmd = CreateObject<OranCommandLte2LteTxPower>();
-            txCmd->SetAttribute("TargetE2NodeId", UintegerValue(e2id));
-            txCmd->SetAttribute("PowerDeltaDb",   DoubleValue(m_stepSizeDb));
+            const double offset = m_surrogate.GetPowerOffset(cell) + m_stepSizeDb;
+            predictedGain =
+                static_cast<int64_t>(
+                    m_surrogate.EvaluatePowerOffset(cell, offset, m_lowRsrpThresholdDbm)) -
+                m_surrogate.CountCovered(m_lowRsrpThresholdDbm);
+            if (predictedGain < m_minPredictedCoverageGain)
+            {
+                std::ostringstream msg;
+                msg << "CCO TXP skipped cell=" << cellId << " lowFrac=" << lowFraction
+                    << " predictedGain=" << predictedGain;
+                data->LogActionLm(m_name, msg.str());
+                NS_LOG_INFO(msg.str());
+                raiseTxPower = false;
+            }
+            else
+            {
+                m_surrogate.SetPowerOffset(cell, offset);
+            }
+        }
+        if (raiseTxPower)
+        {
+            Ptr<OranCommandLte2LteTxPower> txCmd =
+                OranCommandLte2LteTxPower::Create(e2id, m_stepSizeDb);
             data->LogCommandLm(m_name, txCmd);
             commands.push_back(txCmd);
 
@@ -194,6 +240,8 @@ OranLmLte2LteCoverageCapacityOptimization::Run()
                 << " avgRsrp=" << avgRsrp
                 << " thr=" << m_lowRsrpThresholdDbm
                 << " delta=+" << m_stepSizeDb << "dB";
+            if (cell != OranRsrpSurrogate::NO_CELL)
+                msg << " predictedGain=" << predictedGain;
             data->LogActionLm(m_name, msg.str());
             NS_LOG_INFO(msg.str());
         }
@@ -204,16 +252,12 @@ OranLmLte2LteCoverageCapacityOptimization::Run()
         if (critFraction >= m_criticalFractionThreshold && m_retStepDeg != 0.0)
         {
             // Read current RET to compute absolute new value
-            OranLteCellControlParams cp = GetLteCellControlParameters(e2id);
+            OranCellControlParams cp = m_nearRtRic->GetCellControlStore()->Get(e2id);
             double newRet = cp.retDeg + m_retStepDeg;
             newRet = std::max(0.0, std::min(15.0, newRet)); // clamp [0,15] deg
 
             Ptr<OranCommandLte2LteCellParameter> retCmd =
-                CreateObject<OranCommandLte2LteCellParameter>();
-            retCmd->SetAttribute("TargetE2NodeId", UintegerValue(e2id));
-            retCmd->SetAttribute("ParameterName",  StringValue("RET"));
-            retCmd->SetAttribute("Value",          DoubleValue(newRet));
-            retCmd->SetAttribute("IsDelta",        BooleanValue(false));
+                OranCommandLte2LteCellParameter::Create(e2id, "RET", newRet, false);
             data->LogCommandLm(m_name, retCmd);
             commands.push_back(retCmd);
 
@@ -231,4 +275,26 @@ OranLmLte2LteCoverageCapacityOptimization::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteCoverageCapacityOptimization::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<OranSubscription> subscriptions = {
+        OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                         {OranNearRtRic::LTEUE},
+                         Seconds(0)},
+        OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                         {OranNearRtRic::LTEUE},
+                         Seconds(0)}};
+    if (m_predictCoverage)
+    {
+        subscriptions.push_back(OranSubscription{OranReportLocation::GetTypeId(),
+                                                 {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                                                 Seconds(0)});
+    }
+
+    return subscriptions;
+}
+
 } // namespace ns3
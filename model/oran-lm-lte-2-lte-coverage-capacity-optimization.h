@@ -7,6 +7,7 @@
 #define ORAN_LM_LTE_2_LTE_COVERAGE_CAPACITY_OPTIMIZATION_H
 
 #include "oran-lm.h"
+#include "oran-rsrp-surrogate.h"
 
 namespace ns3
 {
@@ -19,6 +20,7 @@ class OranLmLte2LteCoverageCapacityOptimization : public OranLm
     ~OranLmLte2LteCoverageCapacityOptimization() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     double   m_lowRsrpThresholdDbm;
@@ -30,6 +32,11 @@ class OranLmLte2LteCoverageCapacityOptimization : public OranLm
     double   m_criticalRsrpThresholdDbm;
     double   m_criticalFractionThreshold;
     double   m_retStepDeg;
+    // What-if check: TxPower is only raised where the RSRP surrogate
+    // predicts that it brings UEs above LowRsrpThresholdDbm.
+    bool     m_predictCoverage;
+    uint32_t m_minPredictedCoverageGain;
+    OranRsrpSurrogate m_surrogate;
 };
 
 } // namespace ns3
@@ -32,6 +32,8 @@
 
 #include "oran-command-lte-2-lte-handover.h"
 #include "oran-data-repository.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-cell-info.h"
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
@@ -109,7 +111,7 @@ OranLmLte2LteDistanceHandover::GetUeInfos(Ptr<OranDataRepository> data) const
         {
             // Get the latest location of the UE.
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -148,7 +150,7 @@ OranLmLte2LteDistanceHandover::GetEnbInfos(Ptr<OranDataRepository> data) const
         {
             // Get all known locations of the eNB.
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(enbInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(enbInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -227,14 +229,11 @@ OranLmLte2LteDistanceHandover::GetHandoverCommands(
         if (newCellId != ueInfo.cellId)
         {
             // It is, so issue a handover command.
+            // Send the command to the cell currently serving the UE, give it
+            // the ID of the new cell to handover to, and use the RNTI that the
+            // current cell is using to identify the UE.
             Ptr<OranCommandLte2LteHandover> handoverCommand =
-                CreateObject<OranCommandLte2LteHandover>();
-            // Send the command to the cell currently serving the UE.
-            handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(oldCellNodeId));
-            // Use the RNTI that the current cell is using to identify the UE.
-            handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-            // Give the current cell the ID of the new cell to handover to.
-            handoverCommand->SetAttribute("TargetCellId", UintegerValue(newCellId));
+                OranCommandLte2LteHandover::Create(oldCellNodeId, newCellId, ueInfo.rnti);
             // Log the command to the storage
             data->LogCommandLm(m_name, handoverCommand);
             // Add the command to send.
@@ -249,4 +248,17 @@ OranLmLte2LteDistanceHandover::GetHandoverCommands(
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteDistanceHandover::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
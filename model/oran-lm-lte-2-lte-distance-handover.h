@@ -92,6 +92,13 @@ class OranLmLte2LteDistanceHandover : public OranLm
      * @return A vector with the handover commands generated by this Logic Module.
      */
     std::vector<Ptr<OranCommand>> Run() override;
+    /**
+     * Get the Reports this Logic Module reads: the locations of the LTE UEs
+     * and eNBs, and the cell information of the LTE UEs.
+     *
+     * @return The subscriptions.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     /**
@@ -19,7 +19,11 @@
 #include "oran-near-rt-ric.h"
 #include "oran-data-repository.h"
 #include "oran-command-lte-2-lte-tx-power.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-energy-efficiency.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/double.h"
@@ -34,13 +38,6 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE("OranLmLte2LteEnergySaving");
 NS_OBJECT_ENSURE_REGISTERED(OranLmLte2LteEnergySaving);
 
-namespace {
-  // Per-eNB: remaining energy (J) at the last run
-  std::unordered_map<uint64_t, double> g_prevEnbRemainingJ;
-  // Simulation time (s) at the last run
-  double g_prevTimeSec = std::numeric_limits<double>::quiet_NaN();
-}
-
 TypeId
 OranLmLte2LteEnergySaving::GetTypeId (void)
 {
@@ -62,12 +59,34 @@ OranLmLte2LteEnergySaving::GetTypeId (void)
                   "Expected LM query interval (s). Used to convert ΔJ → average power (W).",
                   DoubleValue(5.0),
                   MakeDoubleAccessor(&OranLmLte2LteEnergySaving::m_lmIntervalSec),
-                  MakeDoubleChecker<double>(1e-3));
+                  MakeDoubleChecker<double>(1e-3))
+    .AddAttribute("PredictCoverage",
+                  "Whether TxPower is only lowered where the RSRP surrogate, fitted to the "
+                  "last UE positions and RSRP reports, predicts that few UEs lose coverage.",
+                  BooleanValue(false),
+                  MakeBooleanAccessor(&OranLmLte2LteEnergySaving::m_predictCoverage),
+                  MakeBooleanChecker())
+    .AddAttribute("CoverageThresholdDbm",
+                  "RSRP a UE needs from its best cell to count as covered when "
+                  "PredictCoverage is enabled.",
+                  DoubleValue(-110.0),
+                  MakeDoubleAccessor(&OranLmLte2LteEnergySaving::m_coverageThresholdDbm),
+                  MakeDoubleChecker<double>())
+    .AddAttribute("MaxPredictedCoverageLoss",
+                  "UEs a TxPower reduction may be predicted to leave uncovered when "
+                  "PredictCoverage is enabled.",
+                  UintegerValue(0),
+                  MakeUintegerAccessor(&OranLmLte2LteEnergySaving::m_maxPredictedCoverageLoss),
+                  MakeUintegerChecker<uint32_t>());
   return tid;
 }
 
 OranLmLte2LteEnergySaving::OranLmLte2LteEnergySaving ()
-  : OranLm ()
+  : OranLm (),
+    m_prevTimeSec (std::numeric_limits<double>::quiet_NaN ()),
+    m_predictCoverage (false),
+    m_coverageThresholdDbm (-110.0),
+    m_maxPredictedCoverageLoss (0)
 {
   NS_LOG_FUNCTION(this);
   m_name = "OranLmLte2LteEnergySaving";
@@ -78,6 +97,19 @@ OranLmLte2LteEnergySaving::~OranLmLte2LteEnergySaving ()
   NS_LOG_FUNCTION(this);
 }
 
+void
+OranLmLte2LteEnergySaving::RestoreState (std::istream& is, Time timeShift)
+{
+  NS_LOG_FUNCTION(this << timeShift);
+
+  // The LM keeps no smoothing or hold-off state, only the energy baselines
+  // of the last run. Those describe the run the checkpoint was taken from,
+  // and the restored run need not have the same energy models, so nothing
+  // is saved and the baselines re-prime on the first Run.
+  m_prevTimeSec = std::numeric_limits<double>::quiet_NaN ();
+  m_prevEnbRemainingJ.clear();
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmLte2LteEnergySaving::Run (void)
 {
@@ -96,29 +128,33 @@ OranLmLte2LteEnergySaving::Run (void)
   const double nowSec = Simulator::Now().GetSeconds();
 
   // Warm-up: record baselines on first call
-  const bool firstRun = !std::isfinite(g_prevTimeSec);
+  const bool firstRun = !std::isfinite(m_prevTimeSec);
   if (firstRun)
   {
-    g_prevTimeSec = nowSec;
+    m_prevTimeSec = nowSec;
     for (auto enbId : repo->GetLteEnbE2NodeIds())
     {
-      g_prevEnbRemainingJ[enbId] = repo->GetLteEnergyRemaining(enbId);
+      m_prevEnbRemainingJ[enbId] = repo->GetLteEnergyRemaining(enbId);
     }
     NS_LOG_INFO("Energy-Saving LM warm-up complete; no commands this tick.");
     return commands;
   }
 
   // Elapsed time since last call (use actual sim clock for accuracy)
-  double dt = nowSec - g_prevTimeSec;
-  g_prevTimeSec = nowSec;
+  double dt = nowSec - m_prevTimeSec;
+  m_prevTimeSec = nowSec;
   if (dt <= 0.0) dt = m_lmIntervalSec; // guard clock stall
 
   constexpr double eps = 1e-9;
 
+  // With PredictCoverage, the reductions already chosen this run are
+  // applied to the surrogate, so each one is scored against the others.
+  const bool predict = m_predictCoverage && m_surrogate.LoadLte(repo);
+
   for (auto enbId : repo->GetLteEnbE2NodeIds())
   {
     const double remNow  = repo->GetLteEnergyRemaining(enbId);
-    double& remPrev      = g_prevEnbRemainingJ[enbId]; // creates 0 if missing
+    double& remPrev      = m_prevEnbRemainingJ[enbId]; // creates 0 if missing
     const double deltaJ  = remPrev - remNow;            // energy consumed this window (J)
     remPrev              = remNow;                       // update baseline
 
@@ -146,9 +182,23 @@ OranLmLte2LteEnergySaving::Run (void)
       continue;
     }
 
-    Ptr<OranCommandLte2LteTxPower> cmd = CreateObject<OranCommandLte2LteTxPower>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbId));
-    cmd->SetAttribute("PowerDeltaDb",   DoubleValue(deltaDb));
+    const int32_t cell = predict ? m_surrogate.GetCellIndex(enbId) : OranRsrpSurrogate::NO_CELL;
+    if (deltaDb < 0.0 && cell != OranRsrpSurrogate::NO_CELL)
+    {
+      const double offset = m_surrogate.GetPowerOffset(cell) + deltaDb;
+      const int64_t predictedLoss =
+        static_cast<int64_t>(m_surrogate.CountCovered(m_coverageThresholdDbm)) -
+        m_surrogate.EvaluatePowerOffset(cell, offset, m_coverageThresholdDbm);
+      if (predictedLoss > m_maxPredictedCoverageLoss)
+      {
+        NS_LOG_INFO("eNB " << enbId << ": ΔTx=" << deltaDb << " dB would leave "
+                    << predictedLoss << " UEs uncovered; no change.");
+        continue;
+      }
+      m_surrogate.SetPowerOffset(cell, offset);
+    }
+
+    Ptr<OranCommandLte2LteTxPower> cmd = OranCommandLte2LteTxPower::Create(enbId, deltaDb);
 
     repo->LogCommandLm(m_name, cmd);
     commands.push_back(cmd);
@@ -164,4 +214,26 @@ OranLmLte2LteEnergySaving::Run (void)
   return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteEnergySaving::GetSubscriptions (void) const
+{
+  NS_LOG_FUNCTION(this);
+
+  std::vector<OranSubscription> subscriptions = {
+    OranSubscription{OranReportLteEnergyEfficiency::GetTypeId (),
+                     {OranNearRtRic::LTEENB},
+                     Seconds (0)}};
+  if (m_predictCoverage)
+  {
+    subscriptions.push_back(OranSubscription{OranReportLocation::GetTypeId (),
+                                             {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                                             Seconds (0)});
+    subscriptions.push_back(OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId (),
+                                             {OranNearRtRic::LTEUE},
+                                             Seconds (0)});
+  }
+
+  return subscriptions;
+}
+
 } // namespace ns3
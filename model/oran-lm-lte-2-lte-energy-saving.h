@@ -16,6 +16,10 @@
 
 #include "oran-lm.h"
 #include "oran-data-repository.h"
+#include "oran-rsrp-surrogate.h"
+
+#include <cstdint>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -31,11 +35,19 @@ public:
   ~OranLmLte2LteEnergySaving () override;
 
   std::vector<Ptr<OranCommand>> Run () override;
+  std::vector<OranSubscription> GetSubscriptions () const override;
+  void RestoreState (std::istream& is, Time timeShift) override;
 
 private:
   double m_targetPowerW;  //!< Target average power consumption per eNB (W)
   double m_stepSize;      //!< Tx power adjustment step (dB) per LM invocation
   double m_lmIntervalSec; //!< Expected LM invocation interval (s) — used to derive W from ΔJ
+  std::unordered_map<uint64_t, double> m_prevEnbRemainingJ; //!< Remaining energy (J) of each eNB at the last run
+  double m_prevTimeSec;   //!< Simulation time (s) of the last run; NaN before the first run
+  bool m_predictCoverage; //!< Whether TxPower reductions are checked against the RSRP surrogate
+  double m_coverageThresholdDbm; //!< RSRP a UE needs from its best cell to count as covered
+  uint32_t m_maxPredictedCoverageLoss; //!< UEs a TxPower reduction may leave uncovered
+  OranRsrpSurrogate m_surrogate; //!< Predicts the RSRP of the UEs, refitted every run
 };
 
 } // namespace ns3
@@ -8,13 +8,18 @@
 #include "oran-command-lte-2-lte-tx-power.h"
 #include "oran-data-repository.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
+#include "ns3/abort.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <tuple>
@@ -80,6 +85,37 @@ OranLmLte2LteKpiPrediction::OranLmLte2LteKpiPrediction()
 
 OranLmLte2LteKpiPrediction::~OranLmLte2LteKpiPrediction() = default;
 
+void
+OranLmLte2LteKpiPrediction::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    os << m_emaState.size() << '\n' << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& [e2NodeId, state] : m_emaState)
+    {
+        os << e2NodeId << ' ' << state.ema << ' ' << state.prevEma << ' ' << state.initialized
+           << ' ' << state.actionCount << '\n';
+    }
+}
+
+void
+OranLmLte2LteKpiPrediction::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+
+    std::size_t n = 0;
+    is >> n;
+    m_emaState.clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t e2NodeId = 0;
+        EmaState state;
+        is >> e2NodeId >> state.ema >> state.prevEma >> state.initialized >> state.actionCount;
+        NS_ABORT_MSG_IF(is.fail(), "Malformed EMA state in checkpoint for " << GetName());
+        m_emaState[e2NodeId] = state;
+    }
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmLte2LteKpiPrediction::Run()
 {
@@ -195,9 +231,8 @@ OranLmLte2LteKpiPrediction::Run()
             NS_LOG_INFO(msg.str());
             data->LogActionLm(m_name, msg.str());
 
-            Ptr<OranCommandLte2LteTxPower> cmd = CreateObject<OranCommandLte2LteTxPower>();
-            cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbE2Id));
-            cmd->SetAttribute("PowerDeltaDb",   DoubleValue(m_stepSizeDb));
+            Ptr<OranCommandLte2LteTxPower> cmd =
+                OranCommandLte2LteTxPower::Create(enbE2Id, m_stepSizeDb);
             data->LogCommandLm(m_name, cmd);
             commands.push_back(cmd);
 
@@ -213,4 +248,17 @@ OranLmLte2LteKpiPrediction::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteKpiPrediction::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -62,6 +62,9 @@ class OranLmLte2LteKpiPrediction : public OranLm
     ~OranLmLte2LteKpiPrediction() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
+    void SaveState(std::ostream& os) const override;
+    void RestoreState(std::istream& is, Time timeShift) override;
 
   private:
     // ── Per-eNB EMA state ────────────────────────────────────────────────────
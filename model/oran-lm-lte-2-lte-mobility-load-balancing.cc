@@ -5,19 +5,25 @@
  */
 #include "oran-lm-lte-2-lte-mobility-load-balancing.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-lte-2-lte-cell-parameter.h"
+#include "oran-command-lte-2-lte-handover.h"
 #include "oran-data-repository.h"
-#include "oran-lte-cell-control-state.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-lte-ue-app-demand.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
 #include "ns3/boolean.h"
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/string.h"
 #include "ns3/uinteger.h"
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <tuple>
@@ -34,11 +40,8 @@ namespace
 Ptr<OranCommandLte2LteCellParameter>
 CreateCellParameterCommand(uint64_t e2NodeId, const std::string& name, double value)
 {
-    Ptr<OranCommandLte2LteCellParameter> cmd = CreateObject<OranCommandLte2LteCellParameter>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(e2NodeId));
-    cmd->SetAttribute("ParameterName", StringValue(name));
-    cmd->SetAttribute("Value", DoubleValue(value));
-    cmd->SetAttribute("IsDelta", BooleanValue(false));
+    Ptr<OranCommandLte2LteCellParameter> cmd =
+        OranCommandLte2LteCellParameter::Create(e2NodeId, name, value, false);
     return cmd;
 }
 
@@ -51,6 +54,15 @@ OranLmLte2LteMobilityLoadBalancing::GetTypeId()
         TypeId("ns3::OranLmLte2LteMobilityLoadBalancing")
             .SetParent<OranLm>()
             .AddConstructor<OranLmLte2LteMobilityLoadBalancing>()
+            .AddAttribute("Mode",
+                          "How load is balanced: by nudging the CIO of imbalanced cells, or by "
+                          "handing over the UEs of a capacity-constrained min-cost assignment.",
+                          EnumValue(OranLmLte2LteMobilityLoadBalancing::CIO),
+                          MakeEnumAccessor<Mode>(&OranLmLte2LteMobilityLoadBalancing::m_mode),
+                          MakeEnumChecker(OranLmLte2LteMobilityLoadBalancing::CIO,
+                                          "CIO",
+                                          OranLmLte2LteMobilityLoadBalancing::ASSIGNMENT,
+                                          "ASSIGNMENT"))
             .AddAttribute("LoadImbalanceThreshold",
                           "Fractional UE-count imbalance around the average that triggers MLB.",
                           DoubleValue(0.20),
@@ -83,18 +95,48 @@ OranLmLte2LteMobilityLoadBalancing::GetTypeId()
                           "--enb-capacity-mbps.",
                           DoubleValue(50.0),
                           MakeDoubleAccessor(&OranLmLte2LteMobilityLoadBalancing::m_enbCapacityMbps),
-                          MakeDoubleChecker<double>(0.0));
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("TargetUtilization",
+                          "In ASSIGNMENT mode, the fraction of EnbCapacityMbps that cells are "
+                          "filled to, and above which a cell triggers a reassignment.",
+                          DoubleValue(1.0),
+                          MakeDoubleAccessor(
+                              &OranLmLte2LteMobilityLoadBalancing::m_targetUtilization),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("HandoverCost",
+                          "In ASSIGNMENT mode, the cost of handing over a UE, in dB of RSRP.",
+                          DoubleValue(3.0),
+                          MakeDoubleAccessor(&OranLmLte2LteMobilityLoadBalancing::m_handoverCost),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MaxRsrpMargin",
+                          "In ASSIGNMENT mode, how far below the RSRP of its serving cell a "
+                          "UE may be handed over to, in dB.",
+                          DoubleValue(10.0),
+                          MakeDoubleAccessor(&OranLmLte2LteMobilityLoadBalancing::m_maxRsrpMargin),
+                          MakeDoubleChecker<double>(0.0))
+            .AddAttribute("MaxAssignmentRounds",
+                          "In ASSIGNMENT mode, the most times the assignment is solved in a "
+                          "run, lowering the UEs taken by the cells still over budget each time.",
+                          UintegerValue(4),
+                          MakeUintegerAccessor(
+                              &OranLmLte2LteMobilityLoadBalancing::m_maxAssignmentRounds),
+                          MakeUintegerChecker<uint32_t>(1));
     return tid;
 }
 
 OranLmLte2LteMobilityLoadBalancing::OranLmLte2LteMobilityLoadBalancing()
     : OranLm(),
+      m_mode(CIO),
       m_loadImbalanceThreshold(0.20),
       m_cioStepDb(1.0),
       m_maxAbsCioDb(6.0),
       m_hotCellTttSec(0.0),
       m_controlTtt(false),
-      m_enbCapacityMbps(50.0)
+      m_enbCapacityMbps(50.0),
+      m_targetUtilization(1.0),
+      m_handoverCost(3.0),
+      m_maxRsrpMargin(10.0),
+      m_maxAssignmentRounds(4)
 {
     m_name = "OranLmLte2LteMobilityLoadBalancing";
 }
@@ -114,6 +156,10 @@ OranLmLte2LteMobilityLoadBalancing::Run()
                     "Attempting to run MLB LM with NULL Near-RT RIC");
 
     Ptr<OranDataRepository> data = m_nearRtRic->Data();
+    if (m_mode == ASSIGNMENT)
+    {
+        return RunAssignment(data);
+    }
 
     std::map<uint16_t, uint64_t> cellToE2;
     std::map<uint16_t, double> demandMbpsByCell;
@@ -182,7 +228,7 @@ OranLmLte2LteMobilityLoadBalancing::Run()
             continue;
         }
 
-        OranLteCellControlParams params = GetLteCellControlParameters(e2NodeId);
+        OranCellControlParams params = m_nearRtRic->GetCellControlStore()->Get(e2NodeId);
         const double direction = (normalizedError > 0.0 || overloaded) ? -1.0 : 1.0;
         const double newCio =
             std::max(-m_maxAbsCioDb,
@@ -211,4 +257,244 @@ OranLmLte2LteMobilityLoadBalancing::Run()
     return commands;
 }
 
+std::vector<Ptr<OranCommand>>
+OranLmLte2LteMobilityLoadBalancing::RunAssignment(Ptr<OranDataRepository> data)
+{
+    std::vector<Ptr<OranCommand>> commands;
+
+    std::vector<uint16_t> cellIds;
+    std::vector<uint64_t> cellE2;
+    std::map<uint16_t, uint32_t> cellIndex;
+    for (auto enbId : data->GetLteEnbE2NodeIds())
+    {
+        bool found = false;
+        uint16_t cellId = 0;
+        std::tie(found, cellId) = data->GetLteEnbCellInfo(enbId);
+        if (found && cellIndex.emplace(cellId, cellIds.size()).second)
+        {
+            cellIds.push_back(cellId);
+            cellE2.push_back(enbId);
+        }
+    }
+
+    std::vector<uint16_t> rntis;
+    std::vector<AssignmentUe> ues;
+    std::vector<double> demandMbpsByCell(cellIds.size(), 0.0);
+    for (auto ueId : data->GetLteUeE2NodeIds())
+    {
+        bool found = false;
+        uint16_t cellId = 0;
+        uint16_t rnti = 0;
+        std::tie(found, cellId, rnti) = data->GetLteUeCellInfo(ueId);
+        auto serving = cellIndex.find(cellId);
+        if (!found || serving == cellIndex.end())
+        {
+            continue;
+        }
+
+        AssignmentUe ue{serving->second, data->GetLteUeAppDemand(ueId), {}};
+        for (const auto& meas : data->GetLteUeRsrpRsrq(ueId))
+        {
+            auto cell = cellIndex.find(std::get<1>(meas));
+            double rsrp = std::get<2>(meas);
+            if (cell != cellIndex.end() && std::isfinite(rsrp))
+            {
+                ue.rsrp.emplace_back(cell->second, rsrp);
+            }
+        }
+        demandMbpsByCell[ue.serving] += ue.demandMbps;
+        rntis.push_back(rnti);
+        ues.push_back(std::move(ue));
+    }
+
+    const double budgetMbps = m_enbCapacityMbps * m_targetUtilization;
+    if (ues.empty() ||
+        *std::max_element(demandMbpsByCell.begin(), demandMbpsByCell.end()) <= budgetMbps)
+    {
+        return commands;
+    }
+
+    AssignmentResult result = Assign(ues, cellIds.size(), budgetMbps);
+    if (result.rounds == 0)
+    {
+        return commands;
+    }
+
+    // UEs that could not be placed stay in their cell.
+    for (uint32_t i = 0; i < ues.size(); i++)
+    {
+        const int32_t cell = result.cells[i];
+        if (cell == OranMinCostAssignment::UNASSIGNED ||
+            static_cast<uint32_t>(cell) == ues[i].serving)
+        {
+            continue;
+        }
+        Ptr<OranCommandLte2LteHandover> cmd =
+            OranCommandLte2LteHandover::Create(cellE2[ues[i].serving], cellIds[cell], rntis[i]);
+        data->LogCommandLm(m_name, cmd);
+        commands.push_back(cmd);
+    }
+
+    std::ostringstream msg;
+    msg << "MLB assignment ues=" << ues.size() << " cells=" << cellIds.size()
+        << " slotsPerCell=" << result.slots << " minSlots=" << result.minSlots
+        << " rounds=" << result.rounds << " handovers=" << commands.size()
+        << " cost=" << result.cost << " overloadMbps=" << result.overloadMbps;
+    data->LogActionLm(m_name, msg.str());
+
+    return commands;
+}
+
+OranLmLte2LteMobilityLoadBalancing::AssignmentResult
+OranLmLte2LteMobilityLoadBalancing::Assign(const std::vector<AssignmentUe>& ues,
+                                           uint32_t numCells,
+                                           double budgetMbps)
+{
+    NS_LOG_FUNCTION(this << ues.size() << numCells << budgetMbps);
+
+    AssignmentResult result{{}, 0.0, std::numeric_limits<double>::infinity(), 0, 0, 0};
+    double totalDemandMbps = 0.0;
+    for (const auto& ue : ues)
+    {
+        totalDemandMbps += ue.demandMbps;
+    }
+    if (ues.empty() || numCells == 0 || totalDemandMbps <= 0.0)
+    {
+        return result;
+    }
+
+    // Assigning by demand under a bandwidth budget is a generalized
+    // assignment problem, which is NP-hard, so cells are given as many UE
+    // slots as UEs of average demand fit in the budget. When the whole
+    // network is over budget, the slots are raised to spread the UEs evenly.
+    const double avgDemandMbps = totalDemandMbps / ues.size();
+    result.slots =
+        std::max(static_cast<uint32_t>(std::floor(budgetMbps / avgDemandMbps)),
+                 static_cast<uint32_t>((ues.size() + numCells - 1) / numCells));
+    std::vector<uint32_t> cellSlots(numCells, result.slots);
+
+    // The demand above the budget, with UEs that could not be placed left in
+    // their serving cell, and the mean demand of the UEs of every cell.
+    std::vector<int32_t> assigned(ues.size());
+    std::vector<double> loadMbps(numCells);
+    std::vector<uint32_t> count(numCells);
+    auto overloadMbps = [&]() {
+        std::fill(loadMbps.begin(), loadMbps.end(), 0.0);
+        std::fill(count.begin(), count.end(), 0);
+        for (uint32_t i = 0; i < ues.size(); i++)
+        {
+            const int32_t cell = assigned[i] == OranMinCostAssignment::UNASSIGNED
+                                     ? static_cast<int32_t>(ues[i].serving)
+                                     : assigned[i];
+            loadMbps[cell] += ues[i].demandMbps;
+            count[cell]++;
+        }
+        double overload = 0.0;
+        for (auto load : loadMbps)
+        {
+            overload += std::max(0.0, load - budgetMbps);
+        }
+        return overload;
+    };
+
+    // Staying costs nothing, and moving costs the handover plus the RSRP lost
+    // relative to the serving cell. UEs without a serving cell measurement
+    // are kept where they are. A cell whose UEs are heavier than average can
+    // still end up over budget, so its slots are lowered to the UEs of its
+    // mean demand that fit, cells with headroom get slots for UEs of average
+    // demand that fit in it, and the assignment is solved again, as long as
+    // that lowers the demand above the budget and MaxAssignmentRounds is not
+    // reached.
+    std::vector<uint32_t> bestSlots;
+    const uint32_t maxRounds = std::min(numCells, m_maxAssignmentRounds);
+    for (uint32_t round = 0; round < maxRounds; round++)
+    {
+        m_assignment.Reset(ues.size(), cellSlots);
+        for (uint32_t i = 0; i < ues.size(); i++)
+        {
+            const AssignmentUe& ue = ues[i];
+            m_assignment.AddCandidate(i, ue.serving, 0.0);
+
+            auto serving = std::find_if(ue.rsrp.begin(), ue.rsrp.end(), [&ue](const auto& item) {
+                return item.first == ue.serving;
+            });
+            if (serving == ue.rsrp.end())
+            {
+                continue;
+            }
+            for (const auto& [cell, rsrp] : ue.rsrp)
+            {
+                const double loss = serving->second - rsrp;
+                if (cell != ue.serving && loss <= m_maxRsrpMargin)
+                {
+                    m_assignment.AddCandidate(i, cell, m_handoverCost + std::max(0.0, loss));
+                }
+            }
+        }
+        const double roundCost = m_assignment.Solve();
+        result.rounds++;
+        for (uint32_t i = 0; i < ues.size(); i++)
+        {
+            assigned[i] = m_assignment.GetAssignment(i);
+        }
+        const double roundOverload = overloadMbps();
+        if (roundOverload >= result.overloadMbps)
+        {
+            break;
+        }
+        result.overloadMbps = roundOverload;
+        result.cost = roundCost;
+        result.cells = assigned;
+        bestSlots = cellSlots;
+
+        bool lowered = false;
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            if (loadMbps[c] > budgetMbps && cellSlots[c] > 0)
+            {
+                const double meanDemandMbps = loadMbps[c] / count[c];
+                cellSlots[c] = std::min(cellSlots[c] - 1,
+                                        static_cast<uint32_t>(budgetMbps / meanDemandMbps));
+                lowered = true;
+            }
+            else if (loadMbps[c] < budgetMbps)
+            {
+                // Make room for the UEs the lowered cells no longer take.
+                cellSlots[c] = std::max(
+                    cellSlots[c],
+                    count[c] + static_cast<uint32_t>((budgetMbps - loadMbps[c]) / avgDemandMbps));
+            }
+        }
+        if (result.overloadMbps <= 0.0 || !lowered)
+        {
+            break;
+        }
+    }
+    result.minSlots = *std::min_element(bestSlots.begin(), bestSlots.end());
+
+    return result;
+}
+
+std::vector<OranSubscription>
+OranLmLte2LteMobilityLoadBalancing::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::vector<OranSubscription> subscriptions = {
+        OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                         {OranNearRtRic::LTEUE},
+                         Seconds(0)},
+        OranSubscription{OranReportLteUeAppDemand::GetTypeId(),
+                         {OranNearRtRic::LTEUE},
+                         Seconds(0)}};
+    if (m_mode == ASSIGNMENT)
+    {
+        subscriptions.push_back(OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                                                 {OranNearRtRic::LTEUE},
+                                                 Seconds(0)});
+    }
+
+    return subscriptions;
+}
+
 } // namespace ns3
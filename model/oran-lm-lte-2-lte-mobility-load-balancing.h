@@ -6,7 +6,9 @@
 #ifndef ORAN_LM_LTE_2_LTE_MOBILITY_LOAD_BALANCING_H
 #define ORAN_LM_LTE_2_LTE_MOBILITY_LOAD_BALANCING_H
 
+#include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-min-cost-assignment.h"
 
 namespace ns3
 {
@@ -14,19 +16,83 @@ namespace ns3
 class OranLmLte2LteMobilityLoadBalancing : public OranLm
 {
   public:
+    /**
+     * How load is balanced.
+     */
+    enum Mode
+    {
+        CIO = 0,   //!< Nudge the CIO of imbalanced or overloaded cells
+        ASSIGNMENT //!< Hand over the UEs of a min-cost assignment to cells
+    };
+
+    /**
+     * A UE to assign in ASSIGNMENT mode.
+     */
+    struct AssignmentUe
+    {
+        uint32_t serving;  //!< The index of the serving cell.
+        double demandMbps; //!< The demand of the UE.
+        std::vector<std::pair<uint32_t, double>> rsrp; //!< Cell indexes and RSRP.
+    };
+
+    /**
+     * The result of an assignment.
+     */
+    struct AssignmentResult
+    {
+        std::vector<int32_t> cells; //!< The cell of every UE, or UNASSIGNED.
+        double cost;                //!< The cost of the assignment.
+        double overloadMbps;        //!< The demand left above the budget.
+        uint32_t slots;             //!< The UEs every cell was first given.
+        uint32_t minSlots;          //!< The fewest UEs a cell was given.
+        uint32_t rounds;            //!< The times the assignment was solved.
+    };
+
     static TypeId GetTypeId();
     OranLmLte2LteMobilityLoadBalancing();
     ~OranLmLte2LteMobilityLoadBalancing() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
+
+    /**
+     * Assigns UEs to cells so that no cell's demand is above the budget, at
+     * the lowest RSRP and handover cost, solving the assignment again with
+     * fewer UEs in the cells left over the budget at most
+     * MaxAssignmentRounds times.
+     *
+     * \param ues The UEs.
+     * \param numCells The number of cells.
+     * \param budgetMbps The demand every cell may carry.
+     * eturn The assignment.
+     */
+    AssignmentResult Assign(const std::vector<AssignmentUe>& ues,
+                            uint32_t numCells,
+                            double budgetMbps);
 
   private:
+    /**
+     * Assigns the UEs to cells so that no cell is loaded beyond its target
+     * utilization, at the lowest RSRP and handover cost, and hands over the
+     * UEs whose cell changes.
+     *
+     * \param data The data repository.
+     * \return The handover commands.
+     */
+    std::vector<Ptr<OranCommand>> RunAssignment(Ptr<OranDataRepository> data);
+
+    Mode m_mode; //!< How load is balanced.
     double m_loadImbalanceThreshold;
     double m_cioStepDb;
     double m_maxAbsCioDb;
     double m_hotCellTttSec;
     bool m_controlTtt;
     double m_enbCapacityMbps; //!< Fixed per-eNB capacity ceiling demand is balanced against.
+    double m_targetUtilization; //!< Fraction of the capacity the assignment fills cells to.
+    double m_handoverCost;      //!< Cost of handing over a UE, in dB of RSRP.
+    double m_maxRsrpMargin;     //!< How far below its best RSRP a UE may be assigned, in dB.
+    uint32_t m_maxAssignmentRounds; //!< The most times the assignment is solved per run.
+    OranMinCostAssignment m_assignment; //!< The solver, kept to reuse its buffers.
 };
 
 } // namespace ns3
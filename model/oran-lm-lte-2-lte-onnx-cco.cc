@@ -14,8 +14,11 @@
 
 #include "oran-command-lte-2-lte-tx-power.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -61,6 +64,12 @@ OranLmLte2LteOnnxCco::GetTypeId()
                           StringValue("cco_dqn.onnx"),
                           MakeStringAccessor(&OranLmLte2LteOnnxCco::SetDqnPath),
                           MakeStringChecker())
+            .AddAttribute("NativeInference",
+                          "Whether to run the model with the built-in inference engine when it "
+                          "supports the model, instead of ONNX Runtime.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&OranLmLte2LteOnnxCco::SetNativeInference),
+                          MakeBooleanChecker())
             .AddAttribute("NominalTxPowerDbm",
                           "Believed initial PTX (dBm) for eNBs not seen yet. Should "
                           "match the scenario's initial --tx-power.",
@@ -95,7 +104,13 @@ OranLmLte2LteOnnxCco::SetDqnPath(const std::string& path)
                         << " contrib/oran/examples/ to the working directory.");
     f.close();
 
-    m_dqnSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_dqnModel.Load(path);
+}
+
+void
+OranLmLte2LteOnnxCco::SetNativeInference(bool nativeInference)
+{
+    m_dqnModel.SetNativeEnabled(nativeInference);
 }
 
 std::vector<OranLmLte2LteOnnxCco::CcoStats>
@@ -233,9 +248,10 @@ OranLmLte2LteOnnxCco::Run()
     std::sort(enbIds.begin(), enbIds.end());
 
     const std::size_t numRus = enbIds.size();
-    NS_ABORT_MSG_IF(numRus != 3,
-                    "OranLmLte2LteOnnxCco: the ONNX model was trained for exactly 3 eNBs"
-                        << " (see workspace/ml/cco_dqn/train_cco.py), got " << numRus);
+    if (numRus == 0)
+    {
+        return commands;
+    }
 
     std::vector<CcoStats> stats = GetCcoStats(data, enbIds);
 
@@ -250,40 +266,35 @@ OranLmLte2LteOnnxCco::Run()
     }
     const double avgLoad = static_cast<double>(totalUes) / numRus;
 
+    // One row per eNB, all run as one batch.
+    constexpr std::size_t kStateSize = 7;
+    std::vector<double> currentPtx(numRus);
+    std::vector<float> states(kStateSize * numRus);
+    for (std::size_t i = 0; i < numRus; ++i)
+    {
+        uint64_t enbId = enbIds[i];
+        currentPtx[i] = m_currentPtxDbm.count(enbId) ? m_currentPtxDbm[enbId]
+                                                     : m_nominalTxPowerDbm;
+
+        float* state = &states[i * kStateSize];
+        state[0] = static_cast<float>(stats[i].meanRsrpServed / 100.0);
+        state[1] = static_cast<float>(stats[i].stdRsrpServed / 20.0);
+        state[2] = static_cast<float>(stats[i].meanIfc / 100.0);
+        state[3] = static_cast<float>(stats[i].load / avgLoad);
+        state[4] = static_cast<float>((kPtxMaxDbm - currentPtx[i]) / 20.0);
+        // t/T: no bounded episode horizon at inference time, same
+        // fixed-midpoint rationale as OranLmLte2LteOnnxEnergySaving.
+        state[5] = 0.5f;
+        // The position of the cell in the network, as a fraction.
+        state[6] = static_cast<float>(i) / static_cast<float>(numRus);
+    }
+
+    const float* qAll = m_dqnModel.Run(states.data(), numRus, kStateSize).data();
+
     for (std::size_t i = 0; i < numRus; ++i)
     {
         uint64_t enbId = enbIds[i];
-        double currentPtx = m_currentPtxDbm.count(enbId) ? m_currentPtxDbm[enbId]
-                                                          : m_nominalTxPowerDbm;
-
-        std::array<float, 7> state{
-            static_cast<float>(stats[i].meanRsrpServed / 100.0),
-            static_cast<float>(stats[i].stdRsrpServed / 20.0),
-            static_cast<float>(stats[i].meanIfc / 100.0),
-            static_cast<float>(stats[i].load / avgLoad),
-            static_cast<float>((kPtxMaxDbm - currentPtx) / 20.0),
-            0.5f, // t/T: no bounded episode horizon at inference time, same
-                  // fixed-midpoint rationale as OranLmLte2LteOnnxEnergySaving.
-            static_cast<float>(i) / static_cast<float>(numRus),
-        };
-
-        std::array<int64_t, 2> shape{1, static_cast<int64_t>(state.size())};
-        Ort::Value tensor = Ort::Value::CreateTensor<float>(m_memoryInfo,
-                                                             state.data(),
-                                                             state.size(),
-                                                             shape.data(),
-                                                             shape.size());
-        const auto inputName = m_dqnSession.GetInputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> inputNames{inputName.get()};
-        const auto outputName = m_dqnSession.GetOutputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> outputNames{outputName.get()};
-        auto output = m_dqnSession.Run(Ort::RunOptions{},
-                                       inputNames.data(),
-                                       &tensor,
-                                       1,
-                                       outputNames.data(),
-                                       1);
-        const float* q = output[0].GetTensorData<float>();
+        const float* q = qAll + i * kNumPtxLevels;
 
         std::size_t bestIdx = 0;
         float bestQ = q[0];
@@ -297,24 +308,35 @@ OranLmLte2LteOnnxCco::Run()
         }
 
         double targetPtx = PtxLevel(bestIdx);
-        double delta = targetPtx - currentPtx;
+        double delta = targetPtx - currentPtx[i];
         if (std::abs(delta) < 0.01)
         {
             continue;
         }
 
-        Ptr<OranCommandLte2LteTxPower> cmd = CreateObject<OranCommandLte2LteTxPower>();
-        cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbId));
-        cmd->SetAttribute("PowerDeltaDb", DoubleValue(delta));
+        Ptr<OranCommandLte2LteTxPower> cmd = OranCommandLte2LteTxPower::Create(enbId, delta);
         data->LogCommandLm(m_name, cmd);
         commands.push_back(cmd);
         m_currentPtxDbm[enbId] = targetPtx;
 
-        NS_LOG_INFO("eNB " << enbId << ": PTX " << currentPtx << " -> " << targetPtx
+        NS_LOG_INFO("eNB " << enbId << ": PTX " << currentPtx[i] << " -> " << targetPtx
                     << " dBm (Δ=" << delta << ")");
     }
 
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteOnnxCco::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
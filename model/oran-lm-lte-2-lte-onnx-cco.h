@@ -19,6 +19,9 @@
  * workspace/ml/cco_dqn/calibrate_ptx_sweep.py); the LM tracks each eNB's
  * believed current PTX (no PHY read-back exists) and issues a
  * OranCommandLte2LteTxPower delta to reach the target.
+ *
+ * The state only describes one eNB and its neighbours' interference, so any
+ * number of eNBs is handled: the states of all of them are run as one batch.
  */
 
 #ifndef ORAN_LM_LTE_2_LTE_ONNX_CCO_H
@@ -26,8 +29,8 @@
 
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <array>
 #include <map>
 #include <vector>
@@ -43,8 +46,16 @@ class OranLmLte2LteOnnxCco : public OranLm
     ~OranLmLte2LteOnnxCco() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
     void SetDqnPath(const std::string& path);
+    /**
+     * Sets whether the model runs on the built-in inference engine when it
+     * supports the model, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
+     */
+    void SetNativeInference(bool nativeInference);
 
   private:
     /** Real per-eNB serving/interference RSRP statistics, matching the
@@ -62,10 +73,7 @@ class OranLmLte2LteOnnxCco : public OranLm
     std::vector<CcoStats> GetCcoStats(Ptr<OranDataRepository> data,
                                       const std::vector<uint64_t>& enbIds) const;
 
-    Ort::Env m_env;
-    Ort::Session m_dqnSession{nullptr};
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    OranOnnxModel m_dqnModel;
 
     double m_nominalTxPowerDbm; //!< Believed initial PTX (dBm) for eNBs not seen yet.
 
@@ -16,15 +16,21 @@
  * reports, serving or not), plus a t/T placeholder (see .cc for why this is
  * a constant at inference time). Output (2*numRUs Q-values): [Q_off(1..N),
  * Q_on(1..N)]; per-eNB argmax(Q_on, Q_off) decides sleep/wake.
+ *
+ * numRUs is the number of eNBs the model was trained for. Networks of any
+ * size are handled by giving every eNB its own input row, with its nearest
+ * neighbours pooled into the other slots (see OranCellSlots), and running
+ * the rows of all the eNBs as one batch.
  */
 
 #ifndef ORAN_LM_LTE_2_LTE_ONNX_ENERGY_SAVING_H
 #define ORAN_LM_LTE_2_LTE_ONNX_ENERGY_SAVING_H
 
+#include "oran-cell-slots.h"
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <map>
 #include <vector>
 
@@ -42,6 +48,7 @@ class OranLmLte2LteOnnxEnergySaving : public OranLm
     ~OranLmLte2LteOnnxEnergySaving() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
     /**
      * Sets the path of the trained ONNX ML model.
@@ -49,6 +56,13 @@ class OranLmLte2LteOnnxEnergySaving : public OranLm
      * @param onnxModelPath the file path of the ONNX ML model.
      */
     void SetOnnxModelPath(const std::string& onnxModelPath);
+    /**
+     * Sets whether the model runs on the built-in inference engine when it
+     * supports the model, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
+     */
+    void SetNativeInference(bool nativeInference);
 
   private:
     /**
@@ -77,10 +91,10 @@ class OranLmLte2LteOnnxEnergySaving : public OranLm
     std::vector<EnbRsrpStats> GetEnbRsrpStats(Ptr<OranDataRepository> data,
                                               const std::vector<uint64_t>& enbIds) const;
 
-    Ort::Env m_env;
-    Ort::Session m_session{nullptr};
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    OranOnnxModel m_model;
+
+    OranCellSlots m_cellSlots; //!< The eNBs in the slots of the input row of every eNB.
+    uint32_t m_neighbourCount; //!< The number of nearest neighbours in the row of a eNB.
 
     double m_nominalTxPowerDbm; //!< "Awake" TxPower (dBm); "asleep" = 0 dBm.
 
@@ -31,8 +31,12 @@
 #include "oran-lm-lte-2-lte-onnx-handover.h"
 
 #include "oran-command-lte-2-lte-handover.h"
+#include "oran-report-apploss.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-cell-info.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
@@ -57,7 +61,13 @@ OranLmLte2LteOnnxHandover::GetTypeId()
                           "The file path of the ML model.",
                           StringValue("saved_trained_classification_pytorch.onnx"),
                           MakeStringAccessor(&OranLmLte2LteOnnxHandover::SetOnnxModelPath),
-                          MakeStringChecker());
+                          MakeStringChecker())
+            .AddAttribute("NativeInference",
+                          "Whether to run the model with the built-in inference engine when it "
+                          "supports the model, instead of ONNX Runtime.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&OranLmLte2LteOnnxHandover::SetNativeInference),
+                          MakeBooleanChecker());
 
     return tid;
 }
@@ -106,7 +116,13 @@ OranLmLte2LteOnnxHandover::SetOnnxModelPath(const std::string& onnxModelPath)
                         << " can be copied from the example folder to the working directory.");
     f.close();
 
-    m_session = Ort::Session(m_env, onnxModelPath.c_str(), Ort::SessionOptions{});
+    m_model.Load(onnxModelPath);
+}
+
+void
+OranLmLte2LteOnnxHandover::SetNativeInference(bool nativeInference)
+{
+    m_model.SetNativeEnabled(nativeInference);
 }
 
 std::vector<OranLmLte2LteOnnxHandover::UeInfo>
@@ -124,7 +140,7 @@ OranLmLte2LteOnnxHandover::GetUeInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
             if (!nodePositions.empty())
             {
                 ueInfo.position = nodePositions.rbegin()->second;
@@ -159,7 +175,7 @@ OranLmLte2LteOnnxHandover::GetEnbInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(enbInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(enbInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -233,32 +249,15 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
                          std::to_string(inputv.at(9)) + ", " + std::to_string(inputv.at(10)) +
                          ", " + std::to_string(inputv.at(11)) + ", " + ")");
 
-    const auto inputShape = m_session.GetInputTypeInfo(0UL).GetTensorTypeAndShapeInfo().GetShape();
-    const auto inputTensor = Ort::Value::CreateTensor<float>(m_memoryInfo,
-                                                             inputv.data(),
-                                                             inputv.size(),
-                                                             inputShape.data(),
-                                                             inputShape.size());
-
-    const auto inputName = m_session.GetInputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> inputNames{inputName.get()};
-
-    const auto outputName = m_session.GetOutputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> outputNames{outputName.get()};
-    const auto output = m_session.Run(Ort::RunOptions{},
-                                      inputNames.data(),
-                                      &inputTensor,
-                                      1UL,
-                                      outputNames.data(),
-                                      1);
+    const std::vector<float>& output = m_model.Run(inputv);
 
     // We get 4 floats back from the network
     // each with the fitting amount for each
     // possible class.
     // We select the class from the index
     // with the highest 'fitting' value
-    const auto outputData = output[0].GetTensorData<float>();
-    const auto count = output[0].GetTensorTypeAndShapeInfo().GetElementCount();
+    const auto outputData = output.data();
+    const auto count = output.size();
     auto maxValue = *outputData;
     auto maxIndex = 0UL;
 
@@ -286,10 +285,7 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
             {
                 // Handover to cellId 2
                 Ptr<OranCommandLte2LteHandover> handoverCommand =
-                    CreateObject<OranCommandLte2LteHandover>();
-                handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(5));
-                handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                handoverCommand->SetAttribute("TargetCellId", UintegerValue(2));
+                    OranCommandLte2LteHandover::Create(5, 2, ueInfo.rnti);
                 data->LogCommandLm(m_name, handoverCommand);
                 commands.push_back(handoverCommand);
 
@@ -301,10 +297,7 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
                 {
                     // Handover to cellId 1
                     Ptr<OranCommandLte2LteHandover> handoverCommand =
-                        CreateObject<OranCommandLte2LteHandover>();
-                    handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(6));
-                    handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                    handoverCommand->SetAttribute("TargetCellId", UintegerValue(1));
+                        OranCommandLte2LteHandover::Create(6, 1, ueInfo.rnti);
                     data->LogCommandLm(m_name, handoverCommand);
                     commands.push_back(handoverCommand);
 
@@ -320,10 +313,7 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
                 {
                     // Handover to cellId 2
                     Ptr<OranCommandLte2LteHandover> handoverCommand =
-                        CreateObject<OranCommandLte2LteHandover>();
-                    handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(5));
-                    handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                    handoverCommand->SetAttribute("TargetCellId", UintegerValue(2));
+                        OranCommandLte2LteHandover::Create(5, 2, ueInfo.rnti);
                     data->LogCommandLm(m_name, handoverCommand);
                     commands.push_back(handoverCommand);
 
@@ -335,10 +325,7 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
                     {
                         // Handover to cellId 1
                         Ptr<OranCommandLte2LteHandover> handoverCommand =
-                            CreateObject<OranCommandLte2LteHandover>();
-                        handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(6));
-                        handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                        handoverCommand->SetAttribute("TargetCellId", UintegerValue(1));
+                            OranCommandLte2LteHandover::Create(6, 1, ueInfo.rnti);
                         data->LogCommandLm(m_name, handoverCommand);
                         commands.push_back(handoverCommand);
 
@@ -352,4 +339,20 @@ OranLmLte2LteOnnxHandover::GetHandoverCommands(
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteOnnxHandover::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportAppLoss::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
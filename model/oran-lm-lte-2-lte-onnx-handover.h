@@ -33,10 +33,10 @@
 
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
 #include "ns3/vector.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <vector>
 
 namespace ns3
@@ -98,30 +98,32 @@ class OranLmLte2LteOnnxHandover : public OranLm
      * @return A vector with the handover commands generated by this Logic Module.
      */
     std::vector<Ptr<OranCommand>> Run() override;
+    /**
+     * Get the Reports this Logic Module reads: the locations of the LTE UEs
+     * and eNBs, and the cell information and application loss of the LTE UEs.
+     *
+     * @return The subscriptions.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
     /**
      * Sets the path of the trainined ONNX ML model.
      *
      * @parm onnxModelPath the file path of the ONNX ML model.
      */
     void SetOnnxModelPath(const std::string& onnxModelPath);
-
-  private:
-    /**
-     * The ONNX environment variable.
-     */
-    Ort::Env m_env;
-    /**
-     * The ONNX session variable.
-     */
-    Ort::Session m_session{nullptr};
     /**
-     * The ONNX memory information variable.
+     * Sets whether the model runs on the built-in inference engine when it
+     * supports the model, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
      */
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
+    void SetNativeInference(bool nativeInference);
+
+  private:
     /**
-     * The ONNX allocator variable.
+     * The ONNX model.
      */
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    OranOnnxModel m_model;
 
     /**
      * Method to get the UE information from the repository.
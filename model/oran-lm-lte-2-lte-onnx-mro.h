@@ -27,6 +27,10 @@
  *   5. DQN head (ONNX): [mode one-hot(7), predicted next X, Y, predicted
  *      RSRP per eNB] -> target eNB index; emits a handover command if that
  *      differs from the UE's current serving cell.
+ *
+ * The DQN head takes a fixed number of candidate eNBs: the serving eNB
+ * and the nearest other ones, so that the LM runs on networks of any size.
+ * Each model is run once per Run(), on the rows of all the UEs.
  */
 
 #ifndef ORAN_LM_LTE_2_LTE_ONNX_MRO_H
@@ -34,12 +38,12 @@
 
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
 #include "ns3/channel-condition-model.h"
 #include "ns3/mobility-model.h"
 #include "ns3/vector.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <map>
 #include <vector>
 
@@ -54,12 +58,20 @@ class OranLmLte2LteOnnxMro : public OranLm
     ~OranLmLte2LteOnnxMro() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
     void SetModeClassifierPath(const std::string& path);
     void SetTrajXPath(const std::string& path);
     void SetTrajYPath(const std::string& path);
     void SetRsrpPath(const std::string& path);
     void SetDqnPath(const std::string& path);
+    /**
+     * Sets whether the models run on the built-in inference engine when it
+     * supports them, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
+     */
+    void SetNativeInference(bool nativeInference);
 
     /**
      * Wires in the shared ChannelConditionModel instance actually driving
@@ -94,20 +106,22 @@ class OranLmLte2LteOnnxMro : public OranLm
      */
     Kinematics GetKinematics(Ptr<OranDataRepository> data, uint64_t ueE2NodeId) const;
 
-    /** Runs a single-input, single-float-output ONNX session (traj_x/y, rsrp). */
-    float RunScalarSession(Ort::Session& session, const std::vector<float>& input) const;
-
-    /** Runs the mode classifier; returns the predicted mode index [0,6]. */
-    int64_t RunModeClassifier(const Kinematics& k);
-
-    Ort::Env m_env;
-    Ort::Session m_modeSession{nullptr};
-    Ort::Session m_trajXSession{nullptr};
-    Ort::Session m_trajYSession{nullptr};
-    Ort::Session m_rsrpSession{nullptr};
-    Ort::Session m_dqnSession{nullptr};
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    /**
+     * Runs a single-float-output ONNX model (traj_x/y, rsrp) on a batch of
+     * rows; returns one value per row.
+     */
+    std::vector<float> RunScalarModel(OranOnnxModel& model,
+                                      const std::vector<float>& rows,
+                                      std::size_t rowSize);
+
+    /** Runs the mode classifier on every UE; returns the mode indices [0,6]. */
+    std::vector<int64_t> RunModeClassifier(const std::vector<Kinematics>& kinematics);
+
+    OranOnnxModel m_modeModel;
+    OranOnnxModel m_trajXModel;
+    OranOnnxModel m_trajYModel;
+    OranOnnxModel m_rsrpModel;
+    OranOnnxModel m_dqnModel;
 
     /**
      * Per-UE recent position history (time-ordered), refreshed each Run()
@@ -11,11 +11,14 @@
 
 #include "oran-lm-lte-2-lte-rsrp-handover.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-lte-2-lte-handover.h"
 #include "oran-data-repository.h"
-#include "oran-lte-cell-control-state.h"
-// No need to include RIC/E2 terminator headers for this LM
-// #include "oran-near-rt-ric.h"
+#include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
+// No need to include E2 terminator headers for this LM
 // #include "oran-e2-node-terminator.h"
 // #include "oran-e2-node-terminator-lte-enb.h"
 
@@ -29,6 +32,8 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <unordered_map>
 #include <utility>
 
@@ -79,6 +84,57 @@ OranLmLte2LteRsrpHandover::OranLmLte2LteRsrpHandover(void)
 
 OranLmLte2LteRsrpHandover::~OranLmLte2LteRsrpHandover(void) = default;
 
+void
+OranLmLte2LteRsrpHandover::SaveState(std::ostream& os) const
+{
+  NS_LOG_FUNCTION(this);
+
+  // Hold-off and time-to-trigger clocks, in simulation seconds.
+  os << std::setprecision(std::numeric_limits<double>::max_digits10);
+  os << m_lastHoTime.size() << '\n';
+  for (const auto& [ueId, t] : m_lastHoTime)
+  {
+    os << ueId << ' ' << t << '\n';
+  }
+  os << m_pendingTargetSince.size() << '\n';
+  for (const auto& [ueId, pending] : m_pendingTargetSince)
+  {
+    os << ueId << ' ' << pending.first << ' ' << pending.second << '\n';
+  }
+}
+
+void
+OranLmLte2LteRsrpHandover::RestoreState(std::istream& is, Time timeShift)
+{
+  NS_LOG_FUNCTION(this << timeShift);
+
+  const double shift = timeShift.GetSeconds();
+  std::size_t n = 0;
+
+  m_lastHoTime.clear();
+  is >> n;
+  for (std::size_t i = 0; i < n && is; i++)
+  {
+    uint64_t ueId = 0;
+    double t = 0.0;
+    is >> ueId >> t;
+    m_lastHoTime[ueId] = t + shift;
+  }
+
+  m_pendingTargetSince.clear();
+  is >> n;
+  for (std::size_t i = 0; i < n && is; i++)
+  {
+    uint64_t ueId = 0;
+    uint16_t cellId = 0;
+    double since = 0.0;
+    is >> ueId >> cellId >> since;
+    m_pendingTargetSince[ueId] = std::make_pair(cellId, since + shift);
+  }
+
+  NS_ABORT_MSG_IF(is.fail(), "Malformed handover state in checkpoint for " << GetName());
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmLte2LteRsrpHandover::Run(void)
 {
@@ -119,7 +175,7 @@ OranLmLte2LteRsrpHandover::GetUeInfos(Ptr<OranDataRepository> data) const
       continue;
     }
 
-    auto nodePositions = data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+    auto nodePositions = data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
     if (nodePositions.empty())
     {
       NS_LOG_INFO("No UE position for E2 UE " << ueInfo.nodeId);
@@ -149,7 +205,7 @@ OranLmLte2LteRsrpHandover::GetEnbInfos(Ptr<OranDataRepository> data) const
       continue;
     }
 
-    auto nodePositions = data->GetNodePositions(enbInfo.nodeId, Seconds(0), Simulator::Now());
+    auto nodePositions = data->GetNodePositions(enbInfo.nodeId, Time::Min(), Simulator::Now());
     if (nodePositions.empty())
     {
       NS_LOG_INFO("No eNB position for E2 eNB " << enbInfo.nodeId);
@@ -199,6 +255,7 @@ OranLmLte2LteRsrpHandover::GetHandoverCommands(
     cellIdToEnbE2.emplace(e.cellId, e.nodeId);
 
   const double now = Simulator::Now().GetSeconds();
+  Ptr<OranCellControlStore> cellControl = m_nearRtRic->GetCellControlStore();
 
   for (const auto& ueInfo : ueInfos)
   {
@@ -227,9 +284,8 @@ OranLmLte2LteRsrpHandover::GetHandoverCommands(
                         << " has no valid eNB E2 node; suppressing HO.");
       continue;
     }
-    const OranLteCellControlParams servingParams =
-        m_enableCellControlBias ? GetLteCellControlParameters(servingE2)
-                                : OranLteCellControlParams();
+    const OranCellControlParams servingParams =
+        m_enableCellControlBias ? cellControl->Get(servingE2) : OranCellControlParams();
 
     // Pull latest RSRP/RSRQ
     auto meas = data->GetLteUeRsrpRsrq(ueInfo.nodeId);
@@ -257,7 +313,7 @@ OranLmLte2LteRsrpHandover::GetHandoverCommands(
         const uint64_t cellE2 = SafeCellIdToEnbE2(data, cellIdToEnbE2, cellId);
         if (cellE2 != 0)
         {
-          adjustedRsrp += GetLteCellControlParameters(cellE2).cioDb;
+          adjustedRsrp += cellControl->Get(cellE2).cioDb;
         }
       }
 
@@ -313,10 +369,9 @@ OranLmLte2LteRsrpHandover::GetHandoverCommands(
 
     // Build and log command
     // Address the **serving eNB** (it executes the HO to target cellId).
-    Ptr<OranCommandLte2LteHandover> cmd = CreateObject<OranCommandLte2LteHandover>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(servingE2)); // execution terminator
-    cmd->SetAttribute("TargetRnti",     UintegerValue(ueInfo.rnti));
-    cmd->SetAttribute("TargetCellId",   UintegerValue(bestCell));
+    // The serving cell's terminator executes the handover.
+    Ptr<OranCommandLte2LteHandover> cmd =
+        OranCommandLte2LteHandover::Create(servingE2, bestCell, ueInfo.rnti);
 
     data->LogCommandLm(m_name, cmd);
     commands.push_back(cmd);
@@ -337,4 +392,20 @@ OranLmLte2LteRsrpHandover::GetHandoverCommands(
   return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteRsrpHandover::GetSubscriptions(void) const
+{
+  NS_LOG_FUNCTION(this);
+
+  return {OranSubscription{OranReportLocation::GetTypeId(),
+                           {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                           Seconds(0)},
+          OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                           {OranNearRtRic::LTEUE},
+                           Seconds(0)},
+          OranSubscription{OranReportLteUeRsrpRsrq::GetTypeId(),
+                           {OranNearRtRic::LTEUE},
+                           Seconds(0)}};
+}
+
 } // namespace ns3
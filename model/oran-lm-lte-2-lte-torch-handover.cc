@@ -31,6 +31,9 @@
 #include "oran-lm-lte-2-lte-torch-handover.h"
 
 #include "oran-command-lte-2-lte-handover.h"
+#include "oran-report-apploss.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-ue-cell-info.h"
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
@@ -131,7 +134,7 @@ OranLmLte2LteTorchHandover::GetUeInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
             if (!nodePositions.empty())
             {
                 ueInfo.position = nodePositions.rbegin()->second;
@@ -166,7 +169,7 @@ OranLmLte2LteTorchHandover::GetEnbInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(enbInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(enbInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -254,10 +257,7 @@ OranLmLte2LteTorchHandover::GetHandoverCommands(
             {
                 // Handover to cellId 2
                 Ptr<OranCommandLte2LteHandover> handoverCommand =
-                    CreateObject<OranCommandLte2LteHandover>();
-                handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(5));
-                handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                handoverCommand->SetAttribute("TargetCellId", UintegerValue(2));
+                    OranCommandLte2LteHandover::Create(5, 2, ueInfo.rnti);
                 data->LogCommandLm(m_name, handoverCommand);
                 commands.push_back(handoverCommand);
 
@@ -269,10 +269,7 @@ OranLmLte2LteTorchHandover::GetHandoverCommands(
                 {
                     // Handover to cellId 1
                     Ptr<OranCommandLte2LteHandover> handoverCommand =
-                        CreateObject<OranCommandLte2LteHandover>();
-                    handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(6));
-                    handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                    handoverCommand->SetAttribute("TargetCellId", UintegerValue(1));
+                        OranCommandLte2LteHandover::Create(6, 1, ueInfo.rnti);
                     data->LogCommandLm(m_name, handoverCommand);
                     commands.push_back(handoverCommand);
 
@@ -288,10 +285,7 @@ OranLmLte2LteTorchHandover::GetHandoverCommands(
                 {
                     // Handover to cellId 2
                     Ptr<OranCommandLte2LteHandover> handoverCommand =
-                        CreateObject<OranCommandLte2LteHandover>();
-                    handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(5));
-                    handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                    handoverCommand->SetAttribute("TargetCellId", UintegerValue(2));
+                        OranCommandLte2LteHandover::Create(5, 2, ueInfo.rnti);
                     data->LogCommandLm(m_name, handoverCommand);
                     commands.push_back(handoverCommand);
 
@@ -303,10 +297,7 @@ OranLmLte2LteTorchHandover::GetHandoverCommands(
                     {
                         // Handover to cellId 1
                         Ptr<OranCommandLte2LteHandover> handoverCommand =
-                            CreateObject<OranCommandLte2LteHandover>();
-                        handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(6));
-                        handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-                        handoverCommand->SetAttribute("TargetCellId", UintegerValue(1));
+                            OranCommandLte2LteHandover::Create(6, 1, ueInfo.rnti);
                         data->LogCommandLm(m_name, handoverCommand);
                         commands.push_back(handoverCommand);
 
@@ -320,4 +311,20 @@ OranLmLte2LteTorchHandover::GetHandoverCommands(
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmLte2LteTorchHandover::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::LTEUE, OranNearRtRic::LTEENB},
+                             Seconds(0)},
+            OranSubscription{OranReportLteUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)},
+            OranSubscription{OranReportAppLoss::GetTypeId(),
+                             {OranNearRtRic::LTEUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -98,6 +98,13 @@ class OranLmLte2LteTorchHandover : public OranLm
      * @return A vector with the handover commands generated by this Logic Module.
      */
     std::vector<Ptr<OranCommand>> Run() override;
+    /**
+     * Get the Reports this Logic Module reads: the locations of the LTE UEs
+     * and eNBs, and the cell information and application loss of the LTE UEs.
+     *
+     * @return The subscriptions.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
     /**
      * Sets the path of the trainined PyTorch ML model.
      *
@@ -82,4 +82,12 @@ OranLmNoop::Run()
     return {};
 }
 
+std::vector<OranSubscription>
+OranLmNoop::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
 } // namespace ns3
@@ -73,6 +73,13 @@ class OranLmNoop : public OranLm
      * @return A vector of commands generated.
      */
     std::vector<Ptr<OranCommand>> Run() override;
+    /**
+     * Get the Reports this LM reads. This is a No Operation LM, so it
+     * subscribes to none.
+     *
+     * @return An empty vector.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
 }; // class OranLmNoop
 
 } // namespace ns3
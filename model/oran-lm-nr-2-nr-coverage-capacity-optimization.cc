@@ -5,11 +5,13 @@
  */
 #include "oran-lm-nr-2-nr-coverage-capacity-optimization.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-nr-2-nr-cell-parameter.h"
 #include "oran-command-nr-2-nr-tx-power.h"
 #include "oran-data-repository.h"
-#include "oran-nr-cell-control-state.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include "ns3/boolean.h"
 #include "ns3/double.h"
@@ -176,9 +178,8 @@ OranLmNr2NrCoverageCapacityOptimization::Run()
 
         if (lowFraction >= m_lowRsrpFractionThreshold)
         {
-            Ptr<OranCommandNr2NrTxPower> txCmd = CreateObject<OranCommandNr2NrTxPower>();
-            txCmd->SetAttribute("TargetE2NodeId", UintegerValue(e2id));
-            txCmd->SetAttribute("PowerDeltaDb",   DoubleValue(m_stepSizeDb));
+            Ptr<OranCommandNr2NrTxPower> txCmd =
+                OranCommandNr2NrTxPower::Create(e2id, m_stepSizeDb);
             data->LogCommandLm(m_name, txCmd);
             commands.push_back(txCmd);
 
@@ -194,16 +195,12 @@ OranLmNr2NrCoverageCapacityOptimization::Run()
 
         if (critFraction >= m_criticalFractionThreshold && m_retStepDeg != 0.0)
         {
-            OranNrCellControlParams cp = GetNrCellControlParameters(e2id);
+            OranCellControlParams cp = m_nearRtRic->GetCellControlStore()->Get(e2id);
             double newRet = cp.retDeg + m_retStepDeg;
             newRet = std::max(0.0, std::min(15.0, newRet));
 
             Ptr<OranCommandNr2NrCellParameter> retCmd =
-                CreateObject<OranCommandNr2NrCellParameter>();
-            retCmd->SetAttribute("TargetE2NodeId", UintegerValue(e2id));
-            retCmd->SetAttribute("ParameterName",  StringValue("RET"));
-            retCmd->SetAttribute("Value",          DoubleValue(newRet));
-            retCmd->SetAttribute("IsDelta",        BooleanValue(false));
+                OranCommandNr2NrCellParameter::Create(e2id, "RET", newRet, false);
             data->LogCommandLm(m_name, retCmd);
             commands.push_back(retCmd);
 
@@ -221,4 +218,17 @@ OranLmNr2NrCoverageCapacityOptimization::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrCoverageCapacityOptimization::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
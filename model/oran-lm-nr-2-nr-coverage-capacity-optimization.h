@@ -22,6 +22,7 @@ class OranLmNr2NrCoverageCapacityOptimization : public OranLm
     ~OranLmNr2NrCoverageCapacityOptimization() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     double   m_lowRsrpThresholdDbm;
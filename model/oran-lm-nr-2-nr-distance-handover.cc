@@ -7,6 +7,8 @@
 
 #include "oran-command-nr-2-nr-handover.h"
 #include "oran-data-repository.h"
+#include "oran-report-location.h"
+#include "oran-report-nr-ue-cell-info.h"
 
 #include "ns3/abort.h"
 #include "ns3/log.h"
@@ -81,7 +83,7 @@ OranLmNr2NrDistanceHandover::GetUeInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -116,7 +118,7 @@ OranLmNr2NrDistanceHandover::GetGnbInfos(Ptr<OranDataRepository> data) const
         if (found)
         {
             std::map<Time, Vector> nodePositions =
-                data->GetNodePositions(gnbInfo.nodeId, Seconds(0), Simulator::Now());
+                data->GetNodePositions(gnbInfo.nodeId, Time::Min(), Simulator::Now());
 
             if (!nodePositions.empty())
             {
@@ -180,10 +182,7 @@ OranLmNr2NrDistanceHandover::GetHandoverCommands(
         if (newCellId != ueInfo.cellId)
         {
             Ptr<OranCommandNr2NrHandover> handoverCommand =
-                CreateObject<OranCommandNr2NrHandover>();
-            handoverCommand->SetAttribute("TargetE2NodeId", UintegerValue(oldCellNodeId));
-            handoverCommand->SetAttribute("TargetRnti", UintegerValue(ueInfo.rnti));
-            handoverCommand->SetAttribute("TargetCellId", UintegerValue(newCellId));
+                OranCommandNr2NrHandover::Create(oldCellNodeId, newCellId, ueInfo.rnti);
             data->LogCommandLm(m_name, handoverCommand);
             commands.push_back(handoverCommand);
 
@@ -196,4 +195,17 @@ OranLmNr2NrDistanceHandover::GetHandoverCommands(
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrDistanceHandover::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::NRUE, OranNearRtRic::NRGNB},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
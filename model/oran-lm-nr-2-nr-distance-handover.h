@@ -44,6 +44,7 @@ class OranLmNr2NrDistanceHandover : public OranLm
     OranLmNr2NrDistanceHandover();
     ~OranLmNr2NrDistanceHandover() override;
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     std::vector<OranLmNr2NrDistanceHandover::UeInfo> GetUeInfos(Ptr<OranDataRepository> data) const;
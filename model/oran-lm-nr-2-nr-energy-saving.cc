@@ -12,6 +12,7 @@
 #include "oran-near-rt-ric.h"
 #include "oran-data-repository.h"
 #include "oran-command-nr-2-nr-tx-power.h"
+#include "oran-report-nr-energy-efficiency.h"
 
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -27,11 +28,6 @@ namespace ns3 {
 NS_LOG_COMPONENT_DEFINE("OranLmNr2NrEnergySaving");
 NS_OBJECT_ENSURE_REGISTERED(OranLmNr2NrEnergySaving);
 
-namespace {
-  std::unordered_map<uint64_t, double> g_prevGnbRemainingJ;
-  double g_prevTimeSec = std::numeric_limits<double>::quiet_NaN();
-}
-
 TypeId
 OranLmNr2NrEnergySaving::GetTypeId (void)
 {
@@ -58,7 +54,8 @@ OranLmNr2NrEnergySaving::GetTypeId (void)
 }
 
 OranLmNr2NrEnergySaving::OranLmNr2NrEnergySaving ()
-  : OranLm ()
+  : OranLm (),
+    m_prevTimeSec (std::numeric_limits<double>::quiet_NaN ())
 {
   NS_LOG_FUNCTION(this);
   m_name = "OranLmNr2NrEnergySaving";
@@ -69,6 +66,19 @@ OranLmNr2NrEnergySaving::~OranLmNr2NrEnergySaving ()
   NS_LOG_FUNCTION(this);
 }
 
+void
+OranLmNr2NrEnergySaving::RestoreState (std::istream& is, Time timeShift)
+{
+  NS_LOG_FUNCTION(this << timeShift);
+
+  // The LM keeps no smoothing or hold-off state, only the energy baselines
+  // of the last run. Those describe the run the checkpoint was taken from,
+  // and the restored run need not have the same energy models, so nothing
+  // is saved and the baselines re-prime on the first Run.
+  m_prevTimeSec = std::numeric_limits<double>::quiet_NaN ();
+  m_prevGnbRemainingJ.clear();
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmNr2NrEnergySaving::Run (void)
 {
@@ -86,20 +96,20 @@ OranLmNr2NrEnergySaving::Run (void)
   Ptr<OranDataRepository> repo = m_nearRtRic->Data();
   const double nowSec = Simulator::Now().GetSeconds();
 
-  const bool firstRun = !std::isfinite(g_prevTimeSec);
+  const bool firstRun = !std::isfinite(m_prevTimeSec);
   if (firstRun)
   {
-    g_prevTimeSec = nowSec;
+    m_prevTimeSec = nowSec;
     for (auto gnbId : repo->GetNrGnbE2NodeIds())
     {
-      g_prevGnbRemainingJ[gnbId] = repo->GetNrEnergyRemaining(gnbId);
+      m_prevGnbRemainingJ[gnbId] = repo->GetNrEnergyRemaining(gnbId);
     }
     NS_LOG_INFO("Energy-Saving LM warm-up complete; no commands this tick.");
     return commands;
   }
 
-  double dt = nowSec - g_prevTimeSec;
-  g_prevTimeSec = nowSec;
+  double dt = nowSec - m_prevTimeSec;
+  m_prevTimeSec = nowSec;
   if (dt <= 0.0) dt = m_lmIntervalSec;
 
   constexpr double eps = 1e-9;
@@ -107,7 +117,7 @@ OranLmNr2NrEnergySaving::Run (void)
   for (auto gnbId : repo->GetNrGnbE2NodeIds())
   {
     const double remNow  = repo->GetNrEnergyRemaining(gnbId);
-    double& remPrev      = g_prevGnbRemainingJ[gnbId];
+    double& remPrev      = m_prevGnbRemainingJ[gnbId];
     const double deltaJ  = remPrev - remNow;
     remPrev              = remNow;
 
@@ -133,9 +143,7 @@ OranLmNr2NrEnergySaving::Run (void)
       continue;
     }
 
-    Ptr<OranCommandNr2NrTxPower> cmd = CreateObject<OranCommandNr2NrTxPower>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(gnbId));
-    cmd->SetAttribute("PowerDeltaDb",   DoubleValue(deltaDb));
+    Ptr<OranCommandNr2NrTxPower> cmd = OranCommandNr2NrTxPower::Create(gnbId, deltaDb);
 
     repo->LogCommandLm(m_name, cmd);
     commands.push_back(cmd);
@@ -151,4 +159,14 @@ OranLmNr2NrEnergySaving::Run (void)
   return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrEnergySaving::GetSubscriptions (void) const
+{
+  NS_LOG_FUNCTION(this);
+
+  return {OranSubscription{OranReportNrEnergyEfficiency::GetTypeId (),
+                           {OranNearRtRic::NRGNB},
+                           Seconds (0)}};
+}
+
 } // namespace ns3
@@ -16,6 +16,9 @@
 #include "oran-lm.h"
 #include "oran-data-repository.h"
 
+#include <cstdint>
+#include <unordered_map>
+
 namespace ns3 {
 
 class OranLmNr2NrEnergySaving : public OranLm
@@ -26,11 +29,15 @@ public:
   ~OranLmNr2NrEnergySaving () override;
 
   std::vector<Ptr<OranCommand>> Run () override;
+  std::vector<OranSubscription> GetSubscriptions () const override;
+  void RestoreState (std::istream& is, Time timeShift) override;
 
 private:
   double m_targetPowerW;
   double m_stepSize;
   double m_lmIntervalSec;
+  std::unordered_map<uint64_t, double> m_prevGnbRemainingJ;
+  double m_prevTimeSec;
 };
 
 } // namespace ns3
@@ -8,13 +8,18 @@
 #include "oran-command-nr-2-nr-tx-power.h"
 #include "oran-data-repository.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
+#include "ns3/abort.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/uinteger.h"
 
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <sstream>
 #include <tuple>
@@ -80,6 +85,37 @@ OranLmNr2NrKpiPrediction::OranLmNr2NrKpiPrediction()
 
 OranLmNr2NrKpiPrediction::~OranLmNr2NrKpiPrediction() = default;
 
+void
+OranLmNr2NrKpiPrediction::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+
+    os << m_emaState.size() << '\n' << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (const auto& [e2NodeId, state] : m_emaState)
+    {
+        os << e2NodeId << ' ' << state.ema << ' ' << state.prevEma << ' ' << state.initialized
+           << ' ' << state.actionCount << '\n';
+    }
+}
+
+void
+OranLmNr2NrKpiPrediction::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+
+    std::size_t n = 0;
+    is >> n;
+    m_emaState.clear();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        uint64_t e2NodeId = 0;
+        EmaState state;
+        is >> e2NodeId >> state.ema >> state.prevEma >> state.initialized >> state.actionCount;
+        NS_ABORT_MSG_IF(is.fail(), "Malformed EMA state in checkpoint for " << GetName());
+        m_emaState[e2NodeId] = state;
+    }
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmNr2NrKpiPrediction::Run()
 {
@@ -183,9 +219,8 @@ OranLmNr2NrKpiPrediction::Run()
             NS_LOG_INFO(msg.str());
             data->LogActionLm(m_name, msg.str());
 
-            Ptr<OranCommandNr2NrTxPower> cmd = CreateObject<OranCommandNr2NrTxPower>();
-            cmd->SetAttribute("TargetE2NodeId", UintegerValue(gnbE2Id));
-            cmd->SetAttribute("PowerDeltaDb", DoubleValue(m_stepSizeDb));
+            Ptr<OranCommandNr2NrTxPower> cmd =
+                OranCommandNr2NrTxPower::Create(gnbE2Id, m_stepSizeDb);
             data->LogCommandLm(m_name, cmd);
             commands.push_back(cmd);
 
@@ -201,4 +236,17 @@ OranLmNr2NrKpiPrediction::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrKpiPrediction::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
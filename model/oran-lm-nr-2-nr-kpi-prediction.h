@@ -29,6 +29,9 @@ class OranLmNr2NrKpiPrediction : public OranLm
     ~OranLmNr2NrKpiPrediction() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
+    void SaveState(std::ostream& os) const override;
+    void RestoreState(std::istream& is, Time timeShift) override;
 
   private:
     struct EmaState
@@ -5,10 +5,12 @@
  */
 #include "oran-lm-nr-2-nr-mobility-load-balancing.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-nr-2-nr-cell-parameter.h"
 #include "oran-data-repository.h"
-#include "oran-nr-cell-control-state.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
 
 #include "ns3/boolean.h"
 #include "ns3/double.h"
@@ -34,11 +36,8 @@ namespace
 Ptr<OranCommandNr2NrCellParameter>
 CreateCellParameterCommand(uint64_t e2NodeId, const std::string& name, double value)
 {
-    Ptr<OranCommandNr2NrCellParameter> cmd = CreateObject<OranCommandNr2NrCellParameter>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(e2NodeId));
-    cmd->SetAttribute("ParameterName", StringValue(name));
-    cmd->SetAttribute("Value", DoubleValue(value));
-    cmd->SetAttribute("IsDelta", BooleanValue(false));
+    Ptr<OranCommandNr2NrCellParameter> cmd =
+        OranCommandNr2NrCellParameter::Create(e2NodeId, name, value, false);
     return cmd;
 }
 
@@ -171,7 +170,7 @@ OranLmNr2NrMobilityLoadBalancing::Run()
             continue;
         }
 
-        OranNrCellControlParams params = GetNrCellControlParameters(e2NodeId);
+        OranCellControlParams params = m_nearRtRic->GetCellControlStore()->Get(e2NodeId);
         const double direction = (normalizedError > 0.0 || overloaded) ? -1.0 : 1.0;
         const double newCio =
             std::max(-m_maxAbsCioDb,
@@ -200,4 +199,17 @@ OranLmNr2NrMobilityLoadBalancing::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrMobilityLoadBalancing::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeAppDemand::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -22,6 +22,7 @@ class OranLmNr2NrMobilityLoadBalancing : public OranLm
     ~OranLmNr2NrMobilityLoadBalancing() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     double m_loadImbalanceThreshold;
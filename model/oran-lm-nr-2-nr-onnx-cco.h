@@ -16,6 +16,9 @@
  * workspace/ml/cco_dqn/calibrate_ptx_sweep.py for the NR-recalibrated
  * range); the LM tracks each gNB's believed current PTX (no PHY read-back
  * exists) and issues an OranCommandNr2NrTxPower delta to reach the target.
+ *
+ * The state only describes one gNB and its neighbours' interference, so any
+ * number of gNBs is handled: the states of all of them are run as one batch.
  */
 
 #ifndef ORAN_LM_NR_2_NR_ONNX_CCO_H
@@ -23,8 +26,8 @@
 
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <array>
 #include <map>
 #include <vector>
@@ -40,8 +43,16 @@ class OranLmNr2NrOnnxCco : public OranLm
     ~OranLmNr2NrOnnxCco() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
     void SetDqnPath(const std::string& path);
+    /**
+     * Sets whether the model runs on the built-in inference engine when it
+     * supports the model, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
+     */
+    void SetNativeInference(bool nativeInference);
 
   private:
     /** Real per-gNB serving/interference RSRP statistics, matching the
@@ -59,10 +70,7 @@ class OranLmNr2NrOnnxCco : public OranLm
     std::vector<CcoStats> GetCcoStats(Ptr<OranDataRepository> data,
                                       const std::vector<uint64_t>& enbIds) const;
 
-    Ort::Env m_env;
-    Ort::Session m_dqnSession{nullptr};
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    OranOnnxModel m_dqnModel;
 
     double m_nominalTxPowerDbm; //!< Believed initial PTX (dBm) for gNBs not seen yet.
 
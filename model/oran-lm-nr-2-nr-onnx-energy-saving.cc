@@ -13,8 +13,11 @@
 
 #include "oran-command-nr-2-nr-tx-power.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -33,6 +36,16 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("OranLmNr2NrOnnxEnergySaving");
 NS_OBJECT_ENSURE_REGISTERED(OranLmNr2NrOnnxEnergySaving);
 
+namespace
+{
+// Fallback matches the empty-measurement case in train_es_dqn.py's
+// build_state (RMIN_DBM = -95.0), so a gNB with no visible UEs yet
+// doesn't look like a strong-signal cell to the model.
+constexpr double kNoDataRsrp = -95.0;
+// Features per gNB slot of the model input.
+constexpr std::size_t kSlotFeatures = 6;
+} // namespace
+
 TypeId
 OranLmNr2NrOnnxEnergySaving::GetTypeId()
 {
@@ -45,6 +58,19 @@ OranLmNr2NrOnnxEnergySaving::GetTypeId()
                           StringValue("es_dqn_nr.onnx"),
                           MakeStringAccessor(&OranLmNr2NrOnnxEnergySaving::SetOnnxModelPath),
                           MakeStringChecker())
+            .AddAttribute("NativeInference",
+                          "Whether to run the model with the built-in inference engine when it "
+                          "supports the model, instead of ONNX Runtime.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&OranLmNr2NrOnnxEnergySaving::SetNativeInference),
+                          MakeBooleanChecker())
+            .AddAttribute("NeighbourCount",
+                          "The number of nearest gNBs whose features fill the other gNB "
+                          "slots of the input row of a gNB, when the network does not "
+                          "have as many gNBs as the model was trained for.",
+                          UintegerValue(6),
+                          MakeUintegerAccessor(&OranLmNr2NrOnnxEnergySaving::m_neighbourCount),
+                          MakeUintegerChecker<uint32_t>())
             .AddAttribute("NominalTxPowerDbm",
                           "The 'awake' TxPower (dBm); 'asleep' gNBs are dropped to 0 dBm. "
                           "Should match the scenario's initial --tx-power.",
@@ -56,6 +82,7 @@ OranLmNr2NrOnnxEnergySaving::GetTypeId()
 }
 
 OranLmNr2NrOnnxEnergySaving::OranLmNr2NrOnnxEnergySaving()
+    : m_neighbourCount(6)
 {
     NS_LOG_FUNCTION(this);
 
@@ -78,7 +105,13 @@ OranLmNr2NrOnnxEnergySaving::SetOnnxModelPath(const std::string& onnxModelPath)
                         << " contrib/oran/examples/ to the working directory.");
     f.close();
 
-    m_session = Ort::Session(m_env, onnxModelPath.c_str(), Ort::SessionOptions{});
+    m_model.Load(onnxModelPath);
+}
+
+void
+OranLmNr2NrOnnxEnergySaving::SetNativeInference(bool nativeInference)
+{
+    m_model.SetNativeEnabled(nativeInference);
 }
 
 std::vector<OranLmNr2NrOnnxEnergySaving::EnbRsrpStats>
@@ -115,11 +148,6 @@ OranLmNr2NrOnnxEnergySaving::GetEnbRsrpStats(Ptr<OranDataRepository> data,
         }
     }
 
-    // Fallback matches the empty-measurement case in train_es_dqn.py's
-    // build_state (RMIN_DBM = -95.0), so a gNB with no visible UEs yet
-    // doesn't look like a strong-signal cell to the model.
-    constexpr double kNoDataRsrp = -95.0;
-
     std::vector<EnbRsrpStats> stats(enbIds.size());
     for (std::size_t i = 0; i < enbIds.size(); ++i)
     {
@@ -176,52 +204,62 @@ OranLmNr2NrOnnxEnergySaving::Run()
 
     std::vector<EnbRsrpStats> stats = GetEnbRsrpStats(data, enbIds);
 
-    std::vector<float> input(6 * numRus + 1);
+    std::vector<float> features(kSlotFeatures * numRus);
+    std::vector<Vector> positions(numRus);
     for (std::size_t i = 0; i < numRus; ++i)
     {
         bool awake = !m_enbAwake.count(enbIds[i]) || m_enbAwake[enbIds[i]];
-        input[i * 6 + 0] = static_cast<float>(stats[i].mean / 100.0);
-        input[i * 6 + 1] = static_cast<float>(stats[i].stdDev / 20.0);
-        input[i * 6 + 2] = static_cast<float>(stats[i].max / 100.0);
-        input[i * 6 + 3] = static_cast<float>(stats[i].min / 100.0);
-        input[i * 6 + 4] = static_cast<float>(stats[i].reachableFrac);
-        input[i * 6 + 5] = awake ? 1.0f : 0.0f;
+        float* f = &features[i * kSlotFeatures];
+        f[0] = static_cast<float>(stats[i].mean / 100.0);
+        f[1] = static_cast<float>(stats[i].stdDev / 20.0);
+        f[2] = static_cast<float>(stats[i].max / 100.0);
+        f[3] = static_cast<float>(stats[i].min / 100.0);
+        f[4] = static_cast<float>(stats[i].reachableFrac);
+        f[5] = awake ? 1.0f : 0.0f;
+
+        std::map<Time, Vector> hist =
+            data->GetNodePositions(enbIds[i], Time::Min(), Simulator::Now());
+        if (!hist.empty())
+        {
+            positions[i] = hist.rbegin()->second;
+        }
+    }
+
+    // The model takes a fixed number of gNB slots, so every gNB gets its own
+    // row with its nearest neighbours in the other slots. A slot left empty
+    // looks like an asleep gNB that no UE hears.
+    const std::size_t inputSize = m_model.GetInputSize();
+    const std::size_t numSlots = inputSize > 0 ? (inputSize - 1) / kSlotFeatures : numRus;
+    m_cellSlots.Assign(positions, numSlots, m_neighbourCount);
+    const float noData = static_cast<float>(kNoDataRsrp / 100.0);
+    const std::vector<float> empty{noData, 0.0f, noData, noData, 0.0f, 0.0f};
+
+    const std::size_t rowSize = numSlots * kSlotFeatures + 1;
+    std::vector<float> rows(rowSize * numRus);
+    for (std::size_t i = 0; i < numRus; ++i)
+    {
+        float* row = &rows[i * rowSize];
+        m_cellSlots.Pool(i, features, empty, row);
+        // t/T: training varied this over a bounded episode, but a continuously
+        // running LM has no equivalent bounded horizon, so a fixed mid-point
+        // placeholder is used here at inference time (see the LTE ONNX ES LM
+        // for the same rationale).
+        row[numSlots * kSlotFeatures] = 0.5f;
     }
-    // t/T: training varied this over a bounded episode, but a continuously
-    // running LM has no equivalent bounded horizon, so a fixed mid-point
-    // placeholder is used here at inference time (see the LTE ONNX ES LM
-    // for the same rationale).
-    input[6 * numRus] = 0.5f;
-
-    std::array<int64_t, 2> inputShape{1, static_cast<int64_t>(input.size())};
-    Ort::Value inputTensor = Ort::Value::CreateTensor<float>(m_memoryInfo,
-                                                             input.data(),
-                                                             input.size(),
-                                                             inputShape.data(),
-                                                             inputShape.size());
-
-    const auto inputName = m_session.GetInputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> inputNames{inputName.get()};
-    const auto outputName = m_session.GetOutputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> outputNames{outputName.get()};
-
-    const auto output = m_session.Run(Ort::RunOptions{},
-                                      inputNames.data(),
-                                      &inputTensor,
-                                      1UL,
-                                      outputNames.data(),
-                                      1);
-    const float* q = output[0].GetTensorData<float>();
-
-    // q layout: [Q_off(1..numRus), Q_on(1..numRus)] -- see DQN.forward() in
-    // train_es_dqn.py.
+
+    const float* q = m_model.Run(rows.data(), numRus, rowSize).data();
+
+    // q layout, per row: [Q_off(1..numSlots), Q_on(1..numSlots)] -- see
+    // DQN.forward() in train_es_dqn.py. Every gNB reads its own slot.
     std::vector<bool> wantAwake(numRus);
     std::size_t bestMarginIdx = 0;
     float bestMargin = -std::numeric_limits<float>::infinity();
     bool anyAwake = false;
     for (std::size_t i = 0; i < numRus; ++i)
     {
-        float margin = q[numRus + i] - q[i]; // Q_on - Q_off
+        const float* qRow = q + i * 2 * numSlots;
+        std::size_t slot = m_cellSlots.GetOwnSlot(i);
+        float margin = qRow[numSlots + slot] - qRow[slot]; // Q_on - Q_off
         wantAwake[i] = margin > 0.0f;
         anyAwake = anyAwake || wantAwake[i];
         if (margin > bestMargin)
@@ -245,11 +283,8 @@ OranLmNr2NrOnnxEnergySaving::Run()
             continue;
         }
 
-        Ptr<OranCommandNr2NrTxPower> cmd = CreateObject<OranCommandNr2NrTxPower>();
-        cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbId));
-        cmd->SetAttribute(
-            "PowerDeltaDb",
-            DoubleValue(wantAwake[i] ? m_nominalTxPowerDbm : -m_nominalTxPowerDbm));
+        double deltaDb = wantAwake[i] ? m_nominalTxPowerDbm : -m_nominalTxPowerDbm;
+        Ptr<OranCommandNr2NrTxPower> cmd = OranCommandNr2NrTxPower::Create(enbId, deltaDb);
         data->LogCommandLm(m_name, cmd);
         commands.push_back(cmd);
         m_enbAwake[enbId] = wantAwake[i];
@@ -261,4 +296,17 @@ OranLmNr2NrOnnxEnergySaving::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrOnnxEnergySaving::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::NRGNB},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
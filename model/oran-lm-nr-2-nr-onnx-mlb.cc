@@ -12,9 +12,11 @@
 
 #include "oran-lm-nr-2-nr-onnx-mlb.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-nr-2-nr-cell-parameter.h"
 #include "oran-near-rt-ric.h"
-#include "oran-nr-cell-control-state.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
 #include "ns3/boolean.h"
@@ -47,6 +49,12 @@ OranLmNr2NrOnnxMlb::GetTypeId()
                           StringValue("mlb_dqn_nr.onnx"),
                           MakeStringAccessor(&OranLmNr2NrOnnxMlb::SetDqnPath),
                           MakeStringChecker())
+            .AddAttribute("NativeInference",
+                          "Whether to run the model with the built-in inference engine when it "
+                          "supports the model, instead of ONNX Runtime.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&OranLmNr2NrOnnxMlb::SetNativeInference),
+                          MakeBooleanChecker())
             .AddAttribute("CioStep",
                           "CIO adjustment step in dB.",
                           DoubleValue(1.0),
@@ -93,7 +101,13 @@ OranLmNr2NrOnnxMlb::SetDqnPath(const std::string& path)
                         << " contrib/oran/examples/ to the working directory.");
     f.close();
 
-    m_dqnSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_dqnModel.Load(path);
+}
+
+void
+OranLmNr2NrOnnxMlb::SetNativeInference(bool nativeInference)
+{
+    m_dqnModel.SetNativeEnabled(nativeInference);
 }
 
 double
@@ -210,23 +224,7 @@ OranLmNr2NrOnnxMlb::Run()
         // fixed-midpoint rationale as OranLmNr2NrOnnxEnergySaving.
         state[2 * numRus + 1] = 0.5f;
 
-        std::array<int64_t, 2> shape{1, static_cast<int64_t>(state.size())};
-        Ort::Value tensor = Ort::Value::CreateTensor<float>(m_memoryInfo,
-                                                             state.data(),
-                                                             state.size(),
-                                                             shape.data(),
-                                                             shape.size());
-        const auto inputName = m_dqnSession.GetInputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> inputNames{inputName.get()};
-        const auto outputName = m_dqnSession.GetOutputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> outputNames{outputName.get()};
-        auto output = m_dqnSession.Run(Ort::RunOptions{},
-                                       inputNames.data(),
-                                       &tensor,
-                                       1,
-                                       outputNames.data(),
-                                       1);
-        const float* q = output[0].GetTensorData<float>();
+        const float* q = m_dqnModel.Run(state.data(), 1, state.size()).data();
 
         std::size_t best = 0;
         float bestQ = q[0];
@@ -254,16 +252,13 @@ OranLmNr2NrOnnxMlb::Run()
         }
 
         uint64_t enbId = enbIds[i];
-        OranNrCellControlParams params = GetNrCellControlParameters(enbId);
+        OranCellControlParams params = m_nearRtRic->GetCellControlStore()->Get(enbId);
         double direction = normalizedVoteError > 0.0 ? 1.0 : -1.0;
         double newCio = std::max(-m_maxAbsCioDb,
                                  std::min(m_maxAbsCioDb, params.cioDb + direction * m_cioStepDb));
 
-        Ptr<OranCommandNr2NrCellParameter> cmd = CreateObject<OranCommandNr2NrCellParameter>();
-        cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbId));
-        cmd->SetAttribute("ParameterName", StringValue("CIO"));
-        cmd->SetAttribute("Value", DoubleValue(newCio));
-        cmd->SetAttribute("IsDelta", BooleanValue(false));
+        Ptr<OranCommandNr2NrCellParameter> cmd =
+            OranCommandNr2NrCellParameter::Create(enbId, "CIO", newCio, false);
         data->LogCommandLm(m_name, cmd);
         commands.push_back(cmd);
 
@@ -274,4 +269,17 @@ OranLmNr2NrOnnxMlb::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrOnnxMlb::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -25,8 +25,8 @@
 
 #include "oran-data-repository.h"
 #include "oran-lm.h"
+#include "oran-onnx-model.h"
 
-#include <onnxruntime_cxx_api.h>
 #include <map>
 #include <vector>
 
@@ -41,8 +41,16 @@ class OranLmNr2NrOnnxMlb : public OranLm
     ~OranLmNr2NrOnnxMlb() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
     void SetDqnPath(const std::string& path);
+    /**
+     * Sets whether the model runs on the built-in inference engine when it
+     * supports the model, instead of ONNX Runtime.
+     *
+     * @param nativeInference True to use the built-in engine when possible.
+     */
+    void SetNativeInference(bool nativeInference);
 
   private:
     /**
@@ -54,10 +62,7 @@ class OranLmNr2NrOnnxMlb : public OranLm
      */
     static double SyntheticDemand(uint64_t ueE2NodeId);
 
-    Ort::Env m_env;
-    Ort::Session m_dqnSession{nullptr};
-    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
-    Ort::AllocatorWithDefaultOptions m_allocator;
+    OranOnnxModel m_dqnModel;
 
     double m_cioStepDb;              //!< CIO adjustment step in dB.
     double m_maxAbsCioDb;             //!< Absolute CIO clamp in dB.
@@ -14,8 +14,11 @@
 
 #include "oran-command-nr-2-nr-handover.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-nr-ue-cell-info.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
@@ -26,6 +29,7 @@
 #include <array>
 #include <cmath>
 #include <fstream>
+#include <limits>
 
 namespace ns3
 {
@@ -36,6 +40,8 @@ NS_OBJECT_ENSURE_REGISTERED(OranLmNr2NrOnnxMro);
 namespace
 {
 constexpr std::size_t kNumModes = 7; // PED, CYCLIST, CAR, BUS, TRAIN, DRONE, UAV
+// Predicted RSRP (dBm) given to the DQN head for a candidate slot with no gNB.
+constexpr double kNoCandidateRsrp = -140.0;
 } // namespace
 
 TypeId
@@ -70,6 +76,12 @@ OranLmNr2NrOnnxMro::GetTypeId()
                           StringValue("mro_dqn_nr.onnx"),
                           MakeStringAccessor(&OranLmNr2NrOnnxMro::SetDqnPath),
                           MakeStringChecker())
+            .AddAttribute("NativeInference",
+                          "Whether to run the models with the built-in inference engine when it "
+                          "supports them, instead of ONNX Runtime.",
+                          BooleanValue(true),
+                          MakeBooleanAccessor(&OranLmNr2NrOnnxMro::SetNativeInference),
+                          MakeBooleanChecker())
             .AddAttribute("HandoverHoldoffSec",
                           "Minimum time between consecutive handover commands for the same "
                           "UE, to let NrGnbRrc's state machine settle (see the member "
@@ -111,35 +123,45 @@ void
 OranLmNr2NrOnnxMro::SetModeClassifierPath(const std::string& path)
 {
     CheckOnnxFile(path);
-    m_modeSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_modeModel.Load(path);
 }
 
 void
 OranLmNr2NrOnnxMro::SetTrajXPath(const std::string& path)
 {
     CheckOnnxFile(path);
-    m_trajXSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_trajXModel.Load(path);
 }
 
 void
 OranLmNr2NrOnnxMro::SetTrajYPath(const std::string& path)
 {
     CheckOnnxFile(path);
-    m_trajYSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_trajYModel.Load(path);
 }
 
 void
 OranLmNr2NrOnnxMro::SetRsrpPath(const std::string& path)
 {
     CheckOnnxFile(path);
-    m_rsrpSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_rsrpModel.Load(path);
 }
 
 void
 OranLmNr2NrOnnxMro::SetDqnPath(const std::string& path)
 {
     CheckOnnxFile(path);
-    m_dqnSession = Ort::Session(m_env, path.c_str(), Ort::SessionOptions{});
+    m_dqnModel.Load(path);
+}
+
+void
+OranLmNr2NrOnnxMro::SetNativeInference(bool nativeInference)
+{
+    m_modeModel.SetNativeEnabled(nativeInference);
+    m_trajXModel.SetNativeEnabled(nativeInference);
+    m_trajYModel.SetNativeEnabled(nativeInference);
+    m_rsrpModel.SetNativeEnabled(nativeInference);
+    m_dqnModel.SetNativeEnabled(nativeInference);
 }
 
 void
@@ -166,9 +188,10 @@ OranLmNr2NrOnnxMro::GetKinematics(Ptr<OranDataRepository> data, uint64_t ueE2Nod
     Kinematics k;
 
     // maxEntries defaults to 1 (latest-only) -- explicitly ask for enough
-    // history to finite-difference through jerk (needs 4 samples).
+    // history to finite-difference through jerk (needs 4 samples). History
+    // restored from a checkpoint may predate t=0, so there is no lower bound.
     std::map<Time, Vector> history =
-        data->GetNodePositions(ueE2NodeId, Seconds(0), Simulator::Now(), 8);
+        data->GetNodePositions(ueE2NodeId, Time::Min(), Simulator::Now(), 8);
     if (history.size() < 4)
     {
         return k; // cold start: not enough samples yet, valid stays false
@@ -222,43 +245,38 @@ OranLmNr2NrOnnxMro::GetKinematics(Ptr<OranDataRepository> data, uint64_t ueE2Nod
     return k;
 }
 
-float
-OranLmNr2NrOnnxMro::RunScalarSession(Ort::Session& session, const std::vector<float>& input) const
+std::vector<float>
+OranLmNr2NrOnnxMro::RunScalarModel(OranOnnxModel& model,
+                                   const std::vector<float>& rows,
+                                   std::size_t rowSize)
 {
-    std::array<int64_t, 2> shape{1, static_cast<int64_t>(input.size())};
-    Ort::Value tensor = Ort::Value::CreateTensor<float>(
-        m_memoryInfo, const_cast<float*>(input.data()), input.size(), shape.data(), shape.size());
-
-    const auto inputName = session.GetInputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> inputNames{inputName.get()};
-    const auto outputName = session.GetOutputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> outputNames{outputName.get()};
-
-    auto output = session.Run(Ort::RunOptions{}, inputNames.data(), &tensor, 1, outputNames.data(), 1);
-    return output[0].GetTensorData<float>()[0];
+    return model.Run(rows.data(), rows.size() / rowSize, rowSize);
 }
 
-int64_t
-OranLmNr2NrOnnxMro::RunModeClassifier(const Kinematics& k)
+std::vector<int64_t>
+OranLmNr2NrOnnxMro::RunModeClassifier(const std::vector<Kinematics>& kinematics)
 {
-    std::vector<float> input{static_cast<float>(k.velocity),
-                             static_cast<float>(k.accel),
-                             static_cast<float>(k.jerk),
-                             static_cast<float>(k.bearingRate)};
-    std::array<int64_t, 2> shape{1, static_cast<int64_t>(input.size())};
-    Ort::Value tensor = Ort::Value::CreateTensor<float>(
-        m_memoryInfo, input.data(), input.size(), shape.data(), shape.size());
-
-    const auto inputName = m_modeSession.GetInputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> inputNames{inputName.get()};
-    // Request only "output_label" (index 0) -- the classifier's other output
+    std::vector<float> rows;
+    rows.reserve(4 * kinematics.size());
+    for (const auto& k : kinematics)
+    {
+        rows.insert(rows.end(),
+                    {static_cast<float>(k.velocity),
+                     static_cast<float>(k.accel),
+                     static_cast<float>(k.jerk),
+                     static_cast<float>(k.bearingRate)});
+    }
+    // Only "output_label" (output 0) is read -- the classifier's other output
     // (output_probability) is a seq(map(int64,float)), not needed here.
-    const auto outputName = m_modeSession.GetOutputNameAllocated(0UL, m_allocator);
-    std::array<const char*, 1> outputNames{outputName.get()};
-
-    auto output =
-        m_modeSession.Run(Ort::RunOptions{}, inputNames.data(), &tensor, 1, outputNames.data(), 1);
-    return output[0].GetTensorData<int64_t>()[0];
+    const std::vector<float>& labels = m_modeModel.Run(rows.data(), kinematics.size(), 4);
+    std::vector<int64_t> modes(kinematics.size());
+    for (std::size_t u = 0; u < modes.size(); ++u)
+    {
+        modes[u] = std::clamp<int64_t>(static_cast<int64_t>(labels[u]),
+                                       0,
+                                       static_cast<int64_t>(kNumModes) - 1);
+    }
+    return modes;
 }
 
 std::vector<Ptr<OranCommand>>
@@ -284,13 +302,13 @@ OranLmNr2NrOnnxMro::Run()
         return commands;
     }
 
-    // gNB positions and cellId<->enbId lookups (built once per Run()).
+    // gNB positions and cellId<->index lookups (built once per Run()).
     std::vector<Vector> enbPos(numRus);
-    std::map<uint16_t, uint64_t> cellIdToEnbId;
+    std::map<uint16_t, std::size_t> cellIdToIdx;
     for (std::size_t i = 0; i < numRus; ++i)
     {
         std::map<Time, Vector> hist =
-            data->GetNodePositions(enbIds[i], Seconds(0), Simulator::Now());
+            data->GetNodePositions(enbIds[i], Time::Min(), Simulator::Now());
         NS_ABORT_MSG_IF(hist.empty(), "OranLmNr2NrOnnxMro: no position for gNB " << enbIds[i]);
         enbPos[i] = hist.rbegin()->second;
 
@@ -299,10 +317,23 @@ OranLmNr2NrOnnxMro::Run()
         std::tie(found, cellId) = data->GetNrGnbCellInfo(enbIds[i]);
         if (found)
         {
-            cellIdToEnbId[cellId] = enbIds[i];
+            cellIdToIdx[cellId] = i;
         }
     }
 
+    // The DQN head was trained on a fixed number of gNBs. Each UE is given
+    // as many candidates: its serving gNB and the nearest other ones, in BS
+    // order, so that a network with that many gNBs gets the trained layout.
+    // Candidate slots a smaller network cannot fill are never chosen.
+    const std::size_t dqnInputSize = m_dqnModel.GetInputSize();
+    const std::size_t numSlots =
+        dqnInputSize > kNumModes + 2 ? dqnInputSize - kNumModes - 2 : numRus;
+    constexpr std::size_t kNoCandidate = std::numeric_limits<std::size_t>::max();
+
+    std::vector<uint64_t> ueIds;
+    std::vector<uint16_t> rntis;
+    std::vector<std::size_t> servingIdx;
+    std::vector<Kinematics> kinematics;
     for (auto ueId : data->GetNrUeE2NodeIds())
     {
         Kinematics k = GetKinematics(data, ueId);
@@ -319,27 +350,75 @@ OranLmNr2NrOnnxMro::Run()
         {
             continue;
         }
+        auto servingIt = cellIdToIdx.find(servingCellId);
+        if (servingIt == cellIdToIdx.end())
+        {
+            continue; // serving cell isn't one of our known gNBs (shouldn't happen)
+        }
+
+        ueIds.push_back(ueId);
+        rntis.push_back(rnti);
+        servingIdx.push_back(servingIt->second);
+        kinematics.push_back(k);
+    }
+    const std::size_t numUes = ueIds.size();
+    if (numUes == 0)
+    {
+        return commands;
+    }
+
+    // Every model below is run once, on the rows of all the UEs.
+    std::vector<int64_t> modes = RunModeClassifier(kinematics);
 
-        int64_t modeIdx = RunModeClassifier(k);
-        modeIdx = std::clamp<int64_t>(modeIdx, 0, static_cast<int64_t>(kNumModes) - 1);
-
-        std::vector<float> trajInput{static_cast<float>(k.velocity),
-                                     static_cast<float>(k.accel),
-                                     static_cast<float>(modeIdx),
-                                     static_cast<float>(k.currentPos.x),
-                                     static_cast<float>(k.currentPos.y),
-                                     static_cast<float>(k.bearingRate)};
-        float predX = RunScalarSession(m_trajXSession, trajInput);
-        float predY = RunScalarSession(m_trajYSession, trajInput);
-
-        std::vector<float> state(kNumModes + 2 + numRus, 0.0f);
-        state[modeIdx] = 1.0f;
-        state[kNumModes] = predX / 200.0f;
-        state[kNumModes + 1] = predY / 200.0f;
+    std::vector<float> trajRows;
+    trajRows.reserve(6 * numUes);
+    for (std::size_t u = 0; u < numUes; ++u)
+    {
+        const Kinematics& k = kinematics[u];
+        trajRows.insert(trajRows.end(),
+                        {static_cast<float>(k.velocity),
+                         static_cast<float>(k.accel),
+                         static_cast<float>(modes[u]),
+                         static_cast<float>(k.currentPos.x),
+                         static_cast<float>(k.currentPos.y),
+                         static_cast<float>(k.bearingRate)});
+    }
+    std::vector<float> predX = RunScalarModel(m_trajXModel, trajRows, 6);
+    std::vector<float> predY = RunScalarModel(m_trajYModel, trajRows, 6);
+
+    std::vector<std::size_t> candidates(numUes * numSlots, kNoCandidate);
+    std::vector<float> rsrpRows;
+    std::vector<std::pair<double, std::size_t>> others;
+    for (std::size_t u = 0; u < numUes; ++u)
+    {
+        const Kinematics& k = kinematics[u];
+        auto dist = [&k, &enbPos](std::size_t i) {
+            return std::sqrt(std::pow(k.currentPos.x - enbPos[i].x, 2) +
+                             std::pow(k.currentPos.y - enbPos[i].y, 2));
+        };
+
+        others.clear();
         for (std::size_t i = 0; i < numRus; ++i)
         {
-            double dist = std::sqrt(std::pow(k.currentPos.x - enbPos[i].x, 2) +
-                                    std::pow(k.currentPos.y - enbPos[i].y, 2));
+            if (i != servingIdx[u])
+            {
+                others.emplace_back(dist(i), i);
+            }
+        }
+        std::size_t count = std::min(numSlots - 1, others.size());
+        std::partial_sort(others.begin(), others.begin() + count, others.end());
+
+        std::size_t* ueCandidates = &candidates[u * numSlots];
+        ueCandidates[0] = servingIdx[u];
+        for (std::size_t c = 0; c < count; ++c)
+        {
+            ueCandidates[c + 1] = others[c].second;
+        }
+        std::sort(ueCandidates, ueCandidates + count + 1);
+
+        for (std::size_t c = 0; c <= count; ++c)
+        {
+            std::size_t i = ueCandidates[c];
 
             // Real LOS/NLOS state from the same ChannelConditionModel driving the
             // actual downlink channel -- not a hidden variable to the regressor
@@ -347,7 +426,7 @@ OranLmNr2NrOnnxMro::Run()
             // or mobility references were never wired in from the example.
             float isLos = 1.0f;
             auto enbMobIt = m_enbMobility.find(enbIds[i]);
-            auto ueMobIt = m_ueMobility.find(ueId);
+            auto ueMobIt = m_ueMobility.find(ueIds[u]);
             if (m_channelConditionModel && enbMobIt != m_enbMobility.end() &&
                 ueMobIt != m_ueMobility.end())
             {
@@ -356,55 +435,62 @@ OranLmNr2NrOnnxMro::Run()
                 isLos = cond->IsLos() ? 1.0f : 0.0f;
             }
 
-            std::vector<float> rsrpInput{static_cast<float>(k.velocity),
-                                         static_cast<float>(k.accel),
-                                         static_cast<float>(dist),
-                                         static_cast<float>(modeIdx),
-                                         isLos};
-            float predRsrp = RunScalarSession(m_rsrpSession, rsrpInput);
-            state[kNumModes + 2 + i] = predRsrp / 100.0f;
+            rsrpRows.insert(rsrpRows.end(),
+                            {static_cast<float>(k.velocity),
+                             static_cast<float>(k.accel),
+                             static_cast<float>(dist(i)),
+                             static_cast<float>(modes[u]),
+                             isLos});
+        }
+    }
+    std::vector<float> predRsrp = RunScalarModel(m_rsrpModel, rsrpRows, 5);
+
+    const std::size_t stateSize = kNumModes + 2 + numSlots;
+    std::vector<float> states(numUes * stateSize, 0.0f);
+    std::size_t rsrpRow = 0;
+    for (std::size_t u = 0; u < numUes; ++u)
+    {
+        float* state = &states[u * stateSize];
+        state[modes[u]] = 1.0f;
+        state[kNumModes] = predX[u] / 200.0f;
+        state[kNumModes + 1] = predY[u] / 200.0f;
+        for (std::size_t c = 0; c < numSlots; ++c)
+        {
+            state[kNumModes + 2 + c] = candidates[u * numSlots + c] != kNoCandidate
+                                           ? predRsrp[rsrpRow++] / 100.0f
+                                           : static_cast<float>(kNoCandidateRsrp / 100.0);
         }
+    }
+    const float* qAll = m_dqnModel.Run(states.data(), numUes, stateSize).data();
 
-        std::array<int64_t, 2> dqnShape{1, static_cast<int64_t>(state.size())};
-        Ort::Value dqnTensor = Ort::Value::CreateTensor<float>(
-            m_memoryInfo, state.data(), state.size(), dqnShape.data(), dqnShape.size());
-        const auto dqnInputName = m_dqnSession.GetInputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> dqnInputNames{dqnInputName.get()};
-        const auto dqnOutputName = m_dqnSession.GetOutputNameAllocated(0UL, m_allocator);
-        std::array<const char*, 1> dqnOutputNames{dqnOutputName.get()};
-        auto dqnOutput = m_dqnSession.Run(Ort::RunOptions{},
-                                          dqnInputNames.data(),
-                                          &dqnTensor,
-                                          1,
-                                          dqnOutputNames.data(),
-                                          1);
-        const float* q = dqnOutput[0].GetTensorData<float>();
-        std::size_t targetIdx = 0;
+    for (std::size_t u = 0; u < numUes; ++u)
+    {
+        const float* q = qAll + u * numSlots;
+        const std::size_t* ueCandidates = &candidates[u * numSlots];
+        std::size_t targetIdx = ueCandidates[0];
         float bestQ = q[0];
-        for (std::size_t i = 1; i < numRus; ++i)
+        for (std::size_t c = 1; c < numSlots && ueCandidates[c] != kNoCandidate; ++c)
         {
-            if (q[i] > bestQ)
+            if (q[c] > bestQ)
             {
-                bestQ = q[i];
-                targetIdx = i;
+                bestQ = q[c];
+                targetIdx = ueCandidates[c];
             }
         }
-
-        bool foundTargetCell;
-        uint16_t targetCellId;
-        std::tie(foundTargetCell, targetCellId) = data->GetNrGnbCellInfo(enbIds[targetIdx]);
-        if (!foundTargetCell || targetCellId == servingCellId)
+        if (targetIdx == servingIdx[u])
         {
             continue; // no change needed
         }
 
-        auto servingIt = cellIdToEnbId.find(servingCellId);
-        if (servingIt == cellIdToEnbId.end())
+        bool foundTargetCell;
+        uint16_t targetCellId;
+        std::tie(foundTargetCell, targetCellId) = data->GetNrGnbCellInfo(enbIds[targetIdx]);
+        if (!foundTargetCell)
         {
-            continue; // serving cell isn't one of our known gNBs (shouldn't happen)
+            continue;
         }
 
-        auto lastHoIt = m_lastHandoverTime.find(ueId);
+        auto lastHoIt = m_lastHandoverTime.find(ueIds[u]);
         if (lastHoIt != m_lastHandoverTime.end() &&
             (Simulator::Now() - lastHoIt->second).GetSeconds() < m_handoverHoldoffSec)
         {
@@ -414,16 +500,27 @@ OranLmNr2NrOnnxMro::Run()
             continue;
         }
 
-        Ptr<OranCommandNr2NrHandover> cmd = CreateObject<OranCommandNr2NrHandover>();
-        cmd->SetAttribute("TargetE2NodeId", UintegerValue(servingIt->second));
-        cmd->SetAttribute("TargetRnti", UintegerValue(rnti));
-        cmd->SetAttribute("TargetCellId", UintegerValue(targetCellId));
+        Ptr<OranCommandNr2NrHandover> cmd =
+            OranCommandNr2NrHandover::Create(enbIds[servingIdx[u]], targetCellId, rntis[u]);
         data->LogCommandLm(m_name, cmd);
-        m_lastHandoverTime[ueId] = Simulator::Now();
+        m_lastHandoverTime[ueIds[u]] = Simulator::Now();
         commands.push_back(cmd);
     }
 
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrOnnxMro::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReportLocation::GetTypeId(),
+                             {OranNearRtRic::NRUE, OranNearRtRic::NRGNB},
+                             Seconds(0)},
+            OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                             {OranNearRtRic::NRUE},
+                             Seconds(0)}};
+}
+
 } // namespace ns3
@@ -9,9 +9,13 @@
 
 #include "oran-lm-nr-2-nr-rsrp-handover.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-command-nr-2-nr-handover.h"
 #include "oran-data-repository.h"
-#include "oran-nr-cell-control-state.h"
+#include "oran-near-rt-ric.h"
+#include "oran-report-location.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include <ns3/abort.h>
 #include <ns3/boolean.h>
@@ -23,6 +27,8 @@
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
+#include <iomanip>
+#include <limits>
 #include <unordered_map>
 #include <utility>
 
@@ -73,6 +79,57 @@ OranLmNr2NrRsrpHandover::OranLmNr2NrRsrpHandover(void)
 
 OranLmNr2NrRsrpHandover::~OranLmNr2NrRsrpHandover(void) = default;
 
+void
+OranLmNr2NrRsrpHandover::SaveState(std::ostream& os) const
+{
+  NS_LOG_FUNCTION(this);
+
+  // Hold-off and time-to-trigger clocks, in simulation seconds.
+  os << std::setprecision(std::numeric_limits<double>::max_digits10);
+  os << m_lastHoTime.size() << '\n';
+  for (const auto& [ueId, t] : m_lastHoTime)
+  {
+    os << ueId << ' ' << t << '\n';
+  }
+  os << m_pendingTargetSince.size() << '\n';
+  for (const auto& [ueId, pending] : m_pendingTargetSince)
+  {
+    os << ueId << ' ' << pending.first << ' ' << pending.second << '\n';
+  }
+}
+
+void
+OranLmNr2NrRsrpHandover::RestoreState(std::istream& is, Time timeShift)
+{
+  NS_LOG_FUNCTION(this << timeShift);
+
+  const double shift = timeShift.GetSeconds();
+  std::size_t n = 0;
+
+  m_lastHoTime.clear();
+  is >> n;
+  for (std::size_t i = 0; i < n && is; i++)
+  {
+    uint64_t ueId = 0;
+    double t = 0.0;
+    is >> ueId >> t;
+    m_lastHoTime[ueId] = t + shift;
+  }
+
+  m_pendingTargetSince.clear();
+  is >> n;
+  for (std::size_t i = 0; i < n && is; i++)
+  {
+    uint64_t ueId = 0;
+    uint16_t cellId = 0;
+    double since = 0.0;
+    is >> ueId >> cellId >> since;
+    m_pendingTargetSince[ueId] = std::make_pair(cellId, since + shift);
+  }
+
+  NS_ABORT_MSG_IF(is.fail(), "Malformed handover state in checkpoint for " << GetName());
+}
+
 std::vector<Ptr<OranCommand>>
 OranLmNr2NrRsrpHandover::Run(void)
 {
@@ -113,7 +170,7 @@ OranLmNr2NrRsrpHandover::GetUeInfos(Ptr<OranDataRepository> data) const
       continue;
     }
 
-    auto nodePositions = data->GetNodePositions(ueInfo.nodeId, Seconds(0), Simulator::Now());
+    auto nodePositions = data->GetNodePositions(ueInfo.nodeId, Time::Min(), Simulator::Now());
     if (nodePositions.empty())
     {
       NS_LOG_INFO("No UE position for E2 UE " << ueInfo.nodeId);
@@ -143,7 +200,7 @@ OranLmNr2NrRsrpHandover::GetGnbInfos(Ptr<OranDataRepository> data) const
       continue;
     }
 
-    auto nodePositions = data->GetNodePositions(gnbInfo.nodeId, Seconds(0), Simulator::Now());
+    auto nodePositions = data->GetNodePositions(gnbInfo.nodeId, Time::Min(), Simulator::Now());
     if (nodePositions.empty())
     {
       NS_LOG_INFO("No gNB position for E2 gNB " << gnbInfo.nodeId);
@@ -191,6 +248,7 @@ OranLmNr2NrRsrpHandover::GetHandoverCommands(
     cellIdToGnbE2.emplace(e.cellId, e.nodeId);
 
   const double now = Simulator::Now().GetSeconds();
+  Ptr<OranCellControlStore> cellControl = m_nearRtRic->GetCellControlStore();
 
   for (const auto& ueInfo : ueInfos)
   {
@@ -215,9 +273,8 @@ OranLmNr2NrRsrpHandover::GetHandoverCommands(
                         << " has no valid gNB E2 node; suppressing HO.");
       continue;
     }
-    const OranNrCellControlParams servingParams =
-        m_enableCellControlBias ? GetNrCellControlParameters(servingE2)
-                                : OranNrCellControlParams();
+    const OranCellControlParams servingParams =
+        m_enableCellControlBias ? cellControl->Get(servingE2) : OranCellControlParams();
 
     auto meas = data->GetNrUeRsrpRsrq(ueInfo.nodeId);
     if (meas.empty())
@@ -243,7 +300,7 @@ OranLmNr2NrRsrpHandover::GetHandoverCommands(
         const uint64_t cellE2 = SafeCellIdToGnbE2(data, cellIdToGnbE2, cellId);
         if (cellE2 != 0)
         {
-          adjustedRsrp += GetNrCellControlParameters(cellE2).cioDb;
+          adjustedRsrp += cellControl->Get(cellE2).cioDb;
         }
       }
 
@@ -294,10 +351,8 @@ OranLmNr2NrRsrpHandover::GetHandoverCommands(
       continue;
     }
 
-    Ptr<OranCommandNr2NrHandover> cmd = CreateObject<OranCommandNr2NrHandover>();
-    cmd->SetAttribute("TargetE2NodeId", UintegerValue(servingE2));
-    cmd->SetAttribute("TargetRnti",     UintegerValue(ueInfo.rnti));
-    cmd->SetAttribute("TargetCellId",   UintegerValue(bestCell));
+    Ptr<OranCommandNr2NrHandover> cmd =
+        OranCommandNr2NrHandover::Create(servingE2, bestCell, ueInfo.rnti);
 
     data->LogCommandLm(m_name, cmd);
     commands.push_back(cmd);
@@ -318,4 +373,20 @@ OranLmNr2NrRsrpHandover::GetHandoverCommands(
   return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrRsrpHandover::GetSubscriptions(void) const
+{
+  NS_LOG_FUNCTION(this);
+
+  return {OranSubscription{OranReportLocation::GetTypeId(),
+                           {OranNearRtRic::NRUE, OranNearRtRic::NRGNB},
+                           Seconds(0)},
+          OranSubscription{OranReportNrUeCellInfo::GetTypeId(),
+                           {OranNearRtRic::NRUE},
+                           Seconds(0)},
+          OranSubscription{OranReportNrUeRsrpRsrq::GetTypeId(),
+                           {OranNearRtRic::NRUE},
+                           Seconds(0)}};
+}
+
 } // namespace ns3
@@ -48,6 +48,9 @@ class OranLmNr2NrRsrpHandover : public OranLm
     ~OranLmNr2NrRsrpHandover (void) override;
 
     std::vector<Ptr<OranCommand>> Run (void) override;
+    std::vector<OranSubscription> GetSubscriptions (void) const override;
+    void SaveState (std::ostream& os) const override;
+    void RestoreState (std::istream& is, Time timeShift) override;
 
   private:
     std::vector<UeInfo>  GetUeInfos  (Ptr<OranDataRepository> data) const;
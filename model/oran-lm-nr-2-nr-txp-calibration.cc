@@ -110,9 +110,7 @@ OranLmNr2NrTxpCalibration::Run()
         double targetDbm = goHigh ? m_highDbm : m_lowDbm;
         double delta = targetDbm - m_believedDbm[enbId];
 
-        Ptr<OranCommandNr2NrTxPower> cmd = CreateObject<OranCommandNr2NrTxPower>();
-        cmd->SetAttribute("TargetE2NodeId", UintegerValue(enbId));
-        cmd->SetAttribute("PowerDeltaDb", DoubleValue(delta));
+        Ptr<OranCommandNr2NrTxPower> cmd = OranCommandNr2NrTxPower::Create(enbId, delta);
         data->LogCommandLm(m_name, cmd);
         commands.push_back(cmd);
 
@@ -126,4 +124,12 @@ OranLmNr2NrTxpCalibration::Run()
     return commands;
 }
 
+std::vector<OranSubscription>
+OranLmNr2NrTxpCalibration::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
 } // namespace ns3
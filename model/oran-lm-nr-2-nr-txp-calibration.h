@@ -35,6 +35,7 @@ class OranLmNr2NrTxpCalibration : public OranLm
     ~OranLmNr2NrTxpCalibration() override;
 
     std::vector<Ptr<OranCommand>> Run() override;
+    std::vector<OranSubscription> GetSubscriptions() const override;
 
   private:
     double m_lowDbm;             //!< Low extreme of the square wave (dBm).
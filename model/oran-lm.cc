@@ -32,6 +32,7 @@
 
 #include "oran-data-repository.h"
 #include "oran-near-rt-ric.h"
+#include "oran-report.h"
 
 #include "ns3/abort.h"
 #include "ns3/boolean.h"
@@ -41,6 +42,7 @@
 #include "ns3/string.h"
 
 #include <string>
+#include <utility>
 
 namespace ns3
 {
@@ -197,6 +199,26 @@ OranLm::IsRunning() const
     return m_finishRunEvent.IsPending();
 }
 
+void
+OranLm::SaveState(std::ostream& os) const
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranLm::RestoreState(std::istream& is, Time timeShift)
+{
+    NS_LOG_FUNCTION(this << timeShift);
+}
+
+std::vector<OranSubscription>
+OranLm::GetSubscriptions() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranSubscription{OranReport::GetTypeId(), {}, Seconds(0)}};
+}
+
 void
 OranLm::DoDispose()
 {
@@ -236,7 +258,7 @@ OranLm::FinishRun()
 
         NS_LOG_LOGIC("\"" << m_name << "\" Logic Module finished running");
 
-        m_nearRtRic->NotifyLmFinished(m_cycle, m_commands, GetObject<OranLm>());
+        m_nearRtRic->NotifyLmFinished(m_cycle, std::move(m_commands), GetObject<OranLm>());
 
         m_commands.clear();
     }
@@ -31,11 +31,14 @@
 #ifndef ORAN_LM_H
 #define ORAN_LM_H
 
+#include "oran-subscription.h"
+
 #include "ns3/event-id.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
 
+#include <iostream>
 #include <string_view>
 #include <vector>
 
@@ -116,6 +119,31 @@ class OranLm : public Object
      * @return true, if the LM is running; otherwise, false.
      */
     bool IsRunning() const;
+    /**
+     * Write the internal state of this Logic Module to a checkpoint of the
+     * Near-RT RIC (see OranNearRtRic::SaveCheckpoint). The default writes
+     * nothing, for modules that keep no state outside the Data Repository.
+     *
+     * @param os The stream to write to.
+     */
+    virtual void SaveState(std::ostream& os) const;
+    /**
+     * Restore the internal state written by SaveState.
+     *
+     * @param is The stream to read from.
+     * @param timeShift The time to add to the simulation times in the state,
+     *        i.e., the time of the restore minus the time of the checkpoint.
+     */
+    virtual void RestoreState(std::istream& is, Time timeShift);
+    /**
+     * Get the Reports this Logic Module reads from the Data Repository. When
+     * the Near-RT RIC enforces subscriptions, Reporters whose Reports no
+     * module subscribes to are suspended. The default subscribes to every
+     * Report from every node, at the configured intervals.
+     *
+     * @return The subscriptions.
+     */
+    virtual std::vector<OranSubscription> GetSubscriptions() const;
 
   protected:
     /**
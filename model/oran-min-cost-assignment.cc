@@ -0,0 +1,227 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-min-cost-assignment.h"
+
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+namespace
+{
+constexpr double kInfinity = std::numeric_limits<double>::infinity();
+} // namespace
+
+void
+OranMinCostAssignment::Reset(std::size_t numUes, const std::vector<uint32_t>& capacities)
+{
+    m_numCells = capacities.size();
+    m_capacity = capacities;
+    m_load.assign(m_numCells, 0);
+    m_candidates.assign(numUes, {});
+    m_assignment.assign(numUes, UNASSIGNED);
+    m_assignedCost.assign(numUes, 0.0);
+    m_moves.assign(m_numCells * m_numCells, {});
+    m_unplaced.assign(m_numCells, {});
+    m_potential.assign(m_numCells + 1, 0.0);
+    m_distance.assign(m_numCells + 1, kInfinity);
+    m_parent.assign(m_numCells + 1, -1);
+    m_parentUe.assign(m_numCells + 1, 0);
+    m_parentDelta.assign(m_numCells + 1, 0.0);
+    m_sourceUe.assign(m_numCells, 0);
+    m_done.assign(m_numCells + 1, false);
+    m_totalCost = 0.0;
+    m_numAssigned = 0;
+}
+
+void
+OranMinCostAssignment::AddCandidate(uint32_t ue, uint32_t cell, double cost)
+{
+    NS_ABORT_MSG_IF(ue >= m_candidates.size() || cell >= m_numCells,
+                    "Candidate (" << ue << ", " << cell << ") out of range");
+    m_candidates[ue].emplace_back(cell, cost);
+}
+
+double
+OranMinCostAssignment::Solve()
+{
+    for (uint32_t ue = 0; ue < m_candidates.size(); ++ue)
+    {
+        for (const auto& [cell, cost] : m_candidates[ue])
+        {
+            m_unplaced[cell].push_back(Move{cost, ue});
+        }
+    }
+    for (auto& heap : m_unplaced)
+    {
+        std::make_heap(heap.begin(), heap.end());
+    }
+
+    while (m_numAssigned < m_candidates.size() && Augment())
+    {
+        m_numAssigned++;
+    }
+
+    m_totalCost = 0.0;
+    for (uint32_t ue = 0; ue < m_assignment.size(); ++ue)
+    {
+        if (m_assignment[ue] != UNASSIGNED)
+        {
+            m_totalCost += m_assignedCost[ue];
+        }
+    }
+    return m_totalCost;
+}
+
+int32_t
+OranMinCostAssignment::GetAssignment(uint32_t ue) const
+{
+    return m_assignment.at(ue);
+}
+
+std::size_t
+OranMinCostAssignment::GetNumAssigned() const
+{
+    return m_numAssigned;
+}
+
+void
+OranMinCostAssignment::Place(uint32_t ue, uint32_t cell, double cost)
+{
+    m_assignment[ue] = static_cast<int32_t>(cell);
+    m_assignedCost[ue] = cost;
+    for (const auto& [to, toCost] : m_candidates[ue])
+    {
+        if (to != cell)
+        {
+            std::vector<Move>& heap = m_moves[cell * m_numCells + to];
+            heap.push_back(Move{toCost - cost, ue});
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+}
+
+const OranMinCostAssignment::Move*
+OranMinCostAssignment::CheapestMove(uint32_t from, uint32_t to)
+{
+    // Moves of UEs that have left the cell since are dropped when they
+    // reach the top. A UE that came back has an identical valid entry.
+    std::vector<Move>& heap = m_moves[from * m_numCells + to];
+    while (!heap.empty() && m_assignment[heap.front().ue] != static_cast<int32_t>(from))
+    {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.pop_back();
+    }
+    return heap.empty() ? nullptr : &heap.front();
+}
+
+bool
+OranMinCostAssignment::Augment()
+{
+    const std::size_t sink = m_numCells;
+    std::fill(m_distance.begin(), m_distance.end(), kInfinity);
+    std::fill(m_parent.begin(), m_parent.end(), -1);
+    std::fill(m_done.begin(), m_done.end(), false);
+
+    // Distances are reduced by the potentials: the real distance of a
+    // node is its reduced distance plus its potential. A cell starts at the
+    // cost of the cheapest UE not placed yet that can go there. These costs
+    // may be anything, as they are only starting distances.
+    for (uint32_t cell = 0; cell < m_numCells; ++cell)
+    {
+        std::vector<Move>& heap = m_unplaced[cell];
+        while (!heap.empty() && m_assignment[heap.front().ue] != UNASSIGNED)
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.pop_back();
+        }
+        if (!heap.empty())
+        {
+            m_distance[cell] = heap.front().delta - m_potential[cell];
+            m_sourceUe[cell] = heap.front().ue;
+        }
+    }
+
+    while (true)
+    {
+        std::size_t node = sink + 1;
+        double best = kInfinity;
+        for (std::size_t i = 0; i <= sink; ++i)
+        {
+            if (!m_done[i] && m_distance[i] < best)
+            {
+                best = m_distance[i];
+                node = i;
+            }
+        }
+        if (node > sink)
+        {
+            return false; // no cell with room left can be reached
+        }
+        m_done[node] = true;
+        if (node == sink)
+        {
+            break;
+        }
+
+        const uint32_t from = static_cast<uint32_t>(node);
+        if (m_load[from] < m_capacity[from])
+        {
+            double d = best + m_potential[from] - m_potential[sink];
+            if (d < m_distance[sink])
+            {
+                m_distance[sink] = d;
+                m_parent[sink] = static_cast<int32_t>(from);
+            }
+        }
+        for (uint32_t to = 0; to < m_numCells; ++to)
+        {
+            if (m_done[to] || to == from)
+            {
+                continue;
+            }
+            const Move* move = CheapestMove(from, to);
+            if (move == nullptr)
+            {
+                continue;
+            }
+            double d = best + move->delta + m_potential[from] - m_potential[to];
+            if (d < m_distance[to])
+            {
+                m_distance[to] = d;
+                m_parent[to] = static_cast<int32_t>(from);
+                m_parentUe[to] = move->ue;
+                m_parentDelta[to] = move->delta;
+            }
+        }
+    }
+
+    // Keep every reduced cost non-negative for the next search. Nodes not
+    // settled are at least as far as the sink.
+    const double sinkDistance = m_distance[sink];
+    for (std::size_t i = 0; i <= sink; ++i)
+    {
+        m_potential[i] += std::min(m_distance[i], sinkDistance);
+    }
+
+    // Walk the path back from the cell with room left, moving every UE on
+    // it one cell forward, and place the new UE in the first cell.
+    uint32_t cell = static_cast<uint32_t>(m_parent[sink]);
+    m_load[cell]++;
+    while (m_parent[cell] != -1)
+    {
+        uint32_t moved = m_parentUe[cell];
+        Place(moved, cell, m_assignedCost[moved] + m_parentDelta[cell]);
+        cell = static_cast<uint32_t>(m_parent[cell]);
+    }
+    Place(m_sourceUe[cell], cell, m_unplaced[cell].front().delta);
+    return true;
+}
+
+} // namespace ns3
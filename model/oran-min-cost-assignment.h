@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_MIN_COST_ASSIGNMENT_H
+#define ORAN_MIN_COST_ASSIGNMENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Capacity-constrained min-cost assignment of UEs to cells.
+ *
+ * Every UE is assigned to one of its candidate cells, no cell gets more
+ * UEs than its capacity, and the sum of the costs of the chosen pairs is
+ * minimal. When the candidate cells of some UEs do not have room for all of
+ * them, as many UEs as possible are placed, at the lowest total cost, and
+ * the others are left unassigned.
+ *
+ * The problem is solved as a min-cost flow with successive shortest paths.
+ * UEs are added one at a time along the cheapest path from any UE not
+ * placed yet to a cell with room left, which may move placed UEs from cell
+ * to cell. Paths are searched on the graph of cells, in which the cost of
+ * going from cell a to cell b is the cheapest cost change of moving one of
+ * the UEs of a to b. Each such cost, and the cheapest UE not placed yet of
+ * every cell, is kept in a heap, so that a search costs O(cells^2) whatever
+ * the number of UEs, and cell potentials keep the costs non-negative for
+ * Dijkstra's algorithm. Solving for U UEs takes O(U * cells^2) plus
+ * O(log U) per candidate of every UE moved.
+ */
+class OranMinCostAssignment
+{
+  public:
+    /**
+     * The assignment of a UE that could not be placed.
+     */
+    static constexpr int32_t UNASSIGNED = -1;
+
+    /**
+     * Starts a new problem.
+     *
+     * \param numUes The number of UEs.
+     * \param capacities The number of UEs every cell can take.
+     */
+    void Reset(std::size_t numUes, const std::vector<uint32_t>& capacities);
+    /**
+     * Adds a cell a UE can be assigned to.
+     *
+     * \param ue The index of the UE.
+     * \param cell The index of the cell.
+     * \param cost The cost of assigning the UE to the cell.
+     */
+    void AddCandidate(uint32_t ue, uint32_t cell, double cost);
+    /**
+     * Solves the problem.
+     *
+     * \return The total cost of the assignment.
+     */
+    double Solve();
+    /**
+     * Gets the cell assigned to a UE.
+     *
+     * \param ue The index of the UE.
+     * \return The index of the cell, or UNASSIGNED.
+     */
+    int32_t GetAssignment(uint32_t ue) const;
+    /**
+     * \return The number of UEs that were placed.
+     */
+    std::size_t GetNumAssigned() const;
+
+  private:
+    /**
+     * A UE in the heap of the moves from its cell to another one.
+     */
+    struct Move
+    {
+        double delta; //!< The cost change of the move, or the cost of a UE not placed.
+        uint32_t ue;  //!< The index of the UE.
+
+        /**
+         * Orders the heap so that the cheapest move is on top.
+         *
+         * \param other The other move.
+         * \return True if this move costs more than the other one.
+         */
+        bool operator<(const Move& other) const
+        {
+            return delta > other.delta;
+        }
+    };
+
+    /**
+     * Places a UE in a cell and adds its moves to the heaps of that cell.
+     *
+     * \param ue The index of the UE.
+     * \param cell The index of the cell.
+     * \param cost The cost of the UE in the cell.
+     */
+    void Place(uint32_t ue, uint32_t cell, double cost);
+    /**
+     * Gets the cheapest move of a UE from one cell to another.
+     *
+     * \param from The cell the UE is in.
+     * \param to The cell the UE moves to.
+     * \return The move, or nullptr if no UE of the cell can move there.
+     */
+    const Move* CheapestMove(uint32_t from, uint32_t to);
+    /**
+     * Places one more UE along the cheapest path to a cell with room left.
+     *
+     * \return True if a UE was placed.
+     */
+    bool Augment();
+
+    std::size_t m_numCells = 0;                 //!< The number of cells.
+    std::vector<uint32_t> m_capacity;           //!< The capacity of every cell.
+    std::vector<uint32_t> m_load;               //!< The number of UEs in every cell.
+    std::vector<std::vector<std::pair<uint32_t, double>>> m_candidates; //!< Cells and costs.
+    std::vector<int32_t> m_assignment;          //!< The cell of every UE.
+    std::vector<double> m_assignedCost;         //!< The cost of every UE in its cell.
+    std::vector<std::vector<Move>> m_moves;     //!< The moves from cell a to b, at a*cells+b.
+    std::vector<std::vector<Move>> m_unplaced;  //!< The heap of UEs not placed, by cost, per cell.
+    std::vector<double> m_potential;            //!< The potential of every cell, then of the sink.
+    std::vector<double> m_distance;             //!< The reduced distances of the last search.
+    std::vector<int32_t> m_parent;              //!< The previous cell on the path, or -1.
+    std::vector<uint32_t> m_parentUe;           //!< The UE moved into a cell on the path.
+    std::vector<double> m_parentDelta;          //!< The cost change of that move.
+    std::vector<uint32_t> m_sourceUe;           //!< The cheapest UE not placed of every cell.
+    std::vector<bool> m_done;                   //!< Whether a node was settled in the search.
+    double m_totalCost = 0.0;                   //!< The total cost of the assignment.
+    std::size_t m_numAssigned = 0;              //!< The number of UEs placed.
+};
+
+} // namespace ns3
+
+#endif // ORAN_MIN_COST_ASSIGNMENT_H
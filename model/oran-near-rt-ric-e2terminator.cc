@@ -36,21 +36,26 @@
 #include "oran-e2-node-terminator-lte-ue.h"
 #include "oran-e2-node-terminator-nr-gnb.h"
 #include "oran-e2-node-terminator-nr-ue.h"
+#include "oran-e2-node-terminator-replay.h"
 #include "oran-e2-node-terminator.h"
+#include "oran-e2-socket-transport.h"
 #include "oran-near-rt-ric.h"
 #include "oran-report-apploss.h"
 #include "oran-report-location.h"
 #include "oran-report-lte-ue-app-demand.h"
 #include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-multi-cell-rsrp-rsrq.h"
 #include "oran-report-lte-ue-rsrp-rsrq.h"
 #include "oran-report-lte-energy-efficiency.h"
 #include "oran-report-nr-ue-app-demand.h"
 #include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-multi-cell-rsrp-rsrq.h"
 #include "oran-report-nr-ue-rsrp-rsrq.h"
 #include "oran-report-nr-energy-efficiency.h"
 #include "oran-report.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/log.h"
 #include "ns3/lte-enb-net-device.h"
 #include "ns3/lte-enb-rrc.h"
@@ -63,6 +68,9 @@
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
+#include "ns3/trace-source-accessor.h"
+
+#include <utility>
 
 namespace ns3
 {
@@ -92,7 +100,31 @@ OranNearRtRicE2Terminator::GetTypeId()
                           "delay for a command.",
                           StringValue("ns3::ConstantRandomVariable[Constant=0]"),
                           MakePointerAccessor(&OranNearRtRicE2Terminator::m_transmissionDelayRv),
-                          MakePointerChecker<RandomVariableStream>());
+                          MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("Serialize",
+                          "Flag to indicate if Reports and Commands are encoded into binary E2 "
+                          "messages and decoded again before they are acted on.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OranNearRtRicE2Terminator::m_serialize),
+                          MakeBooleanChecker())
+            .AddAttribute("Transport",
+                          "The transport the encoded E2 messages are sent through when "
+                          "Serialize is enabled, or null to decode them in place.",
+                          PointerValue(nullptr),
+                          MakePointerAccessor(&OranNearRtRicE2Terminator::m_transport),
+                          MakePointerChecker<OranE2SocketTransport>())
+            .AddTraceSource("RxReport",
+                            "A Report received from an E2 Node Terminator.",
+                            MakeTraceSourceAccessor(&OranNearRtRicE2Terminator::m_rxReportTrace),
+                            "ns3::OranNearRtRicE2Terminator::ReportTracedCallback")
+            .AddTraceSource("TxCommand",
+                            "A Command sent to an E2 Node Terminator.",
+                            MakeTraceSourceAccessor(&OranNearRtRicE2Terminator::m_txCommandTrace),
+                            "ns3::OranNearRtRicE2Terminator::CommandTracedCallback")
+            .AddTraceSource("Message",
+                            "An E2 message encoded when Serialize is enabled.",
+                            MakeTraceSourceAccessor(&OranNearRtRicE2Terminator::m_messageTrace),
+                            "ns3::OranNearRtRicE2Terminator::MessageTracedCallback");
 
     return tid;
 }
@@ -100,7 +132,9 @@ OranNearRtRicE2Terminator::GetTypeId()
 OranNearRtRicE2Terminator::OranNearRtRicE2Terminator()
     : Object(),
       m_active(false),
-      m_nodeTerminators(std::map<uint64_t, Ptr<OranE2NodeTerminator>>())
+      m_nodeTerminators(std::map<uint64_t, Ptr<OranE2NodeTerminator>>()),
+      m_hasSubscriptions(false),
+      m_serialize(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -148,38 +182,63 @@ OranNearRtRicE2Terminator::ReceiveRegistrationRequest(OranNearRtRic::NodeType ty
             "Attempting to use a null data repository in the Near-RT RIC E2 Terminator");
         NS_ABORT_MSG_IF(terminator == nullptr, "Attempting to register a NULL Node E2 Terminator");
 
+        // Replayed nodes carry their recorded cell ID or IMSI instead of a
+        // network device.
+        Ptr<OranE2NodeTerminatorReplay> replay =
+            terminator->GetObject<OranE2NodeTerminatorReplay>();
+
         uint64_t e2NodeId;
         switch (type)
         {
         case OranNearRtRic::NodeType::LTEUE:
-            e2NodeId = m_data->RegisterNodeLteUe(id,
-                                                 terminator->GetObject<OranE2NodeTerminatorLteUe>()
-                                                     ->GetNetDevice()
-                                                     ->GetRrc()
-                                                     ->GetImsi());
+            e2NodeId = m_data->RegisterNodeLteUe(
+                id,
+                replay != nullptr ? replay->GetImsi()
+                                  : terminator->GetObject<OranE2NodeTerminatorLteUe>()
+                                        ->GetNetDevice()
+                                        ->GetRrc()
+                                        ->GetImsi());
             break;
         case OranNearRtRic::NodeType::LTEENB:
             e2NodeId = m_data->RegisterNodeLteEnb(
                 id,
-                terminator->GetObject<OranE2NodeTerminatorLteEnb>()->GetNetDevice()->GetCellId());
+                replay != nullptr ? replay->GetCellId()
+                                  : terminator->GetObject<OranE2NodeTerminatorLteEnb>()
+                                        ->GetNetDevice()
+                                        ->GetCellId());
             break;
         case OranNearRtRic::NodeType::NRUE:
-            e2NodeId = m_data->RegisterNodeNrUe(id,
-                                                terminator->GetObject<OranE2NodeTerminatorNrUe>()
-                                                    ->GetNetDevice()
-                                                    ->GetRrc()
-                                                    ->GetImsi());
+            e2NodeId = m_data->RegisterNodeNrUe(
+                id,
+                replay != nullptr ? replay->GetImsi()
+                                  : terminator->GetObject<OranE2NodeTerminatorNrUe>()
+                                        ->GetNetDevice()
+                                        ->GetRrc()
+                                        ->GetImsi());
             break;
         case OranNearRtRic::NodeType::NRGNB:
             e2NodeId = m_data->RegisterNodeNrGnb(
                 id,
-                terminator->GetObject<OranE2NodeTerminatorNrGnb>()->GetNetDevice()->GetCellId());
+                replay != nullptr ? replay->GetCellId()
+                                  : terminator->GetObject<OranE2NodeTerminatorNrGnb>()
+                                        ->GetNetDevice()
+                                        ->GetCellId());
             break;
         default:
             e2NodeId = m_data->RegisterNode(type, id);
             break;
         }
+        bool isNew = m_nodeTerminators.find(e2NodeId) == m_nodeTerminators.end();
         m_nodeTerminators[e2NodeId] = terminator;
+        m_nearRtRic->NotifyE2NodeRegistered(e2NodeId);
+
+        if (isNew && m_hasSubscriptions)
+        {
+            Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
+                                &OranE2NodeTerminator::ReceiveSubscriptions,
+                                terminator,
+                                m_subscriptions);
+        }
 
         Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
                             &OranE2NodeTerminator::ReceiveRegistrationResponse,
@@ -200,6 +259,7 @@ OranNearRtRicE2Terminator::ReceiveDeregistrationRequest(uint64_t e2NodeId)
             "Attempting to use a null data repository in the Near-RT RIC E2 Terminator");
 
         uint64_t deregisteredE2NodeId = m_data->DeregisterNode(e2NodeId);
+        m_nearRtRic->NotifyE2NodeDeregistered(e2NodeId);
 
         Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
                             &OranE2NodeTerminator::ReceiveDeregistrationResponse,
@@ -219,104 +279,38 @@ OranNearRtRicE2Terminator::ReceiveReport(Ptr<OranReport> report)
             m_data == nullptr,
             "Attempting to use a null data repository in the Near-RT RIC E2 Terminator");
 
-        if (report->GetInstanceTypeId() == TypeId::LookupByName("ns3::OranReportLocation"))
-        {
-            Ptr<OranReportLocation> posRpt = report->GetObject<OranReportLocation>();
-            m_data->SavePosition(posRpt->GetReporterE2NodeId(),
-                                 posRpt->GetLocation(),
-                                 posRpt->GetTime());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportLteUeCellInfo"))
-        {
-            Ptr<OranReportLteUeCellInfo> lteUeCellInfoRpt =
-                report->GetObject<OranReportLteUeCellInfo>();
-            m_data->SaveLteUeCellInfo(lteUeCellInfoRpt->GetReporterE2NodeId(),
-                                      lteUeCellInfoRpt->GetCellId(),
-                                      lteUeCellInfoRpt->GetRnti(),
-                                      lteUeCellInfoRpt->GetTime());
-        }
-        else if (report->GetInstanceTypeId() == TypeId::LookupByName("ns3::OranReportAppLoss"))
-        {
-            Ptr<OranReportAppLoss> appLossRpt = report->GetObject<OranReportAppLoss>();
-            m_data->SaveAppLoss(appLossRpt->GetReporterE2NodeId(),
-                                appLossRpt->GetLoss(),
-                                appLossRpt->GetTime());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportLteUeRsrpRsrq"))
-        {
-            Ptr<OranReportLteUeRsrpRsrq> rsrpRsrqRpt = report->GetObject<OranReportLteUeRsrpRsrq>();
-            m_data->SaveLteUeRsrpRsrq(rsrpRsrqRpt->GetReporterE2NodeId(),
-                                      rsrpRsrqRpt->GetTime(),
-                                      rsrpRsrqRpt->GetRnti(),
-                                      rsrpRsrqRpt->GetCellId(),
-                                      rsrpRsrqRpt->GetRsrp(),
-                                      rsrpRsrqRpt->GetRsrq(),
-                                      rsrpRsrqRpt->GetIsServingCell(),
-                                      rsrpRsrqRpt->GetComponentCarrierId());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportLteEnergyEfficiency"))
+        if (m_serialize)
         {
-            Ptr<OranReportLteEnergyEfficiency> energyRpt =
-                report->GetObject<OranReportLteEnergyEfficiency>();
-            m_data->SaveLteEnergyRemaining(energyRpt->GetReporterE2NodeId(),
-                                           energyRpt->GetTime(),
-                                           energyRpt->GetLteEnergyRemaining());
+            m_buffer.clear();
+            m_codec.EncodeReport(report, m_buffer);
+            RelayMessage();
+            return;
         }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportLteUeAppDemand"))
-        {
-            Ptr<OranReportLteUeAppDemand> demandRpt =
-                report->GetObject<OranReportLteUeAppDemand>();
-            m_data->SaveLteUeAppDemand(demandRpt->GetReporterE2NodeId(),
-                                       demandRpt->GetTime(),
-                                       demandRpt->GetDemandMbps());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportNrUeCellInfo"))
-        {
-            Ptr<OranReportNrUeCellInfo> nrUeCellInfoRpt =
-                report->GetObject<OranReportNrUeCellInfo>();
-            m_data->SaveNrUeCellInfo(nrUeCellInfoRpt->GetReporterE2NodeId(),
-                                     nrUeCellInfoRpt->GetCellId(),
-                                     nrUeCellInfoRpt->GetRnti(),
-                                     nrUeCellInfoRpt->GetTime());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportNrUeRsrpRsrq"))
-        {
-            Ptr<OranReportNrUeRsrpRsrq> nrRsrpRsrqRpt = report->GetObject<OranReportNrUeRsrpRsrq>();
-            m_data->SaveNrUeRsrpRsrq(nrRsrpRsrqRpt->GetReporterE2NodeId(),
-                                     nrRsrpRsrqRpt->GetTime(),
-                                     nrRsrpRsrqRpt->GetRnti(),
-                                     nrRsrpRsrqRpt->GetCellId(),
-                                     nrRsrpRsrqRpt->GetRsrp(),
-                                     nrRsrpRsrqRpt->GetRsrq(),
-                                     nrRsrpRsrqRpt->GetIsServingCell(),
-                                     nrRsrpRsrqRpt->GetComponentCarrierId());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportNrEnergyEfficiency"))
-        {
-            Ptr<OranReportNrEnergyEfficiency> nrEnergyRpt =
-                report->GetObject<OranReportNrEnergyEfficiency>();
-            m_data->SaveNrEnergyRemaining(nrEnergyRpt->GetReporterE2NodeId(),
-                                          nrEnergyRpt->GetTime(),
-                                          nrEnergyRpt->GetNrEnergyRemaining());
-        }
-        else if (report->GetInstanceTypeId() ==
-                 TypeId::LookupByName("ns3::OranReportNrUeAppDemand"))
+
+        StoreReport(report);
+    }
+}
+
+void
+OranNearRtRicE2Terminator::ReceiveReportBatch(std::vector<Ptr<OranReport>> reports)
+{
+    NS_LOG_FUNCTION(this << reports.size());
+
+    if (m_active)
+    {
+        NS_ABORT_MSG_IF(
+            m_data == nullptr,
+            "Attempting to use a null data repository in the Near-RT RIC E2 Terminator");
+
+        if (m_serialize)
         {
-            Ptr<OranReportNrUeAppDemand> nrDemandRpt =
-                report->GetObject<OranReportNrUeAppDemand>();
-            m_data->SaveNrUeAppDemand(nrDemandRpt->GetReporterE2NodeId(),
-                                      nrDemandRpt->GetTime(),
-                                      nrDemandRpt->GetDemandMbps());
+            m_buffer.clear();
+            m_codec.EncodeReportBatch(reports, m_buffer);
+            RelayMessage();
+            return;
         }
 
-        m_nearRtRic->NotifyReportReceived(report);
+        StoreReportBatch(reports);
     }
 }
 
@@ -331,17 +325,20 @@ OranNearRtRicE2Terminator::SendCommand(Ptr<OranCommand> command)
             m_data == nullptr,
             "Attempting to use a null data repository in the Near-RT RIC E2 Terminator");
 
-        m_data->LogCommandE2Terminator(command);
+        if (m_serialize)
+        {
+            m_buffer.clear();
+            m_codec.EncodeCommand(command, m_buffer);
+            RelayMessage();
+            return;
+        }
 
-        Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
-                            &OranE2NodeTerminator::ReceiveCommand,
-                            m_nodeTerminators[command->GetTargetE2NodeId()],
-                            command);
+        DeliverCommand(command);
     }
 }
 
 void
-OranNearRtRicE2Terminator::ProcessCommands(std::vector<Ptr<OranCommand>> commands)
+OranNearRtRicE2Terminator::ProcessCommands(const std::vector<Ptr<OranCommand>>& commands)
 {
     NS_LOG_FUNCTION(this);
 
@@ -354,6 +351,32 @@ OranNearRtRicE2Terminator::ProcessCommands(std::vector<Ptr<OranCommand>> command
     }
 }
 
+void
+OranNearRtRicE2Terminator::SendSubscriptions(const OranSubscriptionSet& subscriptions)
+{
+    NS_LOG_FUNCTION(this << subscriptions.ToString());
+
+    m_subscriptions = subscriptions;
+    m_hasSubscriptions = true;
+
+    if (m_active)
+    {
+        for (const auto& entry : m_nodeTerminators)
+        {
+            Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
+                                &OranE2NodeTerminator::ReceiveSubscriptions,
+                                entry.second,
+                                m_subscriptions);
+        }
+    }
+}
+
+const OranE2CodecStats&
+OranNearRtRicE2Terminator::GetCodecStats() const
+{
+    return m_codec.GetStats();
+}
+
 void
 OranNearRtRicE2Terminator::DoDispose()
 {
@@ -363,8 +386,233 @@ OranNearRtRicE2Terminator::DoDispose()
     m_data = nullptr;
     m_nodeTerminators.clear();
     m_transmissionDelayRv = nullptr;
+    m_transport = nullptr;
+    m_buffer.clear();
 
     Object::DoDispose();
 }
 
+void
+OranNearRtRicE2Terminator::StoreReport(Ptr<OranReport> report)
+{
+    NS_LOG_FUNCTION(this << report);
+
+    SaveReport(report);
+
+    m_nearRtRic->NotifyReportReceived(report);
+}
+
+void
+OranNearRtRicE2Terminator::StoreReportBatch(const std::vector<Ptr<OranReport>>& reports)
+{
+    NS_LOG_FUNCTION(this << reports.size());
+
+    m_data->BeginTransaction();
+    for (const auto& report : reports)
+    {
+        NS_LOG_LOGIC("Saving batched report " << report->ToString());
+        SaveReport(report);
+    }
+    m_data->CommitTransaction();
+
+    // Notify once the whole batch is stored, so that LMs queried by a
+    // query trigger see all of it.
+    for (const auto& report : reports)
+    {
+        m_nearRtRic->NotifyReportReceived(report);
+    }
+}
+
+void
+OranNearRtRicE2Terminator::DeliverCommand(Ptr<OranCommand> command)
+{
+    NS_LOG_FUNCTION(this << command);
+
+    auto terminator = m_nodeTerminators.find(command->GetTargetE2NodeId());
+    if (terminator == m_nodeTerminators.end())
+    {
+        // E.g., a node restored from a checkpoint that has not registered again.
+        NS_LOG_WARN("Dropping command for E2 Node " << command->GetTargetE2NodeId()
+                                                    << " that has not registered");
+        return;
+    }
+
+    m_data->LogCommandE2Terminator(command);
+    m_txCommandTrace(command);
+
+    Simulator::Schedule(Seconds(m_transmissionDelayRv->GetValue()),
+                        &OranE2NodeTerminator::ReceiveCommand,
+                        terminator->second,
+                        command);
+}
+
+void
+OranNearRtRicE2Terminator::RelayMessage()
+{
+    NS_LOG_FUNCTION(this << m_buffer.size());
+
+    m_messageTrace(OranE2Codec::PeekType(m_buffer.data(), m_buffer.size()),
+                   static_cast<uint32_t>(m_buffer.size()));
+
+    // Without a transport, the message is decoded as is, as if a peer had
+    // returned it unchanged. The messages are taken out of the buffers
+    // first, as acting on them may send more (e.g., from a triggered LM).
+    std::vector<uint8_t> messages =
+        m_transport != nullptr ? m_transport->Exchange(m_buffer) : std::move(m_buffer);
+    m_buffer.clear();
+
+    std::size_t offset = 0;
+    while (offset < messages.size())
+    {
+        const uint8_t* message = messages.data() + offset;
+        std::size_t size = messages.size() - offset;
+        OranE2MessageType type = OranE2Codec::PeekType(message, size);
+
+        std::vector<Ptr<OranReport>> reports;
+        std::vector<Ptr<OranCommand>> commands;
+        offset += m_codec.Decode(message, size, reports, commands);
+
+        if (type == OranE2MessageType::REPORT_BATCH)
+        {
+            StoreReportBatch(reports);
+        }
+        else
+        {
+            for (const auto& report : reports)
+            {
+                StoreReport(report);
+            }
+        }
+        for (const auto& command : commands)
+        {
+            DeliverCommand(command);
+        }
+    }
+}
+
+void
+OranNearRtRicE2Terminator::SaveReport(Ptr<OranReport> report)
+{
+    NS_LOG_FUNCTION(this << report);
+
+    m_rxReportTrace(report);
+
+    if (report->GetInstanceTypeId() == TypeId::LookupByName("ns3::OranReportLocation"))
+    {
+        Ptr<OranReportLocation> posRpt = report->GetObject<OranReportLocation>();
+        m_data->SavePosition(posRpt->GetReporterE2NodeId(),
+                             posRpt->GetLocation(),
+                             posRpt->GetTime());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportLteUeCellInfo"))
+    {
+        Ptr<OranReportLteUeCellInfo> lteUeCellInfoRpt =
+            report->GetObject<OranReportLteUeCellInfo>();
+        m_data->SaveLteUeCellInfo(lteUeCellInfoRpt->GetReporterE2NodeId(),
+                                  lteUeCellInfoRpt->GetCellId(),
+                                  lteUeCellInfoRpt->GetRnti(),
+                                  lteUeCellInfoRpt->GetTime());
+    }
+    else if (report->GetInstanceTypeId() == TypeId::LookupByName("ns3::OranReportAppLoss"))
+    {
+        Ptr<OranReportAppLoss> appLossRpt = report->GetObject<OranReportAppLoss>();
+        m_data->SaveAppLoss(appLossRpt->GetReporterE2NodeId(),
+                            appLossRpt->GetLoss(),
+                            appLossRpt->GetTime());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportLteUeRsrpRsrq"))
+    {
+        Ptr<OranReportLteUeRsrpRsrq> rsrpRsrqRpt = report->GetObject<OranReportLteUeRsrpRsrq>();
+        m_data->SaveLteUeRsrpRsrq(rsrpRsrqRpt->GetReporterE2NodeId(),
+                                  rsrpRsrqRpt->GetTime(),
+                                  rsrpRsrqRpt->GetRnti(),
+                                  rsrpRsrqRpt->GetCellId(),
+                                  rsrpRsrqRpt->GetRsrp(),
+                                  rsrpRsrqRpt->GetRsrq(),
+                                  rsrpRsrqRpt->GetIsServingCell(),
+                                  rsrpRsrqRpt->GetComponentCarrierId());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportLteUeMultiCellRsrpRsrq"))
+    {
+        Ptr<OranReportLteUeMultiCellRsrpRsrq> multiCellRpt =
+            report->GetObject<OranReportLteUeMultiCellRsrpRsrq>();
+        m_data->SaveLteUeMultiCellRsrpRsrq(multiCellRpt->GetReporterE2NodeId(),
+                                           multiCellRpt->GetTime(),
+                                           multiCellRpt->GetRnti(),
+                                           multiCellRpt->GetMeasurements());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportLteEnergyEfficiency"))
+    {
+        Ptr<OranReportLteEnergyEfficiency> energyRpt =
+            report->GetObject<OranReportLteEnergyEfficiency>();
+        m_data->SaveLteEnergyRemaining(energyRpt->GetReporterE2NodeId(),
+                                       energyRpt->GetTime(),
+                                       energyRpt->GetLteEnergyRemaining());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportLteUeAppDemand"))
+    {
+        Ptr<OranReportLteUeAppDemand> demandRpt =
+            report->GetObject<OranReportLteUeAppDemand>();
+        m_data->SaveLteUeAppDemand(demandRpt->GetReporterE2NodeId(),
+                                   demandRpt->GetTime(),
+                                   demandRpt->GetDemandMbps());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportNrUeCellInfo"))
+    {
+        Ptr<OranReportNrUeCellInfo> nrUeCellInfoRpt =
+            report->GetObject<OranReportNrUeCellInfo>();
+        m_data->SaveNrUeCellInfo(nrUeCellInfoRpt->GetReporterE2NodeId(),
+                                 nrUeCellInfoRpt->GetCellId(),
+                                 nrUeCellInfoRpt->GetRnti(),
+                                 nrUeCellInfoRpt->GetTime());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportNrUeRsrpRsrq"))
+    {
+        Ptr<OranReportNrUeRsrpRsrq> nrRsrpRsrqRpt = report->GetObject<OranReportNrUeRsrpRsrq>();
+        m_data->SaveNrUeRsrpRsrq(nrRsrpRsrqRpt->GetReporterE2NodeId(),
+                                 nrRsrpRsrqRpt->GetTime(),
+                                 nrRsrpRsrqRpt->GetRnti(),
+                                 nrRsrpRsrqRpt->GetCellId(),
+                                 nrRsrpRsrqRpt->GetRsrp(),
+                                 nrRsrpRsrqRpt->GetRsrq(),
+                                 nrRsrpRsrqRpt->GetIsServingCell(),
+                                 nrRsrpRsrqRpt->GetComponentCarrierId());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportNrUeMultiCellRsrpRsrq"))
+    {
+        Ptr<OranReportNrUeMultiCellRsrpRsrq> nrMultiCellRpt =
+            report->GetObject<OranReportNrUeMultiCellRsrpRsrq>();
+        m_data->SaveNrUeMultiCellRsrpRsrq(nrMultiCellRpt->GetReporterE2NodeId(),
+                                          nrMultiCellRpt->GetTime(),
+                                          nrMultiCellRpt->GetRnti(),
+                                          nrMultiCellRpt->GetMeasurements());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportNrEnergyEfficiency"))
+    {
+        Ptr<OranReportNrEnergyEfficiency> nrEnergyRpt =
+            report->GetObject<OranReportNrEnergyEfficiency>();
+        m_data->SaveNrEnergyRemaining(nrEnergyRpt->GetReporterE2NodeId(),
+                                      nrEnergyRpt->GetTime(),
+                                      nrEnergyRpt->GetNrEnergyRemaining());
+    }
+    else if (report->GetInstanceTypeId() ==
+             TypeId::LookupByName("ns3::OranReportNrUeAppDemand"))
+    {
+        Ptr<OranReportNrUeAppDemand> nrDemandRpt =
+            report->GetObject<OranReportNrUeAppDemand>();
+        m_data->SaveNrUeAppDemand(nrDemandRpt->GetReporterE2NodeId(),
+                                  nrDemandRpt->GetTime(),
+                                  nrDemandRpt->GetDemandMbps());
+    }
+}
+
 } // namespace ns3
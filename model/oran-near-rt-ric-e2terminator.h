@@ -33,10 +33,13 @@
 
 #include "oran-command.h"
 #include "oran-data-repository.h"
+#include "oran-e2-codec.h"
 #include "oran-report.h"
+#include "oran-subscription.h"
 
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/traced-callback.h"
 
 #include <map>
 #include <vector>
@@ -46,11 +49,19 @@ namespace ns3
 
 class OranNearRtRic;
 class OranE2NodeTerminator;
+class OranE2SocketTransport;
 
 /**
  * @ingroup oran
  *
  * The E2 Terminator of the Near-RT RIC.
+ *
+ * When Serialize is enabled, every Report received and every Command sent
+ * is encoded into a binary E2 message with an OranE2Codec and decoded
+ * again before it is acted on, so that the size of the E2 traffic and the
+ * cost of encoding it can be measured. When a Transport is also set, the
+ * encoded messages leave the process through it, and the messages it
+ * returns are the ones acted on.
  */
 class OranNearRtRicE2Terminator : public Object
 {
@@ -109,6 +120,13 @@ class OranNearRtRicE2Terminator : public Object
      * @param report The Report from the Reporter.
      */
     void ReceiveReport(Ptr<OranReport> report);
+    /**
+     * Receive a batch of Reports sent together by an E2 Node Terminator, and
+     * log them in the Data Repository in a single transaction.
+     *
+     * @param reports The Reports, in the order they were generated.
+     */
+    void ReceiveReportBatch(std::vector<Ptr<OranReport>> reports);
     /**
      * Send a Command to an E2 Node Terminator. The Command will be transmitted
      * directly to the target Terminator using the map of registered Terminators
@@ -122,7 +140,40 @@ class OranNearRtRicE2Terminator : public Object
      *
      * @param commands A vector with the Commands to send.
      */
-    void ProcessCommands(std::vector<Ptr<OranCommand>> commands);
+    void ProcessCommands(const std::vector<Ptr<OranCommand>>& commands);
+    /**
+     * Send the subscriptions of the Near-RT RIC to every registered Node E2
+     * Terminator, and to every Terminator that registers later.
+     *
+     * @param subscriptions The union of the subscriptions of the modules.
+     */
+    void SendSubscriptions(const OranSubscriptionSet& subscriptions);
+    /**
+     * Get the counters of the codec used when Serialize is enabled.
+     *
+     * @return The counters.
+     */
+    const OranE2CodecStats& GetCodecStats() const;
+
+    /**
+     * TracedCallback signature for received Reports.
+     *
+     * @param [in] report The Report.
+     */
+    typedef void (*ReportTracedCallback)(Ptr<const OranReport> report);
+    /**
+     * TracedCallback signature for sent Commands.
+     *
+     * @param [in] command The Command.
+     */
+    typedef void (*CommandTracedCallback)(Ptr<const OranCommand> command);
+    /**
+     * TracedCallback signature for encoded E2 messages.
+     *
+     * @param [in] type The type of the message.
+     * @param [in] size The size of the message, in bytes.
+     */
+    typedef void (*MessageTracedCallback)(OranE2MessageType type, uint32_t size);
 
   protected:
     /**
@@ -131,6 +182,37 @@ class OranNearRtRicE2Terminator : public Object
     void DoDispose() override;
 
   private:
+    /**
+     * Log a Report in the Data Repository.
+     *
+     * @param report The Report.
+     */
+    void SaveReport(Ptr<OranReport> report);
+    /**
+     * Log a Report in the Data Repository and notify the Near-RT RIC.
+     *
+     * @param report The Report.
+     */
+    void StoreReport(Ptr<OranReport> report);
+    /**
+     * Log a batch of Reports in the Data Repository in a single transaction
+     * and notify the Near-RT RIC.
+     *
+     * @param reports The Reports.
+     */
+    void StoreReportBatch(const std::vector<Ptr<OranReport>>& reports);
+    /**
+     * Deliver a Command to its target E2 Node Terminator.
+     *
+     * @param command The Command.
+     */
+    void DeliverCommand(Ptr<OranCommand> command);
+    /**
+     * Pass the message in m_buffer through the Transport, if any, and act
+     * on the messages that come back.
+     */
+    void RelayMessage();
+
     /**
      * Flag to keep track of active status
      */
@@ -147,10 +229,46 @@ class OranNearRtRicE2Terminator : public Object
      * Map with the active Node E2 Terminators, indexed by E2 Node IDs
      */
     std::map<uint64_t, Ptr<OranE2NodeTerminator>> m_nodeTerminators;
+    /**
+     * The subscriptions sent to the Node E2 Terminators.
+     */
+    OranSubscriptionSet m_subscriptions;
+    /**
+     * Flag to indicate if subscriptions have been set with SendSubscriptions.
+     */
+    bool m_hasSubscriptions;
     /**
      * The random variable used to to determine the transmission delay of a command.
      */
     Ptr<RandomVariableStream> m_transmissionDelayRv;
+    /**
+     * Flag to indicate if Reports and Commands are encoded into E2 messages.
+     */
+    bool m_serialize;
+    /**
+     * The transport the encoded messages are sent through, or nullptr.
+     */
+    Ptr<OranE2SocketTransport> m_transport;
+    /**
+     * The codec of the E2 messages.
+     */
+    OranE2Codec m_codec;
+    /**
+     * The buffer messages are encoded into.
+     */
+    std::vector<uint8_t> m_buffer;
+    /**
+     * The trace of Reports received and logged in the Data Repository.
+     */
+    TracedCallback<Ptr<const OranReport>> m_rxReportTrace;
+    /**
+     * The trace of Commands sent to E2 Node Terminators.
+     */
+    TracedCallback<Ptr<const OranCommand>> m_txCommandTrace;
+    /**
+     * The trace of encoded E2 messages.
+     */
+    TracedCallback<OranE2MessageType, uint32_t> m_messageTrace;
 }; // class  OranNearRtRicE2Terminator
 
 } // namespace ns3
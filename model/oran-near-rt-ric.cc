@@ -30,20 +30,26 @@
 
 #include "oran-near-rt-ric.h"
 
+#include "oran-cell-control-store.h"
 #include "oran-cmm.h"
 #include "oran-command.h"
 #include "oran-data-repository.h"
 #include "oran-lm.h"
 #include "oran-near-rt-ric-e2terminator.h"
 #include "oran-query-trigger.h"
+#include "oran-subscription.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 #include "ns3/string.h"
 
+#include <fstream>
+#include <sstream>
+#include <string>
 #include <vector>
 
 namespace ns3
@@ -108,18 +114,32 @@ OranNearRtRic::GetTypeId()
                 "The random variable used (in seconds) to periodically deregister inactive nodes.",
                 StringValue("ns3::ConstantRandomVariable[Constant=5]"),
                 MakePointerAccessor(&OranNearRtRic::m_e2NodeInactivityIntervalRv),
-                MakePointerChecker<RandomVariableStream>());
+                MakePointerChecker<RandomVariableStream>())
+            .AddAttribute("EnforceSubscriptions",
+                          "Flag to send the subscriptions of the Logic Modules and the Conflict "
+                          "Mitigation Module to the Node E2 Terminators, so that Reporters with "
+                          "no subscribers are suspended and periodic Reporters are relaxed to "
+                          "the shortest interval their subscribers need.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OranNearRtRic::m_enforceSubscriptions),
+                          MakeBooleanChecker())
+            .AddAttribute("TickService",
+                          "The tick service that coalesces the LM query and inactivity check "
+                          "timers. If null, the Near-RT RIC schedules its own simulator events.",
+                          PointerValue(nullptr),
+                          MakePointerAccessor(&OranNearRtRic::m_tickService),
+                          MakePointerChecker<OranTickService>());
 
     return tid;
 }
 
 OranNearRtRic::OranNearRtRic()
     : Object(),
+      m_cellControlStore(CreateObject<OranCellControlStore>()),
       m_additionalLms(std::map<std::string, Ptr<OranLm>>()),
       m_active(false),
-      m_lmQueryEvent(EventId()),
-      m_e2NodeInactivityEvent(EventId()),
-      m_lmQueryCycle(Seconds(0))
+      m_lmQueryCycle(Seconds(0)),
+      m_enforceSubscriptions(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -160,6 +180,8 @@ OranNearRtRic::Activate()
         }
         // Activate the conflic mitigation module
         m_cmm->Activate();
+
+        UpdateSubscriptions();
     }
 }
 
@@ -216,10 +238,13 @@ OranNearRtRic::Start()
     NS_ABORT_MSG_IF(m_lmQueryEvent.IsPending(), "Near-RT RIC has already been started");
     NS_ABORT_MSG_IF(m_e2NodeInactivityEvent.IsPending(), "Near-RT RIC has already been started");
 
-    m_lmQueryEvent = Simulator::Schedule(m_lmQueryInterval, &OranNearRtRic::QueryLms, this);
-    m_e2NodeInactivityEvent = Simulator::Schedule(Seconds(m_e2NodeInactivityIntervalRv->GetValue()),
-                                                  &OranNearRtRic::CheckForInactivity,
-                                                  this);
+    m_lmQueryEvent = OranTickService::Schedule(m_tickService,
+                                               m_lmQueryInterval,
+                                               MakeCallback(&OranNearRtRic::QueryLms, this));
+    m_e2NodeInactivityEvent =
+        OranTickService::Schedule(m_tickService,
+                                  Seconds(m_e2NodeInactivityIntervalRv->GetValue()),
+                                  MakeCallback(&OranNearRtRic::CheckForInactivity, this));
 }
 
 void
@@ -233,6 +258,134 @@ OranNearRtRic::Stop()
     m_processLmQueryCommandsEvent.Cancel();
 }
 
+void
+OranNearRtRic::SaveCheckpoint(std::string prefix)
+{
+    NS_LOG_FUNCTION(this << prefix);
+
+    NS_ABORT_MSG_IF(!m_active, "Attempting to checkpoint an inactive Near-RT RIC");
+
+    m_data->SaveCheckpoint(prefix + ".db");
+
+    std::ofstream out(prefix + ".state");
+    NS_ABORT_MSG_IF(!out.is_open(), "Cannot open checkpoint file " << prefix << ".state");
+
+    // Each section is "<kind> <size> <name>" followed by a payload of <size>
+    // bytes, so that sections of modules missing from the restoring run can
+    // be skipped.
+    auto writeSection = [&out](const std::string& kind,
+                               const std::string& name,
+                               const std::string& payload) {
+        out << kind << ' ' << payload.size() << ' ' << name << '\n' << payload;
+    };
+
+    out << "oran-ric-checkpoint 1\n" << "time " << Simulator::Now().GetTimeStep() << '\n';
+
+    std::ostringstream cellControl;
+    m_cellControlStore->SaveState(cellControl);
+    writeSection("cellcontrol", "", cellControl.str());
+
+    std::vector<Ptr<OranLm>> lms{m_defaultLm};
+    for (const auto& entry : m_additionalLms)
+    {
+        lms.push_back(entry.second);
+    }
+    for (const auto& lm : lms)
+    {
+        std::ostringstream state;
+        lm->SaveState(state);
+        writeSection("lm", lm->GetName(), state.str());
+    }
+
+    std::ostringstream cmmState;
+    m_cmm->SaveState(cmmState);
+    writeSection("cmm", m_cmm->GetName(), cmmState.str());
+
+    NS_ABORT_MSG_IF(!out, "Failed to write checkpoint file " << prefix << ".state");
+}
+
+void
+OranNearRtRic::RestoreCheckpoint(std::string prefix)
+{
+    NS_LOG_FUNCTION(this << prefix);
+
+    NS_ABORT_MSG_IF(!m_active, "Attempting to restore a checkpoint into an inactive Near-RT RIC");
+    // Registration hands out E2 Node IDs that the checkpoint also uses, and
+    // loading it replaces the nodes already registered.
+    NS_ABORT_MSG_IF(!m_data->GetLteUeE2NodeIds().empty() ||
+                        !m_data->GetNrUeE2NodeIds().empty() ||
+                        !m_data->GetLteEnbE2NodeIds().empty() ||
+                        !m_data->GetNrGnbE2NodeIds().empty(),
+                    "Attempting to restore a checkpoint after E2 Node Terminators registered");
+
+    std::ifstream in(prefix + ".state");
+    NS_ABORT_MSG_IF(!in.is_open(), "Cannot open checkpoint file " << prefix << ".state");
+
+    std::string magic;
+    uint32_t version = 0;
+    std::string timeKey;
+    uint64_t timeStep = 0;
+    in >> magic >> version >> timeKey >> timeStep;
+    NS_ABORT_MSG_IF(in.fail() || magic != "oran-ric-checkpoint" || timeKey != "time",
+                    prefix << ".state is not a Near-RT RIC checkpoint");
+    NS_ABORT_MSG_IF(version != 1, "Unsupported Near-RT RIC checkpoint version " << version);
+
+    const Time timeShift = Simulator::Now() - TimeStep(timeStep);
+    NS_LOG_LOGIC("Near-RT RIC restoring checkpoint " << prefix << " shifted by " << timeShift);
+
+    m_data->LoadCheckpoint(prefix + ".db", timeShift);
+
+    std::string kind;
+    std::size_t size = 0;
+    while (in >> kind >> size)
+    {
+        std::string name;
+        std::getline(in, name);
+        if (!name.empty() && name.front() == ' ')
+        {
+            name.erase(0, 1);
+        }
+
+        std::string payload(size, '\0');
+        in.read(payload.data(), size);
+        NS_ABORT_MSG_IF(static_cast<std::size_t>(in.gcount()) != size,
+                        "Truncated checkpoint file " << prefix << ".state");
+        std::istringstream state(payload);
+
+        if (kind == "cellcontrol")
+        {
+            m_cellControlStore->RestoreState(state);
+        }
+        else if (kind == "lm")
+        {
+            Ptr<OranLm> lm =
+                m_defaultLm->GetName() == name ? m_defaultLm : GetAdditionalLogicModule(name);
+            if (lm != nullptr)
+            {
+                lm->RestoreState(state, timeShift);
+            }
+            else
+            {
+                NS_LOG_WARN("Skipping checkpoint state of missing Logic Module \"" << name << "\"");
+            }
+        }
+        else if (kind == "cmm" && m_cmm->GetName() == name)
+        {
+            m_cmm->RestoreState(state, timeShift);
+        }
+        else
+        {
+            NS_LOG_WARN("Skipping checkpoint section \"" << kind << "\" for \"" << name << "\"");
+        }
+    }
+
+    // Restored nodes that do not register again in this run time out as usual.
+    for (const auto& [e2NodeId, registrationTime] : m_data->GetLastRegistrationRequests())
+    {
+        m_e2NodeLiveness.Update(e2NodeId, registrationTime);
+    }
+}
+
 Ptr<OranNearRtRicE2Terminator>
 OranNearRtRic::GetE2Terminator() const
 {
@@ -257,6 +410,7 @@ OranNearRtRic::SetDefaultLogicModule(Ptr<OranLm> newDefaultLm)
     NS_ABORT_MSG_IF(newDefaultLm == nullptr,
                     "Attempting to set a NULL Default Logic Module in the Near-RT RIC");
     m_defaultLm = newDefaultLm;
+    UpdateSubscriptions();
 }
 
 Ptr<OranLm>
@@ -289,6 +443,7 @@ OranNearRtRic::AddLogicModule(Ptr<OranLm> newLm)
     {
         NS_LOG_LOGIC("Near-RT RIC adding the \"" << newLm->GetName() << "\" Logic Module");
         m_additionalLms[newLm->GetName()] = newLm;
+        UpdateSubscriptions();
     }
     else
     {
@@ -310,6 +465,7 @@ OranNearRtRic::RemoveLogicModule(std::string name)
     {
         NS_LOG_LOGIC("Near-RT RIC removing the \"" << name << "\" Logic Module");
         m_additionalLms.erase(name);
+        UpdateSubscriptions();
     }
     else
     {
@@ -374,6 +530,14 @@ OranNearRtRic::Data() const
     return m_data;
 }
 
+Ptr<OranCellControlStore>
+OranNearRtRic::GetCellControlStore() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_cellControlStore;
+}
+
 Ptr<OranCmm>
 OranNearRtRic::GetCmm() const
 {
@@ -390,21 +554,39 @@ OranNearRtRic::SetCmm(Ptr<OranCmm> newCmm)
     NS_ABORT_MSG_IF(newCmm == nullptr,
                     "Attempting to set a NULL Conflict Mitigation Module in the Near-RT RIC");
     m_cmm = newCmm;
+    UpdateSubscriptions();
+}
+
+void
+OranNearRtRic::AddSubscription(const OranSubscription& subscription)
+{
+    NS_LOG_FUNCTION(this << subscription.reportType.GetName());
+
+    m_extraSubscriptions.push_back(subscription);
+    UpdateSubscriptions();
 }
 
 void
-OranNearRtRic::NotifyLmFinished(Time cycle, std::vector<Ptr<OranCommand>> commands, Ptr<OranLm> lm)
+OranNearRtRic::NotifyLmFinished(Time cycle,
+                                std::vector<Ptr<OranCommand>>&& commands,
+                                Ptr<OranLm> lm)
 {
     NS_LOG_FUNCTION(this << cycle << commands << lm);
 
-    // Indicate whether or not this is the default.
-    bool isDefaultLm = (lm == m_defaultLm);
-    // Create the key used to identify the LM.
-    std::tuple<std::string, bool> key = std::make_tuple(lm->GetName(), isDefaultLm);
+    // Find the slot of the LM, laying out the slots again if LMs were
+    // added, removed, or replaced since the last cycle.
+    m_lmQueryCommands.SetLms(m_defaultLm, m_additionalLms);
+    uint32_t lmId = m_lmQueryCommands.GetLmId(lm);
+    if (lmId == OranLmCommandArena::kInvalidLmId)
+    {
+        NS_LOG_WARN("Near-RT RIC dropping command(s) from \""
+                    << lm->GetName() << "\" because it is no longer a Logic Module of the RIC");
+        return;
+    }
 
-    if (m_lmQueryCommands.find(key) != m_lmQueryCommands.end())
+    if (m_lmQueryCommands.GetSlot(lmId).received)
     {
-        m_lmQueryCommands[key] = std::vector<Ptr<OranCommand>>();
+        m_lmQueryCommands.Reset(lmId);
     }
 
     // Check if the issued commands belong to this cycle.
@@ -417,9 +599,7 @@ OranNearRtRic::NotifyLmFinished(Time cycle, std::vector<Ptr<OranCommand>> comman
                          << lm->GetName() << "\" for cycle " << cycle.GetTimeStep());
 
             // Collect the commands generated by the LM
-            m_lmQueryCommands[key].insert(m_lmQueryCommands[key].end(),
-                                          commands.begin(),
-                                          commands.end());
+            m_lmQueryCommands.Store(lmId, std::move(commands));
         }
         else
         {
@@ -434,9 +614,7 @@ OranNearRtRic::NotifyLmFinished(Time cycle, std::vector<Ptr<OranCommand>> comman
                 break;
             case SAVE:
                 NS_LOG_LOGIC("Saving command(s) for this cycle due to late command policy");
-                m_lmQueryCommands[key].insert(m_lmQueryCommands[key].end(),
-                                              commands.begin(),
-                                              commands.end());
+                m_lmQueryCommands.Store(lmId, std::move(commands));
                 break;
             default:
                 NS_ABORT_MSG("Unsupported late command policy in Near-RT RIC");
@@ -453,7 +631,7 @@ OranNearRtRic::NotifyLmFinished(Time cycle, std::vector<Ptr<OranCommand>> comman
     // commands AND it is either the case that all commands have been received
     // before the maiximum wait time has been exceeded or there is no maximum
     // wait time.
-    if (m_lmQueryCommands.size() == m_additionalLms.size() + 1 &&
+    if (m_lmQueryCommands.GetNReceived() == m_lmQueryCommands.GetNLms() &&
         (m_processLmQueryCommandsEvent.IsPending() || m_lmQueryMaxWaitTime == Seconds(0)))
     {
         ProcessLmQueryCommands();
@@ -500,17 +678,21 @@ OranNearRtRic::DoDispose()
 
     m_e2Terminator = nullptr;
     m_data = nullptr;
+    m_cellControlStore = nullptr;
     m_defaultLm = nullptr;
 
     m_additionalLms.clear();
+    m_extraSubscriptions.clear();
 
     m_lmQueryEvent.Cancel();
     m_e2NodeInactivityEvent.Cancel();
     m_processLmQueryCommandsEvent.Cancel();
 
     m_cmm = nullptr;
+    m_tickService = nullptr;
 
-    m_lmQueryCommands.clear();
+    m_lmQueryCommands = OranLmCommandArena();
+    m_e2NodeLiveness.Clear();
 
     Object::DoDispose();
 }
@@ -534,6 +716,7 @@ OranNearRtRic::QueryLms()
 
         // Move to next cycle.
         m_lmQueryCycle = Simulator::Now();
+        m_lmQueryCommands.SetLms(m_defaultLm, m_additionalLms);
 
         NS_LOG_LOGIC("Near-RT RIC querying LMs and signaling for them to run for cycle "
                      << m_lmQueryCycle.GetTimeStep());
@@ -578,10 +761,28 @@ OranNearRtRic::QueryLms()
             lm.second->Run(m_lmQueryCycle);
         }
 
-        m_lmQueryEvent = Simulator::Schedule(m_lmQueryInterval, &OranNearRtRic::QueryLms, this);
+        m_lmQueryEvent = OranTickService::Schedule(m_tickService,
+                                                   m_lmQueryInterval,
+                                                   MakeCallback(&OranNearRtRic::QueryLms, this));
     }
 }
 
+void
+OranNearRtRic::NotifyE2NodeRegistered(uint64_t e2NodeId)
+{
+    NS_LOG_FUNCTION(this << e2NodeId);
+
+    m_e2NodeLiveness.Update(e2NodeId, Simulator::Now());
+}
+
+void
+OranNearRtRic::NotifyE2NodeDeregistered(uint64_t e2NodeId)
+{
+    NS_LOG_FUNCTION(this << e2NodeId);
+
+    m_e2NodeLiveness.Remove(e2NodeId);
+}
+
 void
 OranNearRtRic::CheckForInactivity()
 {
@@ -598,10 +799,10 @@ OranNearRtRic::CheckForInactivity()
 
         NS_LOG_LOGIC("Near-RT RIC checking for E2 Node inactivity");
 
-        std::vector<std::tuple<uint64_t, Time>> lastRegistrations =
-            m_data->GetLastRegistrationRequests();
+        std::vector<std::tuple<uint64_t, Time>> inactiveNodes =
+            m_e2NodeLiveness.PopInactive(Simulator::Now() - m_e2NodeInactivityThreshold);
 
-        for (auto lastreg : lastRegistrations)
+        for (auto lastreg : inactiveNodes)
         {
             uint64_t e2NodeId;
             Time registrationTime;
@@ -610,13 +811,10 @@ OranNearRtRic::CheckForInactivity()
 
             Time inactivityPeriod = Simulator::Now() - registrationTime;
 
-            if (inactivityPeriod > m_e2NodeInactivityThreshold)
-            {
-                NS_LOG_LOGIC("Near-RT RIC deactivating E2 Node with ID "
-                             << e2NodeId << " that has not registered in "
-                             << inactivityPeriod.GetSeconds() << " s");
-                m_e2Terminator->ReceiveDeregistrationRequest(e2NodeId);
-            }
+            NS_LOG_LOGIC("Near-RT RIC deactivating E2 Node with ID "
+                         << e2NodeId << " that has not registered in "
+                         << inactivityPeriod.GetSeconds() << " s");
+            m_e2Terminator->ReceiveDeregistrationRequest(e2NodeId);
         }
 
         if (m_e2NodeInactivityEvent.IsPending())
@@ -625,10 +823,33 @@ OranNearRtRic::CheckForInactivity()
         }
 
         m_e2NodeInactivityEvent =
-            Simulator::Schedule(Seconds(m_e2NodeInactivityIntervalRv->GetValue()),
-                                &OranNearRtRic::CheckForInactivity,
-                                this);
+            OranTickService::Schedule(m_tickService,
+                                      Seconds(m_e2NodeInactivityIntervalRv->GetValue()),
+                                      MakeCallback(&OranNearRtRic::CheckForInactivity, this));
+    }
+}
+
+void
+OranNearRtRic::UpdateSubscriptions()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_enforceSubscriptions || !m_active)
+    {
+        return;
     }
+
+    OranSubscriptionSet subscriptions;
+    subscriptions.Add(m_defaultLm->GetSubscriptions());
+    for (const auto& entry : m_additionalLms)
+    {
+        subscriptions.Add(entry.second->GetSubscriptions());
+    }
+    subscriptions.Add(m_cmm->GetSubscriptions());
+    subscriptions.Add(m_extraSubscriptions);
+
+    NS_LOG_LOGIC("Near-RT RIC subscriptions: " << subscriptions.ToString());
+    m_e2Terminator->SendSubscriptions(subscriptions);
 }
 
 void
@@ -650,7 +871,7 @@ OranNearRtRic::ProcessLmQueryCommands()
         // set of commands generated
         m_e2Terminator->ProcessCommands(m_cmm->Filter(m_lmQueryCommands));
 
-        m_lmQueryCommands.clear();
+        m_lmQueryCommands.Clear();
     }
 }
 
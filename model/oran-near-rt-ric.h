@@ -31,23 +31,30 @@
 #ifndef ORAN_NEAR_RT_RIC_H
 #define ORAN_NEAR_RT_RIC_H
 
+#include "oran-e2-node-liveness-tracker.h"
+#include "oran-lm-command-arena.h"
+#include "oran-tick-service.h"
+
 #include "ns3/event-id.h"
 #include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/random-variable-stream.h"
 
 #include <map>
+#include <vector>
 
 namespace ns3
 {
 
 class OranLm;
+class OranCellControlStore;
 class OranCmm;
 class OranCommand;
 class OranDataRepository;
 class OranNearRtRicE2Terminator;
 class OranQueryTrigger;
 class OranReport;
+struct OranSubscription;
 
 /**
  * @defgroup oran O-RAN architecture
@@ -165,6 +172,31 @@ class OranNearRtRic : public Object
      * Deactivate and stop periodically querying the LMs.
      */
     void Stop();
+    /**
+     * Write a checkpoint of the state of the RIC: the contents of the Data
+     * Repository to "<prefix>.db", and the cell-control parameters and the
+     * internal state of the Logic Modules and the Conflict Mitigation Module
+     * to "<prefix>.state".
+     *
+     * @param prefix The path of the checkpoint files, without extension.
+     */
+    void SaveCheckpoint(std::string prefix);
+    /**
+     * Restore a checkpoint written by SaveCheckpoint, usually in a new run of
+     * the same scenario, so that the RIC does not have to warm up again. The
+     * simulation times in the checkpoint are shifted so that the time it was
+     * written becomes the current time. Only the RIC is restored; the E2
+     * Nodes register again, and get back the E2 Node IDs they had. Nodes in
+     * the checkpoint that do not register again become inactive as usual.
+     *
+     * The RIC must be active, and no E2 Node Terminator may have registered
+     * yet, as their registrations would be lost and their E2 Node IDs could
+     * clash with the ones in the checkpoint. This is usually scheduled right
+     * after Start, before the E2 Node Terminators are activated.
+     *
+     * @param prefix The path of the checkpoint files, without extension.
+     */
+    void RestoreCheckpoint(std::string prefix);
 
     /* Getters and Setters for the modules in the Near-RT RIC */
     /**
@@ -233,6 +265,13 @@ class OranNearRtRic : public Object
      * @return A pointer to the Data Repository instance.
      */
     Ptr<OranDataRepository> Data() const;
+    /**
+     * Get the store of the cell-control parameters applied to the cells of
+     * this RIC.
+     *
+     * @return The cell-control parameter store.
+     */
+    Ptr<OranCellControlStore> GetCellControlStore() const;
     /**
      * Get the Conflict Mitigation Module.
      *
@@ -245,15 +284,24 @@ class OranNearRtRic : public Object
      * @param newCmm The Conflict Mitigation Module to use.
      */
     void SetCmm(Ptr<OranCmm> newCmm);
+    /**
+     * Add a subscription that does not belong to any module, e.g., for the
+     * Reports that the scenario reads from the Data Repository once the
+     * simulation ends. It only has an effect when EnforceSubscriptions is
+     * true.
+     *
+     * @param subscription The subscription.
+     */
+    void AddSubscription(const OranSubscription& subscription);
     /**
      * Notifies the Near-RT RIC that a Logic Module has finished running.
      *
      * @param lmQueryCycle The lmQueryCycle that the commands were generated for.
-     * @param commands The commands that were generated.
+     * @param commands The commands that were generated, moved into the cycle's collection.
      * @param lm The Logic Module that generated the commands.
      */
     void NotifyLmFinished(Time lmQueryCycle,
-                          std::vector<Ptr<OranCommand>> commands,
+                          std::vector<Ptr<OranCommand>>&& commands,
                           Ptr<OranLm> lm);
     /**
      * Notifies the Near-RT RIC that a report was received.
@@ -261,6 +309,18 @@ class OranNearRtRic : public Object
      * @param report The report that was received.
      */
     void NotifyReportReceived(Ptr<OranReport> report);
+    /**
+     * Notifies the Near-RT RIC that an E2 Node sent a registration request.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     */
+    void NotifyE2NodeRegistered(uint64_t e2NodeId);
+    /**
+     * Notifies the Near-RT RIC that an E2 Node was deregistered.
+     *
+     * @param e2NodeId The E2 Node ID of the node.
+     */
+    void NotifyE2NodeDeregistered(uint64_t e2NodeId);
 
   protected:
     /**
@@ -282,6 +342,13 @@ class OranNearRtRic : public Object
      * Processes the commands received for this LM query cycle.
      */
     void ProcessLmQueryCommands();
+    /**
+     * Computes the union of the subscriptions of the Logic Modules, the
+     * Conflict Mitigation Module, and the ones added with AddSubscription,
+     * and sends it to the Node E2 Terminators, if EnforceSubscriptions is
+     * true and the Near-RT RIC is active.
+     */
+    void UpdateSubscriptions();
 
     /**
      * The E2 Terminator.
@@ -291,6 +358,10 @@ class OranNearRtRic : public Object
      * The Data Repository implementation.
      */
     Ptr<OranDataRepository> m_data;
+    /**
+     * The cell-control parameters applied to the cells of this RIC.
+     */
+    Ptr<OranCellControlStore> m_cellControlStore;
     /**
      * The default Logic Module.
      */
@@ -314,11 +385,15 @@ class OranNearRtRic : public Object
     /**
      * Event for the scheduling of LM querying.
      */
-    EventId m_lmQueryEvent;
+    OranTickEventId m_lmQueryEvent;
     /**
      * The event for scheduling to check for node inactivity.
      */
-    EventId m_e2NodeInactivityEvent;
+    OranTickEventId m_e2NodeInactivityEvent;
+    /**
+     * The tick service the LM query and inactivity check timers are scheduled on, if any.
+     */
+    Ptr<OranTickService> m_tickService;
     /**
      * The amount of time that must pass from a node's last registration before determining a node
      * is inactive.
@@ -328,6 +403,10 @@ class OranNearRtRic : public Object
      * The random variable used to periodically schedule checks for node inactivity.
      */
     Ptr<RandomVariableStream> m_e2NodeInactivityIntervalRv;
+    /**
+     * The last registration time of every registered E2 Node.
+     */
+    OranE2NodeLivenessTracker m_e2NodeLiveness;
     /**
      * The current LM query cycle.
      */
@@ -347,11 +426,19 @@ class OranNearRtRic : public Object
     /**
      * The collection of LM commands to send at the end of the query cycle.
      */
-    std::map<std::tuple<std::string, bool>, std::vector<Ptr<OranCommand>>> m_lmQueryCommands;
+    OranLmCommandArena m_lmQueryCommands;
     /**
      * The vector of LM query triggers, indexed by their names.
      */
     std::map<std::string, Ptr<OranQueryTrigger>> m_queryTriggers;
+    /**
+     * Flag to suspend the Reporters that no module subscribes to.
+     */
+    bool m_enforceSubscriptions;
+    /**
+     * The subscriptions added with AddSubscription.
+     */
+    std::vector<OranSubscription> m_extraSubscriptions;
 }; // class OranNearRtRic
 
 } // namespace ns3
@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-onnx-model.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <array>
+#include <map>
+#include <mutex>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranOnnxModel");
+
+namespace
+{
+
+/**
+ * @return The ONNX Runtime environment shared by all the sessions.
+ */
+Ort::Env&
+GetEnv()
+{
+    static Ort::Env env;
+    return env;
+}
+
+/**
+ * The models imported by Preload(), by path. They are never modified once
+ * imported, and the map itself is only accessed with the mutex held.
+ */
+struct PreloadedModels
+{
+    std::mutex mutex; //!< Guards models.
+    std::map<std::string, std::shared_ptr<const OranOnnxNativeModel>> models; //!< By path.
+};
+
+/**
+ * @return The models imported by Preload().
+ */
+PreloadedModels&
+GetPreloaded()
+{
+    static PreloadedModels preloaded;
+    return preloaded;
+}
+
+/**
+ * Find a model imported by Preload().
+ *
+ * @param path The path of the ONNX file.
+ * @return The model, or null if the path was not preloaded.
+ */
+std::shared_ptr<const OranOnnxNativeModel>
+FindPreloaded(const std::string& path)
+{
+    PreloadedModels& preloaded = GetPreloaded();
+    std::lock_guard<std::mutex> lock(preloaded.mutex);
+    auto it = preloaded.models.find(path);
+    return it == preloaded.models.end() ? nullptr : it->second;
+}
+
+} // namespace
+
+OranOnnxModel::OranOnnxModel()
+    : m_nativeEnabled(true),
+      m_rowByRow(true),
+      m_inputSize(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranOnnxModel::~OranOnnxModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranOnnxModel::Load(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+
+    m_path = path;
+    m_session = Ort::Session{nullptr};
+    m_native.reset();
+
+    if (m_nativeEnabled)
+    {
+        m_native = FindPreloaded(path);
+        if (m_native)
+        {
+            NS_LOG_LOGIC("Running \"" << path << "\" with the preloaded built-in engine");
+            return;
+        }
+        auto native = std::make_shared<OranOnnxNativeModel>();
+        if (native->Load(path))
+        {
+            NS_LOG_LOGIC("Running \"" << path << "\" with the built-in engine");
+            m_native = native;
+            return;
+        }
+        NS_LOG_LOGIC("Running \"" << path << "\" with ONNX Runtime: "
+                                  << native->GetUnsupportedReason());
+    }
+
+    m_session = Ort::Session(GetEnv(), path.c_str(), Ort::SessionOptions{});
+
+    Ort::AllocatorWithDefaultOptions allocator;
+    m_inputName = m_session.GetInputNameAllocated(0UL, allocator).get();
+    m_outputName = m_session.GetOutputNameAllocated(0UL, allocator).get();
+    const auto shape = m_session.GetInputTypeInfo(0UL).GetTensorTypeAndShapeInfo().GetShape();
+    m_rowByRow = shape.empty() || shape[0] == 1;
+    m_inputSize = shape.size() > 1 && shape.back() > 0 ? static_cast<std::size_t>(shape.back()) : 0;
+}
+
+bool
+OranOnnxModel::Preload(const std::string& path)
+{
+    NS_LOG_FUNCTION(path);
+
+    if (FindPreloaded(path))
+    {
+        return true;
+    }
+    auto native = std::make_shared<OranOnnxNativeModel>();
+    if (!native->Load(path))
+    {
+        NS_LOG_LOGIC("Not preloading \"" << path << "\": " << native->GetUnsupportedReason());
+        return false;
+    }
+    PreloadedModels& preloaded = GetPreloaded();
+    std::lock_guard<std::mutex> lock(preloaded.mutex);
+    preloaded.models.emplace(path, native);
+    return true;
+}
+
+void
+OranOnnxModel::SetNativeEnabled(bool enabled)
+{
+    NS_LOG_FUNCTION(this << enabled);
+
+    m_nativeEnabled = enabled;
+    if (IsLoaded())
+    {
+        Load(m_path);
+    }
+}
+
+bool
+OranOnnxModel::IsLoaded() const
+{
+    return m_native || m_session;
+}
+
+bool
+OranOnnxModel::IsNative() const
+{
+    return m_native != nullptr;
+}
+
+std::size_t
+OranOnnxModel::GetInputSize() const
+{
+    return m_native ? m_native->GetInputSize() : m_inputSize;
+}
+
+const std::vector<float>&
+OranOnnxModel::Run(const std::vector<float>& input)
+{
+    return Run(input.data(), 1, input.size());
+}
+
+const std::vector<float>&
+OranOnnxModel::Run(const float* input, std::size_t nRows, std::size_t rowSize)
+{
+    NS_LOG_FUNCTION(this << nRows << rowSize);
+
+    NS_ABORT_MSG_IF(!IsLoaded(), "No ONNX model loaded");
+
+    if (m_native)
+    {
+        NS_ABORT_MSG_IF(rowSize != m_native->GetInputSize(),
+                        "Model \"" << m_path << "\" takes " << m_native->GetInputSize()
+                                   << " features, not " << rowSize);
+        m_native->Run(input, nRows, m_scratch, m_output);
+        return m_output;
+    }
+
+    m_output.clear();
+    std::array<const char*, 1> inputNames{m_inputName.c_str()};
+    std::array<const char*, 1> outputNames{m_outputName.c_str()};
+    std::size_t step = m_rowByRow ? 1 : nRows;
+    for (std::size_t row = 0; row < nRows; row += step)
+    {
+        std::array<int64_t, 2> shape{static_cast<int64_t>(step), static_cast<int64_t>(rowSize)};
+        Ort::Value tensor =
+            Ort::Value::CreateTensor<float>(m_memoryInfo,
+                                            const_cast<float*>(input + row * rowSize),
+                                            step * rowSize,
+                                            shape.data(),
+                                            shape.size());
+        auto output = m_session.Run(Ort::RunOptions{},
+                                    inputNames.data(),
+                                    &tensor,
+                                    1,
+                                    outputNames.data(),
+                                    1);
+        const auto info = output[0].GetTensorTypeAndShapeInfo();
+        std::size_t count = info.GetElementCount();
+        if (info.GetElementType() == ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64)
+        {
+            const int64_t* data = output[0].GetTensorData<int64_t>();
+            m_output.insert(m_output.end(), data, data + count);
+        }
+        else
+        {
+            const float* data = output[0].GetTensorData<float>();
+            m_output.insert(m_output.end(), data, data + count);
+        }
+    }
+    return m_output;
+}
+
+} // namespace ns3
@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_ONNX_MODEL_H
+#define ORAN_ONNX_MODEL_H
+
+#include "oran-onnx-native-model.h"
+
+#include <memory>
+#include <onnxruntime_cxx_api.h>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * An ONNX model used by a Logic Module. The model is run by the built-in
+ * OranOnnxNativeModel engine when it supports the graph and native
+ * inference is enabled, and by ONNX Runtime otherwise, so that callers do
+ * not need to know which one is in use.
+ *
+ * The model has one float input of shape [rows, features], and only its
+ * first output is read. An INT64 output, like the label of a classifier,
+ * is converted to floats.
+ *
+ * Preload() imports a model with the built-in engine once per process, and
+ * every OranOnnxModel that loads the same path afterwards shares it instead
+ * of reading the file again. A shared model is never modified after it is
+ * imported; every OranOnnxModel runs it with its own scratch rows. The
+ * built-in engine starts no threads, so a scenario can preload its models
+ * before forking the workers of a sweep (see OranSweepRunner), and the
+ * workers share the weights copy-on-write.
+ */
+class OranOnnxModel
+{
+  public:
+    /**
+     * Constructor of the OranOnnxModel class.
+     */
+    OranOnnxModel();
+    /**
+     * Destructor of the OranOnnxModel class.
+     */
+    ~OranOnnxModel();
+    /**
+     * Load a model, replacing the one loaded, if any.
+     *
+     * @param path The path of the ONNX file.
+     */
+    void Load(const std::string& path);
+    /**
+     * Import a model with the built-in engine for every OranOnnxModel of
+     * the process that loads the same path with native inference enabled.
+     * Models the built-in engine does not support are not preloaded, and
+     * are loaded by ONNX Runtime when Load() is called. It may be called
+     * from any thread.
+     *
+     * @param path The path of the ONNX file.
+     * @return True if the model was preloaded.
+     */
+    static bool Preload(const std::string& path);
+    /**
+     * Set whether the built-in engine is tried before ONNX Runtime. If a
+     * model is loaded, it is loaded again.
+     *
+     * @param enabled True to use the built-in engine when possible.
+     */
+    void SetNativeEnabled(bool enabled);
+    /**
+     * @return True if a model is loaded.
+     */
+    bool IsLoaded() const;
+    /**
+     * @return True if the loaded model runs on the built-in engine.
+     */
+    bool IsNative() const;
+    /**
+     * @return The number of features in a row of the input of the loaded
+     *         model, or 0 if it is not fixed.
+     */
+    std::size_t GetInputSize() const;
+    /**
+     * Run the model on one row.
+     *
+     * @param input The features.
+     * @return The first output of the model.
+     */
+    const std::vector<float>& Run(const std::vector<float>& input);
+    /**
+     * Run the model on a batch of rows.
+     *
+     * @param input The rows, one after the other.
+     * @param nRows The number of rows.
+     * @param rowSize The number of features in a row.
+     * @return The first output for every row, one after the other.
+     */
+    const std::vector<float>& Run(const float* input, std::size_t nRows, std::size_t rowSize);
+
+  private:
+    /**
+     * The path of the loaded model.
+     */
+    std::string m_path;
+    /**
+     * Whether the built-in engine is tried first.
+     */
+    bool m_nativeEnabled;
+    /**
+     * The built-in engine, shared with the other models of the same
+     * preloaded path, or null when ONNX Runtime is used.
+     */
+    std::shared_ptr<const OranOnnxNativeModel> m_native;
+    /**
+     * The scratch rows of the built-in engine, owned by this model.
+     */
+    std::vector<float> m_scratch;
+    /**
+     * The ONNX Runtime session, used when the built-in engine is not.
+     */
+    Ort::Session m_session{nullptr};
+    /**
+     * The memory description of the ONNX Runtime input tensors.
+     */
+    Ort::MemoryInfo m_memoryInfo{Ort::MemoryInfo::CreateCpu(OrtDeviceAllocator, OrtMemTypeCPU)};
+    /**
+     * Whether the ONNX Runtime session takes one row at a time.
+     */
+    bool m_rowByRow;
+    /**
+     * The number of features in a row of the input of the ONNX Runtime
+     * session, or 0 if it is not fixed.
+     */
+    std::size_t m_inputSize;
+    /**
+     * The name of the input of the ONNX Runtime session.
+     */
+    std::string m_inputName;
+    /**
+     * The name of the first output of the ONNX Runtime session.
+     */
+    std::string m_outputName;
+    /**
+     * The output of the last run.
+     */
+    std::vector<float> m_output;
+}; // class OranOnnxModel
+
+} // namespace ns3
+
+#endif // ORAN_ONNX_MODEL_H
@@ -0,0 +1,1587 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-onnx-native-model.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranOnnxNativeModel");
+
+namespace
+{
+
+/**
+ * The number of floats processed together by the dense kernel.
+ */
+constexpr std::size_t LANES = 8;
+
+/**
+ * The alignment of the weights and scratch rows, in bytes.
+ */
+constexpr std::size_t ALIGNMENT = 64;
+
+/**
+ * @param n A number of floats.
+ * @return n rounded up to a multiple of LANES.
+ */
+std::size_t
+Pad(std::size_t n)
+{
+    return (n + LANES - 1) / LANES * LANES;
+}
+
+/**
+ * Allocate an aligned, zeroed block of floats.
+ *
+ * @param n The number of floats.
+ * @return The block, to be released with std::free.
+ */
+float*
+AllocateAligned(std::size_t n)
+{
+    std::size_t bytes = (std::max<std::size_t>(n, 1) * sizeof(float) + ALIGNMENT - 1) /
+                        ALIGNMENT * ALIGNMENT;
+    auto* block = static_cast<float*>(std::aligned_alloc(ALIGNMENT, bytes));
+    NS_ABORT_MSG_IF(block == nullptr, "Could not allocate " << bytes << " bytes");
+    std::memset(block, 0, bytes);
+    return block;
+}
+
+#if defined(__GNUC__)
+/**
+ * Eight floats, mapped by the compiler to one AVX register, or to two SSE or
+ * NEON registers.
+ */
+typedef float Float8 __attribute__((vector_size(LANES * sizeof(float))));
+
+/**
+ * Multiply eight floats of a and b and add them to acc. Vectors are passed
+ * by reference, as they are not passed in registers without AVX.
+ *
+ * @param acc The accumulator.
+ * @param a Eight floats.
+ * @param b Eight floats.
+ */
+inline void
+MultiplyAdd(Float8& acc, const float* a, const float* b)
+{
+    Float8 va;
+    Float8 vb;
+    std::memcpy(&va, a, sizeof(va));
+    std::memcpy(&vb, b, sizeof(vb));
+    acc += va * vb;
+}
+
+/**
+ * @param v A vector.
+ * @return The sum of its floats.
+ */
+inline float
+Sum(const Float8& v)
+{
+    return ((v[0] + v[4]) + (v[1] + v[5])) + ((v[2] + v[6]) + (v[3] + v[7]));
+}
+#endif
+
+/**
+ * Dense layer kernel: y[o] = bias[o] + w[o] . x for every output o.
+ *
+ * Four outputs are computed together, so that every load of x is used four
+ * times and the four accumulators do not wait on each other.
+ *
+ * @param w The weights, one row of stride floats per output.
+ * @param bias The bias.
+ * @param x The input row, stride floats.
+ * @param stride The padded length of the rows, a multiple of LANES.
+ * @param nOut The number of outputs.
+ * @param y The output row.
+ */
+void
+Dense(const float* w,
+      const float* bias,
+      const float* x,
+      std::size_t stride,
+      std::size_t nOut,
+      float* y)
+{
+#if defined(__GNUC__)
+    std::size_t o = 0;
+    for (; o + 4 <= nOut; o += 4)
+    {
+        const float* w0 = w + o * stride;
+        Float8 acc0 = {};
+        Float8 acc1 = {};
+        Float8 acc2 = {};
+        Float8 acc3 = {};
+        for (std::size_t i = 0; i < stride; i += LANES)
+        {
+            MultiplyAdd(acc0, w0 + i, x + i);
+            MultiplyAdd(acc1, w0 + stride + i, x + i);
+            MultiplyAdd(acc2, w0 + 2 * stride + i, x + i);
+            MultiplyAdd(acc3, w0 + 3 * stride + i, x + i);
+        }
+        y[o] = bias[o] + Sum(acc0);
+        y[o + 1] = bias[o + 1] + Sum(acc1);
+        y[o + 2] = bias[o + 2] + Sum(acc2);
+        y[o + 3] = bias[o + 3] + Sum(acc3);
+    }
+    for (; o < nOut; o++)
+    {
+        Float8 acc = {};
+        for (std::size_t i = 0; i < stride; i += LANES)
+        {
+            MultiplyAdd(acc, w + o * stride + i, x + i);
+        }
+        y[o] = bias[o] + Sum(acc);
+    }
+#else
+    for (std::size_t o = 0; o < nOut; o++)
+    {
+        float acc[LANES] = {};
+        for (std::size_t i = 0; i < stride; i += LANES)
+        {
+            for (std::size_t k = 0; k < LANES; k++)
+            {
+                acc[k] += w[o * stride + i + k] * x[i + k];
+            }
+        }
+        y[o] = bias[o] + ((acc[0] + acc[4]) + (acc[1] + acc[5])) +
+               ((acc[2] + acc[6]) + (acc[3] + acc[7]));
+    }
+#endif
+}
+
+/**
+ * Reader of the protocol buffers wire format, enough for ONNX files.
+ * Errors set ok to false instead of aborting, so that the caller can fall
+ * back to ONNX Runtime.
+ */
+struct PbReader
+{
+    const uint8_t* p;   //!< The next byte.
+    const uint8_t* end; //!< One past the last byte.
+    bool ok = true;     //!< False once the input was found malformed.
+
+    /**
+     * @return The next varint.
+     */
+    uint64_t Varint()
+    {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64 && p < end; shift += 7)
+        {
+            uint8_t byte = *p++;
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+            {
+                return value;
+            }
+        }
+        ok = false;
+        return 0;
+    }
+
+    /**
+     * Read the key of the next field.
+     *
+     * @param field Set to the field number.
+     * @param wire Set to the wire type.
+     * @return False at the end of the message or on error.
+     */
+    bool Next(uint32_t& field, uint32_t& wire)
+    {
+        if (!ok || p >= end)
+        {
+            return false;
+        }
+        uint64_t key = Varint();
+        field = static_cast<uint32_t>(key >> 3);
+        wire = static_cast<uint32_t>(key & 7);
+        return ok;
+    }
+
+    /**
+     * @return The next length-delimited field, as a reader.
+     */
+    PbReader Bytes()
+    {
+        uint64_t length = Varint();
+        if (!ok || length > static_cast<uint64_t>(end - p))
+        {
+            ok = false;
+            return PbReader{end, end, false};
+        }
+        PbReader sub{p, p + length};
+        p += length;
+        return sub;
+    }
+
+    /**
+     * @return The next length-delimited field, as a string.
+     */
+    std::string String()
+    {
+        PbReader sub = Bytes();
+        return std::string(reinterpret_cast<const char*>(sub.p), sub.end - sub.p);
+    }
+
+    /**
+     * @return The next 32-bit float.
+     */
+    float Fixed32Float()
+    {
+        if (end - p < 4)
+        {
+            ok = false;
+            return 0;
+        }
+        uint32_t bits = p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        p += 4;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Skip a field.
+     *
+     * @param wire The wire type of the field.
+     */
+    void Skip(uint32_t wire)
+    {
+        switch (wire)
+        {
+        case 0:
+            Varint();
+            break;
+        case 1:
+            p = end - p < 8 ? (ok = false, end) : p + 8;
+            break;
+        case 2:
+            Bytes();
+            break;
+        case 5:
+            p = end - p < 4 ? (ok = false, end) : p + 4;
+            break;
+        default:
+            ok = false;
+        }
+    }
+
+    /**
+     * Append a repeated int64 field, packed or not.
+     *
+     * @param wire The wire type of the field.
+     * @param values The values.
+     */
+    void Ints(uint32_t wire, std::vector<int64_t>& values)
+    {
+        if (wire == 2)
+        {
+            PbReader packed = Bytes();
+            while (packed.ok && packed.p < packed.end)
+            {
+                values.push_back(static_cast<int64_t>(packed.Varint()));
+            }
+            ok = ok && packed.ok;
+        }
+        else
+        {
+            values.push_back(static_cast<int64_t>(Varint()));
+        }
+    }
+
+    /**
+     * Append a repeated float field, packed or not.
+     *
+     * @param wire The wire type of the field.
+     * @param values The values.
+     */
+    void Floats(uint32_t wire, std::vector<float>& values)
+    {
+        if (wire == 2)
+        {
+            PbReader packed = Bytes();
+            while (packed.ok && packed.p < packed.end)
+            {
+                values.push_back(packed.Fixed32Float());
+            }
+            ok = ok && packed.ok;
+        }
+        else
+        {
+            values.push_back(Fixed32Float());
+        }
+    }
+};
+
+/**
+ * An ONNX tensor (TensorProto), converted to floats or int64s.
+ */
+struct Tensor
+{
+    std::vector<int64_t> dims;   //!< The dimensions.
+    std::vector<float> floats;   //!< The data of a FLOAT tensor.
+    std::vector<int64_t> ints;   //!< The data of an INT64 tensor.
+    int32_t dataType = 0;        //!< The ONNX data type.
+
+    /**
+     * @return The number of elements.
+     */
+    std::size_t Size() const
+    {
+        std::size_t size = 1;
+        for (auto dim : dims)
+        {
+            size *= static_cast<std::size_t>(std::max<int64_t>(dim, 0));
+        }
+        return size;
+    }
+};
+
+/**
+ * ONNX data types used here.
+ */
+enum OnnxDataType : int32_t
+{
+    ONNX_FLOAT = 1,
+    ONNX_INT64 = 7,
+};
+
+/**
+ * An ONNX node attribute (AttributeProto).
+ */
+struct Attribute
+{
+    float f = 0;                      //!< FLOAT value.
+    int64_t i = 0;                    //!< INT value.
+    std::string s;                    //!< STRING value.
+    std::vector<float> floats;        //!< FLOATS value.
+    std::vector<int64_t> ints;        //!< INTS value.
+    std::vector<std::string> strings; //!< STRINGS value.
+    bool hasTensor = false;           //!< Whether the value is a tensor.
+    Tensor t;                         //!< TENSOR value.
+};
+
+/**
+ * An ONNX node (NodeProto).
+ */
+struct Node
+{
+    std::vector<std::string> inputs;             //!< The input names.
+    std::vector<std::string> outputs;            //!< The output names.
+    std::string opType;                          //!< The operator.
+    std::string domain;                          //!< The operator domain.
+    std::map<std::string, Attribute> attributes; //!< The attributes.
+
+    /**
+     * @param name The attribute.
+     * @return The attribute, or nullptr.
+     */
+    const Attribute* Get(const std::string& name) const
+    {
+        auto it = attributes.find(name);
+        return it != attributes.end() ? &it->second : nullptr;
+    }
+
+    /**
+     * @param name The attribute.
+     * @param defaultValue The value if the attribute is absent.
+     * @return The INT value of the attribute.
+     */
+    int64_t GetInt(const std::string& name, int64_t defaultValue) const
+    {
+        const Attribute* attribute = Get(name);
+        return attribute != nullptr ? attribute->i : defaultValue;
+    }
+
+    /**
+     * @param name The attribute.
+     * @param defaultValue The value if the attribute is absent.
+     * @return The FLOAT value of the attribute.
+     */
+    float GetFloat(const std::string& name, float defaultValue) const
+    {
+        const Attribute* attribute = Get(name);
+        return attribute != nullptr ? attribute->f : defaultValue;
+    }
+};
+
+/**
+ * An ONNX graph (GraphProto), reduced to what is needed here.
+ */
+struct Graph
+{
+    std::vector<Node> nodes;                   //!< The nodes, in topological order.
+    std::map<std::string, Tensor> initializers; //!< The constant tensors.
+    std::vector<std::string> inputs;           //!< The graph inputs.
+    std::vector<int64_t> inputLastDims;        //!< The last dimension of each input, or -1.
+    std::vector<std::string> outputs;          //!< The graph outputs.
+};
+
+/**
+ * Read a TensorProto.
+ *
+ * @param reader The reader of the message.
+ * @param directory The directory of the model, for external data.
+ * @param name Set to the name of the tensor.
+ * @param error Set on failure.
+ * @return The tensor.
+ */
+Tensor
+ReadTensor(PbReader reader, const std::string& directory, std::string& name, std::string& error)
+{
+    Tensor tensor;
+    std::string raw;
+    std::map<std::string, std::string> external;
+    bool isExternal = false;
+    uint32_t field;
+    uint32_t wire;
+    while (reader.Next(field, wire))
+    {
+        switch (field)
+        {
+        case 1:
+            reader.Ints(wire, tensor.dims);
+            break;
+        case 2:
+            tensor.dataType = static_cast<int32_t>(reader.Varint());
+            break;
+        case 4:
+            reader.Floats(wire, tensor.floats);
+            break;
+        case 7:
+            reader.Ints(wire, tensor.ints);
+            break;
+        case 8:
+            name = reader.String();
+            break;
+        case 9:
+            raw = reader.String();
+            break;
+        case 13: {
+            PbReader entry = reader.Bytes();
+            std::string key;
+            std::string value;
+            uint32_t f;
+            uint32_t w;
+            while (entry.Next(f, w))
+            {
+                if (f == 1)
+                {
+                    key = entry.String();
+                }
+                else if (f == 2)
+                {
+                    value = entry.String();
+                }
+                else
+                {
+                    entry.Skip(w);
+                }
+            }
+            external[key] = value;
+            break;
+        }
+        case 14:
+            isExternal = reader.Varint() == 1;
+            break;
+        default:
+            reader.Skip(wire);
+        }
+    }
+    if (!reader.ok)
+    {
+        error = "malformed tensor";
+        return tensor;
+    }
+
+    if (isExternal)
+    {
+        std::string path = directory + external["location"];
+        std::ifstream file(path, std::ios::binary);
+        if (!file.good())
+        {
+            error = "external data file \"" + path + "\" not found";
+            return tensor;
+        }
+        std::size_t offset = external.count("offset") ? std::stoull(external["offset"]) : 0;
+        file.seekg(0, std::ios::end);
+        std::size_t fileSize = static_cast<std::size_t>(file.tellg());
+        std::size_t length = external.count("length") ? std::stoull(external["length"])
+                                                       : fileSize - std::min(offset, fileSize);
+        if (offset + length > fileSize)
+        {
+            error = "external data of \"" + name + "\" is out of \"" + path + "\"";
+            return tensor;
+        }
+        raw.resize(length);
+        file.seekg(offset);
+        file.read(&raw[0], length);
+    }
+
+    if (!raw.empty())
+    {
+        if (tensor.dataType == ONNX_FLOAT)
+        {
+            tensor.floats.resize(raw.size() / sizeof(float));
+            for (std::size_t i = 0; i < tensor.floats.size(); i++)
+            {
+                // Raw data is little-endian.
+                const auto* b = reinterpret_cast<const uint8_t*>(raw.data()) + 4 * i;
+                uint32_t bits =
+                    b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24);
+                std::memcpy(&tensor.floats[i], &bits, sizeof(float));
+            }
+        }
+        else if (tensor.dataType == ONNX_INT64)
+        {
+            tensor.ints.resize(raw.size() / sizeof(int64_t));
+            for (std::size_t i = 0; i < tensor.ints.size(); i++)
+            {
+                const auto* b = reinterpret_cast<const uint8_t*>(raw.data()) + 8 * i;
+                uint64_t bits = 0;
+                for (int k = 0; k < 8; k++)
+                {
+                    bits |= static_cast<uint64_t>(b[k]) << (8 * k);
+                }
+                tensor.ints[i] = static_cast<int64_t>(bits);
+            }
+        }
+    }
+
+    if (tensor.dataType != ONNX_FLOAT && tensor.dataType != ONNX_INT64)
+    {
+        error = "tensor \"" + name + "\" of data type " + std::to_string(tensor.dataType);
+    }
+    else if ((tensor.dataType == ONNX_FLOAT ? tensor.floats.size() : tensor.ints.size()) !=
+             tensor.Size())
+    {
+        error = "tensor \"" + name + "\" does not match its dimensions";
+    }
+    return tensor;
+}
+
+/**
+ * Read an AttributeProto.
+ *
+ * @param reader The reader of the message.
+ * @param directory The directory of the model, for external data.
+ * @param name Set to the name of the attribute.
+ * @param error Set on failure.
+ * @return The attribute.
+ */
+Attribute
+ReadAttribute(PbReader reader, const std::string& directory, std::string& name, std::string& error)
+{
+    Attribute attribute;
+    uint32_t field;
+    uint32_t wire;
+    while (reader.Next(field, wire))
+    {
+        switch (field)
+        {
+        case 1:
+            name = reader.String();
+            break;
+        case 2:
+            attribute.f = reader.Fixed32Float();
+            break;
+        case 3:
+            attribute.i = static_cast<int64_t>(reader.Varint());
+            break;
+        case 4:
+            attribute.s = reader.String();
+            break;
+        case 5: {
+            std::string tensorName;
+            attribute.t = ReadTensor(reader.Bytes(), directory, tensorName, error);
+            attribute.hasTensor = true;
+            break;
+        }
+        case 7:
+            reader.Floats(wire, attribute.floats);
+            break;
+        case 8:
+            reader.Ints(wire, attribute.ints);
+            break;
+        case 9:
+            attribute.strings.push_back(reader.String());
+            break;
+        default:
+            reader.Skip(wire);
+        }
+    }
+    if (!reader.ok)
+    {
+        error = "malformed attribute";
+    }
+    return attribute;
+}
+
+/**
+ * Read the name and the last dimension of a ValueInfoProto.
+ *
+ * @param reader The reader of the message.
+ * @param lastDim Set to the last dimension, or -1 if it is not fixed.
+ * @return The name.
+ */
+std::string
+ReadValueInfo(PbReader reader, int64_t& lastDim)
+{
+    std::string name;
+    lastDim = -1;
+    uint32_t field;
+    uint32_t wire;
+    while (reader.Next(field, wire))
+    {
+        if (field == 1)
+        {
+            name = reader.String();
+        }
+        else if (field == 2)
+        {
+            // TypeProto.tensor_type.shape.dim[].dim_value
+            PbReader type = reader.Bytes();
+            uint32_t f;
+            uint32_t w;
+            while (type.Next(f, w))
+            {
+                if (f != 1)
+                {
+                    type.Skip(w);
+                    continue;
+                }
+                PbReader tensorType = type.Bytes();
+                while (tensorType.Next(f, w))
+                {
+                    if (f != 2)
+                    {
+                        tensorType.Skip(w);
+                        continue;
+                    }
+                    PbReader shape = tensorType.Bytes();
+                    while (shape.Next(f, w))
+                    {
+                        if (f != 1)
+                        {
+                            shape.Skip(w);
+                            continue;
+                        }
+                        lastDim = -1;
+                        PbReader dim = shape.Bytes();
+                        while (dim.Next(f, w))
+                        {
+                            if (f == 1 && w == 0)
+                            {
+                                lastDim = static_cast<int64_t>(dim.Varint());
+                            }
+                            else
+                            {
+                                dim.Skip(w);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            reader.Skip(wire);
+        }
+    }
+    return name;
+}
+
+/**
+ * Read the graph of an ONNX file.
+ *
+ * @param path The path of the file.
+ * @param graph The graph.
+ * @return An error, or an empty string.
+ */
+std::string
+ReadGraph(const std::string& path, Graph& graph)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.good())
+    {
+        return "cannot read \"" + path + "\"";
+    }
+    std::string bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    std::size_t slash = path.find_last_of('/');
+    std::string directory = slash == std::string::npos ? "" : path.substr(0, slash + 1);
+
+    PbReader model{reinterpret_cast<const uint8_t*>(bytes.data()),
+                   reinterpret_cast<const uint8_t*>(bytes.data()) + bytes.size()};
+    std::string error;
+    bool hasGraph = false;
+    uint32_t field;
+    uint32_t wire;
+    while (model.Next(field, wire))
+    {
+        if (field != 7 || wire != 2)
+        {
+            model.Skip(wire);
+            continue;
+        }
+        hasGraph = true;
+        PbReader reader = model.Bytes();
+        while (reader.Next(field, wire) && error.empty())
+        {
+            switch (field)
+            {
+            case 1: {
+                Node node;
+                PbReader nodeReader = reader.Bytes();
+                uint32_t f;
+                uint32_t w;
+                while (nodeReader.Next(f, w) && error.empty())
+                {
+                    switch (f)
+                    {
+                    case 1:
+                        node.inputs.push_back(nodeReader.String());
+                        break;
+                    case 2:
+                        node.outputs.push_back(nodeReader.String());
+                        break;
+                    case 4:
+                        node.opType = nodeReader.String();
+                        break;
+                    case 5: {
+                        std::string name;
+                        Attribute attribute =
+                            ReadAttribute(nodeReader.Bytes(), directory, name, error);
+                        node.attributes[name] = std::move(attribute);
+                        break;
+                    }
+                    case 7:
+                        node.domain = nodeReader.String();
+                        break;
+                    default:
+                        nodeReader.Skip(w);
+                    }
+                }
+                if (!nodeReader.ok)
+                {
+                    error = "malformed node";
+                }
+                graph.nodes.push_back(std::move(node));
+                break;
+            }
+            case 5: {
+                std::string name;
+                Tensor tensor = ReadTensor(reader.Bytes(), directory, name, error);
+                graph.initializers[name] = std::move(tensor);
+                break;
+            }
+            case 11: {
+                int64_t lastDim;
+                graph.inputs.push_back(ReadValueInfo(reader.Bytes(), lastDim));
+                graph.inputLastDims.push_back(lastDim);
+                break;
+            }
+            case 12: {
+                int64_t lastDim;
+                graph.outputs.push_back(ReadValueInfo(reader.Bytes(), lastDim));
+                break;
+            }
+            default:
+                reader.Skip(wire);
+            }
+        }
+        if (!reader.ok && error.empty())
+        {
+            error = "malformed graph";
+        }
+    }
+
+    if (!model.ok && error.empty())
+    {
+        error = "malformed model";
+    }
+    if (!hasGraph && error.empty())
+    {
+        error = "no graph";
+    }
+    return error;
+}
+
+/**
+ * The activations a dense layer can be fused with.
+ */
+enum class Activation : uint8_t
+{
+    NONE,
+    RELU,
+    SIGMOID,
+    TANH,
+};
+
+/**
+ * Apply an activation to a row in place.
+ *
+ * @param activation The activation.
+ * @param x The row.
+ * @param n The length of the row.
+ */
+void
+Activate(Activation activation, float* x, std::size_t n)
+{
+    switch (activation)
+    {
+    case Activation::NONE:
+        break;
+    case Activation::RELU:
+        for (std::size_t i = 0; i < n; i++)
+        {
+            x[i] = x[i] > 0.0f ? x[i] : 0.0f;
+        }
+        break;
+    case Activation::SIGMOID:
+        for (std::size_t i = 0; i < n; i++)
+        {
+            x[i] = 1.0f / (1.0f + std::exp(-x[i]));
+        }
+        break;
+    case Activation::TANH:
+        for (std::size_t i = 0; i < n; i++)
+        {
+            x[i] = std::tanh(x[i]);
+        }
+        break;
+    }
+}
+
+/**
+ * The branch modes of a tree node.
+ */
+enum class TreeMode : uint8_t
+{
+    LEQ,
+    LT,
+    GTE,
+    GT,
+    EQ,
+    NEQ,
+    LEAF,
+};
+
+/**
+ * A flattened tree node.
+ */
+struct TreeNode
+{
+    float value = 0;                //!< The threshold.
+    uint32_t feature = 0;           //!< The feature compared.
+    uint32_t trueNode = 0;          //!< The index of the true branch.
+    uint32_t falseNode = 0;         //!< The index of the false branch.
+    uint32_t firstWeight = 0;       //!< The first leaf weight, for leaves.
+    uint32_t nWeights = 0;          //!< The number of leaf weights, for leaves.
+    TreeMode mode = TreeMode::LEAF; //!< The branch mode.
+    bool missingTracksTrue = false; //!< Whether NaN takes the true branch.
+};
+
+/**
+ * The aggregate functions of a tree ensemble.
+ */
+enum class Aggregate : uint8_t
+{
+    SUM,
+    AVERAGE,
+    MIN,
+    MAX,
+};
+
+} // namespace
+
+/**
+ * A layer of an OranOnnxNativeModel.
+ */
+struct OranOnnxNativeModel::Layer
+{
+    /**
+     * The kinds of layers.
+     */
+    enum Kind : uint8_t
+    {
+        DENSE,
+        ACTIVATION,
+        SOFTMAX,
+        ARGMAX,
+        TREE_ENSEMBLE,
+    };
+
+    Kind kind = DENSE;                         //!< The kind of layer.
+    Activation activation = Activation::NONE;  //!< The activation applied to the output.
+    bool selectLastIndex = false;              //!< ArgMax: select the last maximum.
+    std::size_t inSize = 0;                    //!< The width of the input row.
+    std::size_t outSize = 0;                   //!< The width of the output row.
+    std::size_t weightOffset = 0;              //!< DENSE: offset of the weights.
+    std::size_t biasOffset = 0;                //!< DENSE: offset of the bias.
+    std::vector<float> staging;                //!< DENSE: weights and bias, before packing.
+    std::vector<TreeNode> nodes;               //!< TREE_ENSEMBLE: the nodes.
+    std::vector<uint32_t> roots;               //!< TREE_ENSEMBLE: the root of every tree.
+    std::vector<std::pair<uint32_t, float>> leafWeights; //!< TREE_ENSEMBLE: (target, weight).
+    std::vector<float> baseValues;             //!< TREE_ENSEMBLE: added to every target.
+    Aggregate aggregate = Aggregate::SUM;      //!< TREE_ENSEMBLE: the aggregate function.
+};
+
+OranOnnxNativeModel::OranOnnxNativeModel()
+    : m_weights(nullptr, std::free),
+      m_inputSize(0),
+      m_outputSize(0),
+      m_maxWidth(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranOnnxNativeModel::~OranOnnxNativeModel()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+bool
+OranOnnxNativeModel::Load(const std::string& path)
+{
+    NS_LOG_FUNCTION(this << path);
+
+    Unload();
+
+    Graph graph;
+    std::string error = ReadGraph(path, graph);
+    if (!error.empty())
+    {
+        return Reject(error);
+    }
+
+    for (const auto& node : graph.nodes)
+    {
+        if (node.opType == "Constant" && node.outputs.size() == 1)
+        {
+            const Attribute* value = node.Get("value");
+            if (value == nullptr || !value->hasTensor)
+            {
+                return Reject("Constant without a tensor value");
+            }
+            graph.initializers[node.outputs[0]] = value->t;
+        }
+    }
+
+    // The one input that is not an initializer.
+    std::string current;
+    int64_t width = -1;
+    for (std::size_t i = 0; i < graph.inputs.size(); i++)
+    {
+        if (graph.initializers.count(graph.inputs[i]))
+        {
+            continue;
+        }
+        if (!current.empty())
+        {
+            return Reject("more than one input");
+        }
+        current = graph.inputs[i];
+        width = graph.inputLastDims[i];
+    }
+    if (current.empty() || graph.outputs.empty())
+    {
+        return Reject("no input or no output");
+    }
+    int64_t inputWidth = width;
+
+    auto floatInit = [&graph](const std::string& name) -> const Tensor* {
+        auto it = graph.initializers.find(name);
+        return it != graph.initializers.end() && it->second.dataType == ONNX_FLOAT ? &it->second
+                                                                                   : nullptr;
+    };
+    auto lastDense = [this]() -> Layer* {
+        return !m_layers.empty() && m_layers.back().kind == Layer::DENSE &&
+                       m_layers.back().activation == Activation::NONE
+                   ? &m_layers.back()
+                   : nullptr;
+    };
+
+    for (const auto& node : graph.nodes)
+    {
+        if (node.opType == "Constant")
+        {
+            continue;
+        }
+        if (node.inputs.empty() || node.inputs[0] != current || node.outputs.empty())
+        {
+            return Reject(node.opType + " node is not on the chain from the input");
+        }
+        const std::string& op = node.opType;
+        bool isMl = node.domain == "ai.onnx.ml";
+        if (!node.domain.empty() && node.domain != "ai.onnx" && !isMl)
+        {
+            return Reject("operator domain \"" + node.domain + "\"");
+        }
+
+        if (op == "Gemm" || op == "MatMul")
+        {
+            const Tensor* b = node.inputs.size() > 1 ? floatInit(node.inputs[1]) : nullptr;
+            if (b == nullptr || b->dims.size() != 2)
+            {
+                return Reject(op + " without constant 2-D weights");
+            }
+            bool transB = op == "Gemm" && node.GetInt("transB", 0) != 0;
+            if (op == "Gemm" && node.GetInt("transA", 0) != 0)
+            {
+                return Reject("Gemm with transA");
+            }
+            float alpha = op == "Gemm" ? node.GetFloat("alpha", 1.0f) : 1.0f;
+            float beta = op == "Gemm" ? node.GetFloat("beta", 1.0f) : 1.0f;
+            auto k = static_cast<std::size_t>(transB ? b->dims[1] : b->dims[0]);
+            auto n = static_cast<std::size_t>(transB ? b->dims[0] : b->dims[1]);
+            if (width >= 0 && static_cast<std::size_t>(width) != k)
+            {
+                return Reject(op + " weights do not match the width of their input");
+            }
+
+            Layer layer;
+            layer.kind = Layer::DENSE;
+            layer.inSize = k;
+            layer.outSize = n;
+            // Rows of the staged weights are output neurons, padded to the
+            // kernel width; the bias follows.
+            std::size_t stride = Pad(k);
+            layer.staging.assign(n * stride + n, 0.0f);
+            for (std::size_t o = 0; o < n; o++)
+            {
+                for (std::size_t i = 0; i < k; i++)
+                {
+                    float w = transB ? b->floats[o * k + i] : b->floats[i * n + o];
+                    layer.staging[o * stride + i] = alpha * w;
+                }
+            }
+            if (op == "Gemm" && node.inputs.size() > 2 && !node.inputs[2].empty())
+            {
+                const Tensor* c = floatInit(node.inputs[2]);
+                if (c == nullptr || (c->Size() != n && c->Size() != 1))
+                {
+                    return Reject("Gemm bias that is not a constant row");
+                }
+                for (std::size_t o = 0; o < n; o++)
+                {
+                    layer.staging[n * stride + o] = beta * c->floats[c->Size() == 1 ? 0 : o];
+                }
+            }
+            m_layers.push_back(std::move(layer));
+            width = static_cast<int64_t>(n);
+        }
+        else if (op == "Add")
+        {
+            Layer* dense = lastDense();
+            const Tensor* c = node.inputs.size() > 1 ? floatInit(node.inputs[1]) : nullptr;
+            if (dense == nullptr || c == nullptr ||
+                (c->Size() != dense->outSize && c->Size() != 1))
+            {
+                return Reject("Add that is not the bias of a MatMul or Gemm");
+            }
+            std::size_t biasStart = dense->outSize * Pad(dense->inSize);
+            for (std::size_t o = 0; o < dense->outSize; o++)
+            {
+                dense->staging[biasStart + o] += c->floats[c->Size() == 1 ? 0 : o];
+            }
+        }
+        else if (op == "Relu" || op == "Sigmoid" || op == "Tanh")
+        {
+            Activation activation = op == "Relu"      ? Activation::RELU
+                                    : op == "Sigmoid" ? Activation::SIGMOID
+                                                      : Activation::TANH;
+            if (Layer* dense = lastDense())
+            {
+                dense->activation = activation;
+            }
+            else
+            {
+                if (width < 0)
+                {
+                    return Reject(op + " of an input of unknown width");
+                }
+                Layer layer;
+                layer.kind = Layer::ACTIVATION;
+                layer.activation = activation;
+                layer.inSize = layer.outSize = static_cast<std::size_t>(width);
+                m_layers.push_back(std::move(layer));
+            }
+        }
+        else if (op == "Softmax" || op == "ArgMax")
+        {
+            int64_t axis = node.GetInt("axis", op == "Softmax" ? -1 : 0);
+            if ((axis != -1 && axis != 1) || width < 0)
+            {
+                return Reject(op + " over an axis other than the last of a row");
+            }
+            Layer layer;
+            layer.kind = op == "Softmax" ? Layer::SOFTMAX : Layer::ARGMAX;
+            layer.inSize = static_cast<std::size_t>(width);
+            layer.outSize = op == "Softmax" ? layer.inSize : 1;
+            layer.selectLastIndex = node.GetInt("select_last_index", 0) != 0;
+            width = static_cast<int64_t>(layer.outSize);
+            m_layers.push_back(std::move(layer));
+        }
+        else if (op == "Identity" || op == "Flatten" || op == "Reshape")
+        {
+            if (op == "Flatten" && node.GetInt("axis", 1) != 1)
+            {
+                return Reject("Flatten on an axis other than 1");
+            }
+            if (op == "Reshape")
+            {
+                auto shape = node.inputs.size() > 1 ? graph.initializers.find(node.inputs[1])
+                                                    : graph.initializers.end();
+                if (shape == graph.initializers.end() || shape->second.dataType != ONNX_INT64 ||
+                    shape->second.ints.empty())
+                {
+                    return Reject("Reshape without a constant shape");
+                }
+                const std::vector<int64_t>& dims = shape->second.ints;
+                for (std::size_t i = 0; i + 1 < dims.size(); i++)
+                {
+                    if (dims[i] != 1 && dims[i] != -1 && dims[i] != 0)
+                    {
+                        return Reject("Reshape of a row into more than one row");
+                    }
+                }
+                if (dims.back() != -1 && dims.back() != width)
+                {
+                    return Reject("Reshape that changes the width of a row");
+                }
+            }
+        }
+        else if (op == "TreeEnsembleRegressor" && isMl)
+        {
+            const Attribute* treeIds = node.Get("nodes_treeids");
+            const Attribute* nodeIds = node.Get("nodes_nodeids");
+            const Attribute* featureIds = node.Get("nodes_featureids");
+            const Attribute* values = node.Get("nodes_values");
+            const Attribute* modes = node.Get("nodes_modes");
+            const Attribute* trueIds = node.Get("nodes_truenodeids");
+            const Attribute* falseIds = node.Get("nodes_falsenodeids");
+            const Attribute* targetTreeIds = node.Get("target_treeids");
+            const Attribute* targetNodeIds = node.Get("target_nodeids");
+            const Attribute* targetIds = node.Get("target_ids");
+            const Attribute* targetWeights = node.Get("target_weights");
+            const Attribute* missingTrue = node.Get("nodes_missing_value_tracks_true");
+            const Attribute* postTransform = node.Get("post_transform");
+            const Attribute* aggregate = node.Get("aggregate_function");
+            const Attribute* baseValues = node.Get("base_values");
+            if (treeIds == nullptr || nodeIds == nullptr || featureIds == nullptr ||
+                values == nullptr || modes == nullptr || trueIds == nullptr ||
+                falseIds == nullptr || targetTreeIds == nullptr || targetNodeIds == nullptr ||
+                targetIds == nullptr || targetWeights == nullptr)
+            {
+                return Reject("TreeEnsembleRegressor without float node and target attributes");
+            }
+            std::size_t nNodes = treeIds->ints.size();
+            std::size_t nTargets = targetTreeIds->ints.size();
+            if (nodeIds->ints.size() != nNodes || featureIds->ints.size() != nNodes ||
+                values->floats.size() != nNodes || modes->strings.size() != nNodes ||
+                trueIds->ints.size() != nNodes || falseIds->ints.size() != nNodes ||
+                targetNodeIds->ints.size() != nTargets || targetIds->ints.size() != nTargets ||
+                targetWeights->floats.size() != nTargets ||
+                (missingTrue != nullptr && !missingTrue->ints.empty() &&
+                 missingTrue->ints.size() != nNodes))
+            {
+                return Reject("TreeEnsembleRegressor with inconsistent attributes");
+            }
+            if (postTransform != nullptr && postTransform->s != "NONE")
+            {
+                return Reject("TreeEnsembleRegressor post transform " + postTransform->s);
+            }
+
+            Layer layer;
+            layer.kind = Layer::TREE_ENSEMBLE;
+            layer.outSize =
+                static_cast<std::size_t>(std::max<int64_t>(node.GetInt("n_targets", 1), 1));
+            if (aggregate != nullptr)
+            {
+                const std::string& function = aggregate->s;
+                layer.aggregate = function == "AVERAGE" ? Aggregate::AVERAGE
+                                  : function == "MIN"   ? Aggregate::MIN
+                                  : function == "MAX"   ? Aggregate::MAX
+                                                        : Aggregate::SUM;
+                if (function != "SUM" && function != "AVERAGE" && function != "MIN" &&
+                    function != "MAX")
+                {
+                    return Reject("TreeEnsembleRegressor aggregate " + function);
+                }
+            }
+            if (baseValues != nullptr && !baseValues->floats.empty())
+            {
+                if (baseValues->floats.size() != layer.outSize)
+                {
+                    return Reject("TreeEnsembleRegressor base values do not match its targets");
+                }
+                layer.baseValues = baseValues->floats;
+            }
+
+            std::map<std::pair<int64_t, int64_t>, uint32_t> index;
+            for (std::size_t i = 0; i < nNodes; i++)
+            {
+                index[{treeIds->ints[i], nodeIds->ints[i]}] = static_cast<uint32_t>(i);
+            }
+            layer.nodes.resize(nNodes);
+            std::set<uint32_t> children;
+            int64_t maxFeature = -1;
+            for (std::size_t i = 0; i < nNodes; i++)
+            {
+                TreeNode& treeNode = layer.nodes[i];
+                const std::string& mode = modes->strings[i];
+                treeNode.mode = mode == "BRANCH_LEQ"   ? TreeMode::LEQ
+                                : mode == "BRANCH_LT"  ? TreeMode::LT
+                                : mode == "BRANCH_GTE" ? TreeMode::GTE
+                                : mode == "BRANCH_GT"  ? TreeMode::GT
+                                : mode == "BRANCH_EQ"  ? TreeMode::EQ
+                                : mode == "BRANCH_NEQ" ? TreeMode::NEQ
+                                                       : TreeMode::LEAF;
+                if (treeNode.mode == TreeMode::LEAF && mode != "LEAF")
+                {
+                    return Reject("TreeEnsembleRegressor node mode " + mode);
+                }
+                treeNode.value = values->floats[i];
+                treeNode.missingTracksTrue =
+                    missingTrue != nullptr && !missingTrue->ints.empty() && missingTrue->ints[i];
+                if (treeNode.mode == TreeMode::LEAF)
+                {
+                    continue;
+                }
+                auto trueNode = index.find({treeIds->ints[i], trueIds->ints[i]});
+                auto falseNode = index.find({treeIds->ints[i], falseIds->ints[i]});
+                if (trueNode == index.end() || falseNode == index.end() || featureIds->ints[i] < 0)
+                {
+                    return Reject("TreeEnsembleRegressor with a dangling branch");
+                }
+                treeNode.feature = static_cast<uint32_t>(featureIds->ints[i]);
+                treeNode.trueNode = trueNode->second;
+                treeNode.falseNode = falseNode->second;
+                children.insert(trueNode->second);
+                children.insert(falseNode->second);
+                maxFeature = std::max(maxFeature, featureIds->ints[i]);
+            }
+
+            // Group the leaf weights by node, in the order of the attributes.
+            std::vector<std::vector<std::pair<uint32_t, float>>> weights(nNodes);
+            for (std::size_t t = 0; t < nTargets; t++)
+            {
+                auto leaf = index.find({targetTreeIds->ints[t], targetNodeIds->ints[t]});
+                if (leaf == index.end() || targetIds->ints[t] < 0 ||
+                    static_cast<std::size_t>(targetIds->ints[t]) >= layer.outSize)
+                {
+                    return Reject("TreeEnsembleRegressor with a dangling target");
+                }
+                weights[leaf->second].emplace_back(static_cast<uint32_t>(targetIds->ints[t]),
+                                                   targetWeights->floats[t]);
+            }
+            for (std::size_t i = 0; i < nNodes; i++)
+            {
+                layer.nodes[i].firstWeight = static_cast<uint32_t>(layer.leafWeights.size());
+                layer.nodes[i].nWeights = static_cast<uint32_t>(weights[i].size());
+                layer.leafWeights.insert(layer.leafWeights.end(),
+                                         weights[i].begin(),
+                                         weights[i].end());
+            }
+            for (std::size_t i = 0; i < nNodes; i++)
+            {
+                if (!children.count(static_cast<uint32_t>(i)))
+                {
+                    layer.roots.push_back(static_cast<uint32_t>(i));
+                }
+            }
+
+            if (width < 0)
+            {
+                width = maxFeature + 1;
+            }
+            else if (maxFeature >= width)
+            {
+                return Reject("TreeEnsembleRegressor feature out of its input");
+            }
+            layer.inSize = static_cast<std::size_t>(width);
+            width = static_cast<int64_t>(layer.outSize);
+            m_layers.push_back(std::move(layer));
+        }
+        else
+        {
+            return Reject("operator " + (node.domain.empty() ? "" : node.domain + ".") + op);
+        }
+
+        current = node.outputs[0];
+        if (inputWidth < 0 && m_layers.size() == 1)
+        {
+            inputWidth = static_cast<int64_t>(m_layers[0].inSize);
+        }
+    }
+
+    if (current != graph.outputs[0])
+    {
+        return Reject("the first output is not the end of the chain");
+    }
+    if (inputWidth < 0 || m_layers.empty())
+    {
+        return Reject("the width of the input is unknown");
+    }
+
+    // Pack the weights of the dense layers into one aligned block, each
+    // layer starting on an alignment boundary.
+    const std::size_t alignFloats = ALIGNMENT / sizeof(float);
+    std::size_t total = 0;
+    m_maxWidth = Pad(static_cast<std::size_t>(inputWidth));
+    for (auto& layer : m_layers)
+    {
+        if (layer.kind == Layer::DENSE)
+        {
+            layer.weightOffset = total;
+            layer.biasOffset = total + layer.outSize * Pad(layer.inSize);
+            total += (layer.staging.size() + alignFloats - 1) / alignFloats * alignFloats;
+        }
+        m_maxWidth = std::max(m_maxWidth, Pad(layer.outSize));
+    }
+    m_weights.reset(AllocateAligned(total));
+    for (auto& layer : m_layers)
+    {
+        if (layer.kind == Layer::DENSE)
+        {
+            std::copy(layer.staging.begin(),
+                      layer.staging.end(),
+                      m_weights.get() + layer.weightOffset);
+            layer.staging.clear();
+            layer.staging.shrink_to_fit();
+        }
+    }
+
+    m_inputSize = static_cast<std::size_t>(inputWidth);
+    m_outputSize = m_layers.back().outSize;
+
+    NS_LOG_LOGIC("Imported \"" << path << "\": " << m_layers.size() << " layers, "
+                               << m_inputSize << " inputs, " << m_outputSize << " outputs");
+    return true;
+}
+
+void
+OranOnnxNativeModel::Unload()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_layers.clear();
+    m_weights.reset();
+    m_inputSize = 0;
+    m_outputSize = 0;
+    m_maxWidth = 0;
+    m_unsupportedReason.clear();
+}
+
+bool
+OranOnnxNativeModel::IsLoaded() const
+{
+    return !m_layers.empty();
+}
+
+const std::string&
+OranOnnxNativeModel::GetUnsupportedReason() const
+{
+    return m_unsupportedReason;
+}
+
+std::size_t
+OranOnnxNativeModel::GetInputSize() const
+{
+    return m_inputSize;
+}
+
+std::size_t
+OranOnnxNativeModel::GetOutputSize() const
+{
+    return m_outputSize;
+}
+
+void
+OranOnnxNativeModel::Run(const float* input,
+                         std::size_t nRows,
+                         std::vector<float>& scratch,
+                         std::vector<float>& output) const
+{
+    NS_LOG_FUNCTION(this << nRows);
+
+    NS_ABORT_MSG_IF(m_layers.empty(), "No model loaded");
+
+    output.resize(nRows * m_outputSize);
+    if (scratch.size() < 2 * m_maxWidth)
+    {
+        scratch.assign(2 * m_maxWidth, 0.0f);
+    }
+    float* a = scratch.data();
+    float* b = a + m_maxWidth;
+    const float* weights = m_weights.get();
+
+    for (std::size_t r = 0; r < nRows; r++)
+    {
+        // The padding after every row stays zero, so the dense kernel can
+        // run over whole vectors.
+        std::memcpy(a, input + r * m_inputSize, m_inputSize * sizeof(float));
+        std::fill(a + m_inputSize, a + Pad(m_inputSize), 0.0f);
+
+        for (const auto& layer : m_layers)
+        {
+            switch (layer.kind)
+            {
+            case Layer::DENSE: {
+                Dense(weights + layer.weightOffset,
+                      weights + layer.biasOffset,
+                      a,
+                      Pad(layer.inSize),
+                      layer.outSize,
+                      b);
+                std::fill(b + layer.outSize, b + Pad(layer.outSize), 0.0f);
+                Activate(layer.activation, b, layer.outSize);
+                std::swap(a, b);
+                break;
+            }
+            case Layer::ACTIVATION:
+                Activate(layer.activation, a, layer.outSize);
+                break;
+            case Layer::SOFTMAX: {
+                float max = *std::max_element(a, a + layer.inSize);
+                float sum = 0.0f;
+                for (std::size_t i = 0; i < layer.inSize; i++)
+                {
+                    a[i] = std::exp(a[i] - max);
+                    sum += a[i];
+                }
+                for (std::size_t i = 0; i < layer.inSize; i++)
+                {
+                    a[i] /= sum;
+                }
+                break;
+            }
+            case Layer::ARGMAX: {
+                std::size_t best = 0;
+                for (std::size_t i = 1; i < layer.inSize; i++)
+                {
+                    if (a[i] > a[best] || (layer.selectLastIndex && a[i] == a[best]))
+                    {
+                        best = i;
+                    }
+                }
+                std::fill(a, a + Pad(layer.inSize), 0.0f);
+                a[0] = static_cast<float>(best);
+                break;
+            }
+            case Layer::TREE_ENSEMBLE: {
+                std::fill(b, b + Pad(layer.outSize), 0.0f);
+                std::vector<bool> hasScore(
+                    layer.aggregate == Aggregate::MIN || layer.aggregate == Aggregate::MAX
+                        ? layer.outSize
+                        : 0,
+                    false);
+                for (uint32_t root : layer.roots)
+                {
+                    const TreeNode* node = &layer.nodes[root];
+                    while (node->mode != TreeMode::LEAF)
+                    {
+                        float x = a[node->feature];
+                        bool branch;
+                        if (std::isnan(x))
+                        {
+                            branch = node->missingTracksTrue;
+                        }
+                        else
+                        {
+                            switch (node->mode)
+                            {
+                            case TreeMode::LEQ:
+                                branch = x <= node->value;
+                                break;
+                            case TreeMode::LT:
+                                branch = x < node->value;
+                                break;
+                            case TreeMode::GTE:
+                                branch = x >= node->value;
+                                break;
+                            case TreeMode::GT:
+                                branch = x > node->value;
+                                break;
+                            case TreeMode::EQ:
+                                branch = x == node->value;
+                                break;
+                            default:
+                                branch = x != node->value;
+                                break;
+                            }
+                        }
+                        node = &layer.nodes[branch ? node->trueNode : node->falseNode];
+                    }
+                    for (uint32_t i = 0; i < node->nWeights; i++)
+                    {
+                        const auto& weight = layer.leafWeights[node->firstWeight + i];
+                        float& score = b[weight.first];
+                        switch (layer.aggregate)
+                        {
+                        case Aggregate::SUM:
+                        case Aggregate::AVERAGE:
+                            score += weight.second;
+                            break;
+                        case Aggregate::MIN:
+                            score = hasScore[weight.first] ? std::min(score, weight.second)
+                                                           : weight.second;
+                            hasScore[weight.first] = true;
+                            break;
+                        case Aggregate::MAX:
+                            score = hasScore[weight.first] ? std::max(score, weight.second)
+                                                           : weight.second;
+                            hasScore[weight.first] = true;
+                            break;
+                        }
+                    }
+                }
+                for (std::size_t t = 0; t < layer.outSize; t++)
+                {
+                    if (layer.aggregate == Aggregate::AVERAGE && !layer.roots.empty())
+                    {
+                        b[t] /= static_cast<float>(layer.roots.size());
+                    }
+                    if (!layer.baseValues.empty())
+                    {
+                        b[t] += layer.baseValues[t];
+                    }
+                }
+                std::swap(a, b);
+                break;
+            }
+            }
+        }
+
+        std::memcpy(output.data() + r * m_outputSize, a, m_outputSize * sizeof(float));
+    }
+}
+
+bool
+OranOnnxNativeModel::Reject(const std::string& reason)
+{
+    NS_LOG_FUNCTION(this << reason);
+
+    Unload();
+    m_unsupportedReason = reason;
+    return false;
+}
+
+} // namespace ns3
@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_ONNX_NATIVE_MODEL_H
+#define ORAN_ONNX_NATIVE_MODEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Built-in inference engine for the small ONNX models used by the Logic
+ * Modules, which avoids the per-call overhead of ONNX Runtime.
+ *
+ * Load() imports the graph of an ONNX file if it is a chain of supported
+ * operators applied to one float input:
+ *
+ * - Gemm, and MatMul optionally followed by Add, with constant weights.
+ *   Each is imported as a dense layer, fused with a following Relu,
+ *   Sigmoid, or Tanh.
+ * - Relu, Sigmoid, Tanh, Softmax, and ArgMax over the last axis.
+ * - Identity, and Flatten or Reshape of a row into a row.
+ * - TreeEnsembleRegressor (ai.onnx.ml), with any branch mode, the SUM,
+ *   AVERAGE, MIN, or MAX aggregate, and no post transform.
+ *
+ * Weights, including those in external data files, are copied into one
+ * 64-byte aligned block, with every row of a dense layer padded to a
+ * multiple of 8 floats, so that the dot products run as 8-wide vector
+ * operations (one AVX register when built for AVX2, two SSE or NEON
+ * registers otherwise) without remainder loops. Trees are flattened into
+ * arrays of nodes.
+ *
+ * Any other graph is rejected, and GetUnsupportedReason() says why, so that
+ * the caller can run it with ONNX Runtime instead (see OranOnnxModel).
+ * Results match ONNX Runtime up to floating-point rounding, as the sums are
+ * done in a different order. ArgMax indices are returned as floats.
+ */
+class OranOnnxNativeModel
+{
+  public:
+    /**
+     * Constructor of the OranOnnxNativeModel class.
+     */
+    OranOnnxNativeModel();
+    /**
+     * Destructor of the OranOnnxNativeModel class.
+     */
+    ~OranOnnxNativeModel();
+    /**
+     * Import a model, replacing the one loaded, if any.
+     *
+     * @param path The path of the ONNX file.
+     * @return True if the model was imported, false if it uses something
+     *         that is not supported or the file cannot be read.
+     */
+    bool Load(const std::string& path);
+    /**
+     * Release the loaded model, if any.
+     */
+    void Unload();
+    /**
+     * @return True if a model is loaded.
+     */
+    bool IsLoaded() const;
+    /**
+     * @return Why the last Load() failed, or an empty string.
+     */
+    const std::string& GetUnsupportedReason() const;
+    /**
+     * @return The number of input features of the loaded model.
+     */
+    std::size_t GetInputSize() const;
+    /**
+     * @return The number of outputs per row of the loaded model.
+     */
+    std::size_t GetOutputSize() const;
+    /**
+     * Run the loaded model on a batch of rows. The model is not modified,
+     * so several callers can share it, each with its own scratch rows.
+     *
+     * @param input The rows, one after the other.
+     * @param nRows The number of rows.
+     * @param scratch The rows the layers ping-pong between, resized as
+     *        needed. Callers that may run the model at the same time need
+     *        their own.
+     * @param output Set to the output rows, one after the other.
+     */
+    void Run(const float* input,
+             std::size_t nRows,
+             std::vector<float>& scratch,
+             std::vector<float>& output) const;
+
+  private:
+    /**
+     * A layer of the model, defined in the implementation.
+     */
+    struct Layer;
+
+    /**
+     * Clear the loaded model and set the reason why loading failed.
+     *
+     * @param reason The reason.
+     * @return False.
+     */
+    bool Reject(const std::string& reason);
+
+    /**
+     * The layers, in execution order.
+     */
+    std::vector<Layer> m_layers;
+    /**
+     * The aligned block holding the weights of every layer.
+     */
+    std::unique_ptr<float, void (*)(void*)> m_weights;
+    /**
+     * The number of input features.
+     */
+    std::size_t m_inputSize;
+    /**
+     * The number of outputs per row.
+     */
+    std::size_t m_outputSize;
+    /**
+     * The widest intermediate row, padded.
+     */
+    std::size_t m_maxWidth;
+    /**
+     * Why the last Load() failed.
+     */
+    std::string m_unsupportedReason;
+}; // class OranOnnxNativeModel
+
+} // namespace ns3
+
+#endif // ORAN_ONNX_NATIVE_MODEL_H
@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-report-lte-ue-multi-cell-rsrp-rsrq.h"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranReportLteUeMultiCellRsrpRsrq");
+NS_OBJECT_ENSURE_REGISTERED(OranReportLteUeMultiCellRsrpRsrq);
+
+TypeId
+OranReportLteUeMultiCellRsrpRsrq::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranReportLteUeMultiCellRsrpRsrq")
+            .SetParent<OranReport>()
+            .AddConstructor<OranReportLteUeMultiCellRsrpRsrq>()
+            .AddAttribute("Rnti",
+                          "The RNTI.",
+                          UintegerValue(),
+                          MakeUintegerAccessor(&OranReportLteUeMultiCellRsrpRsrq::m_rnti),
+                          MakeUintegerChecker<uint16_t>());
+
+    return tid;
+}
+
+OranReportLteUeMultiCellRsrpRsrq::OranReportLteUeMultiCellRsrpRsrq()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranReportLteUeMultiCellRsrpRsrq::~OranReportLteUeMultiCellRsrpRsrq()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+std::string
+OranReportLteUeMultiCellRsrpRsrq::ToString() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::stringstream ss;
+    Time time = GetTime();
+
+    ss << "OranReportLteUeMultiCellRsrpRsrq("
+       << "E2NodeId=" << GetReporterE2NodeId() << ";Time=" << time.As(Time::S)
+       << ";RNTI=" << +m_rnti;
+    for (const auto& measurement : m_measurements)
+    {
+        ss << ";Cell ID=" << +measurement.cellId
+           << ",Component Carrier ID=" << +measurement.componentCarrierId
+           << ",RSRP=" << measurement.rsrp << ",RSRQ=" << measurement.rsrq
+           << ",Is Serving Cell=" << measurement.isServingCell;
+    }
+    ss << ")";
+
+    return ss.str();
+}
+
+uint16_t
+OranReportLteUeMultiCellRsrpRsrq::GetRnti() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rnti;
+}
+
+void
+OranReportLteUeMultiCellRsrpRsrq::SetMeasurements(std::vector<OranUeCellRsrpRsrq> measurements)
+{
+    NS_LOG_FUNCTION(this << measurements.size());
+
+    m_measurements = std::move(measurements);
+}
+
+const std::vector<OranUeCellRsrpRsrq>&
+OranReportLteUeMultiCellRsrpRsrq::GetMeasurements() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_measurements;
+}
+
+} // namespace ns3
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_REPORT_LTE_UE_MULTI_CELL_RSRP_RSRQ
+#define ORAN_REPORT_LTE_UE_MULTI_CELL_RSRP_RSRQ
+
+#include "oran-report.h"
+#include "oran-ue-rsrp-rsrq-aggregator.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Report with the RSRP and RSRQ an LTE UE measured for every cell it heard
+ * during one report period, reduced to one value per cell and component
+ * carrier. It replaces one OranReportLteUeRsrpRsrq per measurement when the
+ * OranReporterLteUeRsrpRsrq aggregates its reports.
+ */
+class OranReportLteUeMultiCellRsrpRsrq : public OranReport
+{
+  public:
+    /**
+     * Get the TypeId of the OranReportLteUeMultiCellRsrpRsrq class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranReportLteUeMultiCellRsrpRsrq class.
+     */
+    OranReportLteUeMultiCellRsrpRsrq();
+    /**
+     * Destructor of the OranReportLteUeMultiCellRsrpRsrq class.
+     */
+    ~OranReportLteUeMultiCellRsrpRsrq() override;
+    /**
+     * Get a string representation of this Report
+     *
+     * @return A string representation of this Report.
+     */
+    std::string ToString() const override;
+    /**
+     * Gets the RNTI.
+     *
+     * @return The RNTI.
+     */
+    uint16_t GetRnti() const;
+    /**
+     * Sets the measurements.
+     *
+     * @param measurements One measurement per cell and component carrier.
+     */
+    void SetMeasurements(std::vector<OranUeCellRsrpRsrq> measurements);
+    /**
+     * Gets the measurements.
+     *
+     * @return One measurement per cell and component carrier.
+     */
+    const std::vector<OranUeCellRsrpRsrq>& GetMeasurements() const;
+
+  private:
+    /**
+     * The RNTI.
+     */
+    uint16_t m_rnti;
+    /**
+     * The measurements.
+     */
+    std::vector<OranUeCellRsrpRsrq> m_measurements;
+
+}; // class OranReportLteUeMultiCellRsrpRsrq
+
+} // namespace ns3
+
+#endif // ORAN_REPORT_LTE_UE_MULTI_CELL_RSRP_RSRQ
@@ -160,4 +160,12 @@ OranReportLteUeRsrpRsrq::GetComponentCarrierId() const
     return m_componentCarrierId;
 }
 
+uint64_t
+OranReportLteUeRsrpRsrq::GetCoalescingKey() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return (static_cast<uint64_t>(m_cellId) << 16) | m_componentCarrierId;
+}
+
 } // namespace ns3
@@ -102,6 +102,13 @@ class OranReportLteUeRsrpRsrq : public OranReport
      * @return The component carrier ID.
      */
     uint16_t GetComponentCarrierId() const;
+    /**
+     * Gets the key that identifies the Reports for the same cell and
+     * component carrier.
+     *
+     * @return The cell ID and component carrier ID, combined.
+     */
+    uint64_t GetCoalescingKey() const override;
 
   private:
     /**
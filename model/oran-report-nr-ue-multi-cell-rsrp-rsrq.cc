@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-report-nr-ue-multi-cell-rsrp-rsrq.h"
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranReportNrUeMultiCellRsrpRsrq");
+NS_OBJECT_ENSURE_REGISTERED(OranReportNrUeMultiCellRsrpRsrq);
+
+TypeId
+OranReportNrUeMultiCellRsrpRsrq::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranReportNrUeMultiCellRsrpRsrq")
+            .SetParent<OranReport>()
+            .AddConstructor<OranReportNrUeMultiCellRsrpRsrq>()
+            .AddAttribute("Rnti",
+                          "The RNTI.",
+                          UintegerValue(),
+                          MakeUintegerAccessor(&OranReportNrUeMultiCellRsrpRsrq::m_rnti),
+                          MakeUintegerChecker<uint16_t>());
+
+    return tid;
+}
+
+OranReportNrUeMultiCellRsrpRsrq::OranReportNrUeMultiCellRsrpRsrq()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranReportNrUeMultiCellRsrpRsrq::~OranReportNrUeMultiCellRsrpRsrq()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+std::string
+OranReportNrUeMultiCellRsrpRsrq::ToString() const
+{
+    NS_LOG_FUNCTION(this);
+
+    std::stringstream ss;
+    Time time = GetTime();
+
+    ss << "OranReportNrUeMultiCellRsrpRsrq("
+       << "E2NodeId=" << GetReporterE2NodeId() << ";Time=" << time.As(Time::S)
+       << ";RNTI=" << +m_rnti;
+    for (const auto& measurement : m_measurements)
+    {
+        ss << ";Cell ID=" << +measurement.cellId
+           << ",Component Carrier ID=" << +measurement.componentCarrierId
+           << ",RSRP=" << measurement.rsrp << ",RSRQ=" << measurement.rsrq
+           << ",Is Serving Cell=" << measurement.isServingCell;
+    }
+    ss << ")";
+
+    return ss.str();
+}
+
+uint16_t
+OranReportNrUeMultiCellRsrpRsrq::GetRnti() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_rnti;
+}
+
+void
+OranReportNrUeMultiCellRsrpRsrq::SetMeasurements(std::vector<OranUeCellRsrpRsrq> measurements)
+{
+    NS_LOG_FUNCTION(this << measurements.size());
+
+    m_measurements = std::move(measurements);
+}
+
+const std::vector<OranUeCellRsrpRsrq>&
+OranReportNrUeMultiCellRsrpRsrq::GetMeasurements() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_measurements;
+}
+
+} // namespace ns3
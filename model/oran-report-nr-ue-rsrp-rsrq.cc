@@ -135,4 +135,12 @@ OranReportNrUeRsrpRsrq::GetComponentCarrierId() const
     return m_componentCarrierId;
 }
 
+uint64_t
+OranReportNrUeRsrpRsrq::GetCoalescingKey() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return (static_cast<uint64_t>(m_cellId) << 16) | m_componentCarrierId;
+}
+
 } // namespace ns3
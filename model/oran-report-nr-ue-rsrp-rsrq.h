@@ -33,6 +33,7 @@ class OranReportNrUeRsrpRsrq : public OranReport
     double GetRsrq() const;
     bool GetIsServingCell() const;
     uint16_t GetComponentCarrierId() const;
+    uint64_t GetCoalescingKey() const override;
 
   private:
     uint16_t m_rnti;
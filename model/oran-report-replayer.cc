@@ -0,0 +1,474 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-report-replayer.h"
+
+#include "oran-near-rt-ric-e2terminator.h"
+#include "oran-report-apploss.h"
+#include "oran-report-location.h"
+#include "oran-report-lte-energy-efficiency.h"
+#include "oran-report-lte-ue-app-demand.h"
+#include "oran-report-lte-ue-cell-info.h"
+#include "oran-report-lte-ue-rsrp-rsrq.h"
+#include "oran-report-nr-energy-efficiency.h"
+#include "oran-report-nr-ue-app-demand.h"
+#include "oran-report-nr-ue-cell-info.h"
+#include "oran-report-nr-ue-rsrp-rsrq.h"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/enum.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+#include "ns3/vector.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranReportReplayer");
+
+NS_OBJECT_ENSURE_REGISTERED(OranReportReplayer);
+
+namespace
+{
+
+/**
+ * The statements reading the recorded tables, indexed by source. Every
+ * statement returns the simulation time and the E2 Node ID first.
+ */
+const char* const g_sourceQueries[] = {
+    "SELECT simulationtime, nodeid, registered FROM noderegistration "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, x, y, z FROM nodelocation "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, loss FROM nodeapploss "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, cellid, rnti FROM lteuecell "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, rnti, cellid, rsrp, rsrq, serving, ccid FROM lteuersrprsrq "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, remaining FROM enb_energy_remaining "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, demandmbps FROM ue_app_demand "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, cellid, rnti FROM nruecell "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, rnti, cellid, rsrp, rsrq, serving, ccid FROM nruersrprsrq "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, remaining FROM nr_energy_remaining "
+    "ORDER BY simulationtime, entryid;",
+    "SELECT simulationtime, nodeid, demandmbps FROM nr_ue_app_demand "
+    "ORDER BY simulationtime, entryid;",
+};
+
+} // namespace
+
+TypeId
+OranReportReplayer::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranReportReplayer")
+            .SetParent<Object>()
+            .AddConstructor<OranReportReplayer>()
+            .AddAttribute("DatabaseFile",
+                          "The SQLite database of the recorded run.",
+                          StringValue(""),
+                          MakeStringAccessor(&OranReportReplayer::m_dbPath),
+                          MakeStringChecker())
+            .AddAttribute("NearRtRic",
+                          "The Near-RT RIC fed with the recorded stream.",
+                          PointerValue(nullptr),
+                          MakePointerAccessor(&OranReportReplayer::m_nearRtRic),
+                          MakePointerChecker<OranNearRtRic>())
+            .AddTraceSource("CommandReceived",
+                            "A Command sent by the Near-RT RIC to a replayed E2 node.",
+                            MakeTraceSourceAccessor(&OranReportReplayer::m_commandTrace),
+                            "ns3::OranE2NodeTerminatorReplay::CommandTracedCallback");
+
+    return tid;
+}
+
+OranReportReplayer::OranReportReplayer()
+    : Object(),
+      m_active(false),
+      m_db(nullptr),
+      m_nReportsReplayed(0),
+      m_nCommandsReceived(0)
+{
+    NS_LOG_FUNCTION(this);
+
+    static_assert(sizeof(g_sourceQueries) / sizeof(g_sourceQueries[0]) == NUM_SOURCES,
+                  "One query per recorded table");
+}
+
+OranReportReplayer::~OranReportReplayer()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranReportReplayer::Activate()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_active)
+    {
+        return;
+    }
+
+    NS_ABORT_MSG_IF(m_nearRtRic == nullptr, "Attempting to replay to a null Near-RT RIC");
+    NS_ABORT_MSG_IF(m_dbPath.empty(), "No recorded database to replay");
+
+    if (sqlite3_open_v2(m_dbPath.c_str(), &m_db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK)
+    {
+        NS_ABORT_MSG("Could not open recorded database \"" << m_dbPath
+                                                           << "\": " << sqlite3_errmsg(m_db));
+    }
+
+    LoadNodes();
+    OpenCursors();
+
+    m_active = true;
+
+    ScheduleNext();
+}
+
+void
+OranReportReplayer::Deactivate()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_active)
+    {
+        m_replayEvent.Cancel();
+        CloseDb();
+        m_active = false;
+    }
+}
+
+bool
+OranReportReplayer::IsActive() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_active;
+}
+
+Ptr<OranE2NodeTerminatorReplay>
+OranReportReplayer::GetTerminator(uint64_t e2NodeId) const
+{
+    NS_LOG_FUNCTION(this << e2NodeId);
+
+    auto it = m_terminators.find(e2NodeId);
+    if (it == m_terminators.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+uint64_t
+OranReportReplayer::GetNReportsReplayed() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nReportsReplayed;
+}
+
+uint64_t
+OranReportReplayer::GetNCommandsReceived() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_nCommandsReceived;
+}
+
+void
+OranReportReplayer::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    Deactivate();
+
+    m_terminators.clear();
+    m_nearRtRic = nullptr;
+
+    Object::DoDispose();
+}
+
+void
+OranReportReplayer::LoadNodes()
+{
+    NS_LOG_FUNCTION(this);
+
+    sqlite3_stmt* stmt = nullptr;
+    int rc = sqlite3_prepare_v2(m_db,
+                                "SELECT node.nodeid, node.nodetype, "
+                                "COALESCE(lteenb.cellid, nrgnb.cellid, 0), "
+                                "COALESCE(lteue.imsi, nrue.imsi, 0) "
+                                "FROM node "
+                                "LEFT JOIN lteenb ON lteenb.nodeid = node.nodeid "
+                                "LEFT JOIN nrgnb ON nrgnb.nodeid = node.nodeid "
+                                "LEFT JOIN lteue ON lteue.nodeid = node.nodeid "
+                                "LEFT JOIN nrue ON nrue.nodeid = node.nodeid "
+                                "ORDER BY node.nodeid;",
+                                -1,
+                                &stmt,
+                                nullptr);
+    NS_ABORT_MSG_IF(rc != SQLITE_OK,
+                    "Could not read the recorded E2 nodes: " << sqlite3_errmsg(m_db));
+
+    while (sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        uint64_t e2NodeId = sqlite3_column_int64(stmt, 0);
+
+        Ptr<OranE2NodeTerminatorReplay> terminator = CreateObject<OranE2NodeTerminatorReplay>();
+        terminator->SetAttribute("E2NodeId", UintegerValue(e2NodeId));
+        terminator->SetAttribute("NearRtRic", PointerValue(m_nearRtRic));
+        terminator->SetAttribute(
+            "NodeType",
+            EnumValue(static_cast<OranNearRtRic::NodeType>(sqlite3_column_int(stmt, 1))));
+        terminator->SetAttribute("CellId", UintegerValue(sqlite3_column_int(stmt, 2)));
+        terminator->SetAttribute("Imsi", UintegerValue(sqlite3_column_int64(stmt, 3)));
+        terminator->TraceConnectWithoutContext(
+            "CommandReceived",
+            MakeCallback(&OranReportReplayer::NotifyCommand, this));
+
+        m_terminators[e2NodeId] = terminator;
+    }
+    sqlite3_finalize(stmt);
+
+    NS_LOG_INFO("Replaying " << m_terminators.size() << " E2 nodes from \"" << m_dbPath << "\"");
+}
+
+void
+OranReportReplayer::OpenCursors()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (uint32_t s = 0; s < NUM_SOURCES; s++)
+    {
+        Cursor& cursor = m_cursors[s];
+        int rc = sqlite3_prepare_v2(m_db, g_sourceQueries[s], -1, &cursor.stmt, nullptr);
+        NS_ABORT_MSG_IF(rc != SQLITE_OK,
+                        "Could not read the recorded table (" << g_sourceQueries[s]
+                                                              << "): " << sqlite3_errmsg(m_db));
+        Step(cursor);
+    }
+}
+
+void
+OranReportReplayer::Step(Cursor& cursor)
+{
+    int rc = sqlite3_step(cursor.stmt);
+    NS_ABORT_MSG_IF(rc != SQLITE_ROW && rc != SQLITE_DONE,
+                    "Error reading the recorded database: " << sqlite3_errmsg(m_db));
+
+    cursor.valid = rc == SQLITE_ROW;
+    if (cursor.valid)
+    {
+        cursor.time = sqlite3_column_int64(cursor.stmt, 0);
+    }
+}
+
+void
+OranReportReplayer::ScheduleNext()
+{
+    NS_LOG_FUNCTION(this);
+
+    bool found = false;
+    int64_t next = 0;
+    for (const auto& cursor : m_cursors)
+    {
+        if (cursor.valid && (!found || cursor.time < next))
+        {
+            next = cursor.time;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        NS_LOG_INFO("Replay complete: " << m_nReportsReplayed << " Reports replayed");
+        return;
+    }
+
+    Time delay = std::max(TimeStep(next) - Simulator::Now(), Seconds(0));
+    m_replayEvent = Simulator::Schedule(delay, &OranReportReplayer::ReplayNext, this);
+}
+
+void
+OranReportReplayer::ReplayNext()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<OranNearRtRicE2Terminator> e2Terminator = m_nearRtRic->GetE2Terminator();
+    int64_t now = Simulator::Now().GetTimeStep();
+
+    // Registrations are replayed before the Reports with the same time, and
+    // deregistrations after them, as the recorded repository only holds
+    // Reports from registered nodes.
+    std::vector<uint64_t> deregistrations;
+    Cursor& registrations = m_cursors[REGISTRATION];
+    for (; registrations.valid && registrations.time <= now; Step(registrations))
+    {
+        uint64_t e2NodeId = sqlite3_column_int64(registrations.stmt, 1);
+        auto it = m_terminators.find(e2NodeId);
+        if (it == m_terminators.end())
+        {
+            NS_LOG_WARN("Skipping the registration of unknown E2 node " << e2NodeId);
+            continue;
+        }
+
+        if (sqlite3_column_int(registrations.stmt, 2) != 0)
+        {
+            e2Terminator->ReceiveRegistrationRequest(it->second->GetNodeType(),
+                                                     e2NodeId,
+                                                     it->second);
+        }
+        else
+        {
+            deregistrations.push_back(e2NodeId);
+        }
+    }
+
+    std::vector<Ptr<OranReport>> reports;
+    for (uint32_t s = REGISTRATION + 1; s < NUM_SOURCES; s++)
+    {
+        Cursor& cursor = m_cursors[s];
+        for (; cursor.valid && cursor.time <= now; Step(cursor))
+        {
+            reports.push_back(BuildReport(static_cast<Source>(s), cursor.stmt));
+        }
+    }
+
+    if (!reports.empty())
+    {
+        m_nReportsReplayed += reports.size();
+        e2Terminator->ReceiveReportBatch(std::move(reports));
+    }
+
+    for (auto e2NodeId : deregistrations)
+    {
+        e2Terminator->ReceiveDeregistrationRequest(e2NodeId);
+    }
+
+    ScheduleNext();
+}
+
+Ptr<OranReport>
+OranReportReplayer::BuildReport(Source source, sqlite3_stmt* stmt) const
+{
+    Ptr<OranReport> report;
+    switch (source)
+    {
+    case LOCATION:
+        report = CreateObject<OranReportLocation>();
+        report->SetAttribute("Location",
+                             VectorValue(Vector(sqlite3_column_double(stmt, 2),
+                                                sqlite3_column_double(stmt, 3),
+                                                sqlite3_column_double(stmt, 4))));
+        break;
+    case APP_LOSS:
+        report = CreateObject<OranReportAppLoss>();
+        report->SetAttribute("Loss", DoubleValue(sqlite3_column_double(stmt, 2)));
+        break;
+    case LTE_UE_CELL_INFO:
+    case NR_UE_CELL_INFO:
+        if (source == LTE_UE_CELL_INFO)
+        {
+            report = CreateObject<OranReportLteUeCellInfo>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeCellInfo>();
+        }
+        report->SetAttribute("CellId", UintegerValue(sqlite3_column_int(stmt, 2)));
+        report->SetAttribute("Rnti", UintegerValue(sqlite3_column_int(stmt, 3)));
+        break;
+    case LTE_UE_RSRP_RSRQ:
+    case NR_UE_RSRP_RSRQ:
+        if (source == LTE_UE_RSRP_RSRQ)
+        {
+            report = CreateObject<OranReportLteUeRsrpRsrq>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeRsrpRsrq>();
+        }
+        report->SetAttribute("Rnti", UintegerValue(sqlite3_column_int(stmt, 2)));
+        report->SetAttribute("CellId", UintegerValue(sqlite3_column_int(stmt, 3)));
+        report->SetAttribute("Rsrp", DoubleValue(sqlite3_column_double(stmt, 4)));
+        report->SetAttribute("Rsrq", DoubleValue(sqlite3_column_double(stmt, 5)));
+        report->SetAttribute("IsServingCell", BooleanValue(sqlite3_column_int(stmt, 6) != 0));
+        report->SetAttribute("ComponentCarrierId", UintegerValue(sqlite3_column_int(stmt, 7)));
+        break;
+    case LTE_ENERGY:
+    case NR_ENERGY:
+        if (source == LTE_ENERGY)
+        {
+            report = CreateObject<OranReportLteEnergyEfficiency>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrEnergyEfficiency>();
+        }
+        report->SetAttribute("EnergyRemaining", DoubleValue(sqlite3_column_double(stmt, 2)));
+        break;
+    case LTE_UE_APP_DEMAND:
+    case NR_UE_APP_DEMAND:
+        if (source == LTE_UE_APP_DEMAND)
+        {
+            report = CreateObject<OranReportLteUeAppDemand>();
+        }
+        else
+        {
+            report = CreateObject<OranReportNrUeAppDemand>();
+        }
+        report->SetAttribute("DemandMbps", DoubleValue(sqlite3_column_double(stmt, 2)));
+        break;
+    default:
+        NS_ABORT_MSG("Not a recorded Report table");
+    }
+
+    report->SetAttribute("ReporterE2NodeId", UintegerValue(sqlite3_column_int64(stmt, 1)));
+    report->SetAttribute("Time", TimeValue(TimeStep(sqlite3_column_int64(stmt, 0))));
+
+    return report;
+}
+
+void
+OranReportReplayer::CloseDb()
+{
+    NS_LOG_FUNCTION(this);
+
+    for (auto& cursor : m_cursors)
+    {
+        sqlite3_finalize(cursor.stmt);
+        cursor = Cursor();
+    }
+
+    sqlite3_close(m_db);
+    m_db = nullptr;
+}
+
+void
+OranReportReplayer::NotifyCommand(uint64_t e2NodeId, Ptr<const OranCommand> command)
+{
+    NS_LOG_FUNCTION(this << e2NodeId << command);
+
+    m_nCommandsReceived++;
+    m_commandTrace(e2NodeId, command);
+}
+
+} // namespace ns3
@@ -0,0 +1,223 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_REPORT_REPLAYER_H
+#define ORAN_REPORT_REPLAYER_H
+
+#include "oran-command.h"
+#include "oran-e2-node-terminator-replay.h"
+#include "oran-near-rt-ric.h"
+#include "oran-report.h"
+
+#include "ns3/event-id.h"
+#include "ns3/object.h"
+#include "ns3/traced-callback.h"
+
+#include <array>
+#include <map>
+#include <sqlite3.h>
+#include <string>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * Drives a Near-RT RIC from the E2 report stream of a previous run, without
+ * simulating the radio network.
+ *
+ * The replayer reads the SQLite database written by the
+ * OranDataRepositorySqlite of the recorded run. It creates an
+ * OranE2NodeTerminatorReplay for every recorded E2 node, and feeds the
+ * recorded registrations, deregistrations, and Reports into the Near-RT RIC
+ * E2 Terminator at their recorded simulation times, so LMs and CMMs run
+ * unchanged on the same data. Commands issued by the RIC are logged by the
+ * replay terminators (and traced by this object) instead of being applied,
+ * so the replayed stream does not react to them.
+ *
+ * The recorded database is only read. The Near-RT RIC must use a different,
+ * empty data repository, and be started at the same time as in the recorded
+ * run. Nodes are registered with their recorded E2 Node IDs.
+ */
+class OranReportReplayer : public Object
+{
+  public:
+    /**
+     * Get the TypeId of the OranReportReplayer class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranReportReplayer class.
+     */
+    OranReportReplayer();
+    /**
+     * Destructor of the OranReportReplayer class.
+     */
+    ~OranReportReplayer() override;
+    /**
+     * Open the recorded database, create the replay terminators, and
+     * schedule the first records. Records older than the current time are
+     * replayed immediately.
+     */
+    void Activate();
+    /**
+     * Stop the replay and close the recorded database.
+     */
+    void Deactivate();
+    /**
+     * Check if the replayer is active.
+     *
+     * @return True if the replayer is active.
+     */
+    bool IsActive() const;
+    /**
+     * Get the replay terminator of a recorded E2 node.
+     *
+     * @param e2NodeId The recorded E2 Node ID.
+     *
+     * @return The terminator, or nullptr if the node was not recorded.
+     */
+    Ptr<OranE2NodeTerminatorReplay> GetTerminator(uint64_t e2NodeId) const;
+    /**
+     * Get the number of Reports replayed so far.
+     *
+     * @return The number of Reports.
+     */
+    uint64_t GetNReportsReplayed() const;
+    /**
+     * Get the number of Commands received by the replay terminators so far.
+     *
+     * @return The number of Commands.
+     */
+    uint64_t GetNCommandsReceived() const;
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    /**
+     * The recorded tables, in the order their records are replayed when
+     * they share a simulation time.
+     */
+    enum Source
+    {
+        REGISTRATION = 0,
+        LOCATION,
+        APP_LOSS,
+        LTE_UE_CELL_INFO,
+        LTE_UE_RSRP_RSRQ,
+        LTE_ENERGY,
+        LTE_UE_APP_DEMAND,
+        NR_UE_CELL_INFO,
+        NR_UE_RSRP_RSRQ,
+        NR_ENERGY,
+        NR_UE_APP_DEMAND,
+        NUM_SOURCES
+    };
+
+    /**
+     * A statement stepping through one recorded table in time order.
+     */
+    struct Cursor
+    {
+        sqlite3_stmt* stmt = nullptr; //!< The statement.
+        bool valid = false;           //!< Whether the statement is on a row.
+        int64_t time = 0;             //!< The simulation time (time steps) of the row.
+    };
+
+    /**
+     * Create the replay terminators for the recorded E2 nodes.
+     */
+    void LoadNodes();
+    /**
+     * Prepare the statement of every recorded table and step to its first row.
+     */
+    void OpenCursors();
+    /**
+     * Step a cursor to its next row.
+     *
+     * @param cursor The cursor.
+     */
+    void Step(Cursor& cursor);
+    /**
+     * Schedule the replay of the next records, if any are left.
+     */
+    void ScheduleNext();
+    /**
+     * Replay every record due at the current time.
+     */
+    void ReplayNext();
+    /**
+     * Build the Report in the current row of a recorded table.
+     *
+     * @param source The table.
+     * @param stmt The statement of the table, on a row.
+     *
+     * @return The Report.
+     */
+    Ptr<OranReport> BuildReport(Source source, sqlite3_stmt* stmt) const;
+    /**
+     * Finalize the statements and close the recorded database.
+     */
+    void CloseDb();
+    /**
+     * Trace sink for the Commands received by the replay terminators.
+     *
+     * @param e2NodeId The recorded E2 Node ID.
+     * @param command The Command.
+     */
+    void NotifyCommand(uint64_t e2NodeId, Ptr<const OranCommand> command);
+
+    /**
+     * Flag to indicate if the replayer is active.
+     */
+    bool m_active;
+    /**
+     * The path of the recorded database.
+     */
+    std::string m_dbPath;
+    /**
+     * The Near-RT RIC fed with the recorded stream.
+     */
+    Ptr<OranNearRtRic> m_nearRtRic;
+    /**
+     * The recorded database.
+     */
+    sqlite3* m_db;
+    /**
+     * The cursors over the recorded tables.
+     */
+    std::array<Cursor, NUM_SOURCES> m_cursors;
+    /**
+     * The replay terminators, by recorded E2 Node ID.
+     */
+    std::map<uint64_t, Ptr<OranE2NodeTerminatorReplay>> m_terminators;
+    /**
+     * The event replaying the next records.
+     */
+    EventId m_replayEvent;
+    /**
+     * The number of Reports replayed.
+     */
+    uint64_t m_nReportsReplayed;
+    /**
+     * The number of Commands received by the replay terminators.
+     */
+    uint64_t m_nCommandsReceived;
+    /**
+     * The trace of Commands received by the replay terminators.
+     */
+    TracedCallback<uint64_t, Ptr<const OranCommand>> m_commandTrace;
+}; // class OranReportReplayer
+
+} // namespace ns3
+
+#endif // ORAN_REPORT_REPLAYER_H
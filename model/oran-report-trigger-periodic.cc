@@ -39,6 +39,8 @@
 #include "ns3/simulator.h"
 #include "ns3/string.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -53,6 +55,12 @@ OranReportTriggerPeriodic::GetTypeId()
         TypeId("ns3::OranReportTriggerPeriodic")
             .SetParent<OranReportTrigger>()
             .AddConstructor<OranReportTriggerPeriodic>()
+            .AddAttribute("TickService",
+                          "The tick service that coalesces the trigger timers. If null, every "
+                          "trigger schedules its own simulator event.",
+                          PointerValue(nullptr),
+                          MakePointerAccessor(&OranReportTriggerPeriodic::m_tickService),
+                          MakePointerChecker<OranTickService>())
             .AddAttribute("IntervalRv",
                           "The random variable used to generate the delay (in seconds) between "
                           "periodic reports.",
@@ -65,7 +73,7 @@ OranReportTriggerPeriodic::GetTypeId()
 
 OranReportTriggerPeriodic::OranReportTriggerPeriodic()
     : OranReportTrigger(),
-      m_triggerEvent(EventId())
+      m_minInterval(Seconds(0))
 {
     NS_LOG_FUNCTION(this);
 }
@@ -82,7 +90,13 @@ OranReportTriggerPeriodic::Activate(Ptr<OranReporter> reporter)
 
     if (!m_active)
     {
-        ScheduleNextTrigger();
+        // The first trigger gets the service's phase jitter, so that
+        // reporters activated together do not all land on the same tick.
+        m_triggerEvent =
+            OranTickService::Schedule(m_tickService,
+                                      std::max(Seconds(m_intervalRv->GetValue()), m_minInterval),
+                                      MakeCallback(&OranReportTriggerPeriodic::TriggerReport, this),
+                                      true);
     }
 
     OranReportTrigger::Activate(reporter);
@@ -101,6 +115,14 @@ OranReportTriggerPeriodic::Deactivate()
     OranReportTrigger::Deactivate();
 }
 
+void
+OranReportTriggerPeriodic::SetMinInterval(Time minInterval)
+{
+    NS_LOG_FUNCTION(this << minInterval);
+
+    m_minInterval = minInterval;
+}
+
 void
 OranReportTriggerPeriodic::DoDispose()
 {
@@ -112,6 +134,7 @@ OranReportTriggerPeriodic::DoDispose()
     }
 
     m_intervalRv = nullptr;
+    m_tickService = nullptr;
 
     OranReportTrigger::DoDispose();
 }
@@ -145,9 +168,10 @@ OranReportTriggerPeriodic::ScheduleNextTrigger()
 {
     NS_LOG_FUNCTION(this);
 
-    m_triggerEvent = Simulator::Schedule(Seconds(m_intervalRv->GetValue()),
-                                         &OranReportTriggerPeriodic::TriggerReport,
-                                         this);
+    m_triggerEvent =
+        OranTickService::Schedule(m_tickService,
+                                  std::max(Seconds(m_intervalRv->GetValue()), m_minInterval),
+                                  MakeCallback(&OranReportTriggerPeriodic::TriggerReport, this));
 }
 
 } // namespace ns3
@@ -32,6 +32,7 @@
 #define ORAN_REPORT_TRIGGER_PERIODIC_H
 
 #include "oran-report-trigger.h"
+#include "oran-tick-service.h"
 
 #include "ns3/event-id.h"
 #include "ns3/object.h"
@@ -76,6 +77,13 @@ class OranReportTriggerPeriodic : public OranReportTrigger
      * Deactivates this trigger and unlinks it from the current reporter.
      */
     void Deactivate() override;
+    /**
+     * Set the shortest interval between the Reports of this trigger. Intervals
+     * drawn from IntervalRv that are shorter are stretched to it.
+     *
+     * @param minInterval The interval, or 0 to keep the drawn intervals.
+     */
+    void SetMinInterval(Time minInterval) override;
 
   protected:
     /**
@@ -99,12 +107,20 @@ class OranReportTriggerPeriodic : public OranReportTrigger
     /**
      * The next trigger event.
      */
-    EventId m_triggerEvent;
+    OranTickEventId m_triggerEvent;
+    /**
+     * The tick service the trigger timers are scheduled on, if any.
+     */
+    Ptr<OranTickService> m_tickService;
     /**
      * The random variable used to generate the delay (in seconds) between
      * triggered reports.
      */
     Ptr<RandomVariableStream> m_intervalRv;
+    /**
+     * The shortest interval between triggered reports.
+     */
+    Time m_minInterval;
 }; // class OranReportTriggerPeriodic
 
 } // namespace ns3
@@ -117,6 +117,12 @@ OranReportTrigger::NotifyRegistrationComplete()
     }
 }
 
+void
+OranReportTrigger::SetMinInterval(Time minInterval)
+{
+    NS_LOG_FUNCTION(this << minInterval);
+}
+
 void
 OranReportTrigger::DoDispose()
 {
@@ -134,6 +140,12 @@ OranReportTrigger::TriggerReport()
 
     NS_ABORT_MSG_IF(m_reporter == nullptr, "Attempting to trigger a report with a NULL reporter.");
 
+    if (m_reporter->IsSuspended())
+    {
+        NS_LOG_LOGIC("Skipping the report of a suspended reporter");
+        return;
+    }
+
     m_reporter->PerformReport();
 }
 
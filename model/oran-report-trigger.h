@@ -31,6 +31,7 @@
 #ifndef ORAN_REPORT_TRIGGER_H
 #define ORAN_REPORT_TRIGGER_H
 
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
@@ -74,6 +75,13 @@ class OranReportTrigger : public Object
      * Notifies the trigger that initial registartion has completed successfully.
      */
     virtual void NotifyRegistrationComplete();
+    /**
+     * Set the shortest interval between the Reports of this trigger. Periodic
+     * triggers stretch shorter intervals to it; the default ignores it.
+     *
+     * @param minInterval The interval, or 0 to keep the configured one.
+     */
+    virtual void SetMinInterval(Time minInterval);
 
   protected:
     /**
@@ -85,7 +93,7 @@ class OranReportTrigger : public Object
      */
     void DoDispose() override;
     /**
-     * Triggers a report.
+     * Triggers a report, unless the reporter is suspended.
      */
     virtual void TriggerReport();
 
@@ -95,4 +95,12 @@ OranReport::GetTime() const
     return m_time;
 }
 
+uint64_t
+OranReport::GetCoalescingKey() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return 0;
+}
+
 } // namespace ns3
@@ -83,6 +83,16 @@ class OranReport : public Object
      * @return The Time at which the Report was generated.
      */
     Time GetTime() const;
+    /**
+     * Get the key that identifies which Reports of the same type from the
+     * same Reporter supersede each other when a Node E2 Terminator coalesces
+     * them (see the CoalescedReportTypes attribute of OranE2NodeTerminator).
+     * Reports that describe a per-cell quantity return a key derived from
+     * the cell, so only the Reports for the same cell replace each other.
+     *
+     * @return The key. The default implementation returns 0.
+     */
+    virtual uint64_t GetCoalescingKey() const;
 
   private:
     /**
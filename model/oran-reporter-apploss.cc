@@ -117,4 +117,12 @@ OranReporterAppLoss::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterAppLoss::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportAppLoss::GetTypeId()};
+}
+
 } // namespace ns3
@@ -79,6 +79,12 @@ class OranReporterAppLoss : public OranReporter
      * @param from The address that the packet is from.
      */
     void AddRx(Ptr<const Packet> p, const Address& from);
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportAppLoss TypeId.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     /**
@@ -89,4 +89,12 @@ OranReporterLocation::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterLocation::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportLocation::GetTypeId()};
+}
+
 } // namespace ns3
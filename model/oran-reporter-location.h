@@ -63,6 +63,12 @@ class OranReporterLocation : public OranReporter
      * Destructor of the OranReporterLocation class.
      */
     ~OranReporterLocation() override;
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportLocation TypeId.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     /**
@@ -101,4 +101,12 @@ OranReporterLteEnergyEfficiency::GenerateReports()
   return out;
 }
 
+std::vector<TypeId>
+OranReporterLteEnergyEfficiency::GetReportTypes () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return {OranReportLteEnergyEfficiency::GetTypeId ()};
+}
+
 } // namespace ns3
@@ -81,4 +81,12 @@ OranReporterLteUeAppDemand::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterLteUeAppDemand::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportLteUeAppDemand::GetTypeId()};
+}
+
 } // namespace ns3
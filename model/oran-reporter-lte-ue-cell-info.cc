@@ -104,4 +104,12 @@ OranReporterLteUeCellInfo::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterLteUeCellInfo::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportLteUeCellInfo::GetTypeId()};
+}
+
 } // namespace ns3
@@ -64,6 +64,12 @@ class OranReporterLteUeCellInfo : public OranReporter
      * Destructor of the OranReporterLteUeCellInfo class.
      */
     ~OranReporterLteUeCellInfo() override;
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportLteUeCellInfo TypeId.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     /**
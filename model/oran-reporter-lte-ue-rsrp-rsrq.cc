@@ -30,12 +30,14 @@
 
 #include "oran-reporter-lte-ue-rsrp-rsrq.h"
 
+#include "oran-report-lte-ue-multi-cell-rsrp-rsrq.h"
 #include "oran-report-lte-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
 #include "ns3/address.h"
 #include "ns3/boolean.h"
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -52,14 +54,37 @@ NS_OBJECT_ENSURE_REGISTERED(OranReporterLteUeRsrpRsrq);
 TypeId
 OranReporterLteUeRsrpRsrq::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::OranReporterLteUeRsrpRsrq")
-                            .SetParent<OranReporter>()
-                            .AddConstructor<OranReporterLteUeRsrpRsrq>();
+    static TypeId tid =
+        TypeId("ns3::OranReporterLteUeRsrpRsrq")
+            .SetParent<OranReporter>()
+            .AddConstructor<OranReporterLteUeRsrpRsrq>()
+            .AddAttribute("Aggregate",
+                          "Whether the measurements of a report period are sent as one "
+                          "multi-cell Report per UE instead of one Report per measurement.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OranReporterLteUeRsrpRsrq::m_aggregate),
+                          MakeBooleanChecker())
+            .AddAttribute("Reduction",
+                          "How the measurements of a cell within a report period are reduced "
+                          "when aggregating.",
+                          EnumValue(OranUeRsrpRsrqAggregator::LAST),
+                          MakeEnumAccessor<OranUeRsrpRsrqAggregator::Reduction>(
+                              &OranReporterLteUeRsrpRsrq::m_reduction),
+                          MakeEnumChecker(OranUeRsrpRsrqAggregator::LAST,
+                                          "LAST",
+                                          OranUeRsrpRsrqAggregator::MEAN,
+                                          "MEAN",
+                                          OranUeRsrpRsrqAggregator::MIN,
+                                          "MIN",
+                                          OranUeRsrpRsrqAggregator::MAX,
+                                          "MAX"));
 
     return tid;
 }
 
 OranReporterLteUeRsrpRsrq::OranReporterLteUeRsrpRsrq()
+    : m_aggregate(false),
+      m_reduction(OranUeRsrpRsrqAggregator::LAST)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -100,6 +125,13 @@ OranReporterLteUeRsrpRsrq::ReportRsrpRsrq(uint16_t rnti,
         NS_ABORT_MSG_IF(m_terminator == nullptr,
                         "Attempting to generate reports in reporter with NULL E2 Terminator");
 
+        if (m_aggregate)
+        {
+            m_aggregator
+                .Add(Simulator::Now(), rnti, cellId, rsrp, rsrq, isServingCell, componentCarrierId);
+            return;
+        }
+
         Ptr<OranReportLteUeRsrpRsrq> report = CreateObject<OranReportLteUeRsrpRsrq>();
         report->SetAttribute("ReporterE2NodeId", UintegerValue(m_terminator->GetE2NodeId()));
         report->SetAttribute("Time", TimeValue(Simulator::Now()));
@@ -125,9 +157,30 @@ OranReporterLteUeRsrpRsrq::GenerateReports()
     {
         reports = m_reports;
         m_reports.clear();
+
+        if (!m_aggregator.IsEmpty())
+        {
+            Ptr<OranReportLteUeMultiCellRsrpRsrq> report =
+                CreateObject<OranReportLteUeMultiCellRsrpRsrq>();
+            report->SetAttribute("ReporterE2NodeId",
+                                 UintegerValue(m_terminator->GetE2NodeId()));
+            report->SetAttribute("Time", TimeValue(m_aggregator.GetTime()));
+            report->SetAttribute("Rnti", UintegerValue(m_aggregator.GetRnti()));
+            report->SetMeasurements(m_aggregator.Flush(m_reduction));
+
+            reports.push_back(report);
+        }
     }
 
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterLteUeRsrpRsrq::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportLteUeRsrpRsrq::GetTypeId(), OranReportLteUeMultiCellRsrpRsrq::GetTypeId()};
+}
+
 } // namespace ns3
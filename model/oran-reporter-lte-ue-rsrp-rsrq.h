@@ -33,6 +33,7 @@
 
 #include "oran-report.h"
 #include "oran-reporter.h"
+#include "oran-ue-rsrp-rsrq-aggregator.h"
 
 #include "ns3/ptr.h"
 
@@ -82,6 +83,12 @@ class OranReporterLteUeRsrpRsrq : public OranReporter
                         double rsrq,
                         bool isServingCell,
                         uint8_t componentCarrierId);
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportLteUeRsrpRsrq and OranReportLteUeMultiCellRsrpRsrq TypeIds.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     /**
@@ -96,6 +103,21 @@ class OranReporterLteUeRsrpRsrq : public OranReporter
      * The reports.
      */
     std::vector<Ptr<OranReport>> m_reports;
+    /**
+     * Whether the measurements of a report period are sent as one
+     * OranReportLteUeMultiCellRsrpRsrq instead of one Report each.
+     */
+    bool m_aggregate;
+    /**
+     * How the measurements of a cell within a report period are reduced
+     * when m_aggregate is true.
+     */
+    OranUeRsrpRsrqAggregator::Reduction m_reduction;
+    /**
+     * The measurements of the current report period, when m_aggregate is
+     * true.
+     */
+    OranUeRsrpRsrqAggregator m_aggregator;
 };
 
 } // namespace ns3
@@ -100,4 +100,12 @@ OranReporterNrEnergyEfficiency::GenerateReports()
   return out;
 }
 
+std::vector<TypeId>
+OranReporterNrEnergyEfficiency::GetReportTypes () const
+{
+  NS_LOG_FUNCTION (this);
+
+  return {OranReportNrEnergyEfficiency::GetTypeId ()};
+}
+
 } // namespace ns3
@@ -38,6 +38,8 @@ public:
 
   void ReportEnergyEfficiency (void);
 
+  std::vector<TypeId> GetReportTypes () const override;
+
 protected:
   std::vector<Ptr<OranReport>> GenerateReports () override;
 
@@ -81,4 +81,12 @@ OranReporterNrUeAppDemand::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterNrUeAppDemand::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportNrUeAppDemand::GetTypeId()};
+}
+
 } // namespace ns3
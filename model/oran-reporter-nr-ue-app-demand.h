@@ -36,6 +36,12 @@ class OranReporterNrUeAppDemand : public OranReporter
      * @param demandMbps Observed demand (Mbps) over the last reporting interval.
      */
     void ReportDemand(double demandMbps);
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportNrUeAppDemand TypeId.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     std::vector<Ptr<OranReport>> GenerateReports() override;
@@ -79,4 +79,12 @@ OranReporterNrUeCellInfo::GenerateReports()
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterNrUeCellInfo::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportNrUeCellInfo::GetTypeId()};
+}
+
 } // namespace ns3
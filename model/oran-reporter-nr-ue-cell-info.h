@@ -28,6 +28,7 @@ class OranReporterNrUeCellInfo : public OranReporter
     static TypeId GetTypeId();
     OranReporterNrUeCellInfo();
     ~OranReporterNrUeCellInfo() override;
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     std::vector<Ptr<OranReport>> GenerateReports() override;
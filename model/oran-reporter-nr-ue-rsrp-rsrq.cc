@@ -5,12 +5,14 @@
  */
 #include "oran-reporter-nr-ue-rsrp-rsrq.h"
 
+#include "oran-report-nr-ue-multi-cell-rsrp-rsrq.h"
 #include "oran-report-nr-ue-rsrp-rsrq.h"
 
 #include "ns3/abort.h"
 #include "ns3/address.h"
 #include "ns3/boolean.h"
 #include "ns3/double.h"
+#include "ns3/enum.h"
 #include "ns3/log.h"
 #include "ns3/packet.h"
 #include "ns3/simulator.h"
@@ -27,14 +29,37 @@ NS_OBJECT_ENSURE_REGISTERED(OranReporterNrUeRsrpRsrq);
 TypeId
 OranReporterNrUeRsrpRsrq::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::OranReporterNrUeRsrpRsrq")
-                            .SetParent<OranReporter>()
-                            .AddConstructor<OranReporterNrUeRsrpRsrq>();
+    static TypeId tid =
+        TypeId("ns3::OranReporterNrUeRsrpRsrq")
+            .SetParent<OranReporter>()
+            .AddConstructor<OranReporterNrUeRsrpRsrq>()
+            .AddAttribute("Aggregate",
+                          "Whether the measurements of a report period are sent as one "
+                          "multi-cell Report per UE instead of one Report per measurement.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&OranReporterNrUeRsrpRsrq::m_aggregate),
+                          MakeBooleanChecker())
+            .AddAttribute("Reduction",
+                          "How the measurements of a cell within a report period are reduced "
+                          "when aggregating.",
+                          EnumValue(OranUeRsrpRsrqAggregator::LAST),
+                          MakeEnumAccessor<OranUeRsrpRsrqAggregator::Reduction>(
+                              &OranReporterNrUeRsrpRsrq::m_reduction),
+                          MakeEnumChecker(OranUeRsrpRsrqAggregator::LAST,
+                                          "LAST",
+                                          OranUeRsrpRsrqAggregator::MEAN,
+                                          "MEAN",
+                                          OranUeRsrpRsrqAggregator::MIN,
+                                          "MIN",
+                                          OranUeRsrpRsrqAggregator::MAX,
+                                          "MAX"));
 
     return tid;
 }
 
 OranReporterNrUeRsrpRsrq::OranReporterNrUeRsrpRsrq()
+    : m_aggregate(false),
+      m_reduction(OranUeRsrpRsrqAggregator::LAST)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -67,6 +92,13 @@ OranReporterNrUeRsrpRsrq::ReportRsrpRsrq(uint16_t rnti,
         NS_ABORT_MSG_IF(m_terminator == nullptr,
                         "Attempting to generate reports in reporter with NULL E2 Terminator");
 
+        if (m_aggregate)
+        {
+            m_aggregator
+                .Add(Simulator::Now(), rnti, cellId, rsrp, rsrq, isServingCell, componentCarrierId);
+            return;
+        }
+
         Ptr<OranReportNrUeRsrpRsrq> report = CreateObject<OranReportNrUeRsrpRsrq>();
         report->SetAttribute("ReporterE2NodeId", UintegerValue(m_terminator->GetE2NodeId()));
         report->SetAttribute("Time", TimeValue(Simulator::Now()));
@@ -92,9 +124,30 @@ OranReporterNrUeRsrpRsrq::GenerateReports()
     {
         reports = m_reports;
         m_reports.clear();
+
+        if (!m_aggregator.IsEmpty())
+        {
+            Ptr<OranReportNrUeMultiCellRsrpRsrq> report =
+                CreateObject<OranReportNrUeMultiCellRsrpRsrq>();
+            report->SetAttribute("ReporterE2NodeId",
+                                 UintegerValue(m_terminator->GetE2NodeId()));
+            report->SetAttribute("Time", TimeValue(m_aggregator.GetTime()));
+            report->SetAttribute("Rnti", UintegerValue(m_aggregator.GetRnti()));
+            report->SetMeasurements(m_aggregator.Flush(m_reduction));
+
+            reports.push_back(report);
+        }
     }
 
     return reports;
 }
 
+std::vector<TypeId>
+OranReporterNrUeRsrpRsrq::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {OranReportNrUeRsrpRsrq::GetTypeId(), OranReportNrUeMultiCellRsrpRsrq::GetTypeId()};
+}
+
 } // namespace ns3
@@ -8,6 +8,7 @@
 
 #include "oran-report.h"
 #include "oran-reporter.h"
+#include "oran-ue-rsrp-rsrq-aggregator.h"
 
 #include "ns3/ptr.h"
 
@@ -47,12 +48,33 @@ class OranReporterNrUeRsrpRsrq : public OranReporter
                         double rsrq,
                         bool isServingCell,
                         uint8_t componentCarrierId);
+    /**
+     * Get the types of the Reports this Reporter generates.
+     *
+     * @return The OranReportNrUeRsrpRsrq and OranReportNrUeMultiCellRsrpRsrq TypeIds.
+     */
+    std::vector<TypeId> GetReportTypes() const override;
 
   protected:
     std::vector<Ptr<OranReport>> GenerateReports() override;
 
   private:
     std::vector<Ptr<OranReport>> m_reports;
+    /**
+     * Whether the measurements of a report period are sent as one
+     * OranReportNrUeMultiCellRsrpRsrq instead of one Report each.
+     */
+    bool m_aggregate;
+    /**
+     * How the measurements of a cell within a report period are reduced
+     * when m_aggregate is true.
+     */
+    OranUeRsrpRsrqAggregator::Reduction m_reduction;
+    /**
+     * The measurements of the current report period, when m_aggregate is
+     * true.
+     */
+    OranUeRsrpRsrqAggregator m_aggregator;
 };
 
 } // namespace ns3
@@ -66,7 +66,8 @@ OranReporter::GetTypeId()
 
 OranReporter::OranReporter()
     : Object(),
-      m_active(false)
+      m_active(false),
+      m_suspended(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -149,6 +150,57 @@ OranReporter::NotifyRegistrationComplete()
     m_trigger->NotifyRegistrationComplete();
 }
 
+std::vector<TypeId>
+OranReporter::GetReportTypes() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return {};
+}
+
+void
+OranReporter::Suspend()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_suspended = true;
+}
+
+void
+OranReporter::Resume()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_suspended)
+    {
+        m_suspended = false;
+        if (m_active)
+        {
+            // Discard the measurements buffered while no module read them.
+            GenerateReports();
+        }
+    }
+}
+
+bool
+OranReporter::IsSuspended() const
+{
+    NS_LOG_FUNCTION(this);
+
+    return m_suspended;
+}
+
+void
+OranReporter::SetMinReportInterval(Time minInterval)
+{
+    NS_LOG_FUNCTION(this << minInterval);
+
+    if (m_trigger != nullptr)
+    {
+        m_trigger->SetMinInterval(minInterval);
+    }
+}
+
 void
 OranReporter::DoDispose()
 {
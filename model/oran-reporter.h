@@ -33,11 +33,13 @@
 
 #include "oran-e2-node-terminator.h"
 
+#include "ns3/nstime.h"
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/random-variable-stream.h"
 
 #include <string>
+#include <vector>
 
 namespace ns3
 {
@@ -98,6 +100,40 @@ class OranReporter : public Object
      * Notifies the reporter that initial registartion has completed successfully.
      */
     virtual void NotifyRegistrationComplete();
+    /**
+     * Get the types of the Reports this Reporter generates, so that the
+     * E2 Node Terminator can check if any module of the Near-RT RIC
+     * subscribes to them.
+     *
+     * @return The Report types, or an empty vector if unknown, in which case
+     *         the Reporter is never suspended.
+     */
+    virtual std::vector<TypeId> GetReportTypes() const;
+    /**
+     * Suspend the Reporter because no module of the Near-RT RIC subscribes to
+     * its Reports. The trigger keeps running, but skips the Reports until
+     * Resume is called.
+     */
+    void Suspend();
+    /**
+     * Resume a suspended Reporter, discarding the measurements buffered while
+     * it was suspended.
+     */
+    void Resume();
+    /**
+     * Indicate if the Reporter is suspended.
+     *
+     * @return True, if the Reporter is suspended; otherwise, false.
+     */
+    bool IsSuspended() const;
+    /**
+     * Set the shortest interval between the Reports of the trigger, to relax
+     * the trigger to the needs of the subscribers (see
+     * OranReportTrigger::SetMinInterval).
+     *
+     * @param minInterval The interval, or 0 to keep the configured one.
+     */
+    void SetMinReportInterval(Time minInterval);
 
   protected:
     /**
@@ -126,6 +162,10 @@ class OranReporter : public Object
      * The trigger that generates reports.
      */
     Ptr<OranReportTrigger> m_trigger;
+    /**
+     * Flag to indicate if the Reporter is suspended.
+     */
+    bool m_suspended;
 }; // class OranReporter
 
 } // namespace ns3
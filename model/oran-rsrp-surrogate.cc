@@ -0,0 +1,477 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-rsrp-surrogate.h"
+
+#include "ns3/abort.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace ns3
+{
+
+namespace
+{
+
+/**
+ * The number of UEs processed together.
+ */
+constexpr std::size_t LANES = 8;
+
+/**
+ * The path loss exponent of the default model.
+ */
+constexpr double DEFAULT_EXPONENT = 3.76;
+
+/**
+ * The RSRP at 1 m of the default model: 46 dBm over 1200 subcarriers, minus
+ * 128.1 dB at 1 km, plus the 3 decades of 37.6 dB back to 1 m.
+ */
+const double DEFAULT_INTERCEPT = 46.0 - 10.0 * std::log10(1200.0) - 128.1 + 3.0 * 37.6;
+
+constexpr float NEG_INF = -std::numeric_limits<float>::infinity();
+
+#if defined(__GNUC__)
+/**
+ * Eight floats, mapped by the compiler to one AVX register, or to two SSE or
+ * NEON registers.
+ */
+typedef float Float8 __attribute__((vector_size(LANES * sizeof(float))));
+/**
+ * Eight integers, the type of the comparisons of two Float8.
+ */
+typedef int32_t Int8 __attribute__((vector_size(LANES * sizeof(int32_t))));
+
+/**
+ * Load eight elements into a vector. Vectors are passed by reference, as
+ * they are not passed in registers without AVX.
+ *
+ * @tparam V The vector type.
+ * @tparam T The element type.
+ * @param v Set to the elements.
+ * @param p Eight elements.
+ */
+template <typename V, typename T>
+inline void
+Load(V& v, const T* p)
+{
+    std::memcpy(&v, p, sizeof(v));
+}
+#endif
+
+} // namespace
+
+OranRsrpSurrogate::OranRsrpSurrogate()
+    : m_numCells(0),
+      m_numUes(0),
+      m_stride(0),
+      m_exponent(DEFAULT_EXPONENT)
+{
+}
+
+void
+OranRsrpSurrogate::SetLayout(const std::vector<Vector>& cells, const std::vector<Vector>& ues)
+{
+    m_numCells = cells.size();
+    m_numUes = ues.size();
+    m_stride = (m_numUes + LANES - 1) / LANES * LANES;
+    m_exponent = DEFAULT_EXPONENT;
+    m_intercept.assign(m_numCells, DEFAULT_INTERCEPT);
+    m_offset.assign(m_numCells, 0.0f);
+    m_cellIndex.clear();
+
+    m_logDistance.assign(m_numCells * m_stride, 0.0f);
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        float* row = &m_logDistance[c * m_stride];
+        for (std::size_t u = 0; u < m_numUes; u++)
+        {
+            row[u] = static_cast<float>(
+                10.0 * std::log10(std::max(1.0, CalculateDistance(cells[c], ues[u]))));
+        }
+    }
+    Rebuild();
+}
+
+double
+OranRsrpSurrogate::Calibrate(const std::vector<std::tuple<uint32_t, uint32_t, double>>& samples)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+
+    // With the intercepts free, the exponent is the slope of RSRP over
+    // 10 log10(d) about the mean of each cell.
+    struct Sums
+    {
+        std::size_t n = 0;
+        double x = 0.0;
+        double r = 0.0;
+        double xx = 0.0;
+        double xr = 0.0;
+    };
+
+    std::vector<Sums> sums(m_numCells);
+    for (const auto& [ue, cell, rsrp] : samples)
+    {
+        NS_ABORT_MSG_IF(ue >= m_numUes || cell >= m_numCells,
+                        "Sample (" << ue << ", " << cell << ") out of range");
+        const double x = m_logDistance[cell * m_stride + ue];
+        Sums& s = sums[cell];
+        s.n++;
+        s.x += x;
+        s.r += rsrp;
+        s.xx += x * x;
+        s.xr += x * rsrp;
+    }
+
+    double sxx = 0.0;
+    double sxr = 0.0;
+    for (const Sums& s : sums)
+    {
+        if (s.n > 0)
+        {
+            sxx += s.xx - s.x * s.x / s.n;
+            sxr += s.xr - s.x * s.r / s.n;
+        }
+    }
+    if (sxx > 1e-6 && sxr < 0.0)
+    {
+        m_exponent = -sxr / sxx;
+    }
+
+    double interceptSum = 0.0;
+    std::size_t fitted = 0;
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        if (sums[c].n > 0)
+        {
+            m_intercept[c] = (sums[c].r + m_exponent * sums[c].x) / sums[c].n;
+            interceptSum += m_intercept[c];
+            fitted++;
+        }
+    }
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        if (sums[c].n == 0)
+        {
+            m_intercept[c] = interceptSum / fitted;
+        }
+    }
+    Rebuild();
+
+    double squares = 0.0;
+    for (const auto& [ue, cell, rsrp] : samples)
+    {
+        const double error = m_rsrp[cell * m_stride + ue] - rsrp;
+        squares += error * error;
+    }
+    return std::sqrt(squares / samples.size());
+}
+
+bool
+OranRsrpSurrogate::LoadLte(Ptr<OranDataRepository> data)
+{
+    std::vector<Vector> cells;
+    std::vector<uint64_t> enbIds;
+    std::map<uint16_t, uint32_t> cellIdIndex;
+    for (auto enbId : data->GetLteEnbE2NodeIds())
+    {
+        bool found = false;
+        uint16_t cellId = 0;
+        std::tie(found, cellId) = data->GetLteEnbCellInfo(enbId);
+        auto positions = data->GetNodePositions(enbId, Time::Min(), Simulator::Now());
+        if (found && !positions.empty() && cellIdIndex.emplace(cellId, cells.size()).second)
+        {
+            cells.push_back(positions.rbegin()->second);
+            enbIds.push_back(enbId);
+        }
+    }
+
+    std::vector<Vector> ues;
+    std::vector<std::tuple<uint32_t, uint32_t, double>> samples;
+    for (auto ueId : data->GetLteUeE2NodeIds())
+    {
+        auto positions = data->GetNodePositions(ueId, Time::Min(), Simulator::Now());
+        if (positions.empty())
+        {
+            continue;
+        }
+        for (const auto& meas : data->GetLteUeRsrpRsrq(ueId))
+        {
+            auto cell = cellIdIndex.find(std::get<1>(meas));
+            if (cell != cellIdIndex.end() && std::isfinite(std::get<2>(meas)))
+            {
+                samples.emplace_back(ues.size(), cell->second, std::get<2>(meas));
+            }
+        }
+        ues.push_back(positions.rbegin()->second);
+    }
+
+    if (cells.empty() || ues.empty())
+    {
+        return false;
+    }
+    SetLayout(cells, ues);
+    for (uint32_t c = 0; c < enbIds.size(); c++)
+    {
+        m_cellIndex[enbIds[c]] = static_cast<int32_t>(c);
+    }
+    Calibrate(samples);
+    return true;
+}
+
+int32_t
+OranRsrpSurrogate::GetCellIndex(uint64_t e2NodeId) const
+{
+    auto it = m_cellIndex.find(e2NodeId);
+    return it == m_cellIndex.end() ? NO_CELL : it->second;
+}
+
+std::size_t
+OranRsrpSurrogate::GetNumCells() const
+{
+    return m_numCells;
+}
+
+std::size_t
+OranRsrpSurrogate::GetNumUes() const
+{
+    return m_numUes;
+}
+
+double
+OranRsrpSurrogate::GetPathLossExponent() const
+{
+    return m_exponent;
+}
+
+void
+OranRsrpSurrogate::SetPowerOffset(uint32_t cell, double offsetDb)
+{
+    NS_ABORT_MSG_IF(cell >= m_numCells, "Cell " << cell << " out of range");
+
+    m_offset[cell] = static_cast<float>(offsetDb);
+    const float* column = &m_rsrp[cell * m_stride];
+    const int32_t c = static_cast<int32_t>(cell);
+    for (uint32_t u = 0; u < m_numUes; u++)
+    {
+        const float rsrp = column[u] + m_offset[cell];
+        if (m_bestCell[u] == c)
+        {
+            if (rsrp >= m_second[u] && rsrp > NEG_INF)
+            {
+                m_best[u] = rsrp;
+            }
+            else
+            {
+                Rescan(u);
+            }
+        }
+        else if (m_secondCell[u] == c)
+        {
+            if (rsrp > m_best[u])
+            {
+                m_second[u] = m_best[u];
+                m_secondCell[u] = m_bestCell[u];
+                m_best[u] = rsrp;
+                m_bestCell[u] = c;
+            }
+            else if (rsrp >= m_second[u])
+            {
+                m_second[u] = rsrp;
+            }
+            else
+            {
+                Rescan(u);
+            }
+        }
+        else
+        {
+            Merge(u, rsrp, c);
+        }
+    }
+}
+
+double
+OranRsrpSurrogate::GetPowerOffset(uint32_t cell) const
+{
+    return m_offset.at(cell);
+}
+
+double
+OranRsrpSurrogate::GetRsrp(uint32_t ue, uint32_t cell) const
+{
+    NS_ABORT_MSG_IF(ue >= m_numUes || cell >= m_numCells,
+                    "(" << ue << ", " << cell << ") out of range");
+    return m_rsrp[cell * m_stride + ue] + m_offset[cell];
+}
+
+double
+OranRsrpSurrogate::GetBestRsrp(uint32_t ue) const
+{
+    NS_ABORT_MSG_IF(ue >= m_numUes, "UE " << ue << " out of range");
+    return m_best[ue];
+}
+
+int32_t
+OranRsrpSurrogate::GetBestCell(uint32_t ue) const
+{
+    NS_ABORT_MSG_IF(ue >= m_numUes, "UE " << ue << " out of range");
+    return m_bestCell[ue];
+}
+
+uint32_t
+OranRsrpSurrogate::CountCovered(double thresholdDbm) const
+{
+    const float threshold = static_cast<float>(thresholdDbm);
+    uint32_t covered = 0;
+    for (uint32_t u = 0; u < m_numUes; u++)
+    {
+        covered += m_best[u] >= threshold ? 1 : 0;
+    }
+    return covered;
+}
+
+uint32_t
+OranRsrpSurrogate::EvaluatePowerOffset(uint32_t cell, double offsetDb, double thresholdDbm) const
+{
+    NS_ABORT_MSG_IF(cell >= m_numCells, "Cell " << cell << " out of range");
+
+    // The best RSRP of a UE becomes the larger of the new RSRP of the cell
+    // and the best RSRP of the other cells. Padding UEs have no RSRP.
+    const float* column = &m_rsrp[cell * m_stride];
+    const float offset = static_cast<float>(offsetDb);
+    const float threshold = static_cast<float>(thresholdDbm);
+    const int32_t c = static_cast<int32_t>(cell);
+#if defined(__GNUC__)
+    Int8 count = {};
+    for (std::size_t u = 0; u < m_stride; u += LANES)
+    {
+        Float8 rsrp;
+        Float8 best;
+        Float8 second;
+        Int8 bestCell;
+        Load(rsrp, column + u);
+        Load(best, &m_best[u]);
+        Load(second, &m_second[u]);
+        Load(bestCell, &m_bestCell[u]);
+        rsrp += offset;
+        const Float8 others = bestCell == c ? second : best;
+        const Float8 newBest = rsrp > others ? rsrp : others;
+        count -= newBest >= threshold; // true is -1
+    }
+    uint32_t covered = 0;
+    for (std::size_t i = 0; i < LANES; i++)
+    {
+        covered += static_cast<uint32_t>(count[i]);
+    }
+    return covered;
+#else
+    uint32_t covered = 0;
+    for (std::size_t u = 0; u < m_numUes; u++)
+    {
+        const float rsrp = column[u] + offset;
+        const float others = m_bestCell[u] == c ? m_second[u] : m_best[u];
+        covered += std::max(rsrp, others) >= threshold ? 1 : 0;
+    }
+    return covered;
+#endif
+}
+
+void
+OranRsrpSurrogate::Rebuild()
+{
+    m_rsrp.assign(m_numCells * m_stride, NEG_INF);
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        const float intercept = static_cast<float>(m_intercept[c]);
+        const float exponent = static_cast<float>(m_exponent);
+        const float* distance = &m_logDistance[c * m_stride];
+        float* rsrp = &m_rsrp[c * m_stride];
+        for (std::size_t u = 0; u < m_numUes; u++)
+        {
+            rsrp[u] = intercept - exponent * distance[u];
+        }
+    }
+
+    m_best.assign(m_stride, NEG_INF);
+    m_second.assign(m_stride, NEG_INF);
+    m_bestCell.assign(m_stride, NO_CELL);
+    m_secondCell.assign(m_stride, NO_CELL);
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        const float* column = &m_rsrp[c * m_stride];
+        const int32_t cell = static_cast<int32_t>(c);
+#if defined(__GNUC__)
+        for (std::size_t u = 0; u < m_stride; u += LANES)
+        {
+            Float8 rsrp;
+            Float8 best;
+            Float8 second;
+            Int8 bestCell;
+            Int8 secondCell;
+            Load(rsrp, column + u);
+            Load(best, &m_best[u]);
+            Load(second, &m_second[u]);
+            Load(bestCell, &m_bestCell[u]);
+            Load(secondCell, &m_secondCell[u]);
+            rsrp += m_offset[c];
+            const Int8 first = rsrp > best;
+            const Int8 runnerUp = rsrp > second;
+            const Float8 newSecond = first ? best : (runnerUp ? rsrp : second);
+            const Int8 newSecondCell = first ? bestCell : (runnerUp ? cell : secondCell);
+            const Float8 newBest = first ? rsrp : best;
+            const Int8 newBestCell = first ? cell : bestCell;
+            std::memcpy(&m_best[u], &newBest, sizeof(newBest));
+            std::memcpy(&m_second[u], &newSecond, sizeof(newSecond));
+            std::memcpy(&m_bestCell[u], &newBestCell, sizeof(newBestCell));
+            std::memcpy(&m_secondCell[u], &newSecondCell, sizeof(newSecondCell));
+        }
+#else
+        for (uint32_t u = 0; u < m_numUes; u++)
+        {
+            Merge(u, column[u] + m_offset[c], cell);
+        }
+#endif
+    }
+}
+
+void
+OranRsrpSurrogate::Rescan(uint32_t ue)
+{
+    m_best[ue] = NEG_INF;
+    m_second[ue] = NEG_INF;
+    m_bestCell[ue] = NO_CELL;
+    m_secondCell[ue] = NO_CELL;
+    for (std::size_t c = 0; c < m_numCells; c++)
+    {
+        Merge(ue, m_rsrp[c * m_stride + ue] + m_offset[c], static_cast<int32_t>(c));
+    }
+}
+
+void
+OranRsrpSurrogate::Merge(uint32_t ue, float rsrp, int32_t cell)
+{
+    if (rsrp > m_best[ue])
+    {
+        m_second[ue] = m_best[ue];
+        m_secondCell[ue] = m_bestCell[ue];
+        m_best[ue] = rsrp;
+        m_bestCell[ue] = cell;
+    }
+    else if (rsrp > m_second[ue])
+    {
+        m_second[ue] = rsrp;
+        m_secondCell[ue] = cell;
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,188 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_RSRP_SURROGATE_H
+#define ORAN_RSRP_SURROGATE_H
+
+#include "oran-data-repository.h"
+
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \brief Predicts the RSRP of every UE from every cell, so that TxPower and
+ *        sleep changes can be scored before they are commanded.
+ *
+ * The RSRP of UE u from cell c is K_c - 10 n log10(d_uc) + o_c, where d_uc
+ * is the distance in meters (at least 1), K_c the intercept of the cell,
+ * which includes its current TxPower, n the path loss exponent shared by the
+ * cells, and o_c the TxPower offset of the cell being tried. An offset of
+ * -infinity switches the cell off. Calibrate() fits K_c and n to reported
+ * RSRP by least squares. Until then, and for cells without reports, the
+ * 3GPP macro model 128.1 + 37.6 log10(d in km) is used, for 46 dBm over 1200
+ * subcarriers.
+ *
+ * The predictions are kept as a cell-major UE x cell matrix, with the best
+ * and second best cell of every UE, so that the coverage a change of one
+ * cell would give is computed in one pass over its column, 8 UEs at a time
+ * (one AVX register when built for AVX2, two SSE or NEON registers
+ * otherwise). Applying a change is one pass over the column too, and only
+ * the UEs whose best or second best cell gets weaker than the next one are
+ * rescanned.
+ */
+class OranRsrpSurrogate
+{
+  public:
+    /**
+     * The index of the best cell of a UE when every cell is off.
+     */
+    static constexpr int32_t NO_CELL = -1;
+
+    /**
+     * Constructor of the OranRsrpSurrogate class.
+     */
+    OranRsrpSurrogate();
+    /**
+     * Places the cells and UEs. The offsets are cleared, and the intercepts
+     * and path loss exponent are reset to the default model.
+     *
+     * \param cells The positions of the cells.
+     * \param ues The positions of the UEs.
+     */
+    void SetLayout(const std::vector<Vector>& cells, const std::vector<Vector>& ues);
+    /**
+     * Fits the intercepts and the path loss exponent to reported RSRP. The
+     * exponent is kept if the reports do not determine it. Cells without
+     * reports get the mean intercept of the cells with reports. Far cells
+     * are only reported when their shadowing is favourable, so the fitted
+     * exponent is lower than the real one if UEs stop reporting well above
+     * the noise floor.
+     *
+     * \param samples The UE index, cell index, and RSRP in dBm of every report.
+     * \return The RMS error of the fit in dB, or 0 without samples.
+     */
+    double Calibrate(const std::vector<std::tuple<uint32_t, uint32_t, double>>& samples);
+    /**
+     * Places the LTE cells and UEs of a data repository at their last
+     * reported positions and calibrates the model on their last RSRP
+     * reports. Cells and UEs without a position are left out.
+     *
+     * \param data The data repository.
+     * \return False if no cell or no UE has a position.
+     */
+    bool LoadLte(Ptr<OranDataRepository> data);
+    /**
+     * Gets the index of a cell placed by LoadLte().
+     *
+     * \param e2NodeId The E2 Node ID of the eNB.
+     * \return The index, or NO_CELL.
+     */
+    int32_t GetCellIndex(uint64_t e2NodeId) const;
+    /**
+     * \return The number of cells.
+     */
+    std::size_t GetNumCells() const;
+    /**
+     * \return The number of UEs.
+     */
+    std::size_t GetNumUes() const;
+    /**
+     * \return The fitted path loss exponent.
+     */
+    double GetPathLossExponent() const;
+    /**
+     * Applies a TxPower offset to a cell, replacing its previous offset.
+     *
+     * \param cell The index of the cell.
+     * \param offsetDb The offset in dB, or -infinity to switch the cell off.
+     */
+    void SetPowerOffset(uint32_t cell, double offsetDb);
+    /**
+     * \param cell The index of the cell.
+     * \return The TxPower offset of the cell in dB.
+     */
+    double GetPowerOffset(uint32_t cell) const;
+    /**
+     * \param ue The index of the UE.
+     * \param cell The index of the cell.
+     * \return The predicted RSRP in dBm.
+     */
+    double GetRsrp(uint32_t ue, uint32_t cell) const;
+    /**
+     * \param ue The index of the UE.
+     * \return The predicted RSRP of the best cell of the UE in dBm.
+     */
+    double GetBestRsrp(uint32_t ue) const;
+    /**
+     * \param ue The index of the UE.
+     * \return The index of the best cell of the UE, or NO_CELL.
+     */
+    int32_t GetBestCell(uint32_t ue) const;
+    /**
+     * Counts the UEs covered with the current offsets.
+     *
+     * \param thresholdDbm The RSRP a UE needs from its best cell.
+     * \return The number of UEs covered.
+     */
+    uint32_t CountCovered(double thresholdDbm) const;
+    /**
+     * Counts the UEs that would be covered if the offset of one cell were
+     * changed, without changing it.
+     *
+     * \param cell The index of the cell.
+     * \param offsetDb The offset in dB, or -infinity to switch the cell off.
+     * \param thresholdDbm The RSRP a UE needs from its best cell.
+     * \return The number of UEs covered.
+     */
+    uint32_t EvaluatePowerOffset(uint32_t cell, double offsetDb, double thresholdDbm) const;
+
+  private:
+    /**
+     * Recomputes the RSRP matrix from the distances and the model, and the
+     * best cells of every UE.
+     */
+    void Rebuild();
+    /**
+     * Recomputes the best two cells of a UE from its row.
+     *
+     * \param ue The index of the UE.
+     */
+    void Rescan(uint32_t ue);
+    /**
+     * Offers the RSRP of a cell to the best two cells of a UE.
+     *
+     * \param ue The index of the UE.
+     * \param rsrp The RSRP of the cell, offset included.
+     * \param cell The index of the cell.
+     */
+    void Merge(uint32_t ue, float rsrp, int32_t cell);
+
+    std::size_t m_numCells;               //!< The number of cells.
+    std::size_t m_numUes;                 //!< The number of UEs.
+    std::size_t m_stride;                 //!< The padded number of UEs, a multiple of 8.
+    double m_exponent;                    //!< The path loss exponent.
+    std::vector<double> m_intercept;      //!< The intercept of every cell, in dBm at 1 m.
+    std::vector<float> m_offset;          //!< The TxPower offset of every cell, in dB.
+    std::vector<float> m_logDistance;     //!< 10 log10 of the distances, cell-major.
+    std::vector<float> m_rsrp;            //!< The RSRP without offsets, cell-major.
+    std::vector<float> m_best;            //!< The RSRP of the best cell of every UE.
+    std::vector<float> m_second;          //!< The RSRP of the second best cell of every UE.
+    std::vector<int32_t> m_bestCell;      //!< The best cell of every UE.
+    std::vector<int32_t> m_secondCell;    //!< The second best cell of every UE.
+    std::map<uint64_t, int32_t> m_cellIndex; //!< The cell index of every eNB placed by LoadLte().
+};
+
+} // namespace ns3
+
+#endif // ORAN_RSRP_SURROGATE_H
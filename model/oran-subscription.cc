@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-subscription.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranSubscription");
+
+void
+OranSubscriptionSet::Add(const OranSubscription& subscription)
+{
+    NS_LOG_FUNCTION(this << subscription.reportType.GetName() << subscription.maxInterval);
+
+    std::vector<OranNearRtRic::NodeType> nodeTypes = subscription.nodeTypes;
+    std::sort(nodeTypes.begin(), nodeTypes.end());
+    nodeTypes.erase(std::unique(nodeTypes.begin(), nodeTypes.end()), nodeTypes.end());
+
+    for (auto& existing : m_subscriptions)
+    {
+        if (existing.reportType == subscription.reportType && existing.nodeTypes == nodeTypes)
+        {
+            if (existing.maxInterval.IsZero() || subscription.maxInterval.IsZero())
+            {
+                existing.maxInterval = Seconds(0);
+            }
+            else
+            {
+                existing.maxInterval = std::min(existing.maxInterval, subscription.maxInterval);
+            }
+            return;
+        }
+    }
+
+    m_subscriptions.push_back(OranSubscription{subscription.reportType,
+                                               std::move(nodeTypes),
+                                               subscription.maxInterval});
+}
+
+void
+OranSubscriptionSet::Add(const std::vector<OranSubscription>& subscriptions)
+{
+    for (const auto& subscription : subscriptions)
+    {
+        Add(subscription);
+    }
+}
+
+bool
+OranSubscriptionSet::Covers(TypeId reportType,
+                            OranNearRtRic::NodeType nodeType,
+                            Time& maxInterval) const
+{
+    NS_LOG_FUNCTION(this << reportType.GetName() << nodeType);
+
+    bool covered = false;
+    for (const auto& subscription : m_subscriptions)
+    {
+        if (reportType != subscription.reportType && !reportType.IsChildOf(subscription.reportType))
+        {
+            continue;
+        }
+        if (!subscription.nodeTypes.empty() &&
+            std::find(subscription.nodeTypes.begin(), subscription.nodeTypes.end(), nodeType) ==
+                subscription.nodeTypes.end())
+        {
+            continue;
+        }
+
+        if (!covered || subscription.maxInterval.IsZero())
+        {
+            maxInterval = subscription.maxInterval;
+        }
+        else if (!maxInterval.IsZero())
+        {
+            maxInterval = std::min(maxInterval, subscription.maxInterval);
+        }
+        covered = true;
+    }
+
+    return covered;
+}
+
+const std::vector<OranSubscription>&
+OranSubscriptionSet::GetSubscriptions() const
+{
+    return m_subscriptions;
+}
+
+std::string
+OranSubscriptionSet::ToString() const
+{
+    std::ostringstream ss;
+    for (std::size_t i = 0; i < m_subscriptions.size(); i++)
+    {
+        const OranSubscription& subscription = m_subscriptions[i];
+        ss << (i == 0 ? "" : ";") << subscription.reportType.GetName() << "[";
+        for (std::size_t j = 0; j < subscription.nodeTypes.size(); j++)
+        {
+            ss << (j == 0 ? "" : ",") << subscription.nodeTypes[j];
+        }
+        ss << "]/" << subscription.maxInterval.As(Time::S);
+    }
+    return ss.str();
+}
+
+} // namespace ns3
@@ -0,0 +1,96 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_SUBSCRIPTION_H
+#define ORAN_SUBSCRIPTION_H
+
+#include "oran-near-rt-ric.h"
+
+#include "ns3/nstime.h"
+#include "ns3/type-id.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The Reports that a Logic Module or Conflict Mitigation Module reads from
+ * the data repository.
+ */
+struct OranSubscription
+{
+    /**
+     * The Report type. Subscribing to a type also subscribes to the types
+     * derived from it, so OranReport subscribes to every Report.
+     */
+    TypeId reportType;
+    /**
+     * The types of the nodes whose Reports are read, or empty for all.
+     */
+    std::vector<OranNearRtRic::NodeType> nodeTypes;
+    /**
+     * The longest acceptable interval between two Reports, or 0 to keep the
+     * interval configured in the Reporter.
+     */
+    Time maxInterval;
+};
+
+/**
+ * @ingroup oran
+ *
+ * The union of the subscriptions of the Logic Modules and Conflict
+ * Mitigation Modules of a Near-RT RIC.
+ */
+class OranSubscriptionSet
+{
+  public:
+    /**
+     * Add a subscription. A subscription to the same Report type and node
+     * types as one already in the set is merged into it, keeping the
+     * shortest interval.
+     *
+     * @param subscription The subscription.
+     */
+    void Add(const OranSubscription& subscription);
+    /**
+     * Add several subscriptions.
+     *
+     * @param subscriptions The subscriptions.
+     */
+    void Add(const std::vector<OranSubscription>& subscriptions);
+    /**
+     * Check if any subscription covers the Reports of a type from a type of
+     * node.
+     *
+     * @param reportType The Report type.
+     * @param nodeType The node type.
+     * @param maxInterval Set to the shortest interval of the covering
+     *        subscriptions, or 0 if any of them keeps the configured one.
+     * @return True if any subscription covers the Reports.
+     */
+    bool Covers(TypeId reportType, OranNearRtRic::NodeType nodeType, Time& maxInterval) const;
+    /**
+     * @return The subscriptions in the set.
+     */
+    const std::vector<OranSubscription>& GetSubscriptions() const;
+    /**
+     * @return The set formatted as "type[nodeTypes]/interval;...", for logs.
+     */
+    std::string ToString() const;
+
+  private:
+    /**
+     * The subscriptions.
+     */
+    std::vector<OranSubscription> m_subscriptions;
+}; // class OranSubscriptionSet
+
+} // namespace ns3
+
+#endif // ORAN_SUBSCRIPTION_H
@@ -0,0 +1,304 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-tick-service.h"
+
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/pointer.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+
+#include <algorithm>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranTickService");
+
+NS_OBJECT_ENSURE_REGISTERED(OranTickService);
+
+void
+OranTickEventId::Cancel()
+{
+    if (m_service != nullptr)
+    {
+        m_service->Cancel(m_id);
+    }
+    else
+    {
+        m_event.Cancel();
+    }
+}
+
+bool
+OranTickEventId::IsPending() const
+{
+    if (m_service != nullptr)
+    {
+        return m_service->IsPending(m_id);
+    }
+    return m_event.IsPending();
+}
+
+TypeId
+OranTickService::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::OranTickService")
+            .SetParent<Object>()
+            .AddConstructor<OranTickService>()
+            .AddAttribute("TickInterval",
+                          "The interval between ticks. Scheduled delays are rounded up to it.",
+                          TimeValue(MilliSeconds(1)),
+                          MakeTimeAccessor(&OranTickService::m_tickInterval),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("PhaseJitterRv",
+                          "The random variable used (in seconds) to offset the first timer of "
+                          "a periodic subscriber.",
+                          StringValue("ns3::ConstantRandomVariable[Constant=0]"),
+                          MakePointerAccessor(&OranTickService::m_phaseJitterRv),
+                          MakePointerChecker<RandomVariableStream>());
+
+    return tid;
+}
+
+OranTickService::OranTickService()
+    : Object(),
+      m_nextId(1),
+      m_currentTick(0),
+      m_nextTick(0),
+      m_nTicksProcessed(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranTickService::~OranTickService()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+OranTickEventId
+OranTickService::Schedule(Ptr<OranTickService> service,
+                          Time delay,
+                          const Callback<void>& callback,
+                          bool jitter)
+{
+    OranTickEventId eventId;
+    if (service != nullptr)
+    {
+        eventId.m_service = service;
+        eventId.m_id = service->DoSchedule(delay, callback, jitter);
+    }
+    else
+    {
+        eventId.m_event = Simulator::Schedule(delay, [callback]() { callback(); });
+    }
+    return eventId;
+}
+
+uint32_t
+OranTickService::GetNPending() const
+{
+    return m_pending.size();
+}
+
+uint64_t
+OranTickService::GetNTicksProcessed() const
+{
+    return m_nTicksProcessed;
+}
+
+void
+OranTickService::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_tickEvent.Cancel();
+    m_pending.clear();
+    for (auto& level : m_levels)
+    {
+        for (auto& slot : level)
+        {
+            slot.clear();
+        }
+    }
+    m_overflow.clear();
+    m_phaseJitterRv = nullptr;
+
+    Object::DoDispose();
+}
+
+uint64_t
+OranTickService::DoSchedule(Time delay, const Callback<void>& callback, bool jitter)
+{
+    NS_LOG_FUNCTION(this << delay << jitter);
+
+    if (jitter)
+    {
+        delay += Seconds(m_phaseJitterRv->GetValue());
+    }
+    NS_ABORT_MSG_IF(delay.IsStrictlyNegative(), "Attempting to schedule a tick in the past");
+
+    if (m_pending.empty())
+    {
+        // Idle: restart the wheel at the current time.
+        m_currentTick = Simulator::Now().GetTimeStep() / m_tickInterval.GetTimeStep();
+    }
+
+    uint64_t id = m_nextId++;
+    uint64_t due = std::max(CeilTick(Simulator::Now() + delay), m_currentTick + 1);
+    m_pending.emplace(id, callback);
+    Insert(Entry(due, id));
+
+    if (!m_tickEvent.IsPending() || due < m_nextTick)
+    {
+        ScheduleNextTick();
+    }
+
+    return id;
+}
+
+void
+OranTickService::Cancel(uint64_t id)
+{
+    NS_LOG_FUNCTION(this << id);
+
+    // The entry stays in the wheel and is skipped when its tick comes.
+    if (m_pending.erase(id) > 0 && m_pending.empty())
+    {
+        ScheduleNextTick();
+    }
+}
+
+bool
+OranTickService::IsPending(uint64_t id) const
+{
+    return m_pending.find(id) != m_pending.end();
+}
+
+void
+OranTickService::Insert(const Entry& entry)
+{
+    for (uint32_t l = 0; l < kLevels; l++)
+    {
+        uint32_t shift = kLevelBits * (l + 1);
+        if ((entry.first >> shift) == (m_currentTick >> shift))
+        {
+            m_levels[l][(entry.first >> (kLevelBits * l)) & (kSlotsPerLevel - 1)].push_back(entry);
+            return;
+        }
+    }
+    m_overflow.push_back(entry);
+}
+
+void
+OranTickService::ProcessTick(uint64_t tick)
+{
+    NS_LOG_FUNCTION(this << tick);
+
+    m_currentTick = tick;
+    m_nTicksProcessed++;
+
+    // Cascade the slots that start on this tick, from the top level down, so
+    // that their callbacks land in the level below.
+    for (uint32_t l = kLevels; l > 0; l--)
+    {
+        if ((tick & ((uint64_t(1) << (kLevelBits * l)) - 1)) != 0)
+        {
+            continue;
+        }
+        std::vector<Entry> cascaded;
+        if (l == kLevels)
+        {
+            cascaded.swap(m_overflow);
+        }
+        else
+        {
+            cascaded.swap(m_levels[l][(tick >> (kLevelBits * l)) & (kSlotsPerLevel - 1)]);
+        }
+        for (const auto& entry : cascaded)
+        {
+            if (IsPending(entry.second))
+            {
+                Insert(entry);
+            }
+        }
+    }
+
+    std::vector<Entry> due;
+    due.swap(m_levels[0][tick & (kSlotsPerLevel - 1)]);
+    std::vector<uint64_t> ids;
+    ids.reserve(due.size());
+    for (const auto& entry : due)
+    {
+        NS_ASSERT_MSG(entry.first == tick || !IsPending(entry.second),
+                      "Tick wheel entry due on " << entry.first << " found on " << tick);
+        ids.push_back(entry.second);
+    }
+    // Run the callbacks in the order they were scheduled.
+    std::sort(ids.begin(), ids.end());
+
+    NS_LOG_LOGIC("Tick " << tick << " with " << ids.size() << " callbacks");
+
+    for (auto id : ids)
+    {
+        auto it = m_pending.find(id);
+        if (it == m_pending.end())
+        {
+            continue;
+        }
+        Callback<void> callback = it->second;
+        m_pending.erase(it);
+        callback();
+    }
+
+    ScheduleNextTick();
+}
+
+void
+OranTickService::ScheduleNextTick()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_tickEvent.Cancel();
+
+    if (m_pending.empty())
+    {
+        for (auto& level : m_levels)
+        {
+            for (auto& slot : level)
+            {
+                slot.clear();
+            }
+        }
+        m_overflow.clear();
+        return;
+    }
+
+    // The next occupied level-0 slot, or the start of the next level-1 slot,
+    // where the wheel has to cascade.
+    uint64_t next = m_currentTick + 1;
+    while ((next & (kSlotsPerLevel - 1)) != 0 &&
+           m_levels[0][next & (kSlotsPerLevel - 1)].empty())
+    {
+        next++;
+    }
+
+    Time delay = TimeStep(next * m_tickInterval.GetTimeStep()) - Simulator::Now();
+    NS_ASSERT_MSG(!delay.IsStrictlyNegative(), "Tick " << next << " is in the past");
+
+    m_nextTick = next;
+    m_tickEvent = Simulator::Schedule(delay, &OranTickService::ProcessTick, this, next);
+}
+
+uint64_t
+OranTickService::CeilTick(Time t) const
+{
+    int64_t tickStep = m_tickInterval.GetTimeStep();
+    return (t.GetTimeStep() + tickStep - 1) / tickStep;
+}
+
+} // namespace ns3
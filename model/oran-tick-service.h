@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_TICK_SERVICE_H
+#define ORAN_TICK_SERVICE_H
+
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ns3
+{
+
+class OranTickService;
+
+/**
+ * @ingroup oran
+ *
+ * Identifies a callback scheduled with OranTickService::Schedule(), either on
+ * a tick service or, when none is given, directly on the simulator.
+ */
+class OranTickEventId
+{
+  public:
+    /**
+     * Cancels the callback, if it has not run yet.
+     */
+    void Cancel();
+    /**
+     * @return True if the callback has been scheduled and has not run or
+     *         been cancelled yet.
+     */
+    bool IsPending() const;
+
+  private:
+    friend class OranTickService;
+
+    EventId m_event;                 //!< The simulator event, without a tick service.
+    Ptr<OranTickService> m_service;  //!< The tick service, if any.
+    uint64_t m_id = 0;               //!< The ID of the callback in the tick service.
+};
+
+/**
+ * @ingroup oran
+ *
+ * Coalesces the periodic timers of many ORAN components (report triggers,
+ * E2 Node Terminators, the Near-RT RIC) onto a shared tick. Each of these
+ * uses the service set in its "TickService" attribute, and schedules its own
+ * simulator events when none is set.
+ *
+ * Callbacks are due on the first tick at or after their requested time and
+ * are kept in a hierarchical timing wheel: 4 levels of 64 slots, each slot of
+ * a level spanning a full turn of the level below, plus an overflow list for
+ * callbacks further away than the wheel spans. The service schedules a single
+ * simulator event for the next tick with a due callback (or at most one every
+ * 64 ticks to move the wheel), and runs every callback due on that tick, in
+ * the order they were scheduled. The number of simulator events therefore
+ * depends on the tick interval, not on the number of subscribers.
+ *
+ * Delays are rounded up to the tick interval, so the interval sets the timing
+ * resolution. It must be set before anything is scheduled.
+ */
+class OranTickService : public Object
+{
+  public:
+    /**
+     * Get the TypeId of the OranTickService class.
+     *
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranTickService class.
+     */
+    OranTickService();
+    /**
+     * Destructor of the OranTickService class.
+     */
+    ~OranTickService() override;
+
+    /**
+     * Schedules a callback on a tick service, or on the simulator if the
+     * service is null.
+     *
+     * @param service The tick service, or nullptr.
+     * @param delay The delay after which to run the callback.
+     * @param callback The callback.
+     * @param jitter Whether to add a draw of the service's phase jitter to
+     *               the delay. Used for the first timer of a periodic loop,
+     *               to spread subscribers started together over several
+     *               ticks.
+     *
+     * @return The ID of the scheduled callback.
+     */
+    static OranTickEventId Schedule(Ptr<OranTickService> service,
+                                    Time delay,
+                                    const Callback<void>& callback,
+                                    bool jitter = false);
+    /**
+     * @return The number of callbacks waiting to run.
+     */
+    uint32_t GetNPending() const;
+    /**
+     * @return The number of ticks processed so far.
+     */
+    uint64_t GetNTicksProcessed() const;
+
+  protected:
+    /**
+     * Dispose of the object.
+     */
+    void DoDispose() override;
+
+  private:
+    friend class OranTickEventId;
+
+    static constexpr uint32_t kLevelBits = 6;                  //!< log2 of the slots per level.
+    static constexpr uint32_t kSlotsPerLevel = 1 << kLevelBits; //!< Slots per level.
+    static constexpr uint32_t kLevels = 4;                     //!< Number of levels.
+
+    /**
+     * A scheduled callback in the wheel: the tick it is due and its ID.
+     */
+    typedef std::pair<uint64_t, uint64_t> Entry;
+    /**
+     * The slots of one level of the wheel.
+     */
+    typedef std::array<std::vector<Entry>, kSlotsPerLevel> Level;
+
+    /**
+     * Schedules a callback on this service.
+     *
+     * @param delay The delay.
+     * @param callback The callback.
+     * @param jitter Whether to add a draw of the phase jitter to the delay.
+     *
+     * @return The ID of the callback.
+     */
+    uint64_t DoSchedule(Time delay, const Callback<void>& callback, bool jitter);
+    /**
+     * Cancels a callback.
+     *
+     * @param id The ID of the callback.
+     */
+    void Cancel(uint64_t id);
+    /**
+     * @param id The ID of the callback.
+     * @return True if the callback is waiting to run.
+     */
+    bool IsPending(uint64_t id) const;
+    /**
+     * Places a callback in the slot for its due tick, relative to the
+     * current tick.
+     *
+     * @param entry The callback.
+     */
+    void Insert(const Entry& entry);
+    /**
+     * Moves the wheel to the given tick, cascading the higher-level slots
+     * that start on it, and runs the callbacks due on it.
+     *
+     * @param tick The tick. It must not skip over the start of a level-1 slot.
+     */
+    void ProcessTick(uint64_t tick);
+    /**
+     * Schedules the simulator event for the next tick that needs processing,
+     * or none if nothing is pending.
+     */
+    void ScheduleNextTick();
+    /**
+     * Converts a time to the first tick at or after it.
+     *
+     * @param t The time.
+     * @return The tick.
+     */
+    uint64_t CeilTick(Time t) const;
+
+    Time m_tickInterval;                                  //!< The tick interval.
+    Ptr<RandomVariableStream> m_phaseJitterRv;            //!< The phase jitter (s).
+    std::array<Level, kLevels> m_levels;                  //!< The timing wheel.
+    std::vector<Entry> m_overflow;                        //!< Callbacks beyond the wheel.
+    std::unordered_map<uint64_t, Callback<void>> m_pending; //!< Pending callbacks by ID.
+    uint64_t m_nextId;                                    //!< The ID of the next callback.
+    uint64_t m_currentTick;                               //!< The last tick processed.
+    uint64_t m_nextTick;                                  //!< The tick of m_tickEvent.
+    EventId m_tickEvent;                                  //!< The next tick event.
+    uint64_t m_nTicksProcessed;                           //!< Ticks processed so far.
+};
+
+} // namespace ns3
+
+#endif // ORAN_TICK_SERVICE_H
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#include "oran-ue-rsrp-rsrq-aggregator.h"
+
+#include "ns3/log.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("OranUeRsrpRsrqAggregator");
+
+OranUeRsrpRsrqAggregator::OranUeRsrpRsrqAggregator()
+    : m_servingIndex(std::numeric_limits<std::size_t>::max()),
+      m_time(Seconds(0)),
+      m_rnti(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+OranUeRsrpRsrqAggregator::Add(Time t,
+                              uint16_t rnti,
+                              uint16_t cellId,
+                              double rsrp,
+                              double rsrq,
+                              bool isServingCell,
+                              uint8_t componentCarrierId)
+{
+    NS_LOG_FUNCTION(this << t << +rnti << +cellId << rsrp << rsrq << isServingCell
+                         << +componentCarrierId);
+
+    std::size_t i = 0;
+    while (i < m_cells.size() && (m_cells[i].last.cellId != cellId ||
+                                  m_cells[i].last.componentCarrierId != componentCarrierId))
+    {
+        i++;
+    }
+
+    if (i == m_cells.size())
+    {
+        Accumulator acc;
+        acc.sumRsrp = 0.0;
+        acc.sumRsrq = 0.0;
+        acc.minRsrp = rsrp;
+        acc.minRsrq = rsrq;
+        acc.maxRsrp = rsrp;
+        acc.maxRsrq = rsrq;
+        acc.n = 0;
+        m_cells.push_back(acc);
+    }
+
+    Accumulator& acc = m_cells[i];
+    acc.last.cellId = cellId;
+    acc.last.componentCarrierId = componentCarrierId;
+    acc.last.isServingCell = isServingCell;
+    acc.last.rsrp = rsrp;
+    acc.last.rsrq = rsrq;
+    acc.sumRsrp += rsrp;
+    acc.sumRsrq += rsrq;
+    acc.minRsrp = std::min(acc.minRsrp, rsrp);
+    acc.minRsrq = std::min(acc.minRsrq, rsrq);
+    acc.maxRsrp = std::max(acc.maxRsrp, rsrp);
+    acc.maxRsrq = std::max(acc.maxRsrq, rsrq);
+    acc.n++;
+
+    if (isServingCell)
+    {
+        m_servingIndex = i;
+    }
+    m_time = t;
+    m_rnti = rnti;
+}
+
+bool
+OranUeRsrpRsrqAggregator::IsEmpty() const
+{
+    return m_cells.empty();
+}
+
+Time
+OranUeRsrpRsrqAggregator::GetTime() const
+{
+    return m_time;
+}
+
+uint16_t
+OranUeRsrpRsrqAggregator::GetRnti() const
+{
+    return m_rnti;
+}
+
+std::vector<OranUeCellRsrpRsrq>
+OranUeRsrpRsrqAggregator::Flush(Reduction reduction)
+{
+    NS_LOG_FUNCTION(this << reduction);
+
+    std::vector<OranUeCellRsrpRsrq> measurements;
+    measurements.reserve(m_cells.size());
+    for (std::size_t i = 0; i < m_cells.size(); i++)
+    {
+        const Accumulator& acc = m_cells[i];
+        OranUeCellRsrpRsrq measurement = acc.last;
+        measurement.isServingCell = (i == m_servingIndex);
+        switch (reduction)
+        {
+        case MEAN:
+            measurement.rsrp = acc.sumRsrp / acc.n;
+            measurement.rsrq = acc.sumRsrq / acc.n;
+            break;
+        case MIN:
+            measurement.rsrp = acc.minRsrp;
+            measurement.rsrq = acc.minRsrq;
+            break;
+        case MAX:
+            measurement.rsrp = acc.maxRsrp;
+            measurement.rsrq = acc.maxRsrq;
+            break;
+        default:
+            break;
+        }
+        measurements.push_back(measurement);
+    }
+
+    m_cells.clear();
+    m_servingIndex = std::numeric_limits<std::size_t>::max();
+
+    return measurements;
+}
+
+} // namespace ns3
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Author: Abdul Wadud
+ * Affiliation: University College Dublin, Ireland.
+ */
+#ifndef ORAN_UE_RSRP_RSRQ_AGGREGATOR_H
+#define ORAN_UE_RSRP_RSRQ_AGGREGATOR_H
+
+#include "ns3/nstime.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * @ingroup oran
+ *
+ * The RSRP and RSRQ measured by a UE for one cell and component carrier.
+ */
+struct OranUeCellRsrpRsrq
+{
+    uint16_t cellId = 0;            //!< The cell ID.
+    uint8_t componentCarrierId = 0; //!< The component carrier ID.
+    bool isServingCell = false;     //!< Whether this is the serving cell.
+    double rsrp = 0.0;              //!< The RSRP.
+    double rsrq = 0.0;              //!< The RSRQ.
+};
+
+/**
+ * @ingroup oran
+ *
+ * Accumulates the RSRP and RSRQ measurements of one UE over a report period
+ * and reduces them to one value per cell and component carrier.
+ *
+ * Only the cell of the latest serving-cell measurement is flagged as the
+ * serving cell, so a handover within the period does not leave two serving
+ * cells in the result.
+ */
+class OranUeRsrpRsrqAggregator
+{
+  public:
+    /**
+     * How the measurements of a cell within a period are reduced.
+     */
+    enum Reduction
+    {
+        LAST = 0, //!< The latest measurement.
+        MEAN,     //!< The mean of the measurements.
+        MIN,      //!< The minimum of the measurements.
+        MAX       //!< The maximum of the measurements.
+    };
+
+    /**
+     * Create an empty aggregator.
+     */
+    OranUeRsrpRsrqAggregator();
+    /**
+     * Add a measurement.
+     *
+     * @param t The time of the measurement.
+     * @param rnti The RNTI of the UE.
+     * @param cellId The cell ID.
+     * @param rsrp The RSRP.
+     * @param rsrq The RSRQ.
+     * @param isServingCell A flag that indicates if this is the serving cell.
+     * @param componentCarrierId The component carrier ID.
+     */
+    void Add(Time t,
+             uint16_t rnti,
+             uint16_t cellId,
+             double rsrp,
+             double rsrq,
+             bool isServingCell,
+             uint8_t componentCarrierId);
+    /**
+     * @return True if no measurement was added since the last Flush.
+     */
+    bool IsEmpty() const;
+    /**
+     * @return The time of the latest measurement.
+     */
+    Time GetTime() const;
+    /**
+     * @return The RNTI of the latest measurement.
+     */
+    uint16_t GetRnti() const;
+    /**
+     * Reduce the measurements added since the last Flush, and forget them.
+     *
+     * @param reduction How the measurements of each cell are reduced.
+     * @return One entry per cell and component carrier, in the order the
+     *         cells were first measured.
+     */
+    std::vector<OranUeCellRsrpRsrq> Flush(Reduction reduction);
+
+  private:
+    /**
+     * The running statistics of one cell and component carrier.
+     */
+    struct Accumulator
+    {
+        OranUeCellRsrpRsrq last; //!< The latest measurement.
+        double sumRsrp;          //!< The sum of the RSRPs.
+        double sumRsrq;          //!< The sum of the RSRQs.
+        double minRsrp;          //!< The minimum RSRP.
+        double minRsrq;          //!< The minimum RSRQ.
+        double maxRsrp;          //!< The maximum RSRP.
+        double maxRsrq;          //!< The maximum RSRQ.
+        uint32_t n;              //!< The number of measurements.
+    };
+
+    /**
+     * The statistics of each cell measured in the period. A UE hears a
+     * handful of cells, so a linear search beats a map here.
+     */
+    std::vector<Accumulator> m_cells;
+    /**
+     * The index in m_cells of the latest serving-cell measurement, or the
+     * maximum std::size_t if there is none.
+     */
+    std::size_t m_servingIndex;
+    /**
+     * The time of the latest measurement.
+     */
+    Time m_time;
+    /**
+     * The RNTI of the latest measurement.
+     */
+    uint16_t m_rnti;
+}; // class OranUeRsrpRsrqAggregator
+
+} // namespace ns3
+
+#endif // ORAN_UE_RSRP_RSRQ_AGGREGATOR_H
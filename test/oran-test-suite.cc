@@ -34,6 +34,21 @@
 #include "ns3/oran-module.h"
 #include "ns3/test.h"
 
+#include <array>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
 using namespace ns3;
 
 /**
@@ -177,6 +192,2063 @@ OranTestCaseMobility1::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup oran
+ *
+ * Class that tests that a conflict policy is parsed and compiled as expected.
+ */
+class OranTestCaseConflictPolicy1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseConflictPolicy1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseConflictPolicy1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseConflictPolicy1::OranTestCaseConflictPolicy1()
+    : TestCase("Oran Test Case Conflict Policy 1")
+{
+}
+
+OranTestCaseConflictPolicy1::~OranTestCaseConflictPolicy1()
+{
+}
+
+void
+OranTestCaseConflictPolicy1::DoRun()
+{
+    OranCmmConflictPolicy policy;
+
+    // Built-in defaults reproduce the four-xApp role and priority mapping.
+    const OranConflictIdTable& roles = policy.GetRoles();
+    NS_TEST_ASSERT_MSG_EQ(roles.GetName(policy.ClassifyLm("OranLmLte2LteOnnxEnergySaving")),
+                          "ES",
+                          "ONNX energy saving LM not classified as ES.");
+    NS_TEST_ASSERT_MSG_EQ(policy.GetPriority(policy.ClassifyLm("OranLmLte2LteRsrpHandover")),
+                          0,
+                          "MRO does not have the highest priority.");
+    NS_TEST_ASSERT_MSG_EQ(policy.GetPriority(policy.ClassifyLm("OranLmNoop")),
+                          4,
+                          "Unknown LM does not rank below every role.");
+
+    // A custom policy with one Implicit conflict between two ICPs.
+    std::istringstream in("role A 0 Alpha\n"
+                          "role B 1 Beta  # comment\n"
+                          "icp TxPower A B\n"
+                          "icp X B\n"
+                          "influences TxPower K1 K2\n"
+                          "influences X K2\n"
+                          "manages A K2\n"
+                          "detect implicit\n");
+    policy.Load(in, "test policy");
+
+    const OranConflictIdTable& icps = policy.GetIcps();
+    OranConflictIdTable::Id txPower = icps.Find("TxPower");
+    OranConflictIdTable::Id x = icps.Find("X");
+    NS_TEST_ASSERT_MSG_EQ(policy.GetRoles().GetName(policy.ClassifyLm("MyBetaLm")),
+                          "B",
+                          "Custom role pattern not matched.");
+    NS_TEST_ASSERT_MSG_EQ(policy.GetOwners(x),
+                          OranConflictIdTable::Bit(policy.GetRoles().Find("B")),
+                          "ICP owner mask does not match.");
+    NS_TEST_ASSERT_MSG_EQ(policy.IsImplicitDetectionEnabled(), true, "Implicit detection off.");
+
+    std::array<OranConflictIdTable::Mask, OranConflictIdTable::kMaxIds> issuers{};
+    issuers[txPower] = OranConflictIdTable::Bit(policy.GetRoles().Find("A"));
+    issuers[x] = OranConflictIdTable::Bit(policy.GetRoles().Find("B"));
+    std::vector<OranCmmConflictPolicy::ImplicitConflict> implicit = policy.DetectImplicit(issuers);
+    NS_TEST_ASSERT_MSG_EQ(implicit.size(), 1, "Expected exactly one Implicit conflict.");
+    NS_TEST_ASSERT_MSG_EQ(policy.GetKpiNames(implicit[0].kpis).at(0),
+                          "K2",
+                          "Implicit conflict shared KPI does not match.");
+
+    // The same role setting both ICPs is not a conflict.
+    issuers[x] = issuers[txPower];
+    NS_TEST_ASSERT_MSG_EQ(policy.DetectImplicit(issuers).size(),
+                          0,
+                          "Single-role ICP pair reported as Implicit conflict.");
+
+    // Commands for unrecognised parameters are counted together, not dropped.
+    OranConflictIdTable::Id roleA = policy.GetRoles().Find("A");
+    OranConflictIdTable::Id roleB = policy.GetRoles().Find("B");
+    OranIcpCellCounters counters;
+    counters.Record(txPower, roleA);
+    counters.RecordUnknown(roleA);
+    counters.RecordUnknown(roleB);
+    std::map<std::string, uint32_t> counts = counters.GetCounts(icps);
+    NS_TEST_ASSERT_MSG_EQ(counts.size(), 2, "Unexpected number of counted ICPs.");
+    NS_TEST_ASSERT_MSG_EQ(counts[OranIcpCellCounters::kUnknownIcp],
+                          2,
+                          "Unrecognised parameter commands not counted.");
+    NS_TEST_ASSERT_MSG_EQ(
+        counters.GetActors(icps, policy.GetRoles())[OranIcpCellCounters::kUnknownIcp].size(),
+        2,
+        "Issuers of unrecognised parameters not reported.");
+    counters.ResetCounts();
+    NS_TEST_ASSERT_MSG_EQ(counters.GetCounts(icps).empty(), true, "Counts not reset.");
+    NS_TEST_ASSERT_MSG_EQ(counters.GetActors(icps, policy.GetRoles()).size(),
+                          2,
+                          "Resetting the counts cleared the actors.");
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that every Report and Command survives an E2 codec round
+ * trip, and that truncated messages and other versions are rejected.
+ */
+class OranTestCaseE2Codec1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseE2Codec1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseE2Codec1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseE2Codec1::OranTestCaseE2Codec1()
+    : TestCase("Oran Test Case E2 Codec 1")
+{
+}
+
+OranTestCaseE2Codec1::~OranTestCaseE2Codec1()
+{
+}
+
+void
+OranTestCaseE2Codec1::DoRun()
+{
+    // One Report of every type, from distinct reporters at distinct times.
+    std::vector<Ptr<OranReport>> reports;
+    auto add = [&reports](Ptr<OranReport> report) {
+        report->SetAttribute("ReporterE2NodeId", UintegerValue(reports.size() + 1));
+        report->SetAttribute("Time", TimeValue(MilliSeconds(12345 + 250 * reports.size())));
+        reports.push_back(report);
+    };
+
+    Ptr<OranReport> location = CreateObject<OranReportLocation>();
+    location->SetAttribute("Location", VectorValue(Vector(120.5, -33.25, 1.5)));
+    add(location);
+    Ptr<OranReport> appLoss = CreateObject<OranReportAppLoss>();
+    appLoss->SetAttribute("Loss", DoubleValue(0.0125));
+    add(appLoss);
+
+    std::vector<OranUeCellRsrpRsrq> measurements;
+    for (uint16_t cellId = 1; cellId <= 4; cellId++)
+    {
+        measurements.push_back({cellId, 1, cellId == 3, -90.0 - cellId, -10.0 - 0.5 * cellId});
+    }
+    Ptr<OranReport> lteCellInfo = CreateObject<OranReportLteUeCellInfo>();
+    Ptr<OranReport> lteRsrpRsrq = CreateObject<OranReportLteUeRsrpRsrq>();
+    Ptr<OranReportLteUeMultiCellRsrpRsrq> lteMultiCell =
+        CreateObject<OranReportLteUeMultiCellRsrpRsrq>();
+    lteMultiCell->SetMeasurements(measurements);
+    Ptr<OranReport> lteEnergy = CreateObject<OranReportLteEnergyEfficiency>();
+    Ptr<OranReport> lteDemand = CreateObject<OranReportLteUeAppDemand>();
+    Ptr<OranReport> nrCellInfo = CreateObject<OranReportNrUeCellInfo>();
+    Ptr<OranReport> nrRsrpRsrq = CreateObject<OranReportNrUeRsrpRsrq>();
+    Ptr<OranReportNrUeMultiCellRsrpRsrq> nrMultiCell =
+        CreateObject<OranReportNrUeMultiCellRsrpRsrq>();
+    nrMultiCell->SetMeasurements(measurements);
+    Ptr<OranReport> nrEnergy = CreateObject<OranReportNrEnergyEfficiency>();
+    Ptr<OranReport> nrDemand = CreateObject<OranReportNrUeAppDemand>();
+
+    for (Ptr<OranReport> cellInfo : {lteCellInfo, nrCellInfo})
+    {
+        cellInfo->SetAttribute("CellId", UintegerValue(3));
+        cellInfo->SetAttribute("Rnti", UintegerValue(17));
+        add(cellInfo);
+    }
+    for (Ptr<OranReport> rsrpRsrq : {lteRsrpRsrq, nrRsrpRsrq})
+    {
+        rsrpRsrq->SetAttribute("Rnti", UintegerValue(17));
+        rsrpRsrq->SetAttribute("CellId", UintegerValue(3));
+        rsrpRsrq->SetAttribute("Rsrp", DoubleValue(-92.5));
+        rsrpRsrq->SetAttribute("Rsrq", DoubleValue(-11.25));
+        rsrpRsrq->SetAttribute("IsServingCell", BooleanValue(true));
+        rsrpRsrq->SetAttribute("ComponentCarrierId", UintegerValue(1));
+        add(rsrpRsrq);
+    }
+    for (Ptr<OranReport> multiCell : {Ptr<OranReport>(lteMultiCell), Ptr<OranReport>(nrMultiCell)})
+    {
+        multiCell->SetAttribute("Rnti", UintegerValue(17));
+        add(multiCell);
+    }
+    for (Ptr<OranReport> energy : {lteEnergy, nrEnergy})
+    {
+        energy->SetAttribute("EnergyRemaining", DoubleValue(8123.75));
+        add(energy);
+    }
+    for (Ptr<OranReport> demand : {lteDemand, nrDemand})
+    {
+        demand->SetAttribute("DemandMbps", DoubleValue(4.5));
+        add(demand);
+    }
+    NS_TEST_ASSERT_MSG_EQ(reports.size(), 12, "Not every Report type is covered.");
+
+    OranE2Codec codec;
+    std::vector<uint8_t> buffer;
+    std::vector<Ptr<OranReport>> decodedReports;
+    std::vector<Ptr<OranCommand>> decodedCommands;
+
+    // Every field of a Report is in its string form, except for the exact
+    // time, which is checked separately.
+    auto checkReport = [this](Ptr<OranReport> decoded, Ptr<OranReport> report) {
+        NS_TEST_ASSERT_MSG_EQ(decoded->GetInstanceTypeId(),
+                              report->GetInstanceTypeId(),
+                              "Decoded Report type does not match.");
+        NS_TEST_ASSERT_MSG_EQ(decoded->GetReporterE2NodeId(),
+                              report->GetReporterE2NodeId(),
+                              "Decoded reporter E2 Node ID does not match.");
+        NS_TEST_ASSERT_MSG_EQ(decoded->GetTime(),
+                              report->GetTime(),
+                              "Decoded Report time does not match.");
+        NS_TEST_ASSERT_MSG_EQ(decoded->ToString(),
+                              report->ToString(),
+                              "Decoded Report fields do not match.");
+    };
+
+    for (const auto& report : reports)
+    {
+        buffer.clear();
+        decodedReports.clear();
+        codec.EncodeReport(report, buffer);
+        NS_TEST_ASSERT_MSG_EQ(codec.TryDecode(buffer.data(),
+                                              buffer.size(),
+                                              decodedReports,
+                                              decodedCommands),
+                              buffer.size(),
+                              "Report message not decoded whole.");
+        NS_TEST_ASSERT_MSG_EQ(decodedReports.size(), 1, "Expected exactly one decoded Report.");
+        checkReport(decodedReports[0], report);
+    }
+
+    buffer.clear();
+    decodedReports.clear();
+    codec.EncodeReportBatch(reports, buffer);
+    NS_TEST_ASSERT_MSG_EQ(
+        codec.TryDecode(buffer.data(), buffer.size(), decodedReports, decodedCommands),
+        buffer.size(),
+        "Report batch message not decoded whole.");
+    NS_TEST_ASSERT_MSG_EQ(decodedReports.size(), reports.size(), "Batch size does not match.");
+    for (std::size_t i = 0; i < reports.size(); i++)
+    {
+        checkReport(decodedReports[i], reports[i]);
+    }
+    NS_TEST_ASSERT_MSG_EQ(decodedCommands.size(), 0, "Reports decoded as Commands.");
+
+    // One Command of every type.
+    std::vector<Ptr<OranCommand>> commands = {
+        OranCommandLte2LteHandover::Create(2, 4, 17),
+        OranCommandLte2LteTxPower::Create(3, -3.5),
+        OranCommandLte2LteCellParameter::Create(4, "CIO", 1.5, true),
+        OranCommandNr2NrHandover::Create(5, 6, 18),
+        OranCommandNr2NrTxPower::Create(6, 2.25),
+        OranCommandNr2NrCellParameter::Create(7, "HYS", 3.0, false),
+    };
+    for (const auto& command : commands)
+    {
+        buffer.clear();
+        decodedCommands.clear();
+        codec.EncodeCommand(command, buffer);
+        NS_TEST_ASSERT_MSG_EQ(codec.TryDecode(buffer.data(),
+                                              buffer.size(),
+                                              decodedReports,
+                                              decodedCommands),
+                              buffer.size(),
+                              "Command message not decoded whole.");
+        NS_TEST_ASSERT_MSG_EQ(decodedCommands.size(), 1, "Expected exactly one decoded Command.");
+        Ptr<OranCommand> decoded = decodedCommands[0];
+        NS_TEST_ASSERT_MSG_EQ(decoded->GetInstanceTypeId(),
+                              command->GetInstanceTypeId(),
+                              "Decoded Command type does not match.");
+        NS_TEST_ASSERT_MSG_EQ(decoded->GetTargetE2NodeId(),
+                              command->GetTargetE2NodeId(),
+                              "Decoded target E2 Node ID does not match.");
+        if (auto handover = DynamicCast<OranCommandLte2LteHandover>(command))
+        {
+            auto decodedHandover = DynamicCast<OranCommandLte2LteHandover>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(decodedHandover->GetTargetCellId(),
+                                  handover->GetTargetCellId(),
+                                  "Decoded target cell ID does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedHandover->GetTargetRnti(),
+                                  handover->GetTargetRnti(),
+                                  "Decoded target RNTI does not match.");
+        }
+        if (auto handover = DynamicCast<OranCommandNr2NrHandover>(command))
+        {
+            auto decodedHandover = DynamicCast<OranCommandNr2NrHandover>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(decodedHandover->GetTargetCellId(),
+                                  handover->GetTargetCellId(),
+                                  "Decoded target cell ID does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedHandover->GetTargetRnti(),
+                                  handover->GetTargetRnti(),
+                                  "Decoded target RNTI does not match.");
+        }
+        if (auto txPower = DynamicCast<OranCommandLte2LteTxPower>(command))
+        {
+            auto decodedTxPower = DynamicCast<OranCommandLte2LteTxPower>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(decodedTxPower->GetPowerDeltaDb(),
+                                  txPower->GetPowerDeltaDb(),
+                                  "Decoded TxPower delta does not match.");
+        }
+        if (auto txPower = DynamicCast<OranCommandNr2NrTxPower>(command))
+        {
+            auto decodedTxPower = DynamicCast<OranCommandNr2NrTxPower>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(decodedTxPower->GetPowerDeltaDb(),
+                                  txPower->GetPowerDeltaDb(),
+                                  "Decoded TxPower delta does not match.");
+        }
+        if (auto parameter = DynamicCast<OranCommandLte2LteCellParameter>(command))
+        {
+            auto decodedParameter = DynamicCast<OranCommandLte2LteCellParameter>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(static_cast<int>(decodedParameter->GetParameter()),
+                                  static_cast<int>(parameter->GetParameter()),
+                                  "Decoded cell-control parameter does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedParameter->GetValue(),
+                                  parameter->GetValue(),
+                                  "Decoded cell-control value does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedParameter->IsDelta(),
+                                  parameter->IsDelta(),
+                                  "Decoded cell-control delta flag does not match.");
+        }
+        if (auto parameter = DynamicCast<OranCommandNr2NrCellParameter>(command))
+        {
+            auto decodedParameter = DynamicCast<OranCommandNr2NrCellParameter>(decoded);
+            NS_TEST_ASSERT_MSG_EQ(static_cast<int>(decodedParameter->GetParameter()),
+                                  static_cast<int>(parameter->GetParameter()),
+                                  "Decoded cell-control parameter does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedParameter->GetValue(),
+                                  parameter->GetValue(),
+                                  "Decoded cell-control value does not match.");
+            NS_TEST_ASSERT_MSG_EQ(decodedParameter->IsDelta(),
+                                  parameter->IsDelta(),
+                                  "Decoded cell-control delta flag does not match.");
+        }
+    }
+
+    // Every prefix of a message is rejected, and nothing is decoded from it.
+    buffer.clear();
+    codec.EncodeReportBatch(reports, buffer);
+    decodedReports.clear();
+    decodedCommands.clear();
+    for (std::size_t size = 0; size < buffer.size(); size++)
+    {
+        std::string error;
+        NS_TEST_ASSERT_MSG_EQ(
+            codec.TryDecode(buffer.data(), size, decodedReports, decodedCommands, &error),
+            0,
+            "Message truncated to " << size << " bytes not rejected.");
+        NS_TEST_ASSERT_MSG_EQ(error.empty(), false, "Truncated message rejected without error.");
+    }
+    NS_TEST_ASSERT_MSG_EQ(decodedReports.size(), 0, "Reports decoded from a truncated message.");
+
+    // A message of another version is rejected.
+    buffer[1] = OranE2Codec::VERSION + 1;
+    std::string error;
+    NS_TEST_ASSERT_MSG_EQ(
+        codec.TryDecode(buffer.data(), buffer.size(), decodedReports, decodedCommands, &error),
+        0,
+        "Message of an unknown version not rejected.");
+    NS_TEST_ASSERT_MSG_NE(error.find("version"),
+                          std::string::npos,
+                          "Unknown version rejected for another reason: " << error);
+    NS_TEST_ASSERT_MSG_EQ(decodedReports.size(), 0, "Reports decoded from an unknown version.");
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that the min-cost assignment places as many UEs as
+ * possible at the lowest cost, against a brute force search of small random
+ * problems.
+ */
+class OranTestCaseMinCostAssignment1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseMinCostAssignment1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseMinCostAssignment1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseMinCostAssignment1::OranTestCaseMinCostAssignment1()
+    : TestCase("Oran Test Case Min Cost Assignment 1")
+{
+}
+
+OranTestCaseMinCostAssignment1::~OranTestCaseMinCostAssignment1()
+{
+}
+
+void
+OranTestCaseMinCostAssignment1::DoRun()
+{
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<uint32_t> numUesDist(1, 6);
+    std::uniform_int_distribution<uint32_t> numCellsDist(1, 3);
+    std::uniform_int_distribution<uint32_t> capacityDist(0, 3);
+    std::uniform_int_distribution<uint32_t> costDist(0, 9);
+    std::bernoulli_distribution candidateDist(0.6);
+
+    OranMinCostAssignment assignment;
+    for (uint32_t instance = 0; instance < 200; instance++)
+    {
+        const uint32_t numUes = numUesDist(rng);
+        const uint32_t numCells = numCellsDist(rng);
+        std::vector<uint32_t> capacities(numCells);
+        for (auto& capacity : capacities)
+        {
+            capacity = capacityDist(rng);
+        }
+        // The cost of every candidate pair, or -1.
+        std::vector<std::vector<double>> costs(numUes, std::vector<double>(numCells, -1.0));
+        assignment.Reset(numUes, capacities);
+        for (uint32_t ue = 0; ue < numUes; ue++)
+        {
+            for (uint32_t cell = 0; cell < numCells; cell++)
+            {
+                if (candidateDist(rng))
+                {
+                    costs[ue][cell] = costDist(rng);
+                    assignment.AddCandidate(ue, cell, costs[ue][cell]);
+                }
+            }
+        }
+        const double cost = assignment.Solve();
+
+        // The solution uses candidate pairs, fits the capacities, and costs
+        // what Solve() returned.
+        std::vector<uint32_t> load(numCells, 0);
+        double sum = 0.0;
+        std::size_t placed = 0;
+        for (uint32_t ue = 0; ue < numUes; ue++)
+        {
+            const int32_t cell = assignment.GetAssignment(ue);
+            if (cell == OranMinCostAssignment::UNASSIGNED)
+            {
+                continue;
+            }
+            NS_TEST_ASSERT_MSG_EQ((costs[ue][cell] >= 0.0),
+                                  true,
+                                  "Instance " << instance << ": UE " << ue
+                                              << " assigned to a cell that is not a candidate.");
+            load[cell]++;
+            sum += costs[ue][cell];
+            placed++;
+        }
+        for (uint32_t cell = 0; cell < numCells; cell++)
+        {
+            NS_TEST_ASSERT_MSG_LT_OR_EQ(load[cell],
+                                        capacities[cell],
+                                        "Instance " << instance << ": cell " << cell
+                                                    << " over capacity.");
+        }
+        NS_TEST_ASSERT_MSG_EQ(placed, assignment.GetNumAssigned(), "Placed UE count mismatch.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(sum, cost, 1e-9, "Solve() does not return the assigned cost.");
+
+        // Brute force: every UE unassigned or at any candidate, counting in
+        // base numCells + 1.
+        std::size_t bestPlaced = 0;
+        double bestCost = 0.0;
+        std::vector<uint32_t> choice(numUes, 0);
+        while (true)
+        {
+            std::fill(load.begin(), load.end(), 0);
+            bool feasible = true;
+            std::size_t choicePlaced = 0;
+            double choiceCost = 0.0;
+            for (uint32_t ue = 0; ue < numUes && feasible; ue++)
+            {
+                if (choice[ue] == numCells)
+                {
+                    continue;
+                }
+                feasible = costs[ue][choice[ue]] >= 0.0 &&
+                           ++load[choice[ue]] <= capacities[choice[ue]];
+                choicePlaced++;
+                choiceCost += costs[ue][choice[ue]];
+            }
+            if (feasible && (choicePlaced > bestPlaced ||
+                             (choicePlaced == bestPlaced && choiceCost < bestCost)))
+            {
+                bestPlaced = choicePlaced;
+                bestCost = choiceCost;
+            }
+
+            uint32_t ue = 0;
+            while (ue < numUes && choice[ue] == numCells)
+            {
+                choice[ue++] = 0;
+            }
+            if (ue == numUes)
+            {
+                break;
+            }
+            choice[ue]++;
+        }
+        NS_TEST_ASSERT_MSG_EQ(placed,
+                              bestPlaced,
+                              "Instance " << instance << ": fewer UEs placed than possible.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(cost,
+                                  bestCost,
+                                  1e-9,
+                                  "Instance " << instance << ": assignment is not min-cost.");
+    }
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that the RSRP surrogate scores and applies TxPower
+ * offsets, including switching cells off, as a full recompute of the best
+ * cell of every UE would.
+ */
+class OranTestCaseRsrpSurrogate1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseRsrpSurrogate1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseRsrpSurrogate1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseRsrpSurrogate1::OranTestCaseRsrpSurrogate1()
+    : TestCase("Oran Test Case RSRP Surrogate 1")
+{
+}
+
+OranTestCaseRsrpSurrogate1::~OranTestCaseRsrpSurrogate1()
+{
+}
+
+void
+OranTestCaseRsrpSurrogate1::DoRun()
+{
+    const uint32_t numCells = 5;
+    const uint32_t numUes = 37; // Not a multiple of the SIMD width.
+    const double threshold = -95.0;
+    const double off = -std::numeric_limits<double>::infinity();
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> position(0.0, 2000.0);
+    std::vector<Vector> cells(numCells);
+    std::vector<Vector> ues(numUes);
+    for (auto& cell : cells)
+    {
+        cell = Vector(position(rng), position(rng), 30.0);
+    }
+    for (auto& ue : ues)
+    {
+        ue = Vector(position(rng), position(rng), 1.5);
+    }
+
+    OranRsrpSurrogate surrogate;
+    surrogate.SetLayout(cells, ues);
+
+    // The RSRP without offsets, and the full recompute of the best cell of
+    // every UE for a set of offsets, in the precision of the surrogate.
+    std::vector<std::vector<float>> base(numUes, std::vector<float>(numCells));
+    for (uint32_t u = 0; u < numUes; u++)
+    {
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            base[u][c] = static_cast<float>(surrogate.GetRsrp(u, c));
+        }
+    }
+    std::vector<double> offsets(numCells, 0.0);
+    auto best = [&](uint32_t u, std::vector<double> candidate) {
+        std::pair<float, int32_t> result(-std::numeric_limits<float>::infinity(),
+                                         OranRsrpSurrogate::NO_CELL);
+        for (uint32_t c = 0; c < numCells; c++)
+        {
+            const float rsrp = base[u][c] + static_cast<float>(candidate[c]);
+            if (rsrp > result.first)
+            {
+                result = {rsrp, static_cast<int32_t>(c)};
+            }
+        }
+        return result;
+    };
+    auto covered = [&](std::vector<double> candidate) {
+        uint32_t count = 0;
+        for (uint32_t u = 0; u < numUes; u++)
+        {
+            count += best(u, candidate).first >= static_cast<float>(threshold) ? 1 : 0;
+        }
+        return count;
+    };
+
+    const uint32_t initial = surrogate.CountCovered(threshold);
+    NS_TEST_ASSERT_MSG_EQ(initial, covered(offsets), "Initial coverage does not match.");
+    NS_TEST_ASSERT_MSG_EQ((initial > 0 && initial < numUes),
+                          true,
+                          "The threshold does not split the UEs; the test checks nothing.");
+
+    // Random offsets and cells switched off, then every cell off, then every
+    // cell back on.
+    std::vector<std::pair<uint32_t, double>> steps;
+    std::uniform_int_distribution<uint32_t> cellDist(0, numCells - 1);
+    std::uniform_int_distribution<int32_t> offsetDist(-7, 6);
+    for (uint32_t i = 0; i < 200; i++)
+    {
+        int32_t offset = offsetDist(rng);
+        steps.emplace_back(cellDist(rng), offset < -6 ? off : offset);
+    }
+    for (uint32_t c = 0; c < numCells; c++)
+    {
+        steps.emplace_back(c, off);
+    }
+    for (uint32_t c = 0; c < numCells; c++)
+    {
+        steps.emplace_back(c, 0.0);
+    }
+
+    for (std::size_t i = 0; i < steps.size(); i++)
+    {
+        const uint32_t cell = steps[i].first;
+        std::vector<double> candidate = offsets;
+        candidate[cell] = steps[i].second;
+        const uint32_t expected = covered(candidate);
+        NS_TEST_ASSERT_MSG_EQ(surrogate.EvaluatePowerOffset(cell, candidate[cell], threshold),
+                              expected,
+                              "Step " << i << ": scored coverage does not match.");
+        NS_TEST_ASSERT_MSG_EQ(surrogate.CountCovered(threshold),
+                              covered(offsets),
+                              "Step " << i << ": scoring changed the coverage.");
+
+        surrogate.SetPowerOffset(cell, candidate[cell]);
+        offsets = candidate;
+        NS_TEST_ASSERT_MSG_EQ(surrogate.CountCovered(threshold),
+                              expected,
+                              "Step " << i << ": applied coverage does not match.");
+        for (uint32_t u = 0; u < numUes; u++)
+        {
+            const std::pair<float, int32_t> expectedBest = best(u, offsets);
+            NS_TEST_ASSERT_MSG_EQ(static_cast<float>(surrogate.GetBestRsrp(u)),
+                                  expectedBest.first,
+                                  "Step " << i << ": best RSRP of UE " << u
+                                          << " does not match.");
+            NS_TEST_ASSERT_MSG_EQ(surrogate.GetBestCell(u),
+                                  expectedBest.second,
+                                  "Step " << i << ": best cell of UE " << u
+                                          << " does not match.");
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(surrogate.CountCovered(threshold),
+                          initial,
+                          "Coverage not restored with every cell back on.");
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that an E2 trace is written, read back, and searched by
+ * time as expected, with multi-cell reports split into one record per cell.
+ */
+class OranTestCaseE2Trace1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseE2Trace1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseE2Trace1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseE2Trace1::OranTestCaseE2Trace1()
+    : TestCase("Oran Test Case E2 Trace 1")
+{
+}
+
+OranTestCaseE2Trace1::~OranTestCaseE2Trace1()
+{
+}
+
+void
+OranTestCaseE2Trace1::DoRun()
+{
+    std::string traceFileName = "oran-e2-trace-test.bin";
+    std::string indexFileName = traceFileName + ".idx";
+
+    // A small stride and buffer, so that the index has several entries and
+    // the records are written in several flushes.
+    Ptr<OranE2TraceRecorder> recorder = CreateObject<OranE2TraceRecorder>();
+    recorder->SetAttribute("FileName", StringValue(traceFileName));
+    recorder->SetAttribute("IndexStride", UintegerValue(4));
+    recorder->SetAttribute("BufferSize", UintegerValue(3));
+    recorder->Attach(CreateObject<OranNearRtRicE2Terminator>());
+
+    // Every second, a location Report and a handover Command. At 5 s, a
+    // multi-cell report of 3 cells in between.
+    struct Expected
+    {
+        Time time;                  //!< The time of the record.
+        OranE2TraceRecordType type; //!< The type of the record.
+        uint64_t e2NodeId;          //!< The E2 Node ID of the record.
+        uint16_t cellId;            //!< The cell ID of the record.
+    };
+
+    std::vector<Expected> expected;
+    for (uint32_t k = 0; k < 10; k++)
+    {
+        Ptr<OranReport> location = CreateObject<OranReportLocation>();
+        location->SetAttribute("ReporterE2NodeId", UintegerValue(k + 1));
+        location->SetAttribute("Time", TimeValue(Seconds(k)));
+        location->SetAttribute("Location", VectorValue(Vector(k, 2.0 * k, 1.5)));
+        Simulator::Schedule(Seconds(k), [recorder, location]() {
+            recorder->RecordReport(location);
+        });
+        expected.push_back({Seconds(k), OranE2TraceRecordType::LOCATION, k + 1, 0});
+
+        if (k == 5)
+        {
+            std::vector<OranUeCellRsrpRsrq> measurements;
+            for (uint16_t cellId = 1; cellId <= 3; cellId++)
+            {
+                measurements.push_back({cellId, 0, cellId == 2, -90.0 - cellId, -10.0});
+                expected.push_back(
+                    {Seconds(k), OranE2TraceRecordType::LTE_UE_RSRP_RSRQ, 20, cellId});
+            }
+            Ptr<OranReportLteUeMultiCellRsrpRsrq> multiCell =
+                CreateObject<OranReportLteUeMultiCellRsrpRsrq>();
+            multiCell->SetAttribute("ReporterE2NodeId", UintegerValue(20));
+            multiCell->SetAttribute("Time", TimeValue(Seconds(k)));
+            multiCell->SetAttribute("Rnti", UintegerValue(17));
+            multiCell->SetMeasurements(measurements);
+            Simulator::Schedule(Seconds(k), [recorder, multiCell]() {
+                recorder->RecordReport(multiCell);
+            });
+        }
+
+        Ptr<OranCommand> handover = OranCommandLte2LteHandover::Create(30 + k, 4, 17);
+        Simulator::Schedule(Seconds(k), [recorder, handover]() {
+            recorder->RecordCommand(handover);
+        });
+        expected.push_back({Seconds(k), OranE2TraceRecordType::COMMAND_HANDOVER, 30 + k, 4});
+    }
+
+    Simulator::Run();
+    recorder->Close();
+    NS_TEST_ASSERT_MSG_EQ(recorder->GetNRecords(), expected.size(), "Records not all written.");
+
+    // Seek must find the first record at or after any time, with and
+    // without the index.
+    for (bool withIndex : {true, false})
+    {
+        if (!withIndex)
+        {
+            std::remove(indexFileName.c_str());
+        }
+        OranE2TraceReader reader(traceFileName);
+        NS_TEST_ASSERT_MSG_EQ(reader.GetNRecords(), expected.size(), "Record count mismatch.");
+        for (uint64_t i = 0; i < reader.GetNRecords(); i++)
+        {
+            const OranE2TraceRecord& record = reader.GetRecord(i);
+            NS_TEST_ASSERT_MSG_EQ(record.time,
+                                  expected[i].time.GetTimeStep(),
+                                  "Record " << i << " time does not match.");
+            NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(record.type),
+                                  static_cast<uint32_t>(expected[i].type),
+                                  "Record " << i << " type does not match.");
+            NS_TEST_ASSERT_MSG_EQ(record.e2NodeId,
+                                  expected[i].e2NodeId,
+                                  "Record " << i << " E2 Node ID does not match.");
+            NS_TEST_ASSERT_MSG_EQ(record.cellId,
+                                  expected[i].cellId,
+                                  "Record " << i << " cell ID does not match.");
+            if (expected[i].type == OranE2TraceRecordType::LOCATION)
+            {
+                NS_TEST_ASSERT_MSG_EQ_TOL(record.value[1],
+                                          2.0 * (record.e2NodeId - 1),
+                                          0.001,
+                                          "Record " << i << " location does not match.");
+            }
+            else if (expected[i].type == OranE2TraceRecordType::LTE_UE_RSRP_RSRQ)
+            {
+                NS_TEST_ASSERT_MSG_EQ(record.rnti, 17, "Record " << i << " RNTI does not match.");
+                NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(record.flags),
+                                      record.cellId == 2 ? 1U : 0U,
+                                      "Record " << i << " serving flag does not match.");
+                NS_TEST_ASSERT_MSG_EQ_TOL(record.value[0],
+                                          -90.0 - record.cellId,
+                                          0.001,
+                                          "Record " << i << " RSRP does not match.");
+            }
+        }
+
+        for (int64_t ms = -500; ms <= 10500; ms += 250)
+        {
+            uint64_t first = 0;
+            while (first < expected.size() && expected[first].time < MilliSeconds(ms))
+            {
+                first++;
+            }
+            NS_TEST_ASSERT_MSG_EQ(reader.Seek(MilliSeconds(ms)),
+                                  first,
+                                  "Seek to " << ms << " ms (index " << withIndex
+                                             << ") does not find the first record.");
+        }
+    }
+
+    std::remove(traceFileName.c_str());
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that the built-in ONNX engine imports small models
+ * written by hand, gives the outputs computed from their weights, and
+ * rejects the models it does not support.
+ */
+class OranTestCaseOnnxNativeModel1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseOnnxNativeModel1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseOnnxNativeModel1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseOnnxNativeModel1::OranTestCaseOnnxNativeModel1()
+    : TestCase("Oran Test Case ONNX Native Model 1")
+{
+}
+
+OranTestCaseOnnxNativeModel1::~OranTestCaseOnnxNativeModel1()
+{
+}
+
+void
+OranTestCaseOnnxNativeModel1::DoRun()
+{
+    std::string modelFileName = "oran-onnx-native-model-test.onnx";
+
+    // Writers of the protobuf wire format of the ONNX messages.
+    auto varint = [](uint64_t value) {
+        std::string bytes;
+        while (value >= 0x80)
+        {
+            bytes.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        bytes.push_back(static_cast<char>(value));
+        return bytes;
+    };
+    auto fixed32 = [](float value) {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        std::string bytes;
+        for (int k = 0; k < 4; k++)
+        {
+            bytes.push_back(static_cast<char>((bits >> (8 * k)) & 0xff));
+        }
+        return bytes;
+    };
+    auto bytesField = [&varint](uint32_t number, const std::string& bytes) {
+        return varint(number << 3 | 2) + varint(bytes.size()) + bytes;
+    };
+    auto intField = [&varint](uint32_t number, int64_t value) {
+        return varint(number << 3) + varint(static_cast<uint64_t>(value));
+    };
+    auto floatsField = [&](uint32_t number, const std::vector<float>& values) {
+        std::string bytes;
+        for (float value : values)
+        {
+            bytes += fixed32(value);
+        }
+        return bytesField(number, bytes);
+    };
+    auto intsField = [&](uint32_t number, const std::vector<int64_t>& values) {
+        std::string bytes;
+        for (int64_t value : values)
+        {
+            bytes += varint(static_cast<uint64_t>(value));
+        }
+        return bytesField(number, bytes);
+    };
+
+    // TensorProto, AttributeProto, NodeProto, and ValueInfoProto.
+    auto floatTensor = [&](const std::string& name,
+                           const std::vector<int64_t>& dims,
+                           const std::vector<float>& values) {
+        return intsField(1, dims) + intField(2, 1) + floatsField(4, values) + bytesField(8, name);
+    };
+    auto intTensor = [&](const std::string& name,
+                         const std::vector<int64_t>& dims,
+                         const std::vector<int64_t>& values) {
+        return intsField(1, dims) + intField(2, 7) + intsField(7, values) + bytesField(8, name);
+    };
+    auto floatAttribute = [&](const std::string& name, float value) {
+        return bytesField(1, name) + varint(2 << 3 | 5) + fixed32(value) + intField(20, 1);
+    };
+    auto intAttribute = [&](const std::string& name, int64_t value) {
+        return bytesField(1, name) + intField(3, value) + intField(20, 2);
+    };
+    auto stringAttribute = [&](const std::string& name, const std::string& value) {
+        return bytesField(1, name) + bytesField(4, value) + intField(20, 3);
+    };
+    auto floatsAttribute = [&](const std::string& name, const std::vector<float>& values) {
+        return bytesField(1, name) + floatsField(7, values) + intField(20, 6);
+    };
+    auto intsAttribute = [&](const std::string& name, const std::vector<int64_t>& values) {
+        return bytesField(1, name) + intsField(8, values) + intField(20, 7);
+    };
+    auto stringsAttribute = [&](const std::string& name, const std::vector<std::string>& values) {
+        std::string bytes = bytesField(1, name);
+        for (const auto& value : values)
+        {
+            bytes += bytesField(9, value);
+        }
+        return bytes + intField(20, 8);
+    };
+    auto node = [&](const std::string& opType,
+                    const std::vector<std::string>& inputs,
+                    const std::string& output,
+                    const std::vector<std::string>& attributes = {},
+                    const std::string& domain = "") {
+        std::string bytes;
+        for (const auto& input : inputs)
+        {
+            bytes += bytesField(1, input);
+        }
+        bytes += bytesField(2, output) + bytesField(4, opType);
+        for (const auto& attribute : attributes)
+        {
+            bytes += bytesField(5, attribute);
+        }
+        return domain.empty() ? bytes : bytes + bytesField(7, domain);
+    };
+    // A tensor of shape [N, width] of an element type (1 for float, 7 for int64).
+    auto valueInfo = [&](const std::string& name, int64_t width, int64_t elemType) {
+        std::string shape = bytesField(1, bytesField(2, "N")) + bytesField(1, intField(1, width));
+        return bytesField(1, name) +
+               bytesField(2, bytesField(1, intField(1, elemType) + bytesField(2, shape)));
+    };
+    // A ModelProto of a graph from input X to output Y.
+    auto model = [&](const std::vector<std::string>& nodes,
+                     const std::vector<std::string>& initializers,
+                     int64_t inputWidth,
+                     int64_t outputWidth,
+                     int64_t outputType = 1) {
+        std::string graph;
+        for (const auto& n : nodes)
+        {
+            graph += bytesField(1, n);
+        }
+        graph += bytesField(2, "test");
+        for (const auto& initializer : initializers)
+        {
+            graph += bytesField(5, initializer);
+        }
+        graph += bytesField(11, valueInfo("X", inputWidth, 1));
+        graph += bytesField(12, valueInfo("Y", outputWidth, outputType));
+        return intField(1, 8) + bytesField(2, "oran-test") + bytesField(7, graph) +
+               bytesField(8, bytesField(1, "") + intField(2, 13)) +
+               bytesField(8, bytesField(1, "ai.onnx.ml") + intField(2, 3));
+    };
+    auto load = [&modelFileName](OranOnnxNativeModel& native, const std::string& bytes) {
+        std::ofstream file(modelFileName, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), bytes.size());
+        file.close();
+        return native.Load(modelFileName);
+    };
+
+    OranOnnxNativeModel native;
+    std::vector<float> scratch;
+    std::vector<float> output;
+
+    // Gemm with alpha, beta, and transB, then Relu, MatMul and Add, Sigmoid
+    // (fused into the dense layers), Tanh (on its own), Reshape, and
+    // Softmax. The widths are not multiples of the vector width.
+    std::vector<float> w1 = {0.4f, -1.2f, 0.7f, -0.3f, 0.8f, 1.5f};
+    std::vector<float> c1 = {0.1f, -0.6f};
+    std::vector<float> w2 = {1.0f, -0.5f, 0.25f, 2.0f, -1.5f, 0.75f, 1.25f, -0.2f};
+    std::vector<float> b2 = {0.3f, -0.1f, 0.0f, 0.5f};
+    std::string dense =
+        model({node("Gemm",
+                    {"X", "W1", "C1"},
+                    "H1",
+                    {floatAttribute("alpha", 0.5f),
+                     floatAttribute("beta", 2.0f),
+                     intAttribute("transB", 1)}),
+               node("Relu", {"H1"}, "H2"),
+               node("MatMul", {"H2", "W2"}, "H3"),
+               node("Add", {"H3", "B2"}, "H4"),
+               node("Sigmoid", {"H4"}, "H5"),
+               node("Tanh", {"H5"}, "H6"),
+               node("Reshape", {"H6", "S"}, "H7"),
+               node("Softmax", {"H7"}, "Y", {intAttribute("axis", -1)})},
+              {floatTensor("W1", {2, 3}, w1),
+               floatTensor("C1", {2}, c1),
+               floatTensor("W2", {2, 4}, w2),
+               floatTensor("B2", {4}, b2),
+               intTensor("S", {2}, {-1, 4})},
+              3,
+              4);
+    NS_TEST_ASSERT_MSG_EQ(load(native, dense),
+                          true,
+                          "Dense model not imported: " << native.GetUnsupportedReason());
+    NS_TEST_ASSERT_MSG_EQ(native.GetInputSize(), 3, "Dense model input size does not match.");
+    NS_TEST_ASSERT_MSG_EQ(native.GetOutputSize(), 4, "Dense model output size does not match.");
+
+    std::vector<float> rows = {1.0f, 2.0f, -1.0f, -0.5f, 0.3f, 2.5f, 3.0f, -2.0f, 0.0f};
+    native.Run(rows.data(), 3, scratch, output);
+    NS_TEST_ASSERT_MSG_EQ(output.size(), 12, "Dense model output has the wrong size.");
+    for (std::size_t r = 0; r < 3; r++)
+    {
+        const float* x = &rows[r * 3];
+        double h1[2];
+        for (std::size_t o = 0; o < 2; o++)
+        {
+            double sum = 2.0 * c1[o];
+            for (std::size_t i = 0; i < 3; i++)
+            {
+                sum += 0.5 * w1[o * 3 + i] * x[i];
+            }
+            h1[o] = std::max(sum, 0.0);
+        }
+        double h[4];
+        double total = 0.0;
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            double sum = b2[j] + h1[0] * w2[j] + h1[1] * w2[4 + j];
+            h[j] = std::exp(std::tanh(1.0 / (1.0 + std::exp(-sum))));
+            total += h[j];
+        }
+        for (std::size_t j = 0; j < 4; j++)
+        {
+            NS_TEST_ASSERT_MSG_EQ_TOL(output[r * 4 + j],
+                                      h[j] / total,
+                                      1e-5,
+                                      "Dense model output " << j << " of row " << r
+                                                            << " does not match.");
+        }
+    }
+
+    // ArgMax, with ties going to the first or the last maximum.
+    rows = {1.0f, 3.0f, 3.0f, 0.0f, 5.0f, -1.0f, 2.0f, 5.0f, -2.0f, -1.0f, -3.0f, -4.0f};
+    for (int64_t selectLast : {0, 1})
+    {
+        std::string argMax = model({node("ArgMax",
+                                         {"X"},
+                                         "Y",
+                                         {intAttribute("axis", 1),
+                                          intAttribute("select_last_index", selectLast)})},
+                                   {},
+                                   4,
+                                   1,
+                                   7);
+        NS_TEST_ASSERT_MSG_EQ(load(native, argMax),
+                              true,
+                              "ArgMax model not imported: " << native.GetUnsupportedReason());
+        native.Run(rows.data(), 3, scratch, output);
+        std::vector<float> expected = {selectLast ? 2.0f : 1.0f, selectLast ? 3.0f : 0.0f, 1.0f};
+        for (std::size_t r = 0; r < 3; r++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(output[r],
+                                  expected[r],
+                                  "ArgMax of row " << r << " (select_last_index " << selectLast
+                                                   << ") does not match.");
+        }
+    }
+
+    // Two trees of two targets. Tree 0 takes leaf 1 if x0 <= 0.5 or x0 is
+    // missing, tree 1 takes leaf 1 if x1 > 0.
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    rows = {0.0f, 1.0f, 1.0f, -1.0f, nan, 0.0f, 0.5f, 0.0f};
+    std::vector<std::array<float, 2>> leaves0 = {{1.0f, 10.0f}, {2.0f, 20.0f}};
+    std::vector<std::array<float, 2>> leaves1 = {{5.0f, -4.0f}, {-1.0f, 3.0f}};
+    std::vector<float> baseValues = {0.5f, -0.5f};
+    for (std::string aggregate : {"SUM", "AVERAGE", "MIN", "MAX"})
+    {
+        std::string trees = model(
+            {node("TreeEnsembleRegressor",
+                  {"X"},
+                  "Y",
+                  {intAttribute("n_targets", 2),
+                   stringAttribute("aggregate_function", aggregate),
+                   stringAttribute("post_transform", "NONE"),
+                   floatsAttribute("base_values", baseValues),
+                   intsAttribute("nodes_treeids", {0, 0, 0, 1, 1, 1}),
+                   intsAttribute("nodes_nodeids", {0, 1, 2, 0, 1, 2}),
+                   intsAttribute("nodes_featureids", {0, 0, 0, 1, 0, 0}),
+                   floatsAttribute("nodes_values", {0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}),
+                   stringsAttribute("nodes_modes",
+                                    {"BRANCH_LEQ", "LEAF", "LEAF", "BRANCH_GT", "LEAF", "LEAF"}),
+                   intsAttribute("nodes_truenodeids", {1, 0, 0, 1, 0, 0}),
+                   intsAttribute("nodes_falsenodeids", {2, 0, 0, 2, 0, 0}),
+                   intsAttribute("nodes_missing_value_tracks_true", {1, 0, 0, 0, 0, 0}),
+                   intsAttribute("target_treeids", {0, 0, 0, 0, 1, 1, 1, 1}),
+                   intsAttribute("target_nodeids", {1, 1, 2, 2, 1, 1, 2, 2}),
+                   intsAttribute("target_ids", {0, 1, 0, 1, 0, 1, 0, 1}),
+                   floatsAttribute("target_weights",
+                                   {leaves0[0][0],
+                                    leaves0[0][1],
+                                    leaves0[1][0],
+                                    leaves0[1][1],
+                                    leaves1[0][0],
+                                    leaves1[0][1],
+                                    leaves1[1][0],
+                                    leaves1[1][1]})},
+                  "ai.onnx.ml")},
+            {},
+            2,
+            2);
+        NS_TEST_ASSERT_MSG_EQ(load(native, trees),
+                              true,
+                              "Tree model not imported: " << native.GetUnsupportedReason());
+        native.Run(rows.data(), 4, scratch, output);
+        for (std::size_t r = 0; r < 4; r++)
+        {
+            const float* x = &rows[r * 2];
+            const auto& a = leaves0[std::isnan(x[0]) || x[0] <= 0.5f ? 0 : 1];
+            const auto& b = leaves1[x[1] > 0.0f ? 0 : 1];
+            for (std::size_t t = 0; t < 2; t++)
+            {
+                float expected = aggregate == "SUM"       ? a[t] + b[t]
+                                 : aggregate == "AVERAGE" ? (a[t] + b[t]) / 2
+                                 : aggregate == "MIN"     ? std::min(a[t], b[t])
+                                                          : std::max(a[t], b[t]);
+                NS_TEST_ASSERT_MSG_EQ_TOL(output[r * 2 + t],
+                                          expected + baseValues[t],
+                                          1e-5,
+                                          aggregate << " of target " << t << " of row " << r
+                                                    << " does not match.");
+            }
+        }
+    }
+
+    // Rejected models leave no model loaded, and say why.
+    struct Rejected
+    {
+        std::string bytes;  //!< The model.
+        std::string reason; //!< Part of the reason it is rejected.
+    };
+
+    std::vector<Rejected> rejected = {
+        {model({node("Cos", {"X"}, "Y")}, {}, 3, 3), "operator Cos"},
+        {model({node("Gemm", {"X", "W"}, "Y")},
+               {floatTensor("W", {4, 2}, std::vector<float>(8))},
+               3,
+               2),
+         "weights do not match"},
+        {model({node("MatMul", {"X", "W"}, "H"), node("Add", {"H", "B"}, "Y")},
+               {floatTensor("W", {3, 2}, std::vector<float>(6)),
+                floatTensor("B", {3}, std::vector<float>(3))},
+               3,
+               2),
+         "not the bias"},
+        {dense.substr(0, dense.size() / 2), "malformed"},
+    };
+    for (const auto& entry : rejected)
+    {
+        load(native, dense);
+        NS_TEST_ASSERT_MSG_EQ(load(native, entry.bytes),
+                              false,
+                              "Model that should fail with \"" << entry.reason
+                                                               << "\" was imported.");
+        NS_TEST_ASSERT_MSG_EQ(native.IsLoaded(), false, "A rejected model is still loaded.");
+        NS_TEST_ASSERT_MSG_NE(native.GetUnsupportedReason().find(entry.reason),
+                              std::string::npos,
+                              "Unexpected reason \"" << native.GetUnsupportedReason() << "\".");
+    }
+
+    std::remove(modelFileName.c_str());
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that a checkpoint of the Near-RT RIC is restored into a
+ * new run with its times shifted, and that it cannot be restored once E2
+ * Nodes have registered.
+ */
+class OranTestCaseCheckpoint1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseCheckpoint1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseCheckpoint1();
+
+  private:
+    /**
+     * Method that runs the simulations for the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseCheckpoint1::OranTestCaseCheckpoint1()
+    : TestCase("Oran Test Case Checkpoint 1")
+{
+}
+
+OranTestCaseCheckpoint1::~OranTestCaseCheckpoint1()
+{
+}
+
+void
+OranTestCaseCheckpoint1::DoRun()
+{
+    std::string dbFileName = "oran-checkpoint-test.db";
+    std::string restoredDbFileName = "oran-checkpoint-test-restored.db";
+    std::string prefix = "oran-checkpoint-test-checkpoint";
+    Time checkpointTime = Seconds(5.5);
+    Time restoreTime = Seconds(20);
+    Time shift = restoreTime - checkpointTime;
+    for (const auto& fileName : {dbFileName, restoredDbFileName, prefix + ".db", prefix + ".state"})
+    {
+        std::remove(fileName.c_str());
+    }
+
+    // Both runs use the same modules, so that every section of the
+    // checkpoint is restored.
+    auto createNearRtRic = [](Ptr<OranHelper> oranHelper, const std::string& fileName) {
+        oranHelper->SetDataRepository("ns3::OranDataRepositorySqlite",
+                                      "DatabaseFile",
+                                      StringValue(fileName));
+        oranHelper->SetDefaultLogicModule("ns3::OranLmLte2LteKpiPrediction");
+        oranHelper->AddLogicModule("ns3::OranLmLte2LteRsrpHandover");
+        oranHelper->SetConflictMitigationModule("ns3::OranCmmConflictTriage");
+        return oranHelper->CreateNearRtRic();
+    };
+    auto saveState = [](const auto& module) {
+        std::ostringstream os;
+        module->SaveState(os);
+        return os.str();
+    };
+
+    // The first run: one moving node reports its location every second.
+    NodeContainer nodes;
+    nodes.Create(1);
+    MobilityHelper mobilityHelper;
+    mobilityHelper.SetMobilityModel("ns3::ConstantVelocityMobilityModel");
+    mobilityHelper.Install(nodes);
+    nodes.Get(0)->GetObject<ConstantVelocityMobilityModel>()->SetVelocity(Vector(1, 2, 0));
+
+    Ptr<OranHelper> oranHelper = CreateObject<OranHelper>();
+    Ptr<OranNearRtRic> nearRtRic = createNearRtRic(oranHelper, dbFileName);
+    oranHelper->SetE2NodeTerminator("ns3::OranE2NodeTerminatorWired",
+                                    "RegistrationIntervalRv",
+                                    StringValue("ns3::ConstantRandomVariable[Constant=1]"),
+                                    "SendIntervalRv",
+                                    StringValue("ns3::ConstantRandomVariable[Constant=1]"));
+    oranHelper->AddReporter("ns3::OranReporterLocation",
+                            "Trigger",
+                            StringValue("ns3::OranReportTriggerPeriodic"));
+    OranE2NodeTerminatorContainer e2NodeTerminators =
+        oranHelper->DeployTerminators(nearRtRic, nodes);
+
+    Simulator::Schedule(Seconds(0), &OranHelper::ActivateAndStartNearRtRic, oranHelper, nearRtRic);
+    Simulator::Schedule(Seconds(1),
+                        &OranHelper::ActivateE2NodeTerminators,
+                        oranHelper,
+                        e2NodeTerminators);
+
+    uint64_t e2NodeId = 0;
+    std::map<Time, Vector> savedPositions;
+    std::vector<std::tuple<uint64_t, Time>> savedRegistrations;
+    std::string savedCellControl;
+    std::string savedKpiLm;
+    std::string savedCmm;
+    int restoreStatus = 0;
+    Simulator::Schedule(checkpointTime, [&]() {
+        // Give every module some state to save. The handover LM keeps
+        // times, which the restore must shift.
+        std::istringstream kpiLm("2\n3 1.5 1.25 1 4\n5 -0.5 0 0 0\n");
+        nearRtRic->GetDefaultLogicModule()->RestoreState(kpiLm, Seconds(0));
+        std::istringstream handoverLm("1\n7 3.5\n1\n7 2 4.25\n");
+        nearRtRic->GetAdditionalLogicModule("OranLmLte2LteRsrpHandover")
+            ->RestoreState(handoverLm, Seconds(0));
+        std::istringstream cmm("1\n3 2 1 0 4 0.75\n");
+        nearRtRic->GetCmm()->RestoreState(cmm, Seconds(0));
+        nearRtRic->GetCellControlStore()->Apply(3, OranCellControlParameter::CIO, 2.5, false);
+        nearRtRic->GetCellControlStore()->Apply(3, OranCellControlParameter::HYS, 1.0, false);
+        nearRtRic->GetCellControlStore()->Apply(4, OranCellControlParameter::TTT, 0.32, false);
+
+        e2NodeId = e2NodeTerminators.Get(0)->GetE2NodeId();
+        savedPositions =
+            nearRtRic->Data()->GetNodePositions(e2NodeId, Seconds(0), checkpointTime, 100);
+        savedRegistrations = nearRtRic->Data()->GetLastRegistrationRequests();
+        savedCellControl = saveState(nearRtRic->GetCellControlStore());
+        savedKpiLm = saveState(nearRtRic->GetDefaultLogicModule());
+        savedCmm = saveState(nearRtRic->GetCmm());
+        nearRtRic->SaveCheckpoint(prefix);
+
+        // Restoring once E2 Nodes have registered must abort, so try it in
+        // a child process.
+        std::cout.flush();
+        std::fflush(nullptr);
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            std::freopen("/dev/null", "w", stderr);
+            nearRtRic->RestoreCheckpoint(prefix);
+            std::_Exit(0);
+        }
+        waitpid(pid, &restoreStatus, 0);
+    });
+
+    Simulator::Stop(Seconds(6));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(savedPositions.size() >= 4, true, "Too few positions were reported.");
+    NS_TEST_ASSERT_MSG_EQ(WIFSIGNALED(restoreStatus) && WTERMSIG(restoreStatus) == SIGABRT,
+                          true,
+                          "Restoring after E2 Nodes registered did not abort.");
+
+    // The second run: a new RIC, with no E2 Nodes, restores the checkpoint.
+    Ptr<OranHelper> restoredOranHelper = CreateObject<OranHelper>();
+    Ptr<OranNearRtRic> restoredNearRtRic =
+        createNearRtRic(restoredOranHelper, restoredDbFileName);
+    Simulator::Schedule(Seconds(0),
+                        &OranHelper::ActivateAndStartNearRtRic,
+                        restoredOranHelper,
+                        restoredNearRtRic);
+
+    std::map<Time, Vector> restoredPositions;
+    std::vector<std::tuple<uint64_t, Time>> restoredRegistrations;
+    std::string restoredCellControl;
+    std::string restoredKpiLm;
+    std::string restoredHandoverLm;
+    std::string restoredCmm;
+    Simulator::Schedule(restoreTime, [&]() {
+        restoredNearRtRic->RestoreCheckpoint(prefix);
+
+        restoredPositions =
+            restoredNearRtRic->Data()->GetNodePositions(e2NodeId, Seconds(0), restoreTime, 100);
+        restoredRegistrations = restoredNearRtRic->Data()->GetLastRegistrationRequests();
+        restoredCellControl = saveState(restoredNearRtRic->GetCellControlStore());
+        restoredKpiLm = saveState(restoredNearRtRic->GetDefaultLogicModule());
+        restoredHandoverLm =
+            saveState(restoredNearRtRic->GetAdditionalLogicModule("OranLmLte2LteRsrpHandover"));
+        restoredCmm = saveState(restoredNearRtRic->GetCmm());
+    });
+
+    Simulator::Stop(restoreTime + MilliSeconds(1));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // Rows come back shifted to the time of the restore.
+    NS_TEST_ASSERT_MSG_EQ(restoredPositions.size(),
+                          savedPositions.size(),
+                          "Restored positions do not match the saved ones.");
+    for (const auto& [time, position] : savedPositions)
+    {
+        auto restored = restoredPositions.find(time + shift);
+        NS_TEST_ASSERT_MSG_EQ((restored != restoredPositions.end()),
+                              true,
+                              "Position at " << time.As(Time::S) << " not shifted.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->second.x,
+                                  position.x,
+                                  0.001,
+                                  "Position x-coordinate at " << time.As(Time::S)
+                                                              << " does not match.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(restored->second.y,
+                                  position.y,
+                                  0.001,
+                                  "Position y-coordinate at " << time.As(Time::S)
+                                                              << " does not match.");
+    }
+    NS_TEST_ASSERT_MSG_EQ(restoredRegistrations.size(),
+                          savedRegistrations.size(),
+                          "Restored registrations do not match the saved ones.");
+    for (std::size_t i = 0; i < savedRegistrations.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(std::get<0>(restoredRegistrations[i]),
+                              std::get<0>(savedRegistrations[i]),
+                              "Restored registration " << i << " has another E2 Node ID.");
+        NS_TEST_ASSERT_MSG_EQ(std::get<1>(restoredRegistrations[i]),
+                              std::get<1>(savedRegistrations[i]) + shift,
+                              "Restored registration " << i << " is not shifted.");
+    }
+
+    // The state of the modules comes back as it was saved, with its times
+    // shifted.
+    NS_TEST_ASSERT_MSG_EQ(restoredCellControl,
+                          savedCellControl,
+                          "Cell-control parameters do not match.");
+    NS_TEST_ASSERT_MSG_EQ(restoredKpiLm, savedKpiLm, "KPI prediction LM state does not match.");
+    NS_TEST_ASSERT_MSG_EQ(restoredHandoverLm,
+                          "1\n7 18\n1\n7 2 18.75\n",
+                          "Handover LM state does not match.");
+    NS_TEST_ASSERT_MSG_EQ(restoredCmm, savedCmm, "CMM state does not match.");
+
+    for (const auto& fileName : {dbFileName, restoredDbFileName, prefix + ".db", prefix + ".state"})
+    {
+        std::remove(fileName.c_str());
+    }
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that an E2 Node Terminator coalesces buffered Reports,
+ * moving the newest one to the back, and drops the oldest ones when its
+ * buffer is full.
+ */
+class OranTestCaseE2NodeReportBuffer1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseE2NodeReportBuffer1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseE2NodeReportBuffer1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+    /**
+     * Record a Report dropped by the terminator.
+     *
+     * @param report The Report.
+     */
+    void ReportDropped(Ptr<const OranReport> report);
+
+    /**
+     * The Reports dropped, in order.
+     */
+    std::vector<Ptr<const OranReport>> m_dropped;
+};
+
+OranTestCaseE2NodeReportBuffer1::OranTestCaseE2NodeReportBuffer1()
+    : TestCase("Oran Test Case E2 Node Report Buffer 1")
+{
+}
+
+OranTestCaseE2NodeReportBuffer1::~OranTestCaseE2NodeReportBuffer1()
+{
+}
+
+void
+OranTestCaseE2NodeReportBuffer1::ReportDropped(Ptr<const OranReport> report)
+{
+    m_dropped.push_back(report);
+}
+
+void
+OranTestCaseE2NodeReportBuffer1::DoRun()
+{
+    Ptr<OranNearRtRic> nearRtRic = CreateObject<OranNearRtRic>();
+    nearRtRic->SetAttribute("E2Terminator",
+                            PointerValue(CreateObject<OranNearRtRicE2Terminator>()));
+
+    // RSRP Reports are coalesced per cell, location Reports are not.
+    Ptr<OranE2NodeTerminator> terminator = CreateObject<OranE2NodeTerminatorWired>();
+    terminator->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    terminator->SetAttribute("MaxBufferedReports", UintegerValue(4));
+    terminator->SetAttribute("CoalescedReportTypes", StringValue("ns3::OranReportLteUeRsrpRsrq"));
+    terminator->TraceConnectWithoutContext(
+        "ReportDropped",
+        MakeCallback(&OranTestCaseE2NodeReportBuffer1::ReportDropped, this));
+    terminator->Activate();
+
+    auto location = [](double x) {
+        Ptr<OranReport> report = CreateObject<OranReportLocation>();
+        report->SetAttribute("Location", VectorValue(Vector(x, 0.0, 0.0)));
+        return report;
+    };
+    auto rsrp = [](uint16_t cellId, double value) {
+        Ptr<OranReport> report = CreateObject<OranReportLteUeRsrpRsrq>();
+        report->SetAttribute("CellId", UintegerValue(cellId));
+        report->SetAttribute("Rsrp", DoubleValue(value));
+        return report;
+    };
+    auto check = [this, terminator](const std::vector<Ptr<OranReport>>& expected,
+                                    const std::string& step) {
+        std::vector<Ptr<OranReport>> buffered = terminator->GetBufferedReports();
+        NS_TEST_EXPECT_MSG_EQ(buffered.size(),
+                              expected.size(),
+                              step << ": wrong number of buffered Reports.");
+        for (std::size_t i = 0; i < std::min(buffered.size(), expected.size()); i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(buffered[i],
+                                  expected[i],
+                                  step << ": buffered Report " << i << " does not match.");
+        }
+    };
+
+    Ptr<OranReport> cell1 = rsrp(1, -90.0);
+    Ptr<OranReport> location1 = location(1.0);
+    Ptr<OranReport> cell2 = rsrp(2, -95.0);
+    Ptr<OranReport> cell1Newer = rsrp(1, -91.0);
+    terminator->StoreReport(cell1);
+    terminator->StoreReport(location1);
+    terminator->StoreReport(cell2);
+    terminator->StoreReport(cell1Newer);
+    check({location1, cell2, cell1Newer}, "Coalescing");
+    NS_TEST_ASSERT_MSG_EQ(terminator->GetNCoalescedReports(), 1, "Report not coalesced.");
+
+    // Filling the buffer drops the oldest Reports, coalesced ones included.
+    Ptr<OranReport> location2 = location(2.0);
+    Ptr<OranReport> location3 = location(3.0);
+    Ptr<OranReport> location4 = location(4.0);
+    terminator->StoreReport(location2);
+    terminator->StoreReport(location3);
+    terminator->StoreReport(location4);
+    check({cell1Newer, location2, location3, location4}, "Overflow");
+
+    // The dropped Report of cell 2 is no longer in the index, so a new one
+    // is buffered, and the one of cell 1 is dropped to make room for it.
+    Ptr<OranReport> cell2Newer = rsrp(2, -96.0);
+    terminator->StoreReport(cell2Newer);
+    check({location2, location3, location4, cell2Newer}, "Overflow of a coalesced Report");
+
+    // The index follows the Reports that moved to the front, so the next
+    // Report of cell 2 replaces the newest one without dropping any.
+    Ptr<OranReport> cell2Newest = rsrp(2, -97.0);
+    terminator->StoreReport(cell2Newest);
+    check({location2, location3, location4, cell2Newest}, "Coalescing after overflow");
+    Ptr<OranReport> cell1Newest = rsrp(1, -92.0);
+    terminator->StoreReport(cell1Newest);
+    check({location3, location4, cell2Newest, cell1Newest}, "Overflow after coalescing");
+
+    NS_TEST_ASSERT_MSG_EQ(terminator->GetNCoalescedReports(),
+                          2,
+                          "Wrong number of coalesced Reports.");
+    NS_TEST_ASSERT_MSG_EQ(terminator->GetNDroppedReports(), 4, "Wrong number of dropped Reports.");
+    std::vector<Ptr<OranReport>> dropped = {location1, cell2, cell1Newer, location2};
+    NS_TEST_ASSERT_MSG_EQ(m_dropped.size(), dropped.size(), "Wrong number of dropped traces.");
+    for (std::size_t i = 0; i < dropped.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(m_dropped[i],
+                              Ptr<const OranReport>(dropped[i]),
+                              "Dropped Report " << i << " does not match.");
+    }
+
+    terminator->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup oran
+ *
+ * Logic Module that does nothing and subscribes to the location Reports of
+ * wired E2 Nodes, for the subscription tests.
+ */
+class OranTestLmLocationSubscriber : public OranLmNoop
+{
+  public:
+    /**
+     * Get the TypeId of the OranTestLmLocationSubscriber class.
+     *
+     * @return The TypeId
+     */
+    static TypeId GetTypeId();
+    /**
+     * Constructor of the OranTestLmLocationSubscriber class.
+     */
+    OranTestLmLocationSubscriber();
+    /**
+     * Get the Reports this LM reads.
+     *
+     * @return The location Reports of wired E2 Nodes.
+     */
+    std::vector<OranSubscription> GetSubscriptions() const override;
+};
+
+TypeId
+OranTestLmLocationSubscriber::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::OranTestLmLocationSubscriber")
+                            .SetParent<OranLmNoop>()
+                            .AddConstructor<OranTestLmLocationSubscriber>();
+
+    return tid;
+}
+
+OranTestLmLocationSubscriber::OranTestLmLocationSubscriber()
+    : OranLmNoop()
+{
+    m_name = "OranTestLmLocationSubscriber";
+}
+
+std::vector<OranSubscription>
+OranTestLmLocationSubscriber::GetSubscriptions() const
+{
+    return {OranSubscription{OranReportLocation::GetTypeId(), {OranNearRtRic::WIRED}, Seconds(0)}};
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests the union of the subscriptions of the Near-RT RIC, and
+ * that a Reporter is suspended when its last subscriber leaves and resumed,
+ * at the interval of the new subscriber, when another one subscribes.
+ */
+class OranTestCaseSubscription1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseSubscription1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseSubscription1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseSubscription1::OranTestCaseSubscription1()
+    : TestCase("Oran Test Case Subscription 1")
+{
+}
+
+OranTestCaseSubscription1::~OranTestCaseSubscription1()
+{
+}
+
+void
+OranTestCaseSubscription1::DoRun()
+{
+    // Subscriptions to the same Reports from the same node types are merged,
+    // keeping the shortest interval, whatever the order of the node types.
+    TypeId locationTid = OranReportLocation::GetTypeId();
+    OranSubscriptionSet subscriptions;
+    subscriptions.Add(OranSubscription{locationTid,
+                                       {OranNearRtRic::WIRED, OranNearRtRic::LTEUE},
+                                       Seconds(3)});
+    subscriptions.Add(OranSubscription{locationTid,
+                                       {OranNearRtRic::LTEUE, OranNearRtRic::WIRED},
+                                       Seconds(2)});
+    subscriptions.Add(OranSubscription{locationTid, {OranNearRtRic::LTEENB}, Seconds(4)});
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.GetSubscriptions().size(),
+                          2,
+                          "Subscriptions to the same Reports were not merged.");
+
+    Time maxInterval;
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(locationTid, OranNearRtRic::WIRED, maxInterval),
+                          true,
+                          "Location Reports of wired nodes not covered.");
+    NS_TEST_ASSERT_MSG_EQ(maxInterval, Seconds(2), "The shortest interval was not kept.");
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(locationTid, OranNearRtRic::LTEENB, maxInterval),
+                          true,
+                          "Location Reports of eNBs not covered.");
+    NS_TEST_ASSERT_MSG_EQ(maxInterval, Seconds(4), "Wrong interval for eNBs.");
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(locationTid, OranNearRtRic::NRUE, maxInterval),
+                          false,
+                          "Location Reports of NR UEs covered.");
+    TypeId cellInfoTid = OranReportLteUeCellInfo::GetTypeId();
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(cellInfoTid, OranNearRtRic::LTEUE, maxInterval),
+                          false,
+                          "Cell information Reports covered.");
+
+    // A subscription to every Report covers the derived types from every
+    // node, and its interval of 0 keeps the configured one.
+    subscriptions.Add(OranSubscription{OranReport::GetTypeId(), {}, Seconds(0)});
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(cellInfoTid, OranNearRtRic::NRUE, maxInterval),
+                          true,
+                          "Derived Report types not covered.");
+    NS_TEST_ASSERT_MSG_EQ(subscriptions.Covers(locationTid, OranNearRtRic::WIRED, maxInterval),
+                          true,
+                          "Location Reports of wired nodes no longer covered.");
+    NS_TEST_ASSERT_MSG_EQ(maxInterval, Seconds(0), "The configured interval was not kept.");
+
+    // A wired node reports its location every second to a RIC that enforces
+    // the subscriptions, while a single LM subscribes to it.
+    std::string dbFileName = "oran-subscription-test.db";
+    std::remove(dbFileName.c_str());
+
+    NodeContainer nodes;
+    nodes.Create(1);
+    MobilityHelper mobilityHelper;
+    mobilityHelper.Install(nodes);
+
+    Ptr<OranHelper> oranHelper = CreateObject<OranHelper>();
+    oranHelper->SetDataRepository("ns3::OranDataRepositorySqlite",
+                                  "DatabaseFile",
+                                  StringValue(dbFileName));
+    Ptr<OranNearRtRic> nearRtRic = oranHelper->CreateNearRtRic();
+    nearRtRic->SetAttribute("EnforceSubscriptions", BooleanValue(true));
+    Ptr<OranLm> lm = CreateObject<OranTestLmLocationSubscriber>();
+    lm->SetAttribute("NearRtRic", PointerValue(nearRtRic));
+    nearRtRic->AddLogicModule(lm);
+
+    oranHelper->SetE2NodeTerminator("ns3::OranE2NodeTerminatorWired",
+                                    "RegistrationIntervalRv",
+                                    StringValue("ns3::ConstantRandomVariable[Constant=1]"),
+                                    "SendIntervalRv",
+                                    StringValue("ns3::ConstantRandomVariable[Constant=1]"));
+    oranHelper->AddReporter("ns3::OranReporterLocation",
+                            "Trigger",
+                            StringValue("ns3::OranReportTriggerPeriodic"));
+    OranE2NodeTerminatorContainer e2NodeTerminators =
+        oranHelper->DeployTerminators(nearRtRic, nodes);
+    ObjectVectorValue reporters;
+    e2NodeTerminators.Get(0)->GetAttribute("Reporters", reporters);
+    Ptr<OranReporter> reporter = reporters.Get(0)->GetObject<OranReporter>();
+
+    Simulator::Schedule(Seconds(0), &OranHelper::ActivateAndStartNearRtRic, oranHelper, nearRtRic);
+    Simulator::Schedule(Seconds(1),
+                        &OranHelper::ActivateE2NodeTerminators,
+                        oranHelper,
+                        e2NodeTerminators);
+
+    // The last subscriber leaves, then a new one asks for a Report at least
+    // every 3 seconds.
+    std::vector<bool> suspended;
+    auto checkSuspended = [&suspended, reporter]() {
+        suspended.push_back(reporter->IsSuspended());
+    };
+    Simulator::Schedule(Seconds(5.5), checkSuspended);
+    Simulator::Schedule(Seconds(5.5), &OranNearRtRic::RemoveLogicModule, nearRtRic, lm->GetName());
+    Simulator::Schedule(Seconds(6.5), checkSuspended);
+    Simulator::Schedule(Seconds(10.5), [nearRtRic, locationTid]() {
+        nearRtRic->AddSubscription(
+            OranSubscription{locationTid, {OranNearRtRic::WIRED}, Seconds(3)});
+    });
+    Simulator::Schedule(Seconds(11.5), checkSuspended);
+
+    Simulator::Stop(Seconds(21));
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(suspended.size(), 3, "Suspension not checked.");
+    NS_TEST_ASSERT_MSG_EQ(suspended[0], false, "Reporter suspended with a subscriber.");
+    NS_TEST_ASSERT_MSG_EQ(suspended[1], true, "Reporter not suspended with no subscriber.");
+    NS_TEST_ASSERT_MSG_EQ(suspended[2], false, "Reporter not resumed.");
+
+    uint64_t e2NodeId = e2NodeTerminators.Get(0)->GetE2NodeId();
+    std::map<Time, Vector> positions =
+        nearRtRic->Data()->GetNodePositions(e2NodeId, Seconds(0), Seconds(21), 100);
+    uint32_t before = 0;
+    uint32_t during = 0;
+    std::vector<Time> after;
+    for (const auto& entry : positions)
+    {
+        if (entry.first <= Seconds(5.5))
+        {
+            before++;
+        }
+        else if (entry.first <= Seconds(10.5))
+        {
+            during++;
+        }
+        else
+        {
+            after.push_back(entry.first);
+        }
+    }
+    NS_TEST_ASSERT_MSG_EQ(before >= 3, true, "Too few locations reported with a subscriber.");
+    NS_TEST_ASSERT_MSG_EQ(during, 0, "Locations reported while suspended.");
+    NS_TEST_ASSERT_MSG_EQ(after.size() >= 3, true, "Too few locations reported after resuming.");
+    for (std::size_t i = 1; i < after.size(); i++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(after[i] - after[i - 1] >= Seconds(3),
+                              true,
+                              "Locations reported " << (after[i] - after[i - 1]).As(Time::S)
+                                                    << " apart, under the 3 s subscribed.");
+    }
+
+    Simulator::Destroy();
+    std::remove(dbFileName.c_str());
+}
+
+/**
+ * @ingroup oran
+ *
+ * Class that tests that the RSRP and RSRQ measurements of a UE are reduced
+ * per cell and component carrier with only the latest serving cell flagged,
+ * and that the data repository stores the reduced measurements of every
+ * cell as one report.
+ */
+class OranTestCaseUeRsrpRsrqAggregator1 : public TestCase
+{
+  public:
+    /**
+     * Constructor of the test
+     */
+    OranTestCaseUeRsrpRsrqAggregator1();
+    /**
+     * Destructor of the test
+     */
+    virtual ~OranTestCaseUeRsrpRsrqAggregator1();
+
+  private:
+    /**
+     * Method that runs the test
+     */
+    virtual void DoRun();
+};
+
+OranTestCaseUeRsrpRsrqAggregator1::OranTestCaseUeRsrpRsrqAggregator1()
+    : TestCase("Oran Test Case UE RSRP RSRQ Aggregator 1")
+{
+}
+
+OranTestCaseUeRsrpRsrqAggregator1::~OranTestCaseUeRsrpRsrqAggregator1()
+{
+}
+
+void
+OranTestCaseUeRsrpRsrqAggregator1::DoRun()
+{
+    // The UE hears cell 1 on two component carriers and is handed over from
+    // cell 1 to cell 2, with a new RNTI, within the period.
+    OranUeRsrpRsrqAggregator aggregator;
+    auto fill = [&aggregator]() {
+        aggregator.Add(Seconds(1.0), 5, 1, -90.0, -10.0, true, 0);
+        aggregator.Add(Seconds(1.0), 5, 2, -100.0, -14.0, false, 0);
+        aggregator.Add(Seconds(1.0), 5, 1, -80.0, -9.0, false, 1);
+        aggregator.Add(Seconds(1.2), 5, 1, -96.0, -12.0, true, 0);
+        aggregator.Add(Seconds(1.2), 5, 2, -94.0, -11.0, false, 0);
+        aggregator.Add(Seconds(1.4), 7, 2, -91.0, -8.0, true, 0);
+        aggregator.Add(Seconds(1.4), 7, 1, -99.0, -13.0, false, 0);
+    };
+
+    // The RSRP and RSRQ of cell 1, cell 2, and cell 1 on carrier 1, in the
+    // order they were first measured.
+    using Reduction = OranUeRsrpRsrqAggregator::Reduction;
+    using Expected = std::array<std::pair<double, double>, 3>;
+    std::vector<std::pair<Reduction, Expected>> reductions = {
+        {OranUeRsrpRsrqAggregator::LAST, {{{-99.0, -13.0}, {-91.0, -8.0}, {-80.0, -9.0}}}},
+        {OranUeRsrpRsrqAggregator::MEAN, {{{-95.0, -35.0 / 3}, {-95.0, -11.0}, {-80.0, -9.0}}}},
+        {OranUeRsrpRsrqAggregator::MIN, {{{-99.0, -13.0}, {-100.0, -14.0}, {-80.0, -9.0}}}},
+        {OranUeRsrpRsrqAggregator::MAX, {{{-90.0, -10.0}, {-91.0, -8.0}, {-80.0, -9.0}}}}};
+    const std::array<uint16_t, 3> cellIds = {1, 2, 1};
+    const std::array<uint8_t, 3> componentCarrierIds = {0, 0, 1};
+    for (const auto& [reduction, expected] : reductions)
+    {
+        NS_TEST_ASSERT_MSG_EQ(aggregator.IsEmpty(), true, "Aggregator not empty after a flush.");
+        fill();
+        NS_TEST_ASSERT_MSG_EQ(aggregator.GetTime(), Seconds(1.4), "Wrong time.");
+        NS_TEST_ASSERT_MSG_EQ(aggregator.GetRnti(), 7, "Wrong RNTI.");
+
+        std::vector<OranUeCellRsrpRsrq> measurements = aggregator.Flush(reduction);
+        NS_TEST_ASSERT_MSG_EQ(measurements.size(), 3, "Wrong number of cells.");
+        for (std::size_t i = 0; i < measurements.size(); i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(measurements[i].cellId,
+                                  cellIds[i],
+                                  "Reduction " << reduction << ": wrong cell " << i << ".");
+            NS_TEST_ASSERT_MSG_EQ(+measurements[i].componentCarrierId,
+                                  +componentCarrierIds[i],
+                                  "Reduction " << reduction << ": wrong carrier " << i << ".");
+            NS_TEST_ASSERT_MSG_EQ(measurements[i].isServingCell,
+                                  i == 1,
+                                  "Reduction " << reduction << ": wrong serving flag " << i
+                                               << ".");
+            NS_TEST_ASSERT_MSG_EQ_TOL(measurements[i].rsrp,
+                                      expected[i].first,
+                                      1e-9,
+                                      "Reduction " << reduction << ": wrong RSRP " << i << ".");
+            NS_TEST_ASSERT_MSG_EQ_TOL(measurements[i].rsrq,
+                                      expected[i].second,
+                                      1e-9,
+                                      "Reduction " << reduction << ": wrong RSRQ " << i << ".");
+        }
+    }
+
+    // The serving cell of a period does not carry over to the next one.
+    aggregator.Add(Seconds(2.0), 7, 2, -92.0, -9.0, false, 0);
+    std::vector<OranUeCellRsrpRsrq> measurements =
+        aggregator.Flush(OranUeRsrpRsrqAggregator::LAST);
+    NS_TEST_ASSERT_MSG_EQ(measurements.size(), 1, "Wrong number of cells.");
+    NS_TEST_ASSERT_MSG_EQ(measurements[0].isServingCell,
+                          false,
+                          "Serving flag carried over from the last period.");
+    NS_TEST_ASSERT_MSG_EQ(aggregator.Flush(OranUeRsrpRsrqAggregator::LAST).empty(),
+                          true,
+                          "Flush of an empty aggregator returned cells.");
+
+    // The repository stores every cell of a report at its time, and the
+    // worst serving RSRP of a cell follows the latest report, for LTE and NR.
+    std::string dbFileName = "oran-ue-rsrp-rsrq-aggregator-test.db";
+    std::remove(dbFileName.c_str());
+    Ptr<OranDataRepositorySqlite> data = CreateObject<OranDataRepositorySqlite>();
+    data->SetAttribute("DatabaseFile", StringValue(dbFileName));
+    data->Activate();
+
+    fill();
+    measurements = aggregator.Flush(OranUeRsrpRsrqAggregator::MIN);
+    for (bool nr : {false, true})
+    {
+        std::string rat = nr ? "NR" : "LTE";
+        uint64_t ueId = 0;
+        if (nr)
+        {
+            data->RegisterNodeNrGnb(0, 1);
+            data->RegisterNodeNrGnb(0, 2);
+            ueId = data->RegisterNodeNrUe(0, 200);
+            data->SaveNrUeCellInfo(ueId, 2, 7, Seconds(1.4));
+        }
+        else
+        {
+            data->RegisterNodeLteEnb(0, 1);
+            data->RegisterNodeLteEnb(0, 2);
+            ueId = data->RegisterNodeLteUe(0, 100);
+            data->SaveLteUeCellInfo(ueId, 2, 7, Seconds(1.4));
+        }
+        auto save = [&data, nr, ueId](Time t, const std::vector<OranUeCellRsrpRsrq>& cells) {
+            if (nr)
+            {
+                data->SaveNrUeMultiCellRsrpRsrq(ueId, t, 7, cells);
+            }
+            else
+            {
+                data->SaveLteUeMultiCellRsrpRsrq(ueId, t, 7, cells);
+            }
+        };
+        auto rows = [&data, nr, ueId]() {
+            return nr ? data->GetNrUeRsrpRsrq(ueId) : data->GetLteUeRsrpRsrq(ueId);
+        };
+        auto worst = [&data, nr](uint16_t cellId) {
+            return nr ? data->GetNrCellWorstServingRsrp(cellId)
+                      : data->GetLteCellWorstServingRsrp(cellId);
+        };
+
+        save(Seconds(1.5), measurements);
+        auto stored = rows();
+        NS_TEST_ASSERT_MSG_EQ(stored.size(), measurements.size(), rat << ": wrong number of rows.");
+        for (const auto& measurement : measurements)
+        {
+            auto row = std::find_if(stored.begin(), stored.end(), [&measurement](const auto& r) {
+                return std::get<1>(r) == measurement.cellId &&
+                       std::get<5>(r) == measurement.componentCarrierId;
+            });
+            NS_TEST_ASSERT_MSG_EQ((row != stored.end()),
+                                  true,
+                                  rat << ": no row for cell " << measurement.cellId << ".");
+            NS_TEST_ASSERT_MSG_EQ(std::get<0>(*row), 7, rat << ": wrong RNTI.");
+            NS_TEST_ASSERT_MSG_EQ_TOL(std::get<2>(*row),
+                                      measurement.rsrp,
+                                      1e-9,
+                                      rat << ": wrong RSRP for cell " << measurement.cellId);
+            NS_TEST_ASSERT_MSG_EQ_TOL(std::get<3>(*row),
+                                      measurement.rsrq,
+                                      1e-9,
+                                      rat << ": wrong RSRQ for cell " << measurement.cellId);
+            NS_TEST_ASSERT_MSG_EQ(std::get<4>(*row),
+                                  measurement.isServingCell,
+                                  rat << ": wrong serving flag for cell " << measurement.cellId);
+        }
+
+        bool found = false;
+        double rsrp = 0.0;
+        std::tie(found, rsrp) = worst(2);
+        NS_TEST_ASSERT_MSG_EQ(found, true, rat << ": serving cell not indexed.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(rsrp, -100.0, 1e-9, rat << ": wrong worst serving RSRP.");
+        std::tie(found, rsrp) = worst(1);
+        NS_TEST_ASSERT_MSG_EQ(found, false, rat << ": cell that serves no UE indexed.");
+
+        // A newer report replaces the rows and the index entry of the UE.
+        save(Seconds(2.5), {OranUeCellRsrpRsrq{2, 0, true, -85.0, -7.0}});
+        stored = rows();
+        NS_TEST_ASSERT_MSG_EQ(stored.size(), 1, rat << ": older rows returned.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(std::get<2>(stored[0]), -85.0, 1e-9, rat << ": wrong RSRP.");
+        std::tie(found, rsrp) = worst(2);
+        NS_TEST_ASSERT_MSG_EQ_TOL(rsrp, -85.0, 1e-9, rat << ": index not updated.");
+
+        // A restored index keeps the times of the rows, so a report older
+        // than the restored one is still ignored.
+        std::string checkpointFileName = "oran-ue-rsrp-rsrq-aggregator-test-checkpoint.db";
+        data->SaveCheckpoint(checkpointFileName);
+        Ptr<OranDataRepositorySqlite> restored = CreateObject<OranDataRepositorySqlite>();
+        restored->SetAttribute("DatabaseFile", StringValue(":memory:"));
+        restored->Activate();
+        restored->LoadCheckpoint(checkpointFileName, Seconds(0));
+        std::vector<OranUeCellRsrpRsrq> older{OranUeCellRsrpRsrq{2, 0, true, -120.0, -15.0}};
+        if (nr)
+        {
+            restored->SaveNrUeMultiCellRsrpRsrq(ueId, Seconds(2.0), 7, older);
+            std::tie(found, rsrp) = restored->GetNrCellWorstServingRsrp(2);
+        }
+        else
+        {
+            restored->SaveLteUeMultiCellRsrpRsrq(ueId, Seconds(2.0), 7, older);
+            std::tie(found, rsrp) = restored->GetLteCellWorstServingRsrp(2);
+        }
+        NS_TEST_ASSERT_MSG_EQ(found, true, rat << ": serving cell not restored.");
+        NS_TEST_ASSERT_MSG_EQ_TOL(rsrp, -85.0, 1e-9, rat << ": restored index took older report.");
+        restored->Deactivate();
+        restored->Dispose();
+        std::remove(checkpointFileName.c_str());
+    }
+
+    data->Deactivate();
+    data->Dispose();
+    Simulator::Destroy();
+    std::remove(dbFileName.c_str());
+}
+
 /**
  * @ingroup oran
  *
@@ -195,6 +2267,16 @@ OranTestSuite::OranTestSuite()
     : TestSuite("oran", Type::UNIT)
 {
     AddTestCase(new OranTestCaseMobility1, Duration::QUICK);
+    AddTestCase(new OranTestCaseConflictPolicy1, Duration::QUICK);
+    AddTestCase(new OranTestCaseE2Codec1, Duration::QUICK);
+    AddTestCase(new OranTestCaseMinCostAssignment1, Duration::QUICK);
+    AddTestCase(new OranTestCaseRsrpSurrogate1, Duration::QUICK);
+    AddTestCase(new OranTestCaseE2Trace1, Duration::QUICK);
+    AddTestCase(new OranTestCaseOnnxNativeModel1, Duration::QUICK);
+    AddTestCase(new OranTestCaseCheckpoint1, Duration::QUICK);
+    AddTestCase(new OranTestCaseE2NodeReportBuffer1, Duration::QUICK);
+    AddTestCase(new OranTestCaseSubscription1, Duration::QUICK);
+    AddTestCase(new OranTestCaseUeRsrpRsrqAggregator1, Duration::QUICK);
 }
 
 static OranTestSuite soranTestSuite;